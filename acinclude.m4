@@ -8,6 +8,31 @@ AC_DEFUN([AX_LIBFSEXT_CHECK_LOCAL],
   AC_CHECK_FUNCS([bindtextdomain])
 ])
 
+dnl Function to detect whether trace support should be enabled
+AC_DEFUN([AX_LIBFSEXT_CHECK_ENABLE_TRACE],
+  [AX_COMMON_ARG_ENABLE(
+    [trace],
+    [trace],
+    [enable trace callbacks],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_trace" != xno],
+    [AC_DEFINE(
+      [HAVE_LIBFSEXT_TRACE],
+      [1],
+      [Define to 1 if trace callbacks should be used.])
+    AC_SUBST(
+      [HAVE_LIBFSEXT_TRACE],
+      [1])
+
+    ac_cv_enable_trace=yes],
+    [AC_SUBST(
+      [HAVE_LIBFSEXT_TRACE],
+      [0])
+    ])
+  ])
+
 dnl Function to check if DLL support is needed
 AC_DEFUN([AX_LIBFSEXT_CHECK_DLL_SUPPORT],
   [AS_IF(
@@ -0,0 +1,2927 @@
+/*
+ * Bodyfile handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "bodyfile_handle.h"
+#include "digest_handle.h"
+#include "fsexttools_libbfio.h"
+#include "fsexttools_libcerror.h"
+#include "fsexttools_libcnotify.h"
+#include "fsexttools_libcthreads.h"
+#include "fsexttools_libfsext.h"
+#include "info_handle.h"
+
+#if defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT )
+
+#if !defined( LIBFSEXT_HAVE_BFIO )
+
+extern \
+int libfsext_volume_open_file_io_handle(
+     libfsext_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsext_error_t **error );
+
+#endif /* !defined( LIBFSEXT_HAVE_BFIO ) */
+
+#define BODYFILE_HANDLE_DIGEST_COLUMNS_STRING_SIZE	( 32 + 1 + 40 + 1 + 64 + 1 + 1 )
+
+/* Creates a context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_context_initialize(
+     bodyfile_handle_context_t **context,
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            bodyfile_handle_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( bodyfile_handle_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
+	}
+	/* Every context reads the volume through its own file IO handle
+	 * since the volume does not support concurrent reads
+	 */
+	if( libbfio_handle_clone(
+	     &( ( *context )->file_io_handle ),
+	     info_handle->input_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_volume_initialize(
+	     &( ( *context )->volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_volume_open_file_io_handle(
+	     ( *context )->volume,
+	     ( *context )->file_io_handle,
+	     LIBFSEXT_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->info_handle = memory_allocate_structure(
+	                             info_handle_t );
+
+	if( ( *context )->info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *context )->info_handle,
+	     info_handle,
+	     sizeof( info_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy info handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->info_handle->input_file_io_handle    = ( *context )->file_io_handle;
+	( *context )->info_handle->input_volume            = ( *context )->volume;
+	( *context )->info_handle->digest_handle           = NULL;
+	( *context )->info_handle->bodyfile_header_printed = 1;
+
+	( *context )->stream = open_memstream(
+	                        &( ( *context )->stream_data ),
+	                        &( ( *context )->stream_data_size ) );
+
+	if( ( *context )->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open formatting stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->info_handle->bodyfile_stream = ( *context )->stream;
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		if( ( *context )->info_handle != NULL )
+		{
+			memory_free(
+			 ( *context )->info_handle );
+		}
+		if( ( *context )->volume != NULL )
+		{
+			libfsext_volume_free(
+			 &( ( *context )->volume ),
+			 NULL );
+		}
+		if( ( *context )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *context )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a context
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_context_free(
+     bodyfile_handle_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_context_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( ( *context )->stream != NULL )
+		{
+			fclose(
+			 ( *context )->stream );
+		}
+		if( ( *context )->stream_data != NULL )
+		{
+			memory_free(
+			 ( *context )->stream_data );
+		}
+		if( ( *context )->info_handle != NULL )
+		{
+			if( ( *context )->info_handle->digest_handle != NULL )
+			{
+				if( digest_handle_free(
+				     &( ( *context )->info_handle->digest_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free digest handle.",
+					 function );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *context )->info_handle );
+		}
+		if( libfsext_volume_close(
+		     ( *context )->volume,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close volume.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsext_volume_free(
+		     &( ( *context )->volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *context )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Hands the formatted data of a context to the writer
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_context_flush(
+     bodyfile_handle_context_t *context,
+     libcthreads_queue_t *output_queue,
+     libcerror_error_t **error )
+{
+	bodyfile_handle_buffer_t *buffer = NULL;
+	static char *function            = "bodyfile_handle_context_flush";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid context - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ftell(
+	     context->stream ) <= 0 )
+	{
+		return( 1 );
+	}
+	/* Closing the stream finalizes the stream data and data size
+	 */
+	fclose(
+	 context->stream );
+
+	context->stream = NULL;
+
+	buffer = memory_allocate_structure(
+	          bodyfile_handle_buffer_t );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	buffer->data      = context->stream_data;
+	buffer->data_size = context->stream_data_size;
+
+	context->stream_data      = NULL;
+	context->stream_data_size = 0;
+
+	if( libcthreads_queue_push(
+	     output_queue,
+	     (intptr_t *) buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push buffer onto output queue.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = NULL;
+
+	context->stream = open_memstream(
+	                   &( context->stream_data ),
+	                   &( context->stream_data_size ) );
+
+	if( context->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open formatting stream.",
+		 function );
+
+		goto on_error;
+	}
+	context->info_handle->bodyfile_stream = context->stream;
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		if( buffer->data != NULL )
+		{
+			memory_free(
+			 buffer->data );
+		}
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Frees a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_buffer_free(
+     bodyfile_handle_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_buffer_free";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		if( ( *buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *buffer )->data );
+		}
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a directory
+ * Make sure the value directory is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_directory_initialize(
+     bodyfile_handle_directory_t **directory,
+     uint32_t inode_number,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_directory_initialize";
+	size_t path_size      = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length > (size_t) ( SSIZE_MAX - 2 ) )
+	 || ( name_length > (size_t) ( SSIZE_MAX - 2 - path_length ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*directory = memory_allocate_structure(
+	              bodyfile_handle_directory_t );
+
+	if( *directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	path_size = path_length + 1;
+
+	if( name != NULL )
+	{
+		path_size += name_length + 1;
+	}
+	( *directory )->path = system_string_allocate(
+	                        path_size );
+
+	if( ( *directory )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *directory )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	if( name != NULL )
+	{
+		if( system_string_copy(
+		     &( ( ( *directory )->path )[ path_length ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to path.",
+			 function );
+
+			goto on_error;
+		}
+		( ( *directory )->path )[ path_size - 2 ] = (system_character_t) LIBFSEXT_SEPARATOR;
+	}
+	( ( *directory )->path )[ path_size - 1 ] = (system_character_t) 0;
+
+	( *directory )->inode_number = inode_number;
+	( *directory )->path_length  = path_size - 1;
+
+	return( 1 );
+
+on_error:
+	if( *directory != NULL )
+	{
+		if( ( *directory )->path != NULL )
+		{
+			memory_free(
+			 ( *directory )->path );
+		}
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_directory_free(
+     bodyfile_handle_directory_t **directory,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_directory_free";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		if( ( *directory )->path != NULL )
+		{
+			memory_free(
+			 ( *directory )->path );
+		}
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+	}
+	return( 1 );
+}
+
+/* Frees a hash job
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_hash_job_free(
+     bodyfile_handle_hash_job_t **hash_job,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_hash_job_free";
+
+	if( hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_job != NULL )
+	{
+		if( ( *hash_job )->line != NULL )
+		{
+			memory_free(
+			 ( *hash_job )->line );
+		}
+		memory_free(
+		 *hash_job );
+
+		*hash_job = NULL;
+	}
+	return( 1 );
+}
+
+/* Frees a worker
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_worker_free(
+     bodyfile_handle_worker_t **worker,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_worker_free";
+	int directory_index   = 0;
+	int result            = 1;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		if( ( *worker )->directories != NULL )
+		{
+			for( directory_index = ( *worker )->first_directory_index;
+			     directory_index < ( *worker )->last_directory_index;
+			     directory_index++ )
+			{
+				if( bodyfile_handle_directory_free(
+				     &( ( ( *worker )->directories )[ directory_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory: %d.",
+					 function,
+					 directory_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *worker )->directories );
+		}
+		if( ( *worker )->context != NULL )
+		{
+			if( bodyfile_handle_context_free(
+			     &( ( *worker )->context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( result );
+}
+
+/* Creates a bodyfile handle
+ * Make sure the value bodyfile_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_initialize(
+     bodyfile_handle_t **bodyfile_handle,
+     info_handle_t *info_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_initialize";
+	int thread_index      = 0;
+
+	if( bodyfile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bodyfile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bodyfile_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bodyfile handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > 1024 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*bodyfile_handle = memory_allocate_structure(
+	                    bodyfile_handle_t );
+
+	if( *bodyfile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bodyfile handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bodyfile_handle,
+	     0,
+	     sizeof( bodyfile_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bodyfile handle.",
+		 function );
+
+		memory_free(
+		 *bodyfile_handle );
+
+		*bodyfile_handle = NULL;
+
+		return( -1 );
+	}
+	( *bodyfile_handle )->info_handle       = info_handle;
+	( *bodyfile_handle )->number_of_threads = number_of_threads;
+	( *bodyfile_handle )->result            = 1;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *bodyfile_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *bodyfile_handle )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( ( *bodyfile_handle )->output_queue ),
+	     BODYFILE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output queue.",
+		 function );
+
+		goto on_error;
+	}
+	( *bodyfile_handle )->workers = (bodyfile_handle_worker_t **) memory_allocate(
+	                                                               sizeof( bodyfile_handle_worker_t * ) * number_of_threads );
+
+	if( ( *bodyfile_handle )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *bodyfile_handle )->workers,
+	     0,
+	     sizeof( bodyfile_handle_worker_t * ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		( *bodyfile_handle )->workers[ thread_index ] = memory_allocate_structure(
+		                                                 bodyfile_handle_worker_t );
+
+		if( ( *bodyfile_handle )->workers[ thread_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *bodyfile_handle )->workers[ thread_index ],
+		     0,
+		     sizeof( bodyfile_handle_worker_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear worker: %d.",
+			 function,
+			 thread_index );
+
+			memory_free(
+			 ( *bodyfile_handle )->workers[ thread_index ] );
+
+			( *bodyfile_handle )->workers[ thread_index ] = NULL;
+
+			goto on_error;
+		}
+		( *bodyfile_handle )->workers[ thread_index ]->bodyfile_handle = *bodyfile_handle;
+
+		if( bodyfile_handle_context_initialize(
+		     &( ( *bodyfile_handle )->workers[ thread_index ]->context ),
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize worker: %d context.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		/* The digests of regular files are calculated by the hash thread pool
+		 */
+		if( info_handle->digest_types != 0 )
+		{
+			( *bodyfile_handle )->workers[ thread_index ]->context->info_handle->defer_digests = 1;
+		}
+	}
+	if( info_handle->digest_types != 0 )
+	{
+		( *bodyfile_handle )->hash_contexts = (bodyfile_handle_context_t **) memory_allocate(
+		                                                                      sizeof( bodyfile_handle_context_t * ) * number_of_threads );
+
+		if( ( *bodyfile_handle )->hash_contexts == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash contexts.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *bodyfile_handle )->hash_contexts,
+		     0,
+		     sizeof( bodyfile_handle_context_t * ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear hash contexts.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_initialize(
+		     &( ( *bodyfile_handle )->hash_contexts_queue ),
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize hash contexts queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( bodyfile_handle_context_initialize(
+			     &( ( *bodyfile_handle )->hash_contexts[ thread_index ] ),
+			     info_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize hash context: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     ( *bodyfile_handle )->hash_contexts_queue,
+			     (intptr_t *) ( *bodyfile_handle )->hash_contexts[ thread_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push hash context: %d onto queue.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *bodyfile_handle != NULL )
+	{
+		bodyfile_handle_free(
+		 bodyfile_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a bodyfile handle
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_free(
+     bodyfile_handle_t **bodyfile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_free";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( bodyfile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bodyfile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bodyfile_handle != NULL )
+	{
+		/* The hash contexts are freed below
+		 */
+		if( ( *bodyfile_handle )->hash_contexts_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *bodyfile_handle )->hash_contexts_queue ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hash contexts queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bodyfile_handle )->hash_contexts != NULL )
+		{
+			for( thread_index = 0;
+			     thread_index < ( *bodyfile_handle )->number_of_threads;
+			     thread_index++ )
+			{
+				if( bodyfile_handle_context_free(
+				     &( ( *bodyfile_handle )->hash_contexts[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free hash context: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *bodyfile_handle )->hash_contexts );
+		}
+		if( ( *bodyfile_handle )->workers != NULL )
+		{
+			for( thread_index = 0;
+			     thread_index < ( *bodyfile_handle )->number_of_threads;
+			     thread_index++ )
+			{
+				if( bodyfile_handle_worker_free(
+				     &( ( *bodyfile_handle )->workers[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *bodyfile_handle )->workers );
+		}
+		if( ( *bodyfile_handle )->output_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *bodyfile_handle )->output_queue ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &bodyfile_handle_buffer_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bodyfile_handle )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *bodyfile_handle )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bodyfile_handle )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *bodyfile_handle )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *bodyfile_handle );
+
+		*bodyfile_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the threads to stop after one of them failed
+ */
+void bodyfile_handle_signal_failure(
+      bodyfile_handle_t *bodyfile_handle )
+{
+	if( libcthreads_mutex_grab(
+	     bodyfile_handle->mutex,
+	     NULL ) == 1 )
+	{
+		bodyfile_handle->abort  = 1;
+		bodyfile_handle->result = -1;
+
+		libcthreads_condition_broadcast(
+		 bodyfile_handle->condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 bodyfile_handle->mutex,
+		 NULL );
+	}
+}
+
+/* Pushes a directory onto the stack of a worker
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_push_directory(
+     bodyfile_handle_t *bodyfile_handle,
+     bodyfile_handle_worker_t *worker,
+     bodyfile_handle_directory_t *directory,
+     libcerror_error_t **error )
+{
+	bodyfile_handle_directory_t **directories = NULL;
+	static char *function                     = "bodyfile_handle_push_directory";
+	int directories_size                      = 0;
+	int result                                = 1;
+
+	if( bodyfile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bodyfile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     bodyfile_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->last_directory_index >= worker->directories_size )
+	{
+		if( worker->directories_size >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid worker - directories size value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			directories_size = worker->directories_size * 2;
+
+			if( directories_size == 0 )
+			{
+				directories_size = 256;
+			}
+			directories = (bodyfile_handle_directory_t **) memory_reallocate(
+			                                                worker->directories,
+			                                                sizeof( bodyfile_handle_directory_t * ) * directories_size );
+
+			if( directories == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize directories.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				worker->directories      = directories;
+				worker->directories_size = directories_size;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		worker->directories[ worker->last_directory_index++ ] = directory;
+
+		bodyfile_handle->number_of_pending_directories += 1;
+
+		if( libcthreads_condition_signal(
+		     bodyfile_handle->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     bodyfile_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next directory for a worker
+ * The worker takes the most recently added directory from its own stack,
+ * when empty it steals the least recently added directory of another worker
+ * Returns 1 if successful, 0 if no more directories are available or -1 on error
+ */
+int bodyfile_handle_get_directory(
+     bodyfile_handle_t *bodyfile_handle,
+     bodyfile_handle_worker_t *worker,
+     bodyfile_handle_directory_t **directory,
+     libcerror_error_t **error )
+{
+	bodyfile_handle_worker_t *victim = NULL;
+	static char *function            = "bodyfile_handle_get_directory";
+	int result                       = 0;
+	int thread_index                 = 0;
+
+	if( bodyfile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bodyfile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     bodyfile_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( result == 0 )
+	{
+		if( ( bodyfile_handle->abort != 0 )
+		 || ( bodyfile_handle->info_handle->abort != 0 ) )
+		{
+			break;
+		}
+		if( worker->last_directory_index > worker->first_directory_index )
+		{
+			worker->last_directory_index -= 1;
+
+			*directory = worker->directories[ worker->last_directory_index ];
+
+			if( worker->last_directory_index == worker->first_directory_index )
+			{
+				worker->first_directory_index = 0;
+				worker->last_directory_index  = 0;
+			}
+			result = 1;
+
+			break;
+		}
+		for( thread_index = 0;
+		     thread_index < bodyfile_handle->number_of_threads;
+		     thread_index++ )
+		{
+			victim = bodyfile_handle->workers[ thread_index ];
+
+			if( victim->last_directory_index > victim->first_directory_index )
+			{
+				*directory = victim->directories[ victim->first_directory_index ];
+
+				victim->first_directory_index += 1;
+
+				if( victim->last_directory_index == victim->first_directory_index )
+				{
+					victim->first_directory_index = 0;
+					victim->last_directory_index  = 0;
+				}
+				result = 1;
+
+				break;
+			}
+		}
+		if( ( result != 0 )
+		 || ( bodyfile_handle->number_of_pending_directories == 0 ) )
+		{
+			break;
+		}
+		if( libcthreads_condition_wait(
+		     bodyfile_handle->condition,
+		     bodyfile_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     bodyfile_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Marks a directory as processed
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_release_directory(
+     bodyfile_handle_t *bodyfile_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_release_directory";
+	int result            = 1;
+
+	if( bodyfile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bodyfile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     bodyfile_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	bodyfile_handle->number_of_pending_directories -= 1;
+
+	if( bodyfile_handle->number_of_pending_directories == 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     bodyfile_handle->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     bodyfile_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the name of a file entry
+ * Returns 1 if successful, 0 if the file entry has no name or -1 on error
+ */
+int bodyfile_handle_get_file_entry_name(
+     libfsext_file_entry_t *file_entry,
+     system_character_t **name,
+     size_t *name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "bodyfile_handle_get_file_entry_name";
+	size_t name_size      = 0;
+	int result            = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsext_file_entry_get_utf16_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#else
+	result = libfsext_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &name_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*name = system_string_allocate(
+	         name_size );
+
+	if( *name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsext_file_entry_get_utf16_name(
+	          file_entry,
+	          (uint16_t *) *name,
+	          name_size,
+	          error );
+#else
+	result = libfsext_file_entry_get_utf8_name(
+	          file_entry,
+	          (uint8_t *) *name,
+	          name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string.",
+		 function );
+
+		memory_free(
+		 *name );
+
+		*name = NULL;
+
+		return( -1 );
+	}
+	*name_length = name_size - 1;
+
+	return( 1 );
+}
+
+/* Defers hashing of the bodyfile line the worker has just formatted without digest columns
+ * The line is removed from the formatting stream and handed to the hash thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_worker_push_hash_job(
+     bodyfile_handle_worker_t *worker,
+     uint32_t inode_number,
+     long line_offset,
+     libcerror_error_t **error )
+{
+	bodyfile_handle_context_t *context     = NULL;
+	bodyfile_handle_hash_job_t *hash_job   = NULL;
+	static char *function                  = "bodyfile_handle_worker_push_hash_job";
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	context = worker->context;
+
+	if( fflush(
+	     context->stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush formatting stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( line_offset < 0 )
+	 || ( (size_t) line_offset >= context->stream_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	hash_job = memory_allocate_structure(
+	            bodyfile_handle_hash_job_t );
+
+	if( hash_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash job.",
+		 function );
+
+		goto on_error;
+	}
+	hash_job->inode_number = inode_number;
+	hash_job->line_size    = context->stream_data_size - (size_t) line_offset;
+
+	hash_job->line = (char *) memory_allocate(
+	                           sizeof( char ) * hash_job->line_size );
+
+	if( hash_job->line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     hash_job->line,
+	     &( context->stream_data[ line_offset ] ),
+	     hash_job->line_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy line.",
+		 function );
+
+		goto on_error;
+	}
+	if( fseek(
+	     context->stream,
+	     line_offset,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek line offset in formatting stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_push(
+	     worker->bodyfile_handle->hash_thread_pool,
+	     (intptr_t *) hash_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push hash job onto thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( hash_job != NULL )
+	{
+		bodyfile_handle_hash_job_free(
+		 &hash_job,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the sub file entries of a directory
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_worker_fprint_directory(
+     bodyfile_handle_worker_t *worker,
+     bodyfile_handle_directory_t *directory,
+     libcerror_error_t **error )
+{
+	bodyfile_handle_directory_t *sub_directory = NULL;
+	libfsext_file_entry_t *file_entry          = NULL;
+	libfsext_file_entry_t *sub_file_entry      = NULL;
+	system_character_t *name                   = NULL;
+	static char *function                      = "bodyfile_handle_worker_fprint_directory";
+	size_t name_length                         = 0;
+	long line_offset                           = 0;
+	uint32_t inode_number                      = 0;
+	uint16_t file_mode                         = 0;
+	int number_of_sub_file_entries             = 0;
+	int sub_file_entry_index                   = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_volume_get_file_entry_by_inode(
+	     worker->context->volume,
+	     directory->inode_number,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu32 ".",
+		 function,
+		 directory->inode_number );
+
+		goto on_error;
+	}
+	if( libfsext_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libfsext_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsext_file_entry_get_inode_number(
+		     sub_file_entry,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d inode number.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsext_file_entry_get_file_mode(
+		     sub_file_entry,
+		     &file_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d file mode.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( bodyfile_handle_get_file_entry_name(
+		     sub_file_entry,
+		     &name,
+		     &name_length,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d name.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		line_offset = ftell(
+		               worker->context->stream );
+
+		if( info_handle_file_entry_value_with_name_fprint(
+		     worker->context->info_handle,
+		     sub_file_entry,
+		     directory->path,
+		     directory->path_length,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( ( worker->bodyfile_handle->hash_thread_pool != NULL )
+		 && ( ( file_mode & 0xf000 ) == 0x8000 ) )
+		{
+			if( bodyfile_handle_worker_push_hash_job(
+			     worker,
+			     inode_number,
+			     line_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push sub file entry: %d hash job.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+		}
+		if( ( file_mode & 0xf000 ) == 0x4000 )
+		{
+			if( bodyfile_handle_directory_initialize(
+			     &sub_directory,
+			     inode_number,
+			     directory->path,
+			     directory->path_length,
+			     name,
+			     name_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub directory: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			if( bodyfile_handle_push_directory(
+			     worker->bodyfile_handle,
+			     worker,
+			     sub_directory,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push sub directory: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+			sub_directory = NULL;
+		}
+		if( name != NULL )
+		{
+			memory_free(
+			 name );
+
+			name = NULL;
+		}
+		if( libfsext_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsext_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_directory != NULL )
+	{
+		bodyfile_handle_directory_free(
+		 &sub_directory,
+		 NULL );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs a directory worker
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_worker_run(
+     void *arguments )
+{
+	bodyfile_handle_directory_t *directory = NULL;
+	bodyfile_handle_worker_t *worker       = NULL;
+	libcerror_error_t *error               = NULL;
+	static char *function                  = "bodyfile_handle_worker_run";
+	int result                             = 0;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (bodyfile_handle_worker_t *) arguments;
+
+	do
+	{
+		result = bodyfile_handle_get_directory(
+		          worker->bodyfile_handle,
+		          worker,
+		          &directory,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( bodyfile_handle_worker_fprint_directory(
+		     worker,
+		     directory,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print directory: %" PRIu32 ".",
+			 function,
+			 directory->inode_number );
+
+			goto on_error;
+		}
+		if( bodyfile_handle_directory_free(
+		     &directory,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( bodyfile_handle_release_directory(
+		     worker->bodyfile_handle,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( ftell(
+		     worker->context->stream ) >= BODYFILE_HANDLE_MAXIMUM_BUFFER_SIZE )
+		{
+			if( bodyfile_handle_context_flush(
+			     worker->context,
+			     worker->bodyfile_handle->output_queue,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush context.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result == 1 );
+
+	if( bodyfile_handle_context_flush(
+	     worker->context,
+	     worker->bodyfile_handle->output_queue,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
+	if( directory != NULL )
+	{
+		bodyfile_handle_directory_free(
+		 &directory,
+		 NULL );
+	}
+	bodyfile_handle_signal_failure(
+	 worker->bodyfile_handle );
+
+	return( -1 );
+}
+
+/* Calculates the digests of a file entry and hands the completed bodyfile line to the writer
+ * Errors are reported and signalled to the other threads, but 1 is always returned
+ * so that the thread pool keeps draining its queue
+ */
+int bodyfile_handle_hash_job_run(
+     intptr_t *value,
+     intptr_t *arguments )
+{
+	char digest_columns_string[ BODYFILE_HANDLE_DIGEST_COLUMNS_STRING_SIZE ];
+
+	bodyfile_handle_buffer_t *buffer     = NULL;
+	bodyfile_handle_context_t *context   = NULL;
+	bodyfile_handle_hash_job_t *hash_job = NULL;
+	bodyfile_handle_t *bodyfile_handle   = NULL;
+	libcerror_error_t *error             = NULL;
+	libfsext_file_entry_t *file_entry    = NULL;
+	static char *function                = "bodyfile_handle_hash_job_run";
+	size_t digest_columns_string_length  = 0;
+
+	if( ( value == NULL )
+	 || ( arguments == NULL ) )
+	{
+		return( 1 );
+	}
+	hash_job        = (bodyfile_handle_hash_job_t *) value;
+	bodyfile_handle = (bodyfile_handle_t *) arguments;
+
+	if( ( bodyfile_handle->abort != 0 )
+	 || ( bodyfile_handle->info_handle->abort != 0 ) )
+	{
+		bodyfile_handle_hash_job_free(
+		 &hash_job,
+		 NULL );
+
+		return( 1 );
+	}
+	if( libcthreads_queue_pop(
+	     bodyfile_handle->hash_contexts_queue,
+	     (intptr_t **) &context,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop hash context from queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_volume_get_file_entry_by_inode(
+	     context->volume,
+	     hash_job->inode_number,
+	     &file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu32 ".",
+		 function,
+		 hash_job->inode_number );
+
+		goto on_error;
+	}
+	if( context->info_handle->digest_handle == NULL )
+	{
+		if( digest_handle_initialize(
+		     &( context->info_handle->digest_handle ),
+		     context->info_handle->digest_types,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize digest handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( digest_handle_calculate_file_entry(
+	     context->info_handle->digest_handle,
+	     file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate digests of file entry: %" PRIu32 ".",
+		 function,
+		 hash_job->inode_number );
+
+		goto on_error;
+	}
+	if( info_handle_digest_columns_copy_to_string(
+	     context->info_handle,
+	     context->info_handle->digest_handle,
+	     digest_columns_string,
+	     BODYFILE_HANDLE_DIGEST_COLUMNS_STRING_SIZE,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy digest columns to string.",
+		 function );
+
+		goto on_error;
+	}
+	digest_columns_string_length = narrow_string_length(
+	                                digest_columns_string );
+
+	if( libfsext_file_entry_free(
+	     &file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_push(
+	     bodyfile_handle->hash_contexts_queue,
+	     (intptr_t *) context,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push hash context onto queue.",
+		 function );
+
+		context = NULL;
+
+		goto on_error;
+	}
+	context = NULL;
+
+	buffer = memory_allocate_structure(
+	          bodyfile_handle_buffer_t );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	buffer->data_size = digest_columns_string_length + hash_job->line_size;
+
+	buffer->data = (char *) memory_allocate(
+	                         sizeof( char ) * buffer->data_size );
+
+	if( buffer->data == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     buffer->data,
+	     digest_columns_string,
+	     digest_columns_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy digest columns to buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( buffer->data[ digest_columns_string_length ] ),
+	     hash_job->line,
+	     hash_job->line_size ) == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy line to buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_push(
+	     bodyfile_handle->output_queue,
+	     (intptr_t *) buffer,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push buffer onto output queue.",
+		 function );
+
+		goto on_error;
+	}
+	bodyfile_handle_hash_job_free(
+	 &hash_job,
+	 NULL );
+
+	return( 1 );
+
+on_error:
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
+	if( buffer != NULL )
+	{
+		bodyfile_handle_buffer_free(
+		 &buffer,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		libcthreads_queue_push(
+		 bodyfile_handle->hash_contexts_queue,
+		 (intptr_t *) context,
+		 NULL );
+	}
+	bodyfile_handle_hash_job_free(
+	 &hash_job,
+	 NULL );
+
+	bodyfile_handle_signal_failure(
+	 bodyfile_handle );
+
+	return( 1 );
+}
+
+/* Runs the writer
+ * The writer keeps draining the output queue after a failure so that no producer blocks
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_writer_run(
+     void *arguments )
+{
+	bodyfile_handle_buffer_t *buffer   = NULL;
+	bodyfile_handle_t *bodyfile_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	static char *function              = "bodyfile_handle_writer_run";
+	int result                         = 1;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	bodyfile_handle = (bodyfile_handle_t *) arguments;
+
+	do
+	{
+		if( libcthreads_queue_pop(
+		     bodyfile_handle->output_queue,
+		     (intptr_t **) &buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop buffer from output queue.",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			bodyfile_handle_signal_failure(
+			 bodyfile_handle );
+
+			return( -1 );
+		}
+		if( buffer->data == NULL )
+		{
+			memory_free(
+			 buffer );
+
+			break;
+		}
+		if( result == 1 )
+		{
+			if( fwrite(
+			     buffer->data,
+			     sizeof( char ),
+			     buffer->data_size,
+			     bodyfile_handle->info_handle->bodyfile_stream ) != buffer->data_size )
+			{
+				libcnotify_printf(
+				 "%s: unable to write bodyfile.\n",
+				 function );
+
+				bodyfile_handle_signal_failure(
+				 bodyfile_handle );
+
+				result = -1;
+			}
+		}
+		bodyfile_handle_buffer_free(
+		 &buffer,
+		 NULL );
+	}
+	while( 1 );
+
+	return( result );
+}
+
+/* Prints the file system hierarchy as a bodyfile using multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int bodyfile_handle_file_system_hierarchy_fprint(
+     bodyfile_handle_t *bodyfile_handle,
+     libcerror_error_t **error )
+{
+	bodyfile_handle_buffer_t *buffer       = NULL;
+	bodyfile_handle_directory_t *directory = NULL;
+	libfsext_file_entry_t *file_entry      = NULL;
+	static char *function                  = "bodyfile_handle_file_system_hierarchy_fprint";
+	uint32_t inode_number                  = 0;
+	int number_of_started_threads          = 0;
+	int result                             = 1;
+	int thread_index                       = 0;
+
+	if( bodyfile_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bodyfile handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bodyfile_handle->info_handle->bodyfile_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid bodyfile handle - missing bodyfile stream.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsext_volume_get_root_directory(
+	          bodyfile_handle->info_handle->input_volume,
+	          &file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	result = -1;
+
+	/* The root directory is printed before the writer is started
+	 */
+	if( info_handle_file_entry_value_with_name_fprint(
+	     bodyfile_handle->info_handle,
+	     file_entry,
+	     _SYSTEM_STRING( "/" ),
+	     1,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print root directory file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_file_entry_get_inode_number(
+	     file_entry,
+	     &inode_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory inode number.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( bodyfile_handle_directory_initialize(
+	     &directory,
+	     inode_number,
+	     _SYSTEM_STRING( "/" ),
+	     1,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( bodyfile_handle_push_directory(
+	     bodyfile_handle,
+	     bodyfile_handle->workers[ 0 ],
+	     directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push root directory.",
+		 function );
+
+		goto on_error;
+	}
+	directory = NULL;
+
+	if( libcthreads_thread_create(
+	     &( bodyfile_handle->writer_thread ),
+	     NULL,
+	     &bodyfile_handle_writer_run,
+	     (void *) bodyfile_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create writer thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( bodyfile_handle->hash_contexts_queue != NULL )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( bodyfile_handle->hash_thread_pool ),
+		     NULL,
+		     bodyfile_handle->number_of_threads,
+		     BODYFILE_HANDLE_MAXIMUM_NUMBER_OF_HASH_JOBS,
+		     &bodyfile_handle_hash_job_run,
+		     (intptr_t *) bodyfile_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < bodyfile_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( bodyfile_handle->workers[ thread_index ]->thread ),
+		     NULL,
+		     &bodyfile_handle_worker_run,
+		     (void *) bodyfile_handle->workers[ thread_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		number_of_started_threads++;
+	}
+	result = 1;
+
+on_error:
+	if( result != 1 )
+	{
+		bodyfile_handle_signal_failure(
+		 bodyfile_handle );
+	}
+	if( file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		bodyfile_handle_directory_free(
+		 &directory,
+		 NULL );
+	}
+	/* The stages are stopped in pipeline order: first the directory workers,
+	 * then the hash thread pool and last the writer
+	 */
+	for( thread_index = 0;
+	     thread_index < number_of_started_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( bodyfile_handle->workers[ thread_index ]->thread ),
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( bodyfile_handle->hash_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( bodyfile_handle->hash_thread_pool ),
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( bodyfile_handle->writer_thread != NULL )
+	{
+		buffer = memory_allocate_structure(
+		          bodyfile_handle_buffer_t );
+
+		if( buffer != NULL )
+		{
+			buffer->data      = NULL;
+			buffer->data_size = 0;
+
+			if( libcthreads_queue_push(
+			     bodyfile_handle->output_queue,
+			     (intptr_t *) buffer,
+			     NULL ) != 1 )
+			{
+				memory_free(
+				 buffer );
+
+				buffer = NULL;
+			}
+		}
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to signal end of output to writer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_thread_join(
+		     &( bodyfile_handle->writer_thread ),
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( bodyfile_handle->result != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print file system hierarchy.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,244 @@
+/*
+ * Bodyfile handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BODYFILE_HANDLE_H )
+#define _BODYFILE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsexttools_libbfio.h"
+#include "fsexttools_libcerror.h"
+#include "fsexttools_libcthreads.h"
+#include "fsexttools_libfsext.h"
+#include "info_handle.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_OPEN_MEMSTREAM )
+#define HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT )
+
+/* The maximum number of bytes a worker formats before handing them to the writer
+ */
+#define BODYFILE_HANDLE_MAXIMUM_BUFFER_SIZE		1024 * 1024
+
+/* The maximum number of buffers queued for the writer
+ */
+#define BODYFILE_HANDLE_MAXIMUM_NUMBER_OF_BUFFERS	64
+
+/* The maximum number of file entries queued for hashing
+ */
+#define BODYFILE_HANDLE_MAXIMUM_NUMBER_OF_HASH_JOBS	4096
+
+typedef struct bodyfile_handle bodyfile_handle_t;
+
+typedef struct bodyfile_handle_buffer bodyfile_handle_buffer_t;
+
+struct bodyfile_handle_buffer
+{
+	/* The data, where NULL signals the end of the output
+	 */
+	char *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct bodyfile_handle_context bodyfile_handle_context_t;
+
+struct bodyfile_handle_context
+{
+	/* The libbfio file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The libfsext volume
+	 */
+	libfsext_volume_t *volume;
+
+	/* The info handle used to format the bodyfile lines
+	 */
+	info_handle_t *info_handle;
+
+	/* The formatting stream
+	 */
+	FILE *stream;
+
+	/* The formatting stream data
+	 */
+	char *stream_data;
+
+	/* The formatting stream data size
+	 */
+	size_t stream_data_size;
+};
+
+typedef struct bodyfile_handle_directory bodyfile_handle_directory_t;
+
+struct bodyfile_handle_directory
+{
+	/* The inode number
+	 */
+	uint32_t inode_number;
+
+	/* The path including the trailing separator
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+};
+
+typedef struct bodyfile_handle_hash_job bodyfile_handle_hash_job_t;
+
+struct bodyfile_handle_hash_job
+{
+	/* The inode number
+	 */
+	uint32_t inode_number;
+
+	/* The bodyfile line without the digest columns
+	 */
+	char *line;
+
+	/* The line size
+	 */
+	size_t line_size;
+};
+
+typedef struct bodyfile_handle_worker bodyfile_handle_worker_t;
+
+struct bodyfile_handle_worker
+{
+	/* The bodyfile handle
+	 */
+	bodyfile_handle_t *bodyfile_handle;
+
+	/* The context
+	 */
+	bodyfile_handle_context_t *context;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The directories, the worker takes from the end and other workers steal from the start
+	 */
+	bodyfile_handle_directory_t **directories;
+
+	/* The directories array size
+	 */
+	int directories_size;
+
+	/* The index of the first directory
+	 */
+	int first_directory_index;
+
+	/* The index after the last directory
+	 */
+	int last_directory_index;
+};
+
+struct bodyfile_handle
+{
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The directory workers
+	 */
+	bodyfile_handle_worker_t **workers;
+
+	/* The hash contexts
+	 */
+	bodyfile_handle_context_t **hash_contexts;
+
+	/* The queue of available hash contexts
+	 */
+	libcthreads_queue_t *hash_contexts_queue;
+
+	/* The hash thread pool
+	 */
+	libcthreads_thread_pool_t *hash_thread_pool;
+
+	/* The output queue
+	 */
+	libcthreads_queue_t *output_queue;
+
+	/* The writer thread
+	 */
+	libcthreads_thread_t *writer_thread;
+
+	/* The mutex that guards the directories and the values below
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition signalled when a directory is added or all directories were processed
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The number of directories that are queued or being processed
+	 */
+	int number_of_pending_directories;
+
+	/* Value to indicate if processing should stop
+	 */
+	int abort;
+
+	/* The result, where -1 indicates one of the threads failed
+	 */
+	int result;
+};
+
+int bodyfile_handle_initialize(
+     bodyfile_handle_t **bodyfile_handle,
+     info_handle_t *info_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int bodyfile_handle_free(
+     bodyfile_handle_t **bodyfile_handle,
+     libcerror_error_t **error );
+
+int bodyfile_handle_file_system_hierarchy_fprint(
+     bodyfile_handle_t *bodyfile_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BODYFILE_HANDLE_H ) */
+
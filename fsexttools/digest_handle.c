@@ -0,0 +1,1000 @@
+/*
+ * Digest handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "digest_handle.h"
+#include "digest_hash.h"
+#include "fsexttools_libcerror.h"
+#include "fsexttools_libcnotify.h"
+#include "fsexttools_libcthreads.h"
+#include "fsexttools_libfsext.h"
+#include "fsexttools_libhmac.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int digest_handle_update_thread_run(
+     void *arguments );
+
+#endif
+
+/* Creates a digest handle
+ * Make sure the value digest_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_initialize(
+     digest_handle_t **digest_handle,
+     uint8_t digest_types,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_initialize";
+	int buffer_index      = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_types & ~( DIGEST_HANDLE_TYPE_MD5 | DIGEST_HANDLE_TYPE_SHA1 | DIGEST_HANDLE_TYPE_SHA256 ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest types.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_handle = memory_allocate_structure(
+	                  digest_handle_t );
+
+	if( *digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_handle,
+	     0,
+	     sizeof( digest_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest handle.",
+		 function );
+
+		memory_free(
+		 *digest_handle );
+
+		*digest_handle = NULL;
+
+		return( -1 );
+	}
+	( *digest_handle )->digest_types = digest_types;
+
+	for( buffer_index = 0;
+	     buffer_index < 2;
+	     buffer_index++ )
+	{
+		( *digest_handle )->buffers[ buffer_index ] = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * DIGEST_HANDLE_BUFFER_SIZE );
+
+		if( ( *digest_handle )->buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *digest_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *digest_handle )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+	( *digest_handle )->update_result = 1;
+
+	if( libcthreads_thread_create(
+	     &( ( *digest_handle )->update_thread ),
+	     NULL,
+	     &digest_handle_update_thread_run,
+	     (void *) *digest_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create update thread.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *digest_handle != NULL )
+	{
+		digest_handle_free(
+		 digest_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a digest handle
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_free(
+     digest_handle_t **digest_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *digest_handle )->update_thread != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     ( *digest_handle )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+			( *digest_handle )->stop_update_thread = 1;
+
+			if( libcthreads_condition_broadcast(
+			     ( *digest_handle )->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     ( *digest_handle )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcthreads_thread_join(
+			     &( ( *digest_handle )->update_thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join update thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_handle )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *digest_handle )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_handle )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *digest_handle )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		for( buffer_index = 0;
+		     buffer_index < 2;
+		     buffer_index++ )
+		{
+			if( ( *digest_handle )->buffers[ buffer_index ] != NULL )
+			{
+				memory_free(
+				 ( *digest_handle )->buffers[ buffer_index ] );
+			}
+		}
+		memory_free(
+		 *digest_handle );
+
+		*digest_handle = NULL;
+	}
+	return( result );
+}
+
+/* Updates the digests
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_update(
+     digest_handle_t *digest_handle,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_update";
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_handle->md5_context != NULL )
+	{
+		if( libhmac_md5_update(
+		     digest_handle->md5_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_handle->sha1_context != NULL )
+	{
+		if( libhmac_sha1_update(
+		     digest_handle->sha1_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_handle->sha256_context != NULL )
+	{
+		if( libhmac_sha256_update(
+		     digest_handle->sha256_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Runs the update thread
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_update_thread_run(
+     void *arguments )
+{
+	digest_handle_t *digest_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t update_size             = 0;
+	int result                     = 0;
+	int update_buffer_index        = 0;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	digest_handle = (digest_handle_t *) arguments;
+
+	if( libcthreads_mutex_grab(
+	     digest_handle->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		while( ( digest_handle->update_pending == 0 )
+		    && ( digest_handle->stop_update_thread == 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     digest_handle->condition,
+			     digest_handle->mutex,
+			     NULL ) != 1 )
+			{
+				libcthreads_mutex_release(
+				 digest_handle->mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( digest_handle->update_pending == 0 )
+		{
+			break;
+		}
+		update_buffer_index = digest_handle->update_buffer_index;
+		update_size         = digest_handle->update_size;
+
+		if( libcthreads_mutex_release(
+		     digest_handle->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		result = digest_handle_update(
+		          digest_handle,
+		          digest_handle->buffers[ update_buffer_index ],
+		          update_size,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     digest_handle->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		digest_handle->update_pending = 0;
+		digest_handle->update_result  = result;
+
+		libcthreads_condition_broadcast(
+		 digest_handle->condition,
+		 NULL );
+	}
+	if( libcthreads_mutex_release(
+	     digest_handle->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits for a pending update to complete
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_wait_for_update(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_wait_for_update";
+	int result            = 1;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( digest_handle->update_pending != 0 )
+	{
+		if( libcthreads_condition_wait(
+		     digest_handle->condition,
+		     digest_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( digest_handle->update_result != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digests.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Hands a buffer to the update thread
+ * Waits for the previous update to complete first
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_push_update(
+     digest_handle_t *digest_handle,
+     int buffer_index,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_push_update";
+	int result            = 1;
+
+	if( digest_handle_wait_for_update(
+	     digest_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for previous update.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	digest_handle->update_buffer_index = buffer_index;
+	digest_handle->update_size         = size;
+	digest_handle->update_pending      = 1;
+
+	if( libcthreads_condition_broadcast(
+	     digest_handle->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Frees the digest contexts
+ */
+void digest_handle_free_contexts(
+      digest_handle_t *digest_handle )
+{
+	if( digest_handle->md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &( digest_handle->md5_context ),
+		 NULL );
+	}
+	if( digest_handle->sha1_context != NULL )
+	{
+		libhmac_sha1_free(
+		 &( digest_handle->sha1_context ),
+		 NULL );
+	}
+	if( digest_handle->sha256_context != NULL )
+	{
+		libhmac_sha256_free(
+		 &( digest_handle->sha256_context ),
+		 NULL );
+	}
+}
+
+/* Calculates the digests of the contents of a file entry in a single pass
+ * When multi-threading support is available the digests are updated on
+ * a separate thread while the next buffer is read
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_calculate_file_entry(
+     digest_handle_t *digest_handle,
+     libfsext_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	static char *function = "digest_handle_calculate_file_entry";
+	size64_t data_size    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	int buffer_index      = 0;
+	int result            = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	uint8_t use_thread    = 0;
+#endif
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_size(
+	     file_entry,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_seek_offset(
+	     file_entry,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: 0 in file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_TYPE_MD5 ) != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( digest_handle->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_TYPE_SHA1 ) != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &( digest_handle->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_TYPE_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( digest_handle->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Overlapping the updates with reading only pays off when there is more than one buffer to read
+	 */
+	if( data_size > (size64_t) DIGEST_HANDLE_BUFFER_SIZE )
+	{
+		use_thread = 1;
+	}
+#endif
+	while( data_size > 0 )
+	{
+		read_size = DIGEST_HANDLE_BUFFER_SIZE;
+
+		if( (size64_t) read_size > data_size )
+		{
+			read_size = (size_t) data_size;
+		}
+		read_count = libfsext_file_entry_read_buffer(
+		              file_entry,
+		              digest_handle->buffers[ buffer_index ],
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file entry.",
+			 function );
+
+			goto on_error;
+		}
+		data_size -= read_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( use_thread != 0 )
+		{
+			result = digest_handle_push_update(
+			          digest_handle,
+			          buffer_index,
+			          read_size,
+			          error );
+		}
+		else
+#endif
+		{
+			result = digest_handle_update(
+			          digest_handle,
+			          digest_handle->buffers[ buffer_index ],
+			          read_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digests.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_index = 1 - buffer_index;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_handle_wait_for_update(
+	     digest_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digests.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( digest_handle->md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     digest_handle->md5_context,
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     digest_handle->md5_string,
+		     DIGEST_HANDLE_MD5_STRING_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set MD5 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( digest_handle->sha1_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     digest_handle->sha1_context,
+		     sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA1 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     digest_handle->sha1_string,
+		     DIGEST_HANDLE_SHA1_STRING_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA1 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( digest_handle->sha256_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     digest_handle->sha256_context,
+		     sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     digest_handle->sha256_string,
+		     DIGEST_HANDLE_SHA256_STRING_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA256 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	digest_handle_free_contexts(
+	 digest_handle );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Make sure the update thread no longer uses the contexts
+	 */
+	digest_handle_wait_for_update(
+	 digest_handle,
+	 NULL );
+
+	digest_handle->update_result = 1;
+#endif
+	digest_handle_free_contexts(
+	 digest_handle );
+
+	return( -1 );
+}
+
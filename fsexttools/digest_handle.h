@@ -0,0 +1,140 @@
+/*
+ * Digest handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_HANDLE_H )
+#define _DIGEST_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fsexttools_libcerror.h"
+#include "fsexttools_libcthreads.h"
+#include "fsexttools_libfsext.h"
+#include "fsexttools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define DIGEST_HANDLE_BUFFER_SIZE		1024 * 1024
+
+#define DIGEST_HANDLE_MD5_STRING_SIZE		33
+#define DIGEST_HANDLE_SHA1_STRING_SIZE		41
+#define DIGEST_HANDLE_SHA256_STRING_SIZE	65
+
+enum DIGEST_HANDLE_TYPES
+{
+	DIGEST_HANDLE_TYPE_MD5		= 0x01,
+	DIGEST_HANDLE_TYPE_SHA1		= 0x02,
+	DIGEST_HANDLE_TYPE_SHA256	= 0x04
+};
+
+typedef struct digest_handle digest_handle_t;
+
+struct digest_handle
+{
+	/* The digest types
+	 */
+	uint8_t digest_types;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The read buffers, one is filled while the other is hashed
+	 */
+	uint8_t *buffers[ 2 ];
+
+	/* The MD5 hash string
+	 */
+	char md5_string[ DIGEST_HANDLE_MD5_STRING_SIZE ];
+
+	/* The SHA1 hash string
+	 */
+	char sha1_string[ DIGEST_HANDLE_SHA1_STRING_SIZE ];
+
+	/* The SHA256 hash string
+	 */
+	char sha256_string[ DIGEST_HANDLE_SHA256_STRING_SIZE ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The update thread
+	 */
+	libcthreads_thread_t *update_thread;
+
+	/* The mutex that guards the update values below
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition signalled when the update state changes
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The index of the buffer to update the digests with
+	 */
+	int update_buffer_index;
+
+	/* The size of the data to update the digests with
+	 */
+	size_t update_size;
+
+	/* Value to indicate an update is pending
+	 */
+	int update_pending;
+
+	/* The result of the last update
+	 */
+	int update_result;
+
+	/* Value to indicate the update thread should stop
+	 */
+	int stop_update_thread;
+#endif
+};
+
+int digest_handle_initialize(
+     digest_handle_t **digest_handle,
+     uint8_t digest_types,
+     libcerror_error_t **error );
+
+int digest_handle_free(
+     digest_handle_t **digest_handle,
+     libcerror_error_t **error );
+
+int digest_handle_calculate_file_entry(
+     digest_handle_t *digest_handle,
+     libfsext_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_HANDLE_H ) */
+
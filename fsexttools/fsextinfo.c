@@ -120,11 +120,17 @@ int main( int argc, char * const argv[] )
 	fsexttools_option_t options[ ] = {
 		{ 'B', "bodyfile", "output file system information as a bodyfile" },
 		{ 'd', NULL, "calculate a MD5 hash of a file entry to include in the bodyfile" },
+		{ 'D', "digest_types", "calculate digest (hash) types of a file entry to include in the bodyfile, options: md5, sha1, sha256 (comma separated)" },
 		{ 'E', "inode_number", "show information about a specific inode or \"all\"" },
+		{ 'f', "format", "output format of the bodyfile, options: bodyfile (default), csv" },
 		{ 'F', "path", "show information about a specific file entry path" },
 		{ 'h', NULL, "shows this help" },
 		{ 'H', NULL, "shows the file system hierarchy" },
+		{ 'I', "index_file", "use the metadata index file, which is created when missing or stale" },
+		{ 'j', "number_of_threads", "specify the number of threads used to generate the bodyfile, default is 1" },
+		{ 'J', NULL, "overlay the committed transactions of the journal on the metadata" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'S', NULL, "print I/O and cache statistics" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source volume" },
@@ -133,8 +139,12 @@ int main( int argc, char * const argv[] )
 
 	libfsext_error_t *error                          = NULL;
 	system_character_t *option_bodyfile              = NULL;
+	system_character_t *option_digest_types          = NULL;
 	system_character_t *option_file_entry_identifier = NULL;
 	system_character_t *option_file_entry_path       = NULL;
+	system_character_t *option_metadata_index        = NULL;
+	system_character_t *option_number_of_threads     = NULL;
+	system_character_t *option_output_format         = NULL;
 	system_character_t *option_volume_offset         = NULL;
 	system_character_t *source                       = NULL;
 	char *program                                    = "fsextinfo";
@@ -142,8 +152,11 @@ int main( int argc, char * const argv[] )
 	size_t string_length                             = 0;
 	uint64_t file_entry_identifier                   = 0;
 	uint8_t calculate_md5                            = 0;
+	uint8_t print_statistics                         = 0;
+	uint8_t use_journal                              = 0;
 	int number_of_options                            = (int) ( sizeof( options ) / sizeof( fsexttools_option_t ) );
 	int option_mode                                  = FSEXTINFO_MODE_VOLUME;
+	int result                                       = 0;
 	int verbose                                      = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
@@ -226,12 +239,22 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'D':
+				option_digest_types = optarg;
+
+				break;
+
 			case (system_integer_t) 'E':
 				option_mode                  = FSEXTINFO_MODE_FILE_ENTRY_BY_IDENTIFIER;
 				option_file_entry_identifier = optarg;
 
 				break;
 
+			case (system_integer_t) 'f':
+				option_output_format = optarg;
+
+				break;
+
 			case (system_integer_t) 'F':
 				option_mode            = FSEXTINFO_MODE_FILE_ENTRY_BY_PATH;
 				option_file_entry_path = optarg;
@@ -253,11 +276,31 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'I':
+				option_metadata_index = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'J':
+				use_journal = 1;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_volume_offset = optarg;
 
 				break;
 
+			case (system_integer_t) 'S':
+				print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -309,6 +352,9 @@ int main( int argc, char * const argv[] )
 #if defined( __clang_analyzer__ )
 	__builtin_assume( fsextinfo_info_handle != NULL );
 #endif
+	fsextinfo_info_handle->use_journal                = use_journal;
+	fsextinfo_info_handle->time_checksum_verification = print_statistics;
+
 	if( option_bodyfile != NULL )
 	{
 		if( info_handle_set_bodyfile(
@@ -323,6 +369,68 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_digest_types != NULL )
+	{
+		result = info_handle_set_digest_types(
+		          fsextinfo_info_handle,
+		          option_digest_types,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set digest types.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported digest types.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_output_format != NULL )
+	{
+		result = info_handle_set_output_format(
+		          fsextinfo_info_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_metadata_index != NULL )
+	{
+		if( info_handle_set_metadata_index(
+		     fsextinfo_info_handle,
+		     option_metadata_index,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set metadata index.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_volume_offset != NULL )
 	{
 		if( info_handle_set_volume_offset(
@@ -341,6 +449,24 @@ int main( int argc, char * const argv[] )
 			 fsextinfo_info_handle->volume_offset );
 		}
 	}
+	if( option_number_of_threads != NULL )
+	{
+		if( info_handle_set_number_of_threads(
+		     fsextinfo_info_handle,
+		     option_number_of_threads,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 fsextinfo_info_handle->number_of_threads );
+		}
+	}
 	if( info_handle_open_input(
 	     fsextinfo_info_handle,
 	     source,
@@ -466,6 +592,19 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     fsextinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close_input(
 	     fsextinfo_info_handle,
 	     &error ) != 0 )
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
 
@@ -115,8 +116,13 @@ int main( int argc, char * const argv[] )
 		"Use fsextmount to mount an Extended File System (ext) volume.";
 
 	fsexttools_option_t options[ ] = {
+		{ 'c', "cache_size", "specify the maximum number of cached file entries, where 0 disables caching, default is 256" },
 		{ 'h', NULL, "shows this help" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+		{ 'r', "read_size", "specify the maximum read size in bytes, default is 1048576" },
+		{ 't', "timeout", "specify the kernel entry and attribute cache timeout in seconds, where 0 disables caching, default is 3600" },
+#endif
 		{ 'v', NULL, "verbose output to stderr, while fsextmount will remain running in the foreground" },
 		{ 'V', NULL, "print version" },
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
@@ -128,6 +134,7 @@ int main( int argc, char * const argv[] )
 	system_character_t options_string[ 32 ];
 
 	libfsext_error_t *error                     = NULL;
+	system_character_t *option_cache_size       = NULL;
 	system_character_t *option_offset           = NULL;
 	system_character_t *source                  = NULL;
 	char *program                               = "fsextmount";
@@ -143,16 +150,15 @@ int main( int argc, char * const argv[] )
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 	struct fuse_operations fsextmount_fuse_operations;
 
-	system_character_t *option_extended_options = NULL;
+	char fuse_options[ 256 ];
 
-#if defined( HAVE_LIBFUSE3 )
-	/* Need to set this to 1 even if there no arguments, otherwise this causes
-	 * fuse: empty argv passed to fuse_session_new()
-	 */
-	char *fuse_argv[ 2 ]                        = { program, NULL };
-	struct fuse_args fsextmount_fuse_arguments  = FUSE_ARGS_INIT(1, fuse_argv);
-#else
 	struct fuse_args fsextmount_fuse_arguments  = FUSE_ARGS_INIT(0, NULL);
+	system_character_t *option_cache_timeout    = NULL;
+	system_character_t *option_extended_options = NULL;
+	system_character_t *option_read_size        = NULL;
+	int print_count                             = 0;
+
+#if !defined( HAVE_LIBFUSE3 )
 	struct fuse_chan *fsextmount_fuse_channel   = NULL;
 #endif
 	struct fuse *fsextmount_fuse_handle         = NULL;
@@ -232,6 +238,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'c':
+				option_cache_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				fsexttools_getopt_usage_fprint(
 				 stdout,
@@ -247,6 +258,18 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+			case (system_integer_t) 'r':
+				option_read_size = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_cache_timeout = optarg;
+
+				break;
+#endif
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -333,6 +356,50 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_cache_size != NULL )
+	{
+		if( mount_handle_set_maximum_number_of_cached_file_entries(
+		     fsextmount_mount_handle,
+		     option_cache_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of cached file entries.\n" );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+	if( option_cache_timeout != NULL )
+	{
+		if( mount_handle_set_cache_timeout(
+		     fsextmount_mount_handle,
+		     option_cache_timeout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set cache timeout.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_read_size != NULL )
+	{
+		if( mount_handle_set_maximum_read_size(
+		     fsextmount_mount_handle,
+		     option_read_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum read size.\n" );
+
+			goto on_error;
+		}
+	}
+#endif
 	if( mount_handle_open(
 	     fsextmount_mount_handle,
 	     source,
@@ -345,25 +412,82 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
-	if( option_extended_options != NULL )
+	/* The volume is read-only and immutable while mounted hence by default
+	 * the kernel is allowed to cache entries, attributes and file data
+	 */
+	if( fsextmount_mount_handle->cache_timeout == 0 )
 	{
-#if defined( HAVE_LIBFUSE3 )
-		// fuse_opt_add_arg: Assertion `!args->argv || args->allocated' failed.
-		fsextmount_fuse_arguments.argc = 0;
-		fsextmount_fuse_arguments.argv = NULL;
+		print_count = narrow_string_snprintf(
+		               fuse_options,
+		               256,
+		               "ro,entry_timeout=0,attr_timeout=0,negative_timeout=0" );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               fuse_options,
+		               256,
+		               "ro,kernel_cache,entry_timeout=%" PRIu32 ",attr_timeout=%" PRIu32 ",negative_timeout=%" PRIu32 "",
+		               fsextmount_mount_handle->cache_timeout,
+		               fsextmount_mount_handle->cache_timeout,
+		               fsextmount_mount_handle->cache_timeout );
+	}
+#if !defined( __APPLE__ )
+	if( ( print_count > 0 )
+	 && ( print_count < 256 ) )
+	{
+		print_count += narrow_string_snprintf(
+		                &( fuse_options[ print_count ] ),
+		                256 - print_count,
+		                ",max_read=%" PRIu32 "",
+		                fsextmount_mount_handle->maximum_read_size );
+	}
 #endif
-		/* This argument is required but ignored
-		 */
-		if( fuse_opt_add_arg(
-		     &fsextmount_fuse_arguments,
-		     "" ) != 0 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable add fuse arguments.\n" );
+	if( ( print_count < 0 )
+	 || ( print_count >= 256 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set fuse options.\n" );
 
-			goto on_error;
-		}
+		goto on_error;
+	}
+	/* This argument is required but ignored
+	 */
+	if( fuse_opt_add_arg(
+	     &fsextmount_fuse_arguments,
+	     "" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &fsextmount_fuse_arguments,
+	     "-o" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &fsextmount_fuse_arguments,
+	     fuse_options ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	/* The extended options are added last so they can override the defaults
+	 */
+	if( option_extended_options != NULL )
+	{
 		if( fuse_opt_add_arg(
 		     &fsextmount_fuse_arguments,
 		     "-o" ) != 0 )
@@ -406,6 +530,7 @@ int main( int argc, char * const argv[] )
 	fsextmount_fuse_operations.releasedir = &mount_fuse_releasedir;
 	fsextmount_fuse_operations.getattr    = &mount_fuse_getattr;
 	fsextmount_fuse_operations.readlink   = &mount_fuse_readlink;
+	fsextmount_fuse_operations.init       = &mount_fuse_init;
 	fsextmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
 #if defined( HAVE_LIBFUSE3 )
@@ -27,7 +27,8 @@
 #include <types.h>
 #include <wide_string.h>
 
-#include "digest_hash.h"
+#include "bodyfile_handle.h"
+#include "digest_handle.h"
 #include "fsexttools_libbfio.h"
 #include "fsexttools_libcerror.h"
 #include "fsexttools_libclocale.h"
@@ -37,6 +38,7 @@
 #include "fsexttools_libfsext.h"
 #include "fsexttools_libhmac.h"
 #include "fsexttools_libuna.h"
+#include "fsexttools_unused.h"
 #include "info_handle.h"
 
 #if !defined( LIBFSEXT_HAVE_BFIO )
@@ -55,9 +57,12 @@ int libfsext_volume_open_file_io_handle(
 
 #endif /* !defined( LIBFSEXT_HAVE_BFIO ) */
 
-#define DIGEST_HASH_STRING_SIZE_MD5	33
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
+/* The MD5, SHA1 and SHA256 strings with separators
+ */
+#define INFO_HANDLE_DIGEST_COLUMNS_STRING_SIZE	( 32 + 1 + 40 + 1 + 64 + 1 + 1 )
+
 /* Copies a string of a decimal value to a 64-bit value
  * Returns 1 if successful or -1 on error
  */
@@ -242,8 +247,12 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
-	( *info_handle )->calculate_md5 = calculate_md5;
-	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	if( calculate_md5 != 0 )
+	{
+		( *info_handle )->digest_types = DIGEST_HANDLE_TYPE_MD5;
+	}
+	( *info_handle )->number_of_threads = 1;
+	( *info_handle )->notify_stream     = INFO_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
@@ -332,6 +341,29 @@ int info_handle_free(
 			}
 			( *info_handle )->bodyfile_stream = NULL;
 		}
+		if( ( *info_handle )->digest_handle != NULL )
+		{
+			if( digest_handle_free(
+			     &( ( *info_handle )->digest_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( ( *info_handle )->hierarchy_path != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->hierarchy_path );
+		}
+#endif
 		memory_free(
 		 *info_handle );
 
@@ -447,6 +479,43 @@ int info_handle_set_bodyfile(
 	return( 1 );
 }
 
+/* Sets the metadata index filename
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_metadata_index(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_metadata_index";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->metadata_index_filename = filename;
+
+	return( 1 );
+}
+
 /* Sets the volume offset
  * Returns 1 if successful or -1 on error
  */
@@ -493,6 +562,214 @@ int info_handle_set_volume_offset(
 	return( 1 );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( info_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > 1024 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the digest types from a comma separated string, such as "md5,sha1,sha256"
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int info_handle_set_digest_types(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function     = "info_handle_set_digest_types";
+	size_t string_index       = 0;
+	size_t string_length      = 0;
+	size_t value_string_index = 0;
+	size_t value_length       = 0;
+	uint8_t digest_types      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	while( string_index <= string_length )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			string_index++;
+
+			continue;
+		}
+		value_length = string_index - value_string_index;
+
+		if( ( value_length == 3 )
+		 && ( system_string_compare(
+		       &( string[ value_string_index ] ),
+		       _SYSTEM_STRING( "md5" ),
+		       3 ) == 0 ) )
+		{
+			digest_types |= DIGEST_HANDLE_TYPE_MD5;
+		}
+		else if( ( value_length == 4 )
+		      && ( system_string_compare(
+		            &( string[ value_string_index ] ),
+		            _SYSTEM_STRING( "sha1" ),
+		            4 ) == 0 ) )
+		{
+			digest_types |= DIGEST_HANDLE_TYPE_SHA1;
+		}
+		else if( ( value_length == 6 )
+		      && ( system_string_compare(
+		            &( string[ value_string_index ] ),
+		            _SYSTEM_STRING( "sha256" ),
+		            6 ) == 0 ) )
+		{
+			digest_types |= DIGEST_HANDLE_TYPE_SHA256;
+		}
+		else
+		{
+			return( 0 );
+		}
+		string_index++;
+
+		value_string_index = string_index;
+	}
+	info_handle->digest_types = digest_types;
+
+	return( 1 );
+}
+
+/* Sets the bodyfile output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_CSV;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "bodyfile" ),
+		     8 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_BODYFILE;
+			result                     = 1;
+		}
+	}
+	return( result );
+}
+
 /* Opens the input
  * Returns 1 if successful or -1 on error
  */
@@ -503,6 +780,7 @@ int info_handle_open_input(
 {
 	static char *function  = "info_handle_open_input";
 	size_t filename_length = 0;
+	int result             = 0;
 
 	if( info_handle == NULL )
 	{
@@ -569,6 +847,58 @@ int info_handle_open_input(
 
 		goto on_error;
 	}
+	if( libfsext_volume_set_use_journal(
+	     info_handle->input_volume,
+	     info_handle->use_journal,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set use journal.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_volume_set_time_checksum_verification(
+	     info_handle->input_volume,
+	     info_handle->time_checksum_verification,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time checksum verification.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle->metadata_index_filename != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libfsext_volume_set_metadata_index_wide(
+		     info_handle->input_volume,
+		     info_handle->metadata_index_filename,
+		     error ) != 1 )
+#else
+		if( libfsext_volume_set_metadata_index(
+		     info_handle->input_volume,
+		     info_handle->metadata_index_filename,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set metadata index.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libfsext_volume_open_file_io_handle(
 	     info_handle->input_volume,
 	     info_handle->input_file_io_handle,
@@ -584,6 +914,45 @@ int info_handle_open_input(
 
 		goto on_error;
 	}
+	/* The metadata index is not used together with the journal
+	 */
+	if( ( info_handle->metadata_index_filename != NULL )
+	 && ( info_handle->use_journal == 0 ) )
+	{
+		/* Create or refresh the metadata index when it is missing or stale
+		 */
+		result = libfsext_volume_has_metadata_index(
+		          info_handle->input_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if input volume has metadata index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libfsext_volume_write_metadata_index(
+			     info_handle->input_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write metadata index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -635,24 +1004,25 @@ int info_handle_close_input(
 	return( 0 );
 }
 
-/* Calculates the MD5 of the contents of a file entry
+/* Copies the digest columns of a bodyfile line to a string
+ * The columns include the trailing separator. If digest_handle is NULL
+ * placeholder values are used
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_entry_calculate_md5(
+int info_handle_digest_columns_copy_to_string(
      info_handle_t *info_handle,
-     libfsext_file_entry_t *file_entry,
-     char *md5_string,
-     size_t md5_string_size,
+     digest_handle_t *digest_handle,
+     char *string,
+     size_t string_size,
      libcerror_error_t **error )
 {
-	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
-	uint8_t read_buffer[ 4096 ];
-
-	libhmac_md5_context_t *md5_context = NULL;
-	static char *function              = "info_handle_file_entry_calculate_md5";
-	size64_t data_size                 = 0;
-	size_t read_size                   = 0;
-	ssize_t read_count                 = 0;
+	const char *digest_strings[ 3 ] = { NULL, NULL, NULL };
+	const char *value_string        = NULL;
+	static char *function           = "info_handle_digest_columns_copy_to_string";
+	size_t string_index             = 0;
+	uint8_t digest_types[ 3 ]       = { DIGEST_HANDLE_TYPE_MD5, DIGEST_HANDLE_TYPE_SHA1, DIGEST_HANDLE_TYPE_SHA256 };
+	int digest_index                = 0;
+	int print_count                 = 0;
 
 	if( info_handle == NULL )
 	{
@@ -665,145 +1035,233 @@ int info_handle_file_entry_calculate_md5(
 
 		return( -1 );
 	}
-	if( libfsext_file_entry_get_size(
-	     file_entry,
-	     &data_size,
-	     error ) != 1 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsext_file_entry_seek_offset(
-	     file_entry,
-	     0,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: 0 in file entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_md5_initialize(
-	     &md5_context,
-	     error ) != 1 )
+	if( digest_handle != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize MD5 context.",
-		 function );
-
-		goto on_error;
+		digest_strings[ 0 ] = digest_handle->md5_string;
+		digest_strings[ 1 ] = digest_handle->sha1_string;
+		digest_strings[ 2 ] = digest_handle->sha256_string;
 	}
-	while( data_size > 0 )
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
 	{
-		read_size = 4096;
+		string[ 0 ] = 0;
 
-		if( (size64_t) read_size > data_size )
+		for( digest_index = 0;
+		     digest_index < 3;
+		     digest_index++ )
 		{
-			read_size = (size_t) data_size;
-		}
-		read_count = libfsext_file_entry_read_buffer(
-		              file_entry,
-		              read_buffer,
-		              read_size,
-		              error );
+			if( ( info_handle->digest_types & digest_types[ digest_index ] ) == 0 )
+			{
+				continue;
+			}
+			value_string = digest_strings[ digest_index ];
 
-		if( read_count != (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from file entry.",
-			 function );
+			if( value_string == NULL )
+			{
+				value_string = "";
+			}
+			print_count = narrow_string_snprintf(
+			               &( string[ string_index ] ),
+			               string_size - string_index,
+			               "%s,",
+			               value_string );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= ( string_size - string_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set digest column: %d.",
+				 function,
+				 digest_index );
 
-			goto on_error;
+				return( -1 );
+			}
+			string_index += (size_t) print_count;
 		}
-		data_size -= read_size;
+	}
+	else
+	{
+		/* Colums in a Sleuthkit 3.x and later bodyfile only contain a MD5 column
+		 */
+		value_string = "0";
 
-		if( libhmac_md5_update(
-		     md5_context,
-		     read_buffer,
-		     read_size,
-		     error ) != 1 )
+		if( ( ( info_handle->digest_types & DIGEST_HANDLE_TYPE_MD5 ) != 0 )
+		 && ( digest_strings[ 0 ] != NULL ) )
+		{
+			value_string = digest_strings[ 0 ];
+		}
+		print_count = narrow_string_snprintf(
+		               string,
+		               string_size,
+		               "%s|",
+		               value_string );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= string_size ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 hash.",
+			 "%s: unable to set MD5 column.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libhmac_md5_finalize(
-	     md5_context,
-	     md5_hash,
-	     LIBHMAC_MD5_HASH_SIZE,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Prints the digest columns of a bodyfile line
+ * The digests of regular files are calculated in a single pass over the data
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_entry_digest_columns_fprint(
+     info_handle_t *info_handle,
+     libfsext_file_entry_t *file_entry,
+     uint16_t file_mode,
+     libcerror_error_t **error )
+{
+	char digest_columns_string[ INFO_HANDLE_DIGEST_COLUMNS_STRING_SIZE ];
+
+	digest_handle_t *digest_handle = NULL;
+	static char *function          = "info_handle_file_entry_digest_columns_fprint";
+
+	if( info_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize MD5 hash.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_md5_free(
-	     &md5_context,
-	     error ) != 1 )
+	if( ( info_handle->digest_types != 0 )
+	 && ( ( file_mode & 0xf000 ) == 0x8000 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free MD5 context.",
-		 function );
+		if( info_handle->defer_digests != 0 )
+		{
+			return( 1 );
+		}
+		if( info_handle->digest_handle == NULL )
+		{
+			if( digest_handle_initialize(
+			     &( info_handle->digest_handle ),
+			     info_handle->digest_types,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize digest handle.",
+				 function );
 
-		goto on_error;
+				return( -1 );
+			}
+		}
+		if( digest_handle_calculate_file_entry(
+		     info_handle->digest_handle,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate digests.",
+			 function );
+
+			return( -1 );
+		}
+		digest_handle = info_handle->digest_handle;
 	}
-	if( digest_hash_copy_to_string(
-	     md5_hash,
-	     LIBHMAC_MD5_HASH_SIZE,
-	     md5_string,
-	     md5_string_size,
+	if( info_handle_digest_columns_copy_to_string(
+	     info_handle,
+	     digest_handle,
+	     digest_columns_string,
+	     INFO_HANDLE_DIGEST_COLUMNS_STRING_SIZE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set MD5 hash string.",
+		 "%s: unable to copy digest columns to string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	fprintf(
+	 info_handle->bodyfile_stream,
+	 "%s",
+	 digest_columns_string );
+
 	return( 1 );
+}
 
-on_error:
-	if( md5_context != NULL )
+/* Prints the bodyfile header if the output format requires one
+ */
+void info_handle_bodyfile_header_fprint(
+      info_handle_t *info_handle )
+{
+	if( ( info_handle->bodyfile_stream == NULL )
+	 || ( info_handle->bodyfile_header_printed != 0 ) )
 	{
-		libhmac_md5_free(
-		 &md5_context,
-		 NULL );
+		return;
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+	{
+		if( ( info_handle->digest_types & DIGEST_HANDLE_TYPE_MD5 ) != 0 )
+		{
+			fprintf(
+			 info_handle->bodyfile_stream,
+			 "md5," );
+		}
+		if( ( info_handle->digest_types & DIGEST_HANDLE_TYPE_SHA1 ) != 0 )
+		{
+			fprintf(
+			 info_handle->bodyfile_stream,
+			 "sha1," );
+		}
+		if( ( info_handle->digest_types & DIGEST_HANDLE_TYPE_SHA256 ) != 0 )
+		{
+			fprintf(
+			 info_handle->bodyfile_stream,
+			 "sha256," );
+		}
+		fprintf(
+		 info_handle->bodyfile_stream,
+		 "name,inode,mode,uid,gid,size,atime,mtime,ctime,crtime\n" );
 	}
-	return( -1 );
+	info_handle->bodyfile_header_printed = 1;
 }
 
 /* Prints a file entry or data stream name
@@ -933,6 +1391,14 @@ int info_handle_name_value_fprint(
 		}
 		else
 		{
+			/* Double quotes in a CSV field are escaped by doubling them
+			 */
+			if( ( info_handle->bodyfile_stream != NULL )
+			 && ( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+			 && ( unicode_character == (libuna_unicode_character_t) '"' ) )
+			{
+				escaped_value_string[ escaped_value_string_index++ ] = (system_character_t) '"';
+			}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 			result = libuna_unicode_character_copy_to_utf16(
 			          unicode_character,
@@ -1539,11 +2005,6 @@ int info_handle_file_entry_value_with_name_fprint(
      size_t file_entry_name_length,
      libcerror_error_t **error )
 {
-	char md5_string[ DIGEST_HASH_STRING_SIZE_MD5 ] = {
-		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
-		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
-		0 };
-
 	char file_mode_string[ 11 ]                       = { '-', '-', '-', '-', '-', '-', '-', '-', '-', '-', 0 };
 
 	libfsext_extended_attribute_t *extended_attribute = NULL;
@@ -1842,37 +2303,35 @@ int info_handle_file_entry_value_with_name_fprint(
 	}
 	if( info_handle->bodyfile_stream != NULL )
 	{
-		if( info_handle->calculate_md5 == 0 )
-		{
-			md5_string[ 1 ] = 0;
-		}
-		else if( ( file_mode & 0xf000 ) == 0x8000 )
-		{
-			if( info_handle_file_entry_calculate_md5(
-			     info_handle,
-			     file_entry,
-			     md5_string,
-			     DIGEST_HASH_STRING_SIZE_MD5,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retreive MD5 string.",
-				 function );
+		info_handle_bodyfile_header_fprint(
+		 info_handle );
 
-				goto on_error;
-			}
-		}
 		/* Colums in a Sleuthkit 3.x and later bodyfile
 		 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
+		 * Colums in a CSV file
+		 * [md5,][sha1,][sha256,]name,inode,mode_as_string,UID,GID,size,atime,mtime,ctime,crtime
 		 */
-		fprintf(
-		 info_handle->bodyfile_stream,
-		 "%s|",
-		 md5_string );
+		if( info_handle_file_entry_digest_columns_fprint(
+		     info_handle,
+		     file_entry,
+		     file_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print digest columns.",
+			 function );
 
+			goto on_error;
+		}
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+		{
+			fprintf(
+			 info_handle->bodyfile_stream,
+			 "\"" );
+		}
 		if( path != NULL )
 		{
 			if( info_handle_name_value_fprint(
@@ -1910,45 +2369,106 @@ int info_handle_file_entry_value_with_name_fprint(
 				goto on_error;
 			}
 		}
-		if( symbolic_link_target != NULL )
-		{
-			fprintf(
-			 info_handle->bodyfile_stream,
-			 " -> %" PRIs_SYSTEM "",
-			 symbolic_link_target );
-		}
-		if( has_creation_time != 0 )
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
 		{
-			fprintf(
-			 info_handle->bodyfile_stream,
-			 "|%" PRIu32 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 ".%09" PRIi64 "|%" PRIi64 ".%09" PRIi64 "|%" PRIi64 ".%09" PRIi64 "|%" PRIi64 ".%09" PRIi64 "\n",
-			 file_entry_identifier,
-			 file_mode_string,
-			 owner_identifier,
-			 group_identifier,
-			 size,
-			 access_time / 1000000000,
-			 access_time - ( ( access_time / 1000000000 ) * 1000000000 ),
-			 modification_time / 1000000000,
-			 modification_time - ( ( modification_time / 1000000000 ) * 1000000000 ),
-			 inode_change_time / 1000000000,
-			 inode_change_time - ( ( inode_change_time / 1000000000 ) * 1000000000 ),
-			 creation_time / 1000000000,
-			 creation_time - ( ( creation_time / 1000000000 ) * 1000000000 ) );
+			if( symbolic_link_target != NULL )
+			{
+				fprintf(
+				 info_handle->bodyfile_stream,
+				 " -> " );
+
+				if( info_handle_name_value_fprint(
+				     info_handle,
+				     symbolic_link_target,
+				     symbolic_link_target_size - 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print symbolic link target string.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( has_creation_time != 0 )
+			{
+				fprintf(
+				 info_handle->bodyfile_stream,
+				 "\",%" PRIu32 ",%s,%" PRIu32 ",%" PRIu32 ",%" PRIu64 ",%" PRIi64 ".%09" PRIi64 ",%" PRIi64 ".%09" PRIi64 ",%" PRIi64 ".%09" PRIi64 ",%" PRIi64 ".%09" PRIi64 "\n",
+				 file_entry_identifier,
+				 file_mode_string,
+				 owner_identifier,
+				 group_identifier,
+				 size,
+				 access_time / 1000000000,
+				 access_time - ( ( access_time / 1000000000 ) * 1000000000 ),
+				 modification_time / 1000000000,
+				 modification_time - ( ( modification_time / 1000000000 ) * 1000000000 ),
+				 inode_change_time / 1000000000,
+				 inode_change_time - ( ( inode_change_time / 1000000000 ) * 1000000000 ),
+				 creation_time / 1000000000,
+				 creation_time - ( ( creation_time / 1000000000 ) * 1000000000 ) );
+			}
+			else
+			{
+				fprintf(
+				 info_handle->bodyfile_stream,
+				 "\",%" PRIu32 ",%s,%" PRIu32 ",%" PRIu32 ",%" PRIu64 ",%" PRIi64 ",%" PRIi64 ",%" PRIi64 ",0\n",
+				 file_entry_identifier,
+				 file_mode_string,
+				 owner_identifier,
+				 group_identifier,
+				 size,
+				 access_time / 1000000000,
+				 modification_time / 1000000000,
+				 inode_change_time / 1000000000 );
+			}
 		}
 		else
 		{
-			fprintf(
-			 info_handle->bodyfile_stream,
-			 "|%" PRIu32 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 "|%" PRIi64 "|%" PRIi64 "|0\n",
-			 file_entry_identifier,
-			 file_mode_string,
-			 owner_identifier,
-			 group_identifier,
-			 size,
-			 access_time / 1000000000,
-			 modification_time / 1000000000,
-			 inode_change_time / 1000000000 );
+			if( symbolic_link_target != NULL )
+			{
+				fprintf(
+				 info_handle->bodyfile_stream,
+				 " -> %" PRIs_SYSTEM "",
+				 symbolic_link_target );
+			}
+			if( has_creation_time != 0 )
+			{
+				fprintf(
+				 info_handle->bodyfile_stream,
+				 "|%" PRIu32 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 ".%09" PRIi64 "|%" PRIi64 ".%09" PRIi64 "|%" PRIi64 ".%09" PRIi64 "|%" PRIi64 ".%09" PRIi64 "\n",
+				 file_entry_identifier,
+				 file_mode_string,
+				 owner_identifier,
+				 group_identifier,
+				 size,
+				 access_time / 1000000000,
+				 access_time - ( ( access_time / 1000000000 ) * 1000000000 ),
+				 modification_time / 1000000000,
+				 modification_time - ( ( modification_time / 1000000000 ) * 1000000000 ),
+				 inode_change_time / 1000000000,
+				 inode_change_time - ( ( inode_change_time / 1000000000 ) * 1000000000 ),
+				 creation_time / 1000000000,
+				 creation_time - ( ( creation_time / 1000000000 ) * 1000000000 ) );
+			}
+			else
+			{
+				fprintf(
+				 info_handle->bodyfile_stream,
+				 "|%" PRIu32 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 "|%" PRIi64 "|%" PRIi64 "|0\n",
+				 file_entry_identifier,
+				 file_mode_string,
+				 owner_identifier,
+				 group_identifier,
+				 size,
+				 access_time / 1000000000,
+				 modification_time / 1000000000,
+				 inode_change_time / 1000000000 );
+			}
 		}
 	}
 	else
@@ -2373,27 +2893,20 @@ on_error:
 	return( -1 );
 }
 
-/* Prints file entry information as part of the file system hierarchy
+/* Prints a path as part of the file system hierarchy
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_system_hierarchy_fprint_file_entry(
+int info_handle_file_system_hierarchy_fprint_path(
      info_handle_t *info_handle,
-     libfsext_file_entry_t *file_entry,
      const system_character_t *path,
      size_t path_length,
+     uint32_t inode_number,
      libcerror_error_t **error )
 {
-	libfsext_file_entry_t *sub_file_entry = NULL;
-	system_character_t *file_entry_name   = NULL;
-	system_character_t *sub_path          = NULL;
-	static char *function                 = "info_handle_file_system_hierarchy_fprint_file_entry";
-	size_t file_entry_name_length         = 0;
-	size_t file_entry_name_size           = 0;
-	size_t sub_path_size                  = 0;
-	uint32_t file_entry_identifier        = 0;
-	int number_of_sub_file_entries        = 0;
-	int result                            = 0;
-	int sub_file_entry_index              = 0;
+	libfsext_file_entry_t *file_entry = NULL;
+	static char *function             = "info_handle_file_system_hierarchy_fprint_path";
+	size_t parent_path_length         = 0;
+	int result                        = 0;
 
 	if( info_handle == NULL )
 	{
@@ -2417,313 +2930,263 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 
 		return( -1 );
 	}
-	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsext_file_entry_get_inode_number(
-	     file_entry,
-	     &file_entry_identifier,
-	     error ) != 1 )
+	if( info_handle->bodyfile_stream == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode number.",
-		 function );
+		if( info_handle_name_value_fprint(
+		     info_handle,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print path string.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		return( 1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsext_file_entry_get_utf16_name_size(
-	          file_entry,
-	          &file_entry_name_size,
-	          error );
-#else
-	result = libfsext_file_entry_get_utf8_name_size(
-	          file_entry,
-	          &file_entry_name_size,
-	          error );
-#endif
-	if( result == -1 )
+	if( libfsext_volume_get_file_entry_by_inode(
+	     info_handle->input_volume,
+	     inode_number,
+	     &file_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry name string size.",
-		 function );
+		 "%s: unable to retrieve file entry: %" PRIu32 ".",
+		 function,
+		 inode_number );
 
 		goto on_error;
 	}
-	if( ( result == 1 )
-	 && ( file_entry_name_size > 0 ) )
-	{
-		file_entry_name = system_string_allocate(
-		                   file_entry_name_size );
+	/* The bodyfile values are printed with the parent path, including the trailing separator,
+	 * and the name separately
+	 */
+	parent_path_length = path_length;
 
-		if( file_entry_name == NULL )
+	while( parent_path_length > 0 )
+	{
+		if( path[ parent_path_length - 1 ] == (system_character_t) LIBFSEXT_SEPARATOR )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create file entry name string.",
-			 function );
-
-			goto on_error;
+			break;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfsext_file_entry_get_utf16_name(
+		parent_path_length--;
+	}
+	if( parent_path_length == path_length )
+	{
+		result = info_handle_file_entry_value_with_name_fprint(
+		          info_handle,
 		          file_entry,
-		          (uint16_t *) file_entry_name,
-		          file_entry_name_size,
+		          path,
+		          path_length,
+		          NULL,
+		          0,
 		          error );
-#else
-		result = libfsext_file_entry_get_utf8_name(
+	}
+	else
+	{
+		result = info_handle_file_entry_value_with_name_fprint(
+		          info_handle,
 		          file_entry,
-		          (uint8_t *) file_entry_name,
-		          file_entry_name_size,
+		          path,
+		          parent_path_length,
+		          &( path[ parent_path_length ] ),
+		          path_length - parent_path_length,
 		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry name string.",
-			 function );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print file entry: %" PRIu32 ".",
+		 function,
+		 inode_number );
 
-			goto on_error;
-		}
-		file_entry_name_length = file_entry_name_size - 1;
+		goto on_error;
 	}
-	if( info_handle->bodyfile_stream != NULL )
+	if( libfsext_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
 	{
-		if( info_handle_file_entry_value_with_name_fprint(
-		     info_handle,
-		     file_entry,
-		     path,
-		     path_length,
-		     file_entry_name,
-		     file_entry_name_length,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	else
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
 	{
-		if( info_handle_name_value_fprint(
-		     info_handle,
-		     path,
-		     path_length,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print path string.",
-			 function );
+		libfsext_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		if( ( file_entry_name != NULL )
-		 && ( file_entry_identifier != 2 ) )
-		{
-			if( info_handle_name_value_fprint(
-			     info_handle,
-			     file_entry_name,
-			     file_entry_name_length,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print file entry name string.",
-				 function );
+/* Callback function to print an entry of the file system hierarchy walk
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_system_hierarchy_walk_callback(
+     intptr_t *user_data,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint32_t inode_number,
+     uint16_t file_type FSEXTTOOLS_ATTRIBUTE_UNUSED,
+     int depth FSEXTTOOLS_ATTRIBUTE_UNUSED )
+{
+	const system_character_t *path = NULL;
+	info_handle_t *info_handle     = NULL;
+	libcerror_error_t *error       = NULL;
+	static char *function          = "info_handle_file_system_hierarchy_walk_callback";
+	size_t path_length             = 0;
 
-				goto on_error;
-			}
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	void *reallocation             = NULL;
+	size_t path_size               = 0;
+#endif
+
+	FSEXTTOOLS_UNREFERENCED_PARAMETER( file_type )
+	FSEXTTOOLS_UNREFERENCED_PARAMETER( depth )
+
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		goto on_error;
 	}
-	if( libfsext_file_entry_get_number_of_sub_file_entries(
-	     file_entry,
-	     &number_of_sub_file_entries,
-	     error ) != 1 )
+	info_handle = (info_handle_t *) user_data;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The path is converted into a buffer that is reused for all entries
+	 */
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_path,
+	     utf8_path_length + 1,
+	     &path_size,
+	     &error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
+		 "%s: unable to determine path size.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_sub_file_entries > 0 )
+	if( path_size > info_handle->hierarchy_path_size )
 	{
-		sub_path_size = path_length + 1;
-
-		if( file_entry_name != NULL )
-		{
-			sub_path_size += file_entry_name_size;
-		}
-		sub_path = system_string_allocate(
-		            sub_path_size );
-
-		if( sub_path == NULL )
+		if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
 		{
 			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub path.",
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid path size value exceeds maximum.",
 			 function );
 
 			goto on_error;
 		}
-		if( system_string_copy(
-		     sub_path,
-		     path,
-		     path_length ) == NULL )
+		reallocation = memory_reallocate(
+		                info_handle->hierarchy_path,
+		                sizeof( system_character_t ) * path_size );
+
+		if( reallocation == NULL )
 		{
 			libcerror_error_set(
-			 error,
+			 &error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy path to sub path.",
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
 			 function );
 
 			goto on_error;
 		}
-		if( file_entry_name != NULL )
-		{
-			if( system_string_copy(
-			     &( sub_path[ path_length ] ),
-			     file_entry_name,
-			     file_entry_name_size - 1 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy file entry name to sub path.",
-				 function );
-
-				goto on_error;
-			}
-			sub_path[ sub_path_size - 2 ] = (system_character_t) LIBFSEXT_SEPARATOR;
-		}
-		sub_path[ sub_path_size - 1 ] = (system_character_t) 0;
-
-		for( sub_file_entry_index = 0;
-		     sub_file_entry_index < number_of_sub_file_entries;
-		     sub_file_entry_index++ )
-		{
-			if( libfsext_file_entry_get_sub_file_entry_by_index(
-			     file_entry,
-			     sub_file_entry_index,
-			     &sub_file_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve sub file entry: %d.",
-				 function,
-				 sub_file_entry_index );
-
-				goto on_error;
-			}
-			if( info_handle_file_system_hierarchy_fprint_file_entry(
-			     info_handle,
-			     sub_file_entry,
-			     sub_path,
-			     sub_path_size - 1,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print file entry: %d information.",
-				 function,
-				 sub_file_entry_index );
-
-				goto on_error;
-			}
-			if( libfsext_file_entry_free(
-			     &sub_file_entry,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free sub file entry: %d.",
-				 function,
-				 sub_file_entry_index );
-
-				goto on_error;
-			}
-		}
-		if( sub_path != NULL )
-		{
-			memory_free(
-			 sub_path );
+		info_handle->hierarchy_path      = (system_character_t *) reallocation;
+		info_handle->hierarchy_path_size = path_size;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     (libuna_utf16_character_t *) info_handle->hierarchy_path,
+	     path_size,
+	     utf8_path,
+	     utf8_path_length + 1,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
 
-			sub_path = NULL;
-		}
+		goto on_error;
 	}
-	if( file_entry_name != NULL )
+	path        = info_handle->hierarchy_path;
+	path_length = path_size - 1;
+#else
+	path        = (const system_character_t *) utf8_path;
+	path_length = utf8_path_length;
+#endif
+	if( info_handle_file_system_hierarchy_fprint_path(
+	     info_handle,
+	     path,
+	     path_length,
+	     inode_number,
+	     &error ) != 1 )
 	{
-		memory_free(
-		 file_entry_name );
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print path of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
 
-		file_entry_name = NULL;
+		goto on_error;
 	}
 	return( 1 );
 
 on_error:
-	if( sub_file_entry != NULL )
-	{
-		libfsext_file_entry_free(
-		 &sub_file_entry,
-		 NULL );
-	}
-	if( sub_path != NULL )
-	{
-		memory_free(
-		 sub_path );
-	}
-	if( file_entry_name != NULL )
-	{
-		memory_free(
-		 file_entry_name );
-	}
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
 	return( -1 );
 }
 
@@ -3048,9 +3511,11 @@ int info_handle_file_system_hierarchy_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error )
 {
-	libfsext_file_entry_t *file_entry = NULL;
-	static char *function             = "info_handle_file_system_hierarchy_fprint";
-	int result                        = 0;
+#if defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT )
+	bodyfile_handle_t *bodyfile_handle = NULL;
+	int result                         = 0;
+#endif
+	static char *function              = "info_handle_file_system_hierarchy_fprint";
 
 	if( info_handle == NULL )
 	{
@@ -3063,63 +3528,85 @@ int info_handle_file_system_hierarchy_fprint(
 
 		return( -1 );
 	}
-	if( info_handle->bodyfile_stream == NULL )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "Extended File System information:\n\n" );
-
-		fprintf(
-		 info_handle->notify_stream,
-		 "File system hierarchy:\n" );
-	}
-	result = libfsext_volume_get_root_directory(
-	          info_handle->input_volume,
-	          &file_entry,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root directory file entry.",
-		 function );
-
-		goto on_error;
-	}
-	else if( result != 0 )
+#if defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT )
+	if( ( info_handle->bodyfile_stream != NULL )
+	 && ( info_handle->number_of_threads > 1 ) )
 	{
-		if( info_handle_file_system_hierarchy_fprint_file_entry(
+		if( bodyfile_handle_initialize(
+		     &bodyfile_handle,
 		     info_handle,
-		     file_entry,
-		     _SYSTEM_STRING( "/" ),
-		     1,
+		     info_handle->number_of_threads,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize bodyfile handle.",
+			 function );
+
+			goto on_error;
+		}
+		result = bodyfile_handle_file_system_hierarchy_fprint(
+		          bodyfile_handle,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print root directory file entry information.",
+			 "%s: unable to print file system hierarchy.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsext_file_entry_free(
-		     &file_entry,
+		if( bodyfile_handle_free(
+		     &bodyfile_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file entry.",
+			 "%s: unable to free bodyfile handle.",
 			 function );
 
 			goto on_error;
 		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT ) */
+
+	if( info_handle->bodyfile_stream == NULL )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Extended File System information:\n\n" );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "File system hierarchy:\n" );
+	}
+	if( libfsext_volume_walk(
+	     info_handle->input_volume,
+	     &info_handle_file_system_hierarchy_walk_callback,
+	     NULL,
+	     (intptr_t *) info_handle,
+	     -1,
+	     LIBFSEXT_WALK_FILE_TYPE_FILTER_ALL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print file system hierarchy.",
+		 function );
+
+		goto on_error;
 	}
 	if( info_handle->bodyfile_stream == NULL )
 	{
@@ -3130,12 +3617,14 @@ int info_handle_file_system_hierarchy_fprint(
 	return( 1 );
 
 on_error:
-	if( file_entry != NULL )
+#if defined( HAVE_BODYFILE_HANDLE_MULTI_THREAD_SUPPORT )
+	if( bodyfile_handle != NULL )
 	{
-		libfsext_file_entry_free(
-		 &file_entry,
+		bodyfile_handle_free(
+		 &bodyfile_handle,
 		 NULL );
 	}
+#endif
 	return( -1 );
 }
 
@@ -3154,6 +3643,7 @@ int info_handle_volume_fprint(
 	uint32_t read_only_compatible_features_flags = 0;
 	uint32_t value_32bit                         = 0;
 	uint8_t format_version                       = 0;
+	int number_of_journal_blocks                 = 0;
 	int result                                   = 0;
 
 	if( info_handle == NULL )
@@ -3474,6 +3964,27 @@ int info_handle_volume_fprint(
 
 		goto on_error;
 	}
+	if( info_handle->use_journal != 0 )
+	{
+		if( libfsext_volume_get_number_of_journal_blocks(
+		     info_handle->input_volume,
+		     &number_of_journal_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of journal blocks.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of journal blocks\t: %d\n",
+		 number_of_journal_blocks );
+	}
 /* TODO print more info */
 
 	fprintf(
@@ -3491,3 +4002,129 @@ on_error:
 	return( -1 );
 }
 
+/* Prints the volume statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t statistics_values[ LIBFSEXT_STATISTICS_VALUE_CHECKSUM_VERIFICATION_TIME + 1 ];
+
+	static char *function = "info_handle_statistics_fprint";
+	int statistics_value  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( statistics_value = 0;
+	     statistics_value <= LIBFSEXT_STATISTICS_VALUE_CHECKSUM_VERIFICATION_TIME;
+	     statistics_value++ )
+	{
+		if( libfsext_volume_get_statistics(
+		     info_handle->input_volume,
+		     statistics_value,
+		     &( statistics_values[ statistics_value ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics value: %d.",
+			 function,
+			 statistics_value );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Statistics:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tSuperblock reads\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_SUPERBLOCK_NUMBER_OF_READS ],
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_SUPERBLOCK_READ_SIZE ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tGroup descriptors reads\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_GROUP_DESCRIPTORS_NUMBER_OF_READS ],
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_GROUP_DESCRIPTORS_READ_SIZE ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tInode table reads\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_INODE_TABLE_NUMBER_OF_READS ],
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_INODE_TABLE_READ_SIZE ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDirectory reads\t\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_DIRECTORY_NUMBER_OF_READS ],
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_DIRECTORY_READ_SIZE ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tExtent index reads\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_EXTENT_INDEX_NUMBER_OF_READS ],
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_EXTENT_INDEX_READ_SIZE ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tData reads\t\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_DATA_NUMBER_OF_READS ],
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_DATA_READ_SIZE ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tExtended attributes reads\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_EXTENDED_ATTRIBUTES_NUMBER_OF_READS ],
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_EXTENDED_ATTRIBUTES_READ_SIZE ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tInode cache hits\t\t: %" PRIu64 "\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_INODE_CACHE_HITS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tInode cache misses\t\t: %" PRIu64 "\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_INODE_CACHE_MISSES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tBlock cache hits\t\t: %" PRIu64 "\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_HITS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tBlock cache misses\t\t: %" PRIu64 "\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_MISSES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tChecksum verifications\t\t: %" PRIu64 "\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_NUMBER_OF_CHECKSUM_VERIFICATIONS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tChecksum verification time\t: %" PRIu64 " ns\n",
+	 statistics_values[ LIBFSEXT_STATISTICS_VALUE_CHECKSUM_VERIFICATION_TIME ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
@@ -26,6 +26,7 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "digest_handle.h"
 #include "fsexttools_libbfio.h"
 #include "fsexttools_libcerror.h"
 #include "fsexttools_libfsext.h"
@@ -34,6 +35,12 @@
 extern "C" {
 #endif
 
+enum INFO_HANDLE_OUTPUT_FORMATS
+{
+	INFO_HANDLE_OUTPUT_FORMAT_BODYFILE	= 0,
+	INFO_HANDLE_OUTPUT_FORMAT_CSV		= 1
+};
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -50,9 +57,41 @@ struct info_handle
 	 */
 	libfsext_volume_t *input_volume;
 
-	/* Value to indicate if the MD5 hash should be calculated
+	/* The metadata index filename
+	 */
+	const system_character_t *metadata_index_filename;
+
+	/* Value to indicate the journal should be used
+	 */
+	uint8_t use_journal;
+
+	/* Value to indicate the time spent in checksum verification should be measured
+	 */
+	uint8_t time_checksum_verification;
+
+	/* The digest types that should be calculated
+	 */
+	uint8_t digest_types;
+
+	/* Value to indicate the digest columns of regular files are printed by a separate stage
+	 */
+	uint8_t defer_digests;
+
+	/* The digest handle
 	 */
-	uint8_t calculate_md5;
+	digest_handle_t *digest_handle;
+
+	/* The bodyfile output format
+	 */
+	int output_format;
+
+	/* Value to indicate if the bodyfile header was printed
+	 */
+	uint8_t bodyfile_header_printed;
+
+	/* The number of threads used to generate the bodyfile
+	 */
+	int number_of_threads;
 
 	/* The bodyfile output stream
 	 */
@@ -62,6 +101,17 @@ struct info_handle
 	 */
 	FILE *notify_stream;
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The file system hierarchy path
+	 * Reused to convert the UTF-8 paths of the file system hierarchy walk
+	 */
+	system_character_t *hierarchy_path;
+
+	/* The file system hierarchy path size
+	 */
+	size_t hierarchy_path_size;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -91,11 +141,31 @@ int info_handle_set_bodyfile(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int info_handle_set_metadata_index(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int info_handle_set_volume_offset(
      info_handle_t *info_handle,
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_digest_types(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -105,11 +175,17 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
-int info_handle_file_entry_calculate_md5(
+int info_handle_digest_columns_copy_to_string(
+     info_handle_t *info_handle,
+     digest_handle_t *digest_handle,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int info_handle_file_entry_digest_columns_fprint(
      info_handle_t *info_handle,
      libfsext_file_entry_t *file_entry,
-     char *md5_string,
-     size_t md5_string_size,
+     uint16_t file_mode,
      libcerror_error_t **error );
 
 int info_handle_name_value_fprint(
@@ -151,13 +227,21 @@ int info_handle_file_entry_value_with_name_fprint(
      size_t file_entry_name_length,
      libcerror_error_t **error );
 
-int info_handle_file_system_hierarchy_fprint_file_entry(
+int info_handle_file_system_hierarchy_fprint_path(
      info_handle_t *info_handle,
-     libfsext_file_entry_t *file_entry,
      const system_character_t *path,
      size_t path_length,
+     uint32_t inode_number,
      libcerror_error_t **error );
 
+int info_handle_file_system_hierarchy_walk_callback(
+     intptr_t *user_data,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint32_t inode_number,
+     uint16_t file_type,
+     int depth );
+
 int info_handle_file_entries_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
@@ -180,6 +264,10 @@ int info_handle_volume_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -221,9 +221,26 @@ int mount_file_entry_free(
 			memory_free(
 			 ( *file_entry )->name );
 		}
-		if( libfsext_file_entry_free(
-		     &( ( *file_entry )->fsext_file_entry ),
-		     error ) != 1 )
+		if( ( *file_entry )->is_cached != 0 )
+		{
+			if( mount_file_system_release_cached_file_entry(
+			     ( *file_entry )->file_system,
+			     &( ( *file_entry )->fsext_file_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release cached file entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( libfsext_file_entry_free(
+		          &( ( *file_entry )->fsext_file_entry ),
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -52,6 +52,10 @@ struct mount_file_entry
 	/* The file entry
 	 */
 	libfsext_file_entry_t *fsext_file_entry;
+
+	/* Value to indicate the file entry was retrieved from the file entries cache of the file system
+	 */
+	uint8_t is_cached;
 };
 
 int mount_file_entry_initialize(
@@ -196,6 +196,8 @@ int mount_file_system_initialize(
 
 #endif /* defined( HAVE_CLOCK_GETTIME ) */
 
+	( *file_system )->maximum_number_of_cached_file_entries = MOUNT_FILE_SYSTEM_DEFAULT_MAXIMUM_NUMBER_OF_CACHED_FILE_ENTRIES;
+
 	return( 1 );
 
 on_error:
@@ -232,6 +234,34 @@ int mount_file_system_free(
 	}
 	if( *file_system != NULL )
 	{
+		if( mount_file_system_empty_file_entries_cache(
+		     *file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty file entries cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *file_system )->inode_number_hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *file_system )->inode_number_hash_buckets );
+		}
+		if( ( *file_system )->path_hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *file_system )->path_hash_buckets );
+		}
+		if( ( *file_system )->cached_file_entries != NULL )
+		{
+			memory_free(
+			 ( *file_system )->cached_file_entries );
+		}
 		memory_free(
 		 *file_system );
 
@@ -279,6 +309,137 @@ int mount_file_system_signal_abort(
 	return( 1 );
 }
 
+/* Empties the file entries cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_empty_file_entries_cache(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	mount_cached_file_entry_t *cached_file_entry = NULL;
+	static char *function                        = "mount_file_system_empty_file_entries_cache";
+	int bucket_index                             = 0;
+	int cached_file_entry_index                  = 0;
+	int result                                   = 1;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->cached_file_entries == NULL )
+	{
+		return( 1 );
+	}
+	for( cached_file_entry_index = 0;
+	     cached_file_entry_index < file_system->number_of_cached_file_entries;
+	     cached_file_entry_index++ )
+	{
+		cached_file_entry = &( file_system->cached_file_entries[ cached_file_entry_index ] );
+
+		if( cached_file_entry->path != NULL )
+		{
+			memory_free(
+			 cached_file_entry->path );
+		}
+		if( cached_file_entry->fsext_file_entry != NULL )
+		{
+			if( libfsext_file_entry_free(
+			     &( cached_file_entry->fsext_file_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free cached file entry: %d.",
+				 function,
+				 cached_file_entry_index );
+
+				result = -1;
+			}
+		}
+		cached_file_entry->path                 = NULL;
+		cached_file_entry->path_length          = 0;
+		cached_file_entry->path_hash            = 0;
+		cached_file_entry->inode_number         = 0;
+		cached_file_entry->fsext_file_entry     = NULL;
+		cached_file_entry->number_of_references = 0;
+		cached_file_entry->next_by_path         = 0;
+		cached_file_entry->next_by_inode_number = 0;
+		cached_file_entry->previous_unused      = 0;
+		cached_file_entry->next_unused          = 0;
+	}
+	for( bucket_index = 0;
+	     bucket_index < file_system->number_of_hash_buckets;
+	     bucket_index++ )
+	{
+		file_system->path_hash_buckets[ bucket_index ]         = 0;
+		file_system->inode_number_hash_buckets[ bucket_index ] = 0;
+	}
+	file_system->number_of_cached_file_entries = 0;
+	file_system->first_unused                  = 0;
+	file_system->last_unused                   = 0;
+
+	return( result );
+}
+
+/* Sets the maximum number of cached file entries
+ * A value of 0 disables the file entries cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_maximum_number_of_cached_file_entries(
+     mount_file_system_t *file_system,
+     int maximum_number_of_cached_file_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_set_maximum_number_of_cached_file_entries";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->cached_file_entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - cached file entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_cached_file_entries < 0 )
+	 || ( maximum_number_of_cached_file_entries > MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_CACHED_FILE_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of cached file entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->maximum_number_of_cached_file_entries = maximum_number_of_cached_file_entries;
+
+	return( 1 );
+}
+
 /* Sets the volume
  * Returns 1 if successful or -1 on error
  */
@@ -300,6 +461,21 @@ int mount_file_system_set_volume(
 
 		return( -1 );
 	}
+	/* The cached file entries reference the previous volume
+	 */
+	if( mount_file_system_empty_file_entries_cache(
+	     file_system,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty file entries cache.",
+		 function );
+
+		return( -1 );
+	}
 	file_system->fsext_volume = fsext_volume;
 
 	return( 1 );
@@ -480,6 +656,728 @@ on_error:
 	return( -1 );
 }
 
+/* Calculates the hash of a path
+ * Returns the 32-bit FNV-1a hash of the path characters
+ */
+uint32_t mount_file_system_get_path_hash(
+          const system_character_t *path,
+          size_t path_length )
+{
+	size_t path_index = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		hash ^= (uint32_t) path[ path_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Allocates the file entries cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_allocate_file_entries_cache(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error )
+{
+	static char *function           = "mount_file_system_allocate_file_entries_cache";
+	size_t cached_file_entries_size = 0;
+	int number_of_hash_buckets      = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->cached_file_entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - cached file entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of hash buckets is a power of 2 of at least twice the maximum number of cached file entries
+	 */
+	number_of_hash_buckets = 16;
+
+	while( number_of_hash_buckets < ( 2 * file_system->maximum_number_of_cached_file_entries ) )
+	{
+		number_of_hash_buckets *= 2;
+	}
+	cached_file_entries_size = sizeof( mount_cached_file_entry_t ) * file_system->maximum_number_of_cached_file_entries;
+
+	file_system->cached_file_entries = (mount_cached_file_entry_t *) memory_allocate(
+	                                                                  cached_file_entries_size );
+
+	if( file_system->cached_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cached file entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     file_system->cached_file_entries,
+	     0,
+	     cached_file_entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cached file entries.",
+		 function );
+
+		goto on_error;
+	}
+	file_system->path_hash_buckets = (int *) memory_allocate(
+	                                          sizeof( int ) * number_of_hash_buckets );
+
+	if( file_system->path_hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     file_system->path_hash_buckets,
+	     0,
+	     sizeof( int ) * number_of_hash_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	file_system->inode_number_hash_buckets = (int *) memory_allocate(
+	                                                  sizeof( int ) * number_of_hash_buckets );
+
+	if( file_system->inode_number_hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode number hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     file_system->inode_number_hash_buckets,
+	     0,
+	     sizeof( int ) * number_of_hash_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode number hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	file_system->number_of_hash_buckets        = number_of_hash_buckets;
+	file_system->number_of_cached_file_entries = 0;
+	file_system->first_unused                  = 0;
+	file_system->last_unused                   = 0;
+
+	return( 1 );
+
+on_error:
+	if( file_system->inode_number_hash_buckets != NULL )
+	{
+		memory_free(
+		 file_system->inode_number_hash_buckets );
+
+		file_system->inode_number_hash_buckets = NULL;
+	}
+	if( file_system->path_hash_buckets != NULL )
+	{
+		memory_free(
+		 file_system->path_hash_buckets );
+
+		file_system->path_hash_buckets = NULL;
+	}
+	if( file_system->cached_file_entries != NULL )
+	{
+		memory_free(
+		 file_system->cached_file_entries );
+
+		file_system->cached_file_entries = NULL;
+	}
+	return( -1 );
+}
+
+/* Removes an unreferenced cached file entry from the least recently used list
+ */
+void mount_file_system_remove_unused_cached_file_entry(
+      mount_file_system_t *file_system,
+      int cached_file_entry_index )
+{
+	mount_cached_file_entry_t *cached_file_entry = NULL;
+
+	cached_file_entry = &( file_system->cached_file_entries[ cached_file_entry_index ] );
+
+	if( cached_file_entry->previous_unused == 0 )
+	{
+		file_system->first_unused = cached_file_entry->next_unused;
+	}
+	else
+	{
+		file_system->cached_file_entries[ cached_file_entry->previous_unused - 1 ].next_unused = cached_file_entry->next_unused;
+	}
+	if( cached_file_entry->next_unused == 0 )
+	{
+		file_system->last_unused = cached_file_entry->previous_unused;
+	}
+	else
+	{
+		file_system->cached_file_entries[ cached_file_entry->next_unused - 1 ].previous_unused = cached_file_entry->previous_unused;
+	}
+	cached_file_entry->previous_unused = 0;
+	cached_file_entry->next_unused     = 0;
+}
+
+/* Removes an unreferenced cached file entry from the file entries cache
+ * The cached file entry is removed from the hash buckets and the least recently used list
+ * and its file entry is freed, after which the cached file entry can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_remove_cached_file_entry(
+     mount_file_system_t *file_system,
+     int cached_file_entry_index,
+     libcerror_error_t **error )
+{
+	mount_cached_file_entry_t *cached_file_entry = NULL;
+	static char *function                        = "mount_file_system_remove_cached_file_entry";
+	int *next_index                              = NULL;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cached_file_entry_index < 0 )
+	 || ( cached_file_entry_index >= file_system->number_of_cached_file_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cached file entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cached_file_entry = &( file_system->cached_file_entries[ cached_file_entry_index ] );
+
+	if( cached_file_entry->number_of_references != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cached file entry: %d - still referenced.",
+		 function,
+		 cached_file_entry_index );
+
+		return( -1 );
+	}
+	mount_file_system_remove_unused_cached_file_entry(
+	 file_system,
+	 cached_file_entry_index );
+
+	next_index = &( file_system->path_hash_buckets[ cached_file_entry->path_hash & (uint32_t) ( file_system->number_of_hash_buckets - 1 ) ] );
+
+	while( *next_index != 0 )
+	{
+		if( *next_index == ( cached_file_entry_index + 1 ) )
+		{
+			*next_index = cached_file_entry->next_by_path;
+
+			break;
+		}
+		next_index = &( file_system->cached_file_entries[ *next_index - 1 ].next_by_path );
+	}
+	next_index = &( file_system->inode_number_hash_buckets[ cached_file_entry->inode_number & (uint32_t) ( file_system->number_of_hash_buckets - 1 ) ] );
+
+	while( *next_index != 0 )
+	{
+		if( *next_index == ( cached_file_entry_index + 1 ) )
+		{
+			*next_index = cached_file_entry->next_by_inode_number;
+
+			break;
+		}
+		next_index = &( file_system->cached_file_entries[ *next_index - 1 ].next_by_inode_number );
+	}
+	if( cached_file_entry->path != NULL )
+	{
+		memory_free(
+		 cached_file_entry->path );
+
+		cached_file_entry->path = NULL;
+	}
+	cached_file_entry->path_length          = 0;
+	cached_file_entry->path_hash            = 0;
+	cached_file_entry->inode_number         = 0;
+	cached_file_entry->next_by_path         = 0;
+	cached_file_entry->next_by_inode_number = 0;
+
+	if( cached_file_entry->fsext_file_entry != NULL )
+	{
+		if( libfsext_file_entry_free(
+		     &( cached_file_entry->fsext_file_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cached file entry: %d.",
+			 function,
+			 cached_file_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the file entry of a specific path from the file entries cache
+ * The file entry is looked up by path and otherwise by inode number, so that
+ * hard links share the same cached file entry. The file entry must be
+ * released with mount_file_system_release_cached_file_entry
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_file_system_get_cached_file_entry_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     libfsext_file_entry_t **fsext_file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_file_entry_t *safe_file_entry       = NULL;
+	mount_cached_file_entry_t *cached_file_entry = NULL;
+	static char *function                        = "mount_file_system_get_cached_file_entry_by_path";
+	uint32_t bucket_mask                         = 0;
+	uint32_t inode_number                        = 0;
+	uint32_t path_hash                           = 0;
+	int cached_file_entry_index                  = 0;
+	int hash_chain_index                         = 0;
+	int result                                   = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsext_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->maximum_number_of_cached_file_entries == 0 )
+	{
+		return( mount_file_system_get_file_entry_by_path(
+		         file_system,
+		         path,
+		         path_length,
+		         fsext_file_entry,
+		         error ) );
+	}
+	if( file_system->cached_file_entries == NULL )
+	{
+		if( mount_file_system_allocate_file_entries_cache(
+		     file_system,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate file entries cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	bucket_mask = (uint32_t) ( file_system->number_of_hash_buckets - 1 );
+
+	path_hash = mount_file_system_get_path_hash(
+	             path,
+	             path_length );
+
+	hash_chain_index = file_system->path_hash_buckets[ path_hash & bucket_mask ];
+
+	while( hash_chain_index != 0 )
+	{
+		cached_file_entry_index = hash_chain_index - 1;
+
+		cached_file_entry = &( file_system->cached_file_entries[ cached_file_entry_index ] );
+
+		if( ( cached_file_entry->path_hash == path_hash )
+		 && ( cached_file_entry->path_length == path_length )
+		 && ( system_string_compare(
+		       cached_file_entry->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			break;
+		}
+		hash_chain_index = cached_file_entry->next_by_path;
+	}
+	if( hash_chain_index == 0 )
+	{
+		result = mount_file_system_get_file_entry_by_path(
+		          file_system,
+		          path,
+		          path_length,
+		          &safe_file_entry,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		if( libfsext_file_entry_get_inode_number(
+		     safe_file_entry,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number.",
+			 function );
+
+			goto on_error;
+		}
+		hash_chain_index = file_system->inode_number_hash_buckets[ inode_number & bucket_mask ];
+
+		while( hash_chain_index != 0 )
+		{
+			cached_file_entry_index = hash_chain_index - 1;
+
+			cached_file_entry = &( file_system->cached_file_entries[ cached_file_entry_index ] );
+
+			if( cached_file_entry->inode_number == inode_number )
+			{
+				break;
+			}
+			hash_chain_index = cached_file_entry->next_by_inode_number;
+		}
+		if( hash_chain_index != 0 )
+		{
+			if( libfsext_file_entry_free(
+			     &safe_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( hash_chain_index != 0 )
+	{
+		/* A cached file entry that is referenced is no longer part of the least recently used list
+		 */
+		if( cached_file_entry->number_of_references == 0 )
+		{
+			mount_file_system_remove_unused_cached_file_entry(
+			 file_system,
+			 cached_file_entry_index );
+		}
+		cached_file_entry->number_of_references += 1;
+
+		*fsext_file_entry = cached_file_entry->fsext_file_entry;
+
+		return( 1 );
+	}
+	/* Use an unused cached file entry or otherwise replace the least recently used unreferenced
+	 * cached file entry. If all cached file entries are referenced the file entry is not cached
+	 * and is freed when released
+	 */
+	if( file_system->number_of_cached_file_entries < file_system->maximum_number_of_cached_file_entries )
+	{
+		cached_file_entry_index = file_system->number_of_cached_file_entries;
+
+		file_system->number_of_cached_file_entries += 1;
+	}
+	else if( file_system->last_unused != 0 )
+	{
+		cached_file_entry_index = file_system->last_unused - 1;
+
+		if( mount_file_system_remove_cached_file_entry(
+		     file_system,
+		     cached_file_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used cached file entry: %d.",
+			 function,
+			 cached_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		*fsext_file_entry = safe_file_entry;
+
+		return( 1 );
+	}
+	cached_file_entry = &( file_system->cached_file_entries[ cached_file_entry_index ] );
+
+	cached_file_entry->path = system_string_allocate(
+	                           path_length + 1 );
+
+	if( cached_file_entry->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     cached_file_entry->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		memory_free(
+		 cached_file_entry->path );
+
+		cached_file_entry->path = NULL;
+
+		goto on_error;
+	}
+	cached_file_entry->path[ path_length ] = 0;
+
+	cached_file_entry->path_length          = path_length;
+	cached_file_entry->path_hash            = path_hash;
+	cached_file_entry->inode_number         = inode_number;
+	cached_file_entry->fsext_file_entry     = safe_file_entry;
+	cached_file_entry->number_of_references = 1;
+	cached_file_entry->next_by_path         = file_system->path_hash_buckets[ path_hash & bucket_mask ];
+	cached_file_entry->next_by_inode_number = file_system->inode_number_hash_buckets[ inode_number & bucket_mask ];
+
+	file_system->path_hash_buckets[ path_hash & bucket_mask ]            = cached_file_entry_index + 1;
+	file_system->inode_number_hash_buckets[ inode_number & bucket_mask ] = cached_file_entry_index + 1;
+
+	*fsext_file_entry = safe_file_entry;
+
+	return( 1 );
+
+on_error:
+	if( safe_file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &safe_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases a file entry retrieved from the file entries cache
+ * A cached file entry that is no longer referenced becomes the most recently used
+ * entry of the least recently used list. The file entry is freed if it is not
+ * stored in the file entries cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_release_cached_file_entry(
+     mount_file_system_t *file_system,
+     libfsext_file_entry_t **fsext_file_entry,
+     libcerror_error_t **error )
+{
+	mount_cached_file_entry_t *cached_file_entry = NULL;
+	static char *function                        = "mount_file_system_release_cached_file_entry";
+	uint32_t inode_number                        = 0;
+	int cached_file_entry_index                  = 0;
+	int hash_chain_index                         = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsext_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *fsext_file_entry == NULL )
+	{
+		return( 1 );
+	}
+	if( file_system->cached_file_entries != NULL )
+	{
+		if( libfsext_file_entry_get_inode_number(
+		     *fsext_file_entry,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number.",
+			 function );
+
+			return( -1 );
+		}
+		hash_chain_index = file_system->inode_number_hash_buckets[ inode_number & (uint32_t) ( file_system->number_of_hash_buckets - 1 ) ];
+
+		while( hash_chain_index != 0 )
+		{
+			cached_file_entry_index = hash_chain_index - 1;
+
+			cached_file_entry = &( file_system->cached_file_entries[ cached_file_entry_index ] );
+
+			if( cached_file_entry->fsext_file_entry == *fsext_file_entry )
+			{
+				if( cached_file_entry->number_of_references > 0 )
+				{
+					cached_file_entry->number_of_references -= 1;
+
+					if( cached_file_entry->number_of_references == 0 )
+					{
+						cached_file_entry->previous_unused = 0;
+						cached_file_entry->next_unused     = file_system->first_unused;
+
+						if( file_system->first_unused == 0 )
+						{
+							file_system->last_unused = cached_file_entry_index + 1;
+						}
+						else
+						{
+							file_system->cached_file_entries[ file_system->first_unused - 1 ].previous_unused = cached_file_entry_index + 1;
+						}
+						file_system->first_unused = cached_file_entry_index + 1;
+					}
+				}
+				*fsext_file_entry = NULL;
+
+				return( 1 );
+			}
+			hash_chain_index = cached_file_entry->next_by_inode_number;
+		}
+	}
+	if( libfsext_file_entry_free(
+	     fsext_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the filename from an file entry
  * Returns 1 if successful or -1 on error
  */
@@ -32,6 +32,59 @@
 extern "C" {
 #endif
 
+/* The default maximum number of cached file entries
+ */
+#define MOUNT_FILE_SYSTEM_DEFAULT_MAXIMUM_NUMBER_OF_CACHED_FILE_ENTRIES	256
+
+/* The maximum number of cached file entries
+ */
+#define MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_CACHED_FILE_ENTRIES		65536
+
+typedef struct mount_cached_file_entry mount_cached_file_entry_t;
+
+struct mount_cached_file_entry
+{
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The path hash
+	 */
+	uint32_t path_hash;
+
+	/* The inode number
+	 */
+	uint32_t inode_number;
+
+	/* The file entry
+	 */
+	libfsext_file_entry_t *fsext_file_entry;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+	/* The index + 1 of the next cached file entry with the same path hash bucket or 0 if last
+	 */
+	int next_by_path;
+
+	/* The index + 1 of the next cached file entry with the same inode number hash bucket or 0 if last
+	 */
+	int next_by_inode_number;
+
+	/* The index + 1 of the previous cached file entry in the least recently used list or 0 if first
+	 */
+	int previous_unused;
+
+	/* The index + 1 of the next cached file entry in the least recently used list or 0 if last
+	 */
+	int next_unused;
+};
+
 typedef struct mount_file_system mount_file_system_t;
 
 struct mount_file_system
@@ -43,6 +96,40 @@ struct mount_file_system
 	/* The volume
 	 */
 	libfsext_volume_t *fsext_volume;
+
+	/* The cached file entries
+	 */
+	mount_cached_file_entry_t *cached_file_entries;
+
+	/* The number of cached file entries
+	 */
+	int number_of_cached_file_entries;
+
+	/* The maximum number of cached file entries
+	 */
+	int maximum_number_of_cached_file_entries;
+
+	/* The path hash buckets
+	 * Contains per bucket the index + 1 of the first cached file entry or 0 if the bucket is empty
+	 */
+	int *path_hash_buckets;
+
+	/* The inode number hash buckets
+	 * Contains per bucket the index + 1 of the first cached file entry or 0 if the bucket is empty
+	 */
+	int *inode_number_hash_buckets;
+
+	/* The number of hash buckets
+	 */
+	int number_of_hash_buckets;
+
+	/* The index + 1 of the most recently released unreferenced cached file entry or 0 if none
+	 */
+	int first_unused;
+
+	/* The index + 1 of the least recently released unreferenced cached file entry or 0 if none
+	 */
+	int last_unused;
 };
 
 int mount_file_system_initialize(
@@ -57,6 +144,15 @@ int mount_file_system_signal_abort(
      mount_file_system_t *file_system,
      libcerror_error_t **error );
 
+int mount_file_system_empty_file_entries_cache(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error );
+
+int mount_file_system_set_maximum_number_of_cached_file_entries(
+     mount_file_system_t *file_system,
+     int maximum_number_of_cached_file_entries,
+     libcerror_error_t **error );
+
 int mount_file_system_set_volume(
      mount_file_system_t *file_system,
      libfsext_volume_t *fsext_volume,
@@ -79,6 +175,35 @@ int mount_file_system_get_file_entry_by_path(
      libfsext_file_entry_t **fsext_file_entry,
      libcerror_error_t **error );
 
+uint32_t mount_file_system_get_path_hash(
+          const system_character_t *path,
+          size_t path_length );
+
+int mount_file_system_allocate_file_entries_cache(
+     mount_file_system_t *file_system,
+     libcerror_error_t **error );
+
+void mount_file_system_remove_unused_cached_file_entry(
+      mount_file_system_t *file_system,
+      int cached_file_entry_index );
+
+int mount_file_system_remove_cached_file_entry(
+     mount_file_system_t *file_system,
+     int cached_file_entry_index,
+     libcerror_error_t **error );
+
+int mount_file_system_get_cached_file_entry_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     libfsext_file_entry_t **fsext_file_entry,
+     libcerror_error_t **error );
+
+int mount_file_system_release_cached_file_entry(
+     mount_file_system_t *file_system,
+     libfsext_file_entry_t **fsext_file_entry,
+     libcerror_error_t **error );
+
 int mount_file_system_get_filename_from_file_entry(
      mount_file_system_t *file_system,
      libfsext_file_entry_t *fsext_file_entry,
@@ -153,6 +153,8 @@ int mount_fuse_set_stat_info(
 }
 
 /* Fills a directory entry
+ * If MOUNT_FUSE_FILLDIR_FLAG_STAT_INFO is set the full stat info is provided
+ * otherwise only the file mode, which is needed for the directory entry type
  * Returns 1 if successful or -1 on error
  */
 int mount_fuse_filldir(
@@ -161,6 +163,7 @@ int mount_fuse_filldir(
      const char *name,
      mount_fuse_stat_t *stat_info,
      mount_file_entry_t *file_entry,
+     uint8_t filldir_flags,
      libcerror_error_t **error )
 {
 	static char *function      = "mount_fuse_filldir";
@@ -170,6 +173,10 @@ int mount_fuse_filldir(
 	uint64_t modification_time = 0;
 	uint16_t file_mode         = 0;
 
+#if defined( HAVE_LIBFUSE3 )
+	enum fuse_fill_dir_flags fill_dir_flags = 0;
+#endif
+
 	if( filler == NULL )
 	{
 		libcerror_error_set(
@@ -183,30 +190,34 @@ int mount_fuse_filldir(
 	}
 	if( file_entry != NULL )
 	{
-		if( mount_file_entry_get_size(
+		if( mount_file_entry_get_file_mode(
 		     file_entry,
-		     &file_size,
+		     &file_mode,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry size.",
+			 "%s: unable to retrieve file mode.",
 			 function );
 
 			return( -1 );
 		}
-		if( mount_file_entry_get_file_mode(
+	}
+	if( ( file_entry != NULL )
+	 && ( ( filldir_flags & MOUNT_FUSE_FILLDIR_FLAG_STAT_INFO ) != 0 ) )
+	{
+		if( mount_file_entry_get_size(
 		     file_entry,
-		     &file_mode,
+		     &file_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file mode.",
+			 "%s: unable to retrieve file entry size.",
 			 function );
 
 			return( -1 );
@@ -287,12 +298,20 @@ int mount_fuse_filldir(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFUSE3 )
+	/* Only pass the stat info as attributes of the directory entry
+	 * when it is complete, otherwise fuse would cache incomplete attributes
+	 */
+	if( ( file_entry != NULL )
+	 && ( ( filldir_flags & MOUNT_FUSE_FILLDIR_FLAG_STAT_INFO ) != 0 ) )
+	{
+		fill_dir_flags = FUSE_FILL_DIR_PLUS;
+	}
 	if( filler(
 	     buffer,
 	     name,
 	     stat_info,
 	     0,
-	     0 ) == 1 )
+	     fill_dir_flags ) == 1 )
 #else
 	if( filler(
 	     buffer,
@@ -403,6 +422,15 @@ int mount_fuse_open(
 
 		goto on_error;
 	}
+	/* The volume is immutable while mounted so the kernel page cache
+	 * does not need to be invalidated when the file is opened again,
+	 * unless caching was disabled with a cache timeout of 0
+	 */
+	if( fsextmount_mount_handle->cache_timeout != 0 )
+	{
+		file_info->keep_cache = 1;
+	}
+
 	return( 0 );
 
 on_error:
@@ -1198,15 +1226,15 @@ int mount_fuse_readdir(
      void *buffer,
      mount_fuse_fill_dir_t filler,
      off_t offset FSEXTTOOLS_ATTRIBUTE_UNUSED,
-     struct fuse_file_info *file_info FSEXTTOOLS_ATTRIBUTE_UNUSED,
-     enum fuse_readdir_flags flags FSEXTTOOLS_ATTRIBUTE_UNUSED )
+     struct fuse_file_info *file_info,
+     enum fuse_readdir_flags flags )
 #else
 int mount_fuse_readdir(
      const char *path,
      void *buffer,
      mount_fuse_fill_dir_t filler,
      off_t offset FSEXTTOOLS_ATTRIBUTE_UNUSED,
-     struct fuse_file_info *file_info FSEXTTOOLS_ATTRIBUTE_UNUSED )
+     struct fuse_file_info *file_info )
 #endif
 {
 	mount_fuse_stat_t *stat_info       = NULL;
@@ -1218,13 +1246,10 @@ int mount_fuse_readdir(
 	int number_of_sub_file_entries     = 0;
 	int result                         = 0;
 	int sub_file_entry_index           = 0;
+	uint8_t filldir_flags              = 0;
 
 	FSEXTTOOLS_UNREFERENCED_PARAMETER( offset )
 
-#if defined( HAVE_LIBFUSE3 )
-	FSEXTTOOLS_UNREFERENCED_PARAMETER( flags )
-#endif
-
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1273,6 +1298,17 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFUSE3 )
+	/* With readdirplus the kernel uses the stat info of the directory entries
+	 * instead of requesting the attributes of every entry separately
+	 */
+	if( ( flags & FUSE_READDIR_PLUS ) != 0 )
+	{
+		filldir_flags = MOUNT_FUSE_FILLDIR_FLAG_STAT_INFO;
+	}
+#else
+	filldir_flags = MOUNT_FUSE_FILLDIR_FLAG_STAT_INFO;
+#endif
 	stat_info = memory_allocate_structure(
 	             mount_fuse_stat_t );
 
@@ -1295,6 +1331,7 @@ int mount_fuse_readdir(
 	     ".",
 	     stat_info,
 	     (mount_file_entry_t *) file_info->fh,
+	     filldir_flags,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1314,6 +1351,7 @@ int mount_fuse_readdir(
 	     "..",
 	     stat_info,
 	     NULL,
+	     0,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1422,6 +1460,7 @@ int mount_fuse_readdir(
 		     name,
 		     stat_info,
 		     sub_file_entry,
+		     filldir_flags,
 		     &error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1537,7 +1576,21 @@ int mount_fuse_releasedir(
 	}
 	if( file_info->fh != (uint64_t) NULL )
 	{
-		file_info->fh = (uint64_t) NULL;
+		if( mount_file_entry_free(
+		     (mount_file_entry_t **) &( file_info->fh ),
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			result = -ENOENT;
+
+			goto on_error;
+		}
 	}
 	return( 0 );
 
@@ -1899,6 +1952,73 @@ on_error:
 	return( result );
 }
 
+/* Initializes the fuse connection
+ * Returns the private data of the fuse context
+ */
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration FSEXTTOOLS_ATTRIBUTE_UNUSED )
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information )
+#endif
+{
+	struct fuse_context *fuse_context = NULL;
+	static char *function             = "mount_fuse_init";
+
+#if defined( HAVE_LIBFUSE3 )
+	FSEXTTOOLS_UNREFERENCED_PARAMETER( configuration )
+#endif
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s\n",
+		 function );
+	}
+#endif
+	if( ( connection_information != NULL )
+	 && ( fsextmount_mount_handle != NULL ) )
+	{
+#if defined( HAVE_LIBFUSE3 ) && !defined( __APPLE__ )
+		connection_information->max_read = fsextmount_mount_handle->maximum_read_size;
+#endif
+		if( connection_information->max_readahead > fsextmount_mount_handle->maximum_read_size )
+		{
+			connection_information->max_readahead = fsextmount_mount_handle->maximum_read_size;
+		}
+		/* Read replies are written to the fuse device hence splice write
+		 */
+#if defined( FUSE_CAP_SPLICE_WRITE )
+		if( ( connection_information->capable & FUSE_CAP_SPLICE_WRITE ) != 0 )
+		{
+			connection_information->want |= FUSE_CAP_SPLICE_WRITE;
+		}
+#endif
+#if defined( FUSE_CAP_SPLICE_MOVE )
+		if( ( connection_information->capable & FUSE_CAP_SPLICE_MOVE ) != 0 )
+		{
+			connection_information->want |= FUSE_CAP_SPLICE_MOVE;
+		}
+#endif
+#if defined( HAVE_LIBFUSE3 ) && defined( FUSE_CAP_READDIRPLUS )
+		if( ( connection_information->capable & FUSE_CAP_READDIRPLUS ) != 0 )
+		{
+			connection_information->want |= FUSE_CAP_READDIRPLUS;
+		}
+#endif
+	}
+	fuse_context = fuse_get_context();
+
+	if( fuse_context == NULL )
+	{
+		return( NULL );
+	}
+	return( fuse_context->private_data );
+}
+
 /* Cleans up when fuse is done
  */
 void mount_fuse_destroy(
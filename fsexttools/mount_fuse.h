@@ -72,6 +72,10 @@ typedef struct stat mount_fuse_stat_t;
 #define mount_fuse_fill_dir_t fuse_fill_dir_t
 #endif
 
+/* The fill directory entry flags
+ */
+#define MOUNT_FUSE_FILLDIR_FLAG_STAT_INFO	0x01
+
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 
 int mount_fuse_set_stat_info(
@@ -89,6 +93,7 @@ int mount_fuse_filldir(
      const char *name,
      mount_fuse_stat_t *stat_info,
      mount_file_entry_t *file_entry,
+     uint8_t filldir_flags,
      libcerror_error_t **error );
 
 int mount_fuse_open(
@@ -167,6 +172,15 @@ int mount_fuse_readlink(
      char *buffer,
      size_t size );
 
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration );
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information );
+#endif
+
 void mount_fuse_destroy(
       void *private_data );
 
@@ -215,6 +215,9 @@ int mount_handle_initialize(
 
 		goto on_error;
 	}
+	( *mount_handle )->cache_timeout     = MOUNT_HANDLE_DEFAULT_CACHE_TIMEOUT;
+	( *mount_handle )->maximum_read_size = MOUNT_HANDLE_DEFAULT_MAXIMUM_READ_SIZE;
+
 	if( mount_file_system_initialize(
 	     &( ( *mount_handle )->file_system ),
 	     error ) != 1 )
@@ -367,6 +370,190 @@ int mount_handle_set_offset(
 	return( 1 );
 }
 
+/* Sets the kernel entry and attribute cache timeout
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_cache_timeout(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_cache_timeout";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( mount_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache timeout value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->cache_timeout = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the maximum read size
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_maximum_read_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_maximum_read_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( mount_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit < 4096 )
+	 || ( value_64bit > (uint64_t) INT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->maximum_read_size = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of cached file entries
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_maximum_number_of_cached_file_entries(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_maximum_number_of_cached_file_entries";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( mount_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_CACHED_FILE_ENTRIES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of cached file entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_set_maximum_number_of_cached_file_entries(
+	     mount_handle->file_system,
+	     (int) value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of cached file entries in file system.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Opens the mount handle
  * Returns 1 if successful, 0 if not or -1 on error
  */
@@ -716,7 +903,7 @@ int mount_handle_get_file_entry_by_path(
 		filename        = &( path[ path_index + 1 ] );
 		filename_length = path_length - ( path_index + 1 );
 	}
-	result = mount_file_system_get_file_entry_by_path(
+	result = mount_file_system_get_cached_file_entry_by_path(
 	          mount_handle->file_system,
 	          path,
 	          path_length,
@@ -753,13 +940,15 @@ int mount_handle_get_file_entry_by_path(
 
 			goto on_error;
 		}
+		( *file_entry )->is_cached = 1;
 	}
 	return( result );
 
 on_error:
 	if( fsext_file_entry != NULL )
 	{
-		libfsext_file_entry_free(
+		mount_file_system_release_cached_file_entry(
+		 mount_handle->file_system,
 		 &fsext_file_entry,
 		 NULL );
 	}
@@ -36,6 +36,14 @@
 extern "C" {
 #endif
 
+/* The default kernel entry and attribute cache timeout in seconds
+ */
+#define MOUNT_HANDLE_DEFAULT_CACHE_TIMEOUT	3600
+
+/* The default maximum read size in bytes
+ */
+#define MOUNT_HANDLE_DEFAULT_MAXIMUM_READ_SIZE	1048576
+
 typedef struct mount_handle mount_handle_t;
 
 struct mount_handle
@@ -48,6 +56,14 @@ struct mount_handle
 	 */
 	off64_t volume_offset;
 
+	/* The kernel entry and attribute cache timeout in seconds
+	 */
+	uint32_t cache_timeout;
+
+	/* The maximum read size in bytes
+	 */
+	uint32_t maximum_read_size;
+
 	/* The libbfio file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -80,6 +96,21 @@ int mount_handle_set_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int mount_handle_set_cache_timeout(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_set_maximum_read_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_set_maximum_number_of_cached_file_entries(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int mount_handle_open(
      mount_handle_t *mount_handle,
      const system_character_t *filename,
@@ -0,0 +1,240 @@
+/*
+ * The journal (jbd2) of an Extended File System
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSEXT_JOURNAL_H )
+#define _FSEXT_JOURNAL_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsext_journal_block_header fsext_journal_block_header_t;
+
+struct fsext_journal_block_header
+{
+	/* Signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* Block type
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_type[ 4 ];
+
+	/* Transaction sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+};
+
+typedef struct fsext_journal_superblock fsext_journal_superblock_t;
+
+struct fsext_journal_superblock
+{
+	/* Signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* Block type
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_type[ 4 ];
+
+	/* Transaction sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+
+	/* Block size
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_size[ 4 ];
+
+	/* Number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_blocks[ 4 ];
+
+	/* First log block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_log_block_number[ 4 ];
+
+	/* First transaction sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_sequence_number[ 4 ];
+
+	/* Start log block number
+	 * Contains 0 if the journal is clean
+	 * Consists of 4 bytes
+	 */
+	uint8_t start_log_block_number[ 4 ];
+
+	/* Error value
+	 * Consists of 4 bytes
+	 */
+	uint8_t error_value[ 4 ];
+
+	/* Compatible features flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t compatible_features_flags[ 4 ];
+
+	/* Incompatible features flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t incompatible_features_flags[ 4 ];
+
+	/* Read-only compatible features flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t read_only_compatible_features_flags[ 4 ];
+
+	/* Journal identifier
+	 * Consists of 16 bytes
+	 */
+	uint8_t journal_identifier[ 16 ];
+
+	/* Number of users
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_users[ 4 ];
+
+	/* Dynamic superblock block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t dynamic_superblock_block_number[ 4 ];
+
+	/* Maximum number of blocks per transaction
+	 * Consists of 4 bytes
+	 */
+	uint8_t maximum_transaction_size[ 4 ];
+
+	/* Maximum number of data blocks per transaction
+	 * Consists of 4 bytes
+	 */
+	uint8_t maximum_transaction_data_size[ 4 ];
+
+	/* Checksum type
+	 * Consists of 1 bytes
+	 */
+	uint8_t checksum_type[ 1 ];
+
+	/* Unknown (padding)
+	 * Consists of 3 bytes
+	 */
+	uint8_t unknown1[ 3 ];
+
+	/* Number of fast commit blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_fast_commit_blocks[ 4 ];
+};
+
+typedef struct fsext_journal_block_tag fsext_journal_block_tag_t;
+
+struct fsext_journal_block_tag
+{
+	/* Block number (lower 32-bit)
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_number_lower[ 4 ];
+
+	/* Checksum
+	 * Consists of 2 bytes
+	 */
+	uint8_t checksum[ 2 ];
+
+	/* Flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t flags[ 2 ];
+
+	/* Block number (upper 32-bit)
+	 * Only present if the 64-bit feature is set
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_number_upper[ 4 ];
+};
+
+typedef struct fsext_journal_block_tag3 fsext_journal_block_tag3_t;
+
+struct fsext_journal_block_tag3
+{
+	/* Block number (lower 32-bit)
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_number_lower[ 4 ];
+
+	/* Flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* Block number (upper 32-bit)
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_number_upper[ 4 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct fsext_journal_revoke_header fsext_journal_revoke_header_t;
+
+struct fsext_journal_revoke_header
+{
+	/* Signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* Block type
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_type[ 4 ];
+
+	/* Transaction sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+
+	/* Number of bytes used
+	 * Includes the size of the header
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_bytes_used[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSEXT_JOURNAL_H ) */
+
@@ -0,0 +1,330 @@
+/*
+ * Metadata index file of an Extended File System
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSEXT_METADATA_INDEX_H )
+#define _FSEXT_METADATA_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The metadata index file is not part of the file system but a sidecar
+ * file written by libfsext. All values are stored in little-endian and
+ * all sections start at an 8-byte aligned offset so that the file can be
+ * used as-is when mapped into memory.
+ *
+ * The file consists of:
+ * file header
+ * group descriptors
+ * tree entries, sorted by parent inode number and name
+ * stat records, sorted by inode number
+ * names
+ */
+
+typedef struct fsext_metadata_index_file_header fsext_metadata_index_file_header_t;
+
+struct fsext_metadata_index_file_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "fsextidx"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_size[ 4 ];
+
+	/* File size
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* File system identifier
+	 * Consists of 16 bytes
+	 * Contains a copy of the superblock file system identifier
+	 */
+	uint8_t file_system_identifier[ 16 ];
+
+	/* Last written time
+	 * Consists of 4 bytes
+	 * Contains a copy of the superblock last written time
+	 */
+	uint8_t last_written_time[ 4 ];
+
+	/* Number of inodes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_inodes[ 4 ];
+
+	/* Number of block groups
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_block_groups[ 4 ];
+
+	/* Block size
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_size[ 4 ];
+
+	/* Group descriptors offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t group_descriptors_offset[ 8 ];
+
+	/* Number of group descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_group_descriptors[ 4 ];
+
+	/* Number of tree entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_tree_entries[ 4 ];
+
+	/* Tree entries offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t tree_entries_offset[ 8 ];
+
+	/* Names offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t names_offset[ 8 ];
+
+	/* Names size
+	 * Consists of 8 bytes
+	 */
+	uint8_t names_size[ 8 ];
+
+	/* Stat records offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t stat_records_offset[ 8 ];
+
+	/* Number of stat records
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_stat_records[ 4 ];
+
+	/* Padding
+	 * Consists of 16 bytes
+	 */
+	uint8_t padding1[ 16 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a CRC-32 of the file excluding the checksum
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct fsext_metadata_index_group_descriptor fsext_metadata_index_group_descriptor_t;
+
+struct fsext_metadata_index_group_descriptor
+{
+	/* Group number
+	 * Consists of 4 bytes
+	 */
+	uint8_t group_number[ 4 ];
+
+	/* Block group flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t block_group_flags[ 2 ];
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding1[ 2 ];
+
+	/* Block bitmap block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t block_bitmap_block_number[ 8 ];
+
+	/* Inode bitmap block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t inode_bitmap_block_number[ 8 ];
+
+	/* Inode table block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t inode_table_block_number[ 8 ];
+
+	/* Exclude bitmap block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t exclude_bitmap_block_number[ 8 ];
+
+	/* Number of unallocated blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unallocated_blocks[ 4 ];
+
+	/* Number of unallocated inodes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unallocated_inodes[ 4 ];
+
+	/* Number of directories
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_directories[ 4 ];
+
+	/* Number of unused inodes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unused_inodes[ 4 ];
+
+	/* Block bitmap checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_bitmap_checksum[ 4 ];
+
+	/* Inode bitmap checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t inode_bitmap_checksum[ 4 ];
+};
+
+typedef struct fsext_metadata_index_tree_entry fsext_metadata_index_tree_entry_t;
+
+struct fsext_metadata_index_tree_entry
+{
+	/* Parent inode number
+	 * Consists of 4 bytes
+	 */
+	uint8_t parent_inode_number[ 4 ];
+
+	/* Inode number
+	 * Consists of 4 bytes
+	 */
+	uint8_t inode_number[ 4 ];
+
+	/* Name offset
+	 * Consists of 4 bytes
+	 * The offset is relative to the start of the names
+	 */
+	uint8_t name_offset[ 4 ];
+
+	/* Name size
+	 * Consists of 1 byte
+	 * The name is not terminated by an end-of-string character
+	 */
+	uint8_t name_size;
+
+	/* File type
+	 * Consists of 1 byte
+	 */
+	uint8_t file_type;
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding1[ 2 ];
+};
+
+typedef struct fsext_metadata_index_stat_record fsext_metadata_index_stat_record_t;
+
+struct fsext_metadata_index_stat_record
+{
+	/* Inode number
+	 * Consists of 4 bytes
+	 */
+	uint8_t inode_number[ 4 ];
+
+	/* File mode
+	 * Consists of 2 bytes
+	 */
+	uint8_t file_mode[ 2 ];
+
+	/* Number of links
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_links[ 2 ];
+
+	/* Owner identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t owner_identifier[ 4 ];
+
+	/* Group identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t group_identifier[ 4 ];
+
+	/* Data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* Access time
+	 * Consists of 8 bytes
+	 * Contains a POSIX timestamp in number of nanoseconds
+	 */
+	uint8_t access_time[ 8 ];
+
+	/* Modification time
+	 * Consists of 8 bytes
+	 * Contains a POSIX timestamp in number of nanoseconds
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Inode change time
+	 * Consists of 8 bytes
+	 * Contains a POSIX timestamp in number of nanoseconds
+	 */
+	uint8_t inode_change_time[ 8 ];
+
+	/* Creation time
+	 * Consists of 8 bytes
+	 * Contains a POSIX timestamp in number of nanoseconds
+	 */
+	uint8_t creation_time[ 8 ];
+
+	/* Flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSEXT_METADATA_INDEX_H ) */
+
@@ -146,6 +146,309 @@ int libfsext_attribute_values_free(
 	return( 1 );
 }
 
+/* Clones an attribute values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_attribute_values_clone(
+     libfsext_attribute_values_t **destination_attribute_values,
+     libfsext_attribute_values_t *source_attribute_values,
+     libcerror_error_t **error )
+{
+	libfsext_attribute_values_t *safe_attribute_values = NULL;
+	static char *function                              = "libfsext_attribute_values_clone";
+
+	if( destination_attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_attribute_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination attribute values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_attribute_values == NULL )
+	{
+		*destination_attribute_values = source_attribute_values;
+
+		return( 1 );
+	}
+	safe_attribute_values = memory_allocate_structure(
+	                         libfsext_attribute_values_t );
+
+	if( safe_attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination attribute values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_attribute_values,
+	     source_attribute_values,
+	     sizeof( libfsext_attribute_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination attribute values.",
+		 function );
+
+		memory_free(
+		 safe_attribute_values );
+
+		return( -1 );
+	}
+	safe_attribute_values->name       = NULL;
+	safe_attribute_values->value_data = NULL;
+
+	if( source_attribute_values->name != NULL )
+	{
+		safe_attribute_values->name = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * source_attribute_values->name_size );
+
+		if( safe_attribute_values->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_attribute_values->name,
+		     source_attribute_values->name,
+		     source_attribute_values->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( source_attribute_values->value_data != NULL )
+	{
+		safe_attribute_values->value_data = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * source_attribute_values->value_data_size );
+
+		if( safe_attribute_values->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_attribute_values->value_data,
+		     source_attribute_values->value_data,
+		     (size_t) source_attribute_values->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination value data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*destination_attribute_values = safe_attribute_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_attribute_values != NULL )
+	{
+		libfsext_attribute_values_free(
+		 &safe_attribute_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Calculates the name hash of an UTF-8 encoded name
+ * The hash is calculated over the Unicode characters of the name so that
+ * the hash of an UTF-8 and UTF-16 encoded name are the same
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_attribute_values_calculate_utf8_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsext_attribute_values_calculate_utf8_name_hash";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_name_hash                      = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash = ( safe_name_hash << 5 ) ^ ( safe_name_hash >> 27 ) ^ (uint32_t) unicode_character;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the name hash of an UTF-16 encoded name
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_attribute_values_calculate_utf16_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsext_attribute_values_calculate_utf16_name_hash";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_name_hash                      = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) ( SSIZE_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash = ( safe_name_hash << 5 ) ^ ( safe_name_hash >> 27 ) ^ (uint32_t) unicode_character;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
 /* Reads the attribute values data
  * Returns 1 if successful or -1 on error
  */
@@ -390,6 +693,22 @@ int libfsext_attribute_values_read_data(
 		}
 		( attribute_values->name )[ attribute_values->name_size - 1 ] = 0;
 
+		if( libfsext_attribute_values_calculate_utf8_name_hash(
+		     attribute_values->name,
+		     attribute_values->name_size - 1,
+		     &( attribute_values->name_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate name hash.",
+			 function );
+
+			goto on_error;
+		}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -432,6 +751,7 @@ on_error:
 		attribute_values->name = NULL;
 	}
 	attribute_values->name_size = 0;
+	attribute_values->name_hash = 0;
 
 	return( -1 );
 }
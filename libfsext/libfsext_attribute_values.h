@@ -43,6 +43,10 @@ struct libfsext_attribute_values
 	 */
 	size_t name_size;
 
+	/* Name hash
+	 */
+	uint32_t name_hash;
+
 	/* Value data inode number
 	 */
 	uint32_t value_data_inode_number;
@@ -68,6 +72,23 @@ int libfsext_attribute_values_free(
      libfsext_attribute_values_t **attribute_values,
      libcerror_error_t **error );
 
+int libfsext_attribute_values_clone(
+     libfsext_attribute_values_t **destination_attribute_values,
+     libfsext_attribute_values_t *source_attribute_values,
+     libcerror_error_t **error );
+
+int libfsext_attribute_values_calculate_utf8_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libfsext_attribute_values_calculate_utf16_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
 int libfsext_attribute_values_read_data(
      libfsext_attribute_values_t *attribute_values,
      const uint8_t *data,
@@ -32,6 +32,7 @@
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libcnotify.h"
+#include "libfsext_libfcache.h"
 
 #include "fsext_attributes.h"
 
@@ -454,7 +455,7 @@ int libfsext_attributes_block_read_file_io_handle(
 {
 	uint8_t *data         = NULL;
 	static char *function = "libfsext_attributes_block_read_file_io_handle";
-	ssize_t read_count    = 0;
+	int result            = 0;
 
 	if( io_handle == NULL )
 	{
@@ -503,14 +504,31 @@ int libfsext_attributes_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              data,
-	              (size_t) io_handle->block_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->block_size )
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+	 0,
+	 file_offset,
+	 io_handle->block_size );
+
+	result = libfsext_io_handle_read_metadata_at_offset(
+	          io_handle,
+	          file_io_handle,
+	          data,
+	          (size_t) io_handle->block_size,
+	          file_offset,
+	          error );
+
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 0,
+	 file_offset,
+	 io_handle->block_size );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -523,6 +541,11 @@ int libfsext_attributes_block_read_file_io_handle(
 
 		goto on_error;
 	}
+	libfsext_io_handle_update_read_statistics(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_EXTENDED_ATTRIBUTES_NUMBER_OF_READS,
+	 (size_t) io_handle->block_size );
+
 	if( libfsext_attributes_block_read_header_data(
 	     io_handle,
 	     data,
@@ -568,3 +591,372 @@ on_error:
 	return( -1 );
 }
 
+/* Frees an extended attributes array
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_attributes_block_free_extended_attributes(
+     libcdata_array_t **extended_attributes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_attributes_block_free_extended_attributes";
+
+	if( libcdata_array_free(
+	     extended_attributes,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_attribute_values_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extended attributes array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the extended attributes of a specific extended attributes block
+ * The extended attributes block is read once and cached, since multiple inodes
+ * can share the same extended attributes block. Copies of the extended attributes
+ * are appended to the extended attributes array.
+ * Any entry of the cache can contain any block, when the block is not cached
+ * it replaces an empty entry or otherwise the least recently used entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_attributes_block_get_extended_attributes(
+     libfcache_cache_t *attributes_blocks_cache,
+     int64_t *cache_timestamp,
+     libfsext_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_number,
+     libcdata_array_t *extended_attributes,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *block_extended_attributes        = NULL;
+	libfcache_cache_value_t *cache_value               = NULL;
+	libfsext_attribute_values_t *attribute_values      = NULL;
+	libfsext_attribute_values_t *attribute_values_copy = NULL;
+	static char *function                              = "libfsext_attributes_block_get_extended_attributes";
+	off64_t block_offset                               = 0;
+	off64_t cache_value_offset                         = 0;
+	int64_t cache_value_timestamp                      = 0;
+	int64_t oldest_cache_value_timestamp               = 0;
+	int attribute_index                                = 0;
+	int cache_entry_index                              = 0;
+	int replace_cache_entry_index                      = -1;
+	int cache_value_file_index                         = 0;
+	int entry_index                                    = 0;
+	int number_of_attributes                           = 0;
+	int number_of_cache_entries                        = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_offset = (off64_t) block_number * io_handle->block_size;
+
+	if( libfcache_cache_get_number_of_entries(
+	     attributes_blocks_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of cache entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cache timestamp is a counter of the number of lookups used to determine
+	 * the least recently used entry
+	 */
+	*cache_timestamp += 1;
+
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libfcache_cache_get_value_by_index(
+		     attributes_blocks_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			goto on_error;
+		}
+		if( cache_value == NULL )
+		{
+			if( ( replace_cache_entry_index == -1 )
+			 || ( oldest_cache_value_timestamp != 0 ) )
+			{
+				replace_cache_entry_index    = cache_entry_index;
+				oldest_cache_value_timestamp = 0;
+			}
+			continue;
+		}
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d identifier.",
+			 function,
+			 cache_entry_index );
+
+			goto on_error;
+		}
+		if( cache_value_offset == block_offset )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &block_extended_attributes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				goto on_error;
+			}
+			if( libfcache_cache_value_set_identifier(
+			     cache_value,
+			     0,
+			     block_offset,
+			     *cache_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set cache value: %d identifier.",
+				 function,
+				 cache_entry_index );
+
+				goto on_error;
+			}
+			break;
+		}
+		if( ( replace_cache_entry_index == -1 )
+		 || ( ( oldest_cache_value_timestamp != 0 )
+		  && ( cache_value_timestamp < oldest_cache_value_timestamp ) ) )
+		{
+			replace_cache_entry_index    = cache_entry_index;
+			oldest_cache_value_timestamp = cache_value_timestamp;
+		}
+	}
+	if( block_extended_attributes != NULL )
+	{
+		libfsext_io_handle_increment_statistics_value(
+		 io_handle,
+		 LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_HITS,
+		 1 );
+	}
+	else
+	{
+		libfsext_io_handle_increment_statistics_value(
+		 io_handle,
+		 LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_MISSES,
+		 1 );
+
+		if( libcdata_array_initialize(
+		     &block_extended_attributes,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block extended attributes array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_attributes_block_read_file_io_handle(
+		     block_extended_attributes,
+		     io_handle,
+		     file_io_handle,
+		     block_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extended attributes block: %" PRIu32 ".",
+			 function,
+			 block_number );
+
+			libfsext_attributes_block_free_extended_attributes(
+			 &block_extended_attributes,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_index(
+		     attributes_blocks_cache,
+		     replace_cache_entry_index,
+		     0,
+		     block_offset,
+		     *cache_timestamp,
+		     (intptr_t *) block_extended_attributes,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_attributes_block_free_extended_attributes,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cache value: %d.",
+			 function,
+			 replace_cache_entry_index );
+
+			libfsext_attributes_block_free_extended_attributes(
+			 &block_extended_attributes,
+			 NULL );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     block_extended_attributes,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from block extended attributes array.",
+		 function );
+
+		goto on_error;
+	}
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     block_extended_attributes,
+		     attribute_index,
+		     (intptr_t **) &attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d values.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( libfsext_attribute_values_clone(
+		     &attribute_values_copy,
+		     attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create attribute: %d values copy.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     extended_attributes,
+		     &entry_index,
+		     (intptr_t *) attribute_values_copy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute: %d values to array.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		attribute_values_copy = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( attribute_values_copy != NULL )
+	{
+		libfsext_attribute_values_free(
+		 &attribute_values_copy,
+		 NULL );
+	}
+	return( -1 );
+}
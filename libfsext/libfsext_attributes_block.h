@@ -29,6 +29,7 @@
 #include "libfsext_libbfio.h"
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
+#include "libfsext_libfcache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -54,6 +55,19 @@ int libfsext_attributes_block_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsext_attributes_block_free_extended_attributes(
+     libcdata_array_t **extended_attributes,
+     libcerror_error_t **error );
+
+int libfsext_attributes_block_get_extended_attributes(
+     libfcache_cache_t *attributes_blocks_cache,
+     int64_t *cache_timestamp,
+     libfsext_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_number,
+     libcdata_array_t *extended_attributes,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,8 @@
 #include <types.h>
 
 #include "libfsext_block_data_handle.h"
+#include "libfsext_definitions.h"
+#include "libfsext_io_handle.h"
 #include "libfsext_libbfio.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libfdata.h"
@@ -34,7 +36,7 @@
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libfsext_block_data_handle_read_segment_data(
-         intptr_t *data_handle LIBFSEXT_ATTRIBUTE_UNUSED,
+         intptr_t *data_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index LIBFSEXT_ATTRIBUTE_UNUSED,
@@ -44,13 +46,21 @@ ssize_t libfsext_block_data_handle_read_segment_data(
          uint8_t read_flags LIBFSEXT_ATTRIBUTE_UNUSED,
          libcerror_error_t **error )
 {
-	static char *function = "libfsext_block_data_handle_read_segment_data";
-	ssize_t read_count    = 0;
+	libfsext_io_handle_t *io_handle = NULL;
+	static char *function           = "libfsext_block_data_handle_read_segment_data";
+	ssize_t read_count              = 0;
+
+#if defined( HAVE_LIBFSEXT_TRACE )
+	off64_t segment_offset          = 0;
+#endif
 
-	LIBFSEXT_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSEXT_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBFSEXT_UNREFERENCED_PARAMETER( read_flags )
 
+	/* The data handle is optional and refers to the IO handle
+	 */
+	io_handle = (libfsext_io_handle_t *) data_handle;
+
 	if( segment_index < 0 )
 	{
 		libcerror_error_set(
@@ -104,12 +114,48 @@ ssize_t libfsext_block_data_handle_read_segment_data(
 	}
 	else
 	{
+#if defined( HAVE_LIBFSEXT_TRACE )
+		if( ( io_handle != NULL )
+		 && ( io_handle->trace_callback != NULL ) )
+		{
+			if( libbfio_handle_get_offset(
+			     file_io_handle,
+			     &segment_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment offset.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+		 0,
+		 segment_offset,
+		 segment_data_size );
+
 		read_count = libbfio_handle_read_buffer(
 		              file_io_handle,
 		              segment_data,
 		              segment_data_size,
 		              error );
 
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_END,
+		 0,
+		 segment_offset,
+		 segment_data_size );
+
 		if( read_count < 0 )
 		{
 			libcerror_error_set(
@@ -121,6 +167,10 @@ ssize_t libfsext_block_data_handle_read_segment_data(
 
 			return( -1 );
 		}
+		libfsext_io_handle_update_read_statistics(
+		 io_handle,
+		 LIBFSEXT_STATISTICS_VALUE_DATA_NUMBER_OF_READS,
+		 (size_t) read_count );
 	}
 	return( read_count );
 }
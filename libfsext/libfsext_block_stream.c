@@ -212,14 +212,14 @@ int libfsext_block_stream_initialize_from_extents(
 	}
 	if( libfdata_stream_initialize(
 	     &safe_data_stream,
-	     NULL,
+	     (intptr_t *) io_handle,
 	     NULL,
 	     NULL,
 	     NULL,
 	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsext_block_data_handle_read_segment_data,
 	     NULL,
 	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsext_block_data_handle_seek_segment_offset,
-	     0,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -243,6 +243,7 @@ int libfsext_block_vector_read_element_data(
 {
 	libfsext_block_t *block = NULL;
 	static char *function   = "libfsext_block_vector_read_element_data";
+	int result              = 0;
 
 	LIBFSEXT_UNREFERENCED_PARAMETER( element_index )
 	LIBFSEXT_UNREFERENCED_PARAMETER( element_data_file_index )
@@ -297,11 +298,31 @@ int libfsext_block_vector_read_element_data(
 
 		goto on_error;
 	}
-	if( libfsext_block_read_file_io_handle(
-	     block,
-	     file_io_handle,
-	     block_offset,
-	     error ) != 1 )
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+	 0,
+	 block_offset,
+	 block_size );
+
+	result = libfsext_io_handle_read_metadata_at_offset(
+	          io_handle,
+	          file_io_handle,
+	          block->data,
+	          block->data_size,
+	          block_offset,
+	          error );
+
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 0,
+	 block_offset,
+	 block_size );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -312,6 +333,16 @@ int libfsext_block_vector_read_element_data(
 
 		goto on_error;
 	}
+	libfsext_io_handle_update_read_statistics(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_DIRECTORY_NUMBER_OF_READS,
+	 (size_t) io_handle->block_size );
+
+	libfsext_io_handle_increment_statistics_value(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_MISSES,
+	 1 );
+
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libfsext_block.h"
@@ -462,18 +463,29 @@ int libfsext_data_blocks_read_data(
      int depth,
      libcerror_error_t **error )
 {
-	libfsext_extent_t *extent           = NULL;
-	libfsext_extent_t *last_extent      = NULL;
-	static char *function               = "libfsext_data_blocks_read_data";
-	size_t data_offset                  = 0;
-	uint32_t extent_number_of_blocks    = 0;
-	uint32_t number_of_blocks_per_block = 0;
-	uint32_t sub_block_number           = 0;
-	uint32_t sub_logical_block_number   = 0;
-	uint8_t create_new_extent           = 0;
-	uint8_t extend_last_extent          = 0;
-	int depth_iterator                  = 0;
-	int entry_index                     = 0;
+	libfsext_data_blocks_indirect_block_t **sorted_indirect_blocks = NULL;
+	libfsext_data_blocks_indirect_block_t *indirect_blocks         = NULL;
+	libfsext_extent_t *extent                                      = NULL;
+	libfsext_extent_t *last_extent                                 = NULL;
+	uint8_t *indirect_blocks_data                                  = NULL;
+	static char *function                                          = "libfsext_data_blocks_read_data";
+	size_t data_offset                                             = 0;
+	size_t entry_offset                                            = 0;
+	size_t indirect_blocks_data_size                               = 0;
+	uint64_t batch_logical_block_number                            = 0;
+	uint64_t number_of_blocks_per_entry                            = 1;
+	uint32_t extent_number_of_blocks                               = 0;
+	uint32_t indirect_block_number                                 = 0;
+	uint32_t number_of_blocks_per_block                            = 0;
+	uint32_t sub_block_number                                      = 0;
+	uint32_t sub_logical_block_number                              = 0;
+	uint8_t create_new_extent                                      = 0;
+	uint8_t extend_last_extent                                     = 0;
+	int depth_iterator                                             = 0;
+	int entry_index                                                = 0;
+	int indirect_block_index                                       = 0;
+	int maximum_number_of_indirect_blocks                          = 0;
+	int number_of_indirect_blocks                                  = 0;
 
 	if( io_handle == NULL )
 	{
@@ -589,6 +601,93 @@ int libfsext_data_blocks_read_data(
 
 		sub_logical_block_number = last_extent->logical_block_number + last_extent->number_of_blocks;
 	}
+	if( depth > 0 )
+	{
+		/* The indirect blocks referenced by this block are read in batches
+		 * where adjacent blocks are read with a single read
+		 */
+		for( depth_iterator = 0;
+		     depth_iterator < depth;
+		     depth_iterator++ )
+		{
+			number_of_blocks_per_entry *= number_of_blocks_per_block;
+		}
+		maximum_number_of_indirect_blocks = (int) ( LIBFSEXT_MAXIMUM_INDIRECT_BLOCKS_READ_SIZE / io_handle->block_size );
+
+		/* Only allocate space for the non-sparse entries that map blocks within the number of blocks
+		 */
+		batch_logical_block_number = sub_logical_block_number;
+		number_of_indirect_blocks  = 0;
+
+		for( entry_offset = 0;
+		     entry_offset < data_size;
+		     entry_offset += 4 )
+		{
+			if( ( batch_logical_block_number >= number_of_blocks )
+			 || ( number_of_indirect_blocks >= maximum_number_of_indirect_blocks ) )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ entry_offset ] ),
+			 indirect_block_number );
+
+			if( indirect_block_number != 0 )
+			{
+				number_of_indirect_blocks++;
+			}
+			batch_logical_block_number += number_of_blocks_per_entry;
+		}
+		maximum_number_of_indirect_blocks = number_of_indirect_blocks;
+		number_of_indirect_blocks         = 0;
+
+		if( maximum_number_of_indirect_blocks == 0 )
+		{
+			maximum_number_of_indirect_blocks = 1;
+		}
+		indirect_blocks = (libfsext_data_blocks_indirect_block_t *) memory_allocate(
+		                                                             sizeof( libfsext_data_blocks_indirect_block_t ) * maximum_number_of_indirect_blocks );
+
+		if( indirect_blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create indirect blocks.",
+			 function );
+
+			goto on_error;
+		}
+		sorted_indirect_blocks = (libfsext_data_blocks_indirect_block_t **) memory_allocate(
+		                                                                     sizeof( libfsext_data_blocks_indirect_block_t * ) * maximum_number_of_indirect_blocks );
+
+		if( sorted_indirect_blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted indirect blocks.",
+			 function );
+
+			goto on_error;
+		}
+		indirect_blocks_data = (uint8_t *) memory_allocate(
+		                                    sizeof( uint8_t ) * io_handle->block_size * maximum_number_of_indirect_blocks );
+
+		if( indirect_blocks_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create indirect blocks data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	while( data_offset < data_size )
 	{
 		if( sub_logical_block_number >= number_of_blocks )
@@ -636,13 +735,68 @@ int libfsext_data_blocks_read_data(
 		}
 		else if( depth > 0 )
 		{
-			if( libfsext_data_blocks_read_file_io_handle(
+			if( ( indirect_block_index >= number_of_indirect_blocks )
+			 || ( indirect_blocks[ indirect_block_index ].entry_offset != ( data_offset - 4 ) ) )
+			{
+				/* Gather the non-sparse block numbers, starting with the current one,
+				 * that are needed to map the remaining blocks
+				 */
+				batch_logical_block_number = sub_logical_block_number;
+				entry_offset               = data_offset - 4;
+				indirect_block_index       = 0;
+				number_of_indirect_blocks  = 0;
+
+				while( ( entry_offset < data_size )
+				    && ( batch_logical_block_number < number_of_blocks )
+				    && ( number_of_indirect_blocks < maximum_number_of_indirect_blocks ) )
+				{
+					byte_stream_copy_to_uint32_little_endian(
+					 &( data[ entry_offset ] ),
+					 indirect_block_number );
+
+					if( indirect_block_number != 0 )
+					{
+						indirect_blocks[ number_of_indirect_blocks ].block_number = indirect_block_number;
+						indirect_blocks[ number_of_indirect_blocks ].entry_offset = entry_offset;
+
+						sorted_indirect_blocks[ number_of_indirect_blocks ] = &( indirect_blocks[ number_of_indirect_blocks ] );
+
+						number_of_indirect_blocks++;
+					}
+					entry_offset               += 4;
+					batch_logical_block_number += number_of_blocks_per_entry;
+				}
+				indirect_blocks_data_size = (size_t) io_handle->block_size * number_of_indirect_blocks;
+
+				if( libfsext_data_blocks_read_indirect_blocks(
+				     io_handle,
+				     file_io_handle,
+				     sorted_indirect_blocks,
+				     number_of_indirect_blocks,
+				     indirect_blocks_data,
+				     indirect_blocks_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read indirect blocks at depth: %d.",
+					 function,
+					 depth );
+
+					goto on_error;
+				}
+			}
+			if( libfsext_data_blocks_read_data(
 			     extents_array,
 			     io_handle,
 			     file_io_handle,
 			     number_of_blocks,
-			     sub_block_number,
-			     depth,
+			     (uint64_t) sub_block_number,
+			     &( indirect_blocks_data[ indirect_blocks[ indirect_block_index ].data_offset ] ),
+			     (size_t) io_handle->block_size,
+			     depth - 1,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -656,6 +810,8 @@ int libfsext_data_blocks_read_data(
 
 				goto on_error;
 			}
+			indirect_block_index++;
+
 			if( libfsext_data_blocks_get_last_extent(
 			     extents_array,
 			     &last_extent,
@@ -814,6 +970,21 @@ int libfsext_data_blocks_read_data(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	if( indirect_blocks_data != NULL )
+	{
+		memory_free(
+		 indirect_blocks_data );
+	}
+	if( sorted_indirect_blocks != NULL )
+	{
+		memory_free(
+		 sorted_indirect_blocks );
+	}
+	if( indirect_blocks != NULL )
+	{
+		memory_free(
+		 indirect_blocks );
+	}
 	return( 1 );
 
 on_error:
@@ -823,9 +994,229 @@ on_error:
 		 &extent,
 		 NULL );
 	}
+	if( indirect_blocks_data != NULL )
+	{
+		memory_free(
+		 indirect_blocks_data );
+	}
+	if( sorted_indirect_blocks != NULL )
+	{
+		memory_free(
+		 sorted_indirect_blocks );
+	}
+	if( indirect_blocks != NULL )
+	{
+		memory_free(
+		 indirect_blocks );
+	}
 	return( -1 );
 }
 
+/* Compares two indirect blocks by block number and their position in the parent block
+ * Callback function for qsort
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsext_data_blocks_compare_indirect_blocks(
+     const void *first_indirect_block,
+     const void *second_indirect_block )
+{
+	const libfsext_data_blocks_indirect_block_t *first_block  = *( (libfsext_data_blocks_indirect_block_t * const *) first_indirect_block );
+	const libfsext_data_blocks_indirect_block_t *second_block = *( (libfsext_data_blocks_indirect_block_t * const *) second_indirect_block );
+
+	if( first_block->block_number < second_block->block_number )
+	{
+		return( -1 );
+	}
+	else if( first_block->block_number > second_block->block_number )
+	{
+		return( 1 );
+	}
+	if( first_block->entry_offset < second_block->entry_offset )
+	{
+		return( -1 );
+	}
+	else if( first_block->entry_offset > second_block->entry_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads indirect blocks
+ * The indirect blocks are sorted by block number and adjacent blocks are read with a single read.
+ * The data offset of each indirect block is set to the location of its data in indirect blocks data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_data_blocks_read_indirect_blocks(
+     libfsext_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsext_data_blocks_indirect_block_t **sorted_indirect_blocks,
+     int number_of_indirect_blocks,
+     uint8_t *indirect_blocks_data,
+     size_t indirect_blocks_data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsext_data_blocks_read_indirect_blocks";
+	size_t read_size         = 0;
+	off64_t read_offset      = 0;
+	int first_block_index    = 0;
+	int indirect_block_index = 0;
+	int last_block_index     = 0;
+	int result               = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sorted_indirect_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted indirect blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_indirect_blocks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of indirect blocks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( indirect_blocks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid indirect blocks data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( indirect_blocks_data_size > (size_t) SSIZE_MAX )
+	 || ( indirect_blocks_data_size != ( (size_t) io_handle->block_size * number_of_indirect_blocks ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid indirect blocks data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_indirect_blocks > 1 )
+	{
+		qsort(
+		 sorted_indirect_blocks,
+		 (size_t) number_of_indirect_blocks,
+		 sizeof( libfsext_data_blocks_indirect_block_t * ),
+		 &libfsext_data_blocks_compare_indirect_blocks );
+	}
+	for( indirect_block_index = 0;
+	     indirect_block_index < number_of_indirect_blocks;
+	     indirect_block_index++ )
+	{
+		sorted_indirect_blocks[ indirect_block_index ]->data_offset = (size_t) io_handle->block_size * indirect_block_index;
+	}
+	while( first_block_index < number_of_indirect_blocks )
+	{
+		last_block_index = first_block_index + 1;
+
+		while( ( last_block_index < number_of_indirect_blocks )
+		    && ( (uint64_t) sorted_indirect_blocks[ last_block_index ]->block_number == ( (uint64_t) sorted_indirect_blocks[ last_block_index - 1 ]->block_number + 1 ) ) )
+		{
+			last_block_index++;
+		}
+		read_offset = (off64_t) sorted_indirect_blocks[ first_block_index ]->block_number * io_handle->block_size;
+		read_size   = (size_t) io_handle->block_size * ( last_block_index - first_block_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading %d indirect blocks starting with block: %" PRIu32 " of size: %" PRIzd " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 last_block_index - first_block_index,
+			 sorted_indirect_blocks[ first_block_index ]->block_number,
+			 read_size,
+			 read_offset,
+			 read_offset );
+		}
+#endif
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+		 0,
+		 read_offset,
+		 read_size );
+
+		result = libfsext_io_handle_read_metadata_at_offset(
+		          io_handle,
+		          file_io_handle,
+		          &( indirect_blocks_data[ sorted_indirect_blocks[ first_block_index ]->data_offset ] ),
+		          read_size,
+		          read_offset,
+		          error );
+
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_END,
+		 0,
+		 read_offset,
+		 read_size );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read indirect blocks at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			return( -1 );
+		}
+		libfsext_io_handle_update_read_statistics(
+		 io_handle,
+		 LIBFSEXT_STATISTICS_VALUE_EXTENT_INDEX_NUMBER_OF_READS,
+		 read_size );
+
+		first_block_index = last_block_index;
+	}
+	return( 1 );
+}
+
 /* Reads an indirect block
  * Returns 1 if successful or -1 on error
  */
@@ -841,6 +1232,7 @@ int libfsext_data_blocks_read_file_io_handle(
 	libfsext_block_t *block = NULL;
 	static char *function   = "libfsext_data_blocks_read_file_io_handle";
 	off64_t block_offset    = 0;
+	int result              = 0;
 
 	if( io_handle == NULL )
 	{
@@ -893,11 +1285,31 @@ int libfsext_data_blocks_read_file_io_handle(
 
 		goto on_error;
 	}
-	if( libfsext_block_read_file_io_handle(
-	     block,
-	     file_io_handle,
-	     block_offset,
-	     error ) != 1 )
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+	 0,
+	 block_offset,
+	 io_handle->block_size );
+
+	result = libfsext_io_handle_read_metadata_at_offset(
+	          io_handle,
+	          file_io_handle,
+	          block->data,
+	          block->data_size,
+	          block_offset,
+	          error );
+
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 0,
+	 block_offset,
+	 io_handle->block_size );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -909,6 +1321,11 @@ int libfsext_data_blocks_read_file_io_handle(
 
 		goto on_error;
 	}
+	libfsext_io_handle_update_read_statistics(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_EXTENT_INDEX_NUMBER_OF_READS,
+	 (size_t) io_handle->block_size );
+
 	if( libfsext_data_blocks_read_data(
 	     extents_array,
 	     io_handle,
@@ -35,6 +35,23 @@
 extern "C" {
 #endif
 
+typedef struct libfsext_data_blocks_indirect_block libfsext_data_blocks_indirect_block_t;
+
+struct libfsext_data_blocks_indirect_block
+{
+	/* The block number
+	 */
+	uint32_t block_number;
+
+	/* The offset of the block number in the parent block data
+	 */
+	size_t entry_offset;
+
+	/* The offset of the block data in the indirect blocks data
+	 */
+	size_t data_offset;
+};
+
 int libfsext_data_blocks_get_last_extent(
      libcdata_array_t *extents_array,
      libfsext_extent_t **last_extent,
@@ -60,6 +77,19 @@ int libfsext_data_blocks_read_data(
      int depth,
      libcerror_error_t **error );
 
+int libfsext_data_blocks_compare_indirect_blocks(
+     const void *first_indirect_block,
+     const void *second_indirect_block );
+
+int libfsext_data_blocks_read_indirect_blocks(
+     libfsext_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsext_data_blocks_indirect_block_t **sorted_indirect_blocks,
+     int number_of_indirect_blocks,
+     uint8_t *indirect_blocks_data,
+     size_t indirect_blocks_data_size,
+     libcerror_error_t **error );
+
 int libfsext_data_blocks_read_file_io_handle(
      libcdata_array_t *extents_array,
      libfsext_io_handle_t *io_handle,
@@ -26,6 +26,7 @@
 
 #include "libfsext_block.h"
 #include "libfsext_block_vector.h"
+#include "libfsext_checksum.h"
 #include "libfsext_definitions.h"
 #include "libfsext_directory.h"
 #include "libfsext_directory_entry.h"
@@ -35,9 +36,13 @@
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libcnotify.h"
+#include "libfsext_libcthreads.h"
 #include "libfsext_libfdata.h"
 #include "libfsext_libfcache.h"
 #include "libfsext_libuna.h"
+#include "libfsext_name.h"
+
+#include "fsext_directory_entry.h"
 
 /* Creates a directory
  * Make sure the value directory is referencing, is set to NULL
@@ -118,11 +123,54 @@ int libfsext_directory_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( ( *directory )->deleted_entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deleted entries array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *directory )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *directory != NULL )
 	{
+		if( ( *directory )->deleted_entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *directory )->deleted_entries_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *directory )->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *directory )->entries_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *directory );
 
@@ -154,6 +202,21 @@ int libfsext_directory_free(
 	}
 	if( *directory != NULL )
 	{
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *directory )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( libcdata_array_free(
 		     &( ( *directory )->entries_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_directory_entry_free,
@@ -168,6 +231,35 @@ int libfsext_directory_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *directory )->deleted_entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_directory_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free deleted entries array.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *directory )->name_hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *directory )->name_hash_buckets );
+		}
+		if( ( *directory )->name_hash_chains != NULL )
+		{
+			memory_free(
+			 ( *directory )->name_hash_chains );
+		}
+		if( ( *directory )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *directory )->name_hashes );
+		}
 		memory_free(
 		 *directory );
 
@@ -177,20 +269,39 @@ int libfsext_directory_free(
 }
 
 /* Reads the directory entries from block data
+ * The directory entry size chain of the block is validated before any directory entry
+ * is created, so that the entries array can be resized once per block and no directory
+ * entries are created for the "." and ".." and unused directory entries
  * Returns 1 if successful or -1 on error
  */
 int libfsext_directory_read_block_data(
      libfsext_directory_t *directory,
+     libfsext_io_handle_t *io_handle,
+     libfsext_inode_t *inode,
      const uint8_t *data,
      size_t data_size,
      uint32_t *directory_entry_index,
      libcerror_error_t **error )
 {
+	uint8_t checksum_data[ 4 ];
+
 	libfsext_directory_entry_t *directory_entry = NULL;
 	static char *function                       = "libfsext_directory_read_block_data";
 	size_t data_offset                          = 0;
+	size_t entries_data_size                    = 0;
+	size_t used_data_size                       = 0;
+	uint64_t start_time                         = 0;
+	uint64_t value_64bit                        = 0;
+	uint32_t calculated_checksum                = 0;
 	uint32_t safe_directory_entry_index         = 0;
+	uint32_t stored_checksum                    = 0;
+	uint16_t directory_entry_size               = 0;
+	uint8_t has_checksum_tail                   = 0;
+	uint8_t is_used_entry                       = 0;
+	uint8_t name_size                           = 0;
 	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+	int number_of_used_entries                  = 0;
 
 	if( directory == NULL )
 	{
@@ -203,6 +314,28 @@ int libfsext_directory_read_block_data(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -238,113 +371,333 @@ int libfsext_directory_read_block_data(
 	}
 	safe_directory_entry_index = *directory_entry_index;
 
+	/* Validate the directory entry size chain and determine the number of used directory entries
+	 * The 64-bit value contains: the inode number (bits 0 - 31), the directory entry size (bits 32 - 47),
+	 * the name size (bits 48 - 55) and the file type (bits 56 - 63)
+	 */
 	while( data_offset < data_size )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( ( data_size - data_offset ) < sizeof( fsext_directory_entry_t ) )
 		{
-			libcnotify_printf(
-			 "Reading directory entry: %" PRIu32 " at offset: %" PRIzd " (0x%08" PRIzx ")\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory entry: %" PRIu32 " at offset: %" PRIzd " (0x%08" PRIzx ") - data size value out of bounds.",
+			 function,
 			 safe_directory_entry_index,
 			 data_offset,
 			 data_offset );
+
+			return( -1 );
 		}
-#endif
-		if( libfsext_directory_entry_initialize(
-		     &directory_entry,
-		     error ) != 1 )
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		directory_entry_size = (uint16_t) ( ( value_64bit >> 32 ) & 0x0000ffffUL );
+		name_size            = (uint8_t) ( ( value_64bit >> 48 ) & 0x000000ffUL );
+
+		if( directory_entry_size == 0 )
+		{
+			break;
+		}
+		if( ( directory_entry_size < 8 )
+		 || ( (size_t) directory_entry_size > ( data_size - data_offset ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry: %" PRIu32 ".",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory entry: %" PRIu32 " at offset: %" PRIzd " (0x%08" PRIzx ") - size value out of bounds.",
 			 function,
-			 safe_directory_entry_index );
+			 safe_directory_entry_index,
+			 data_offset,
+			 data_offset );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfsext_directory_entry_read_data(
-		     directory_entry,
-		     &( data[ data_offset ] ),
-		     data_size - data_offset,
-		     error ) != 1 )
+		if( name_size > ( directory_entry_size - 8 ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory entry: %" PRIu32 " at offset: %" PRIzd " (0x%08" PRIzx ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid directory entry: %" PRIu32 " at offset: %" PRIzd " (0x%08" PRIzx ") - name size value out of bounds.",
 			 function,
 			 safe_directory_entry_index,
 			 data_offset,
 			 data_offset );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( directory_entry->size == 0 )
+		/* The metadata checksum tail is an unused directory entry of 12 bytes
+		 * with file type 0xde at the end of the block
+		 */
+		if( ( ( data_offset + 12 ) == data_size )
+		 && ( value_64bit == 0xde00000c00000000ULL ) )
 		{
-			if( libfsext_directory_entry_free(
-			     &directory_entry,
-			     error ) != 1 )
+			has_checksum_tail = 1;
+
+			break;
+		}
+		if( ( value_64bit & 0xffffffffUL ) != 0 )
+		{
+			/* Do not count the "." and ".." directory entries
+			 */
+			if( ( ( name_size != 1 )
+			  || ( data[ data_offset + 8 ] != (uint8_t) '.' ) )
+			 && ( ( name_size != 2 )
+			  || ( data[ data_offset + 8 ] != (uint8_t) '.' )
+			  || ( data[ data_offset + 9 ] != (uint8_t) '.' ) ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entry: %" PRIu32 ".",
+				number_of_used_entries++;
+			}
+		}
+		data_offset += directory_entry_size;
+
+		safe_directory_entry_index++;
+	}
+	entries_data_size = data_offset;
+
+	if( ( has_checksum_tail != 0 )
+	 && ( ( io_handle->read_only_compatible_features_flags & LIBFSEXT_READ_ONLY_COMPATIBLE_FEATURES_FLAG_METADATA_CHECKSUM ) != 0 ) )
+	{
+		start_time = libfsext_io_handle_get_checksum_start_time(
+		              io_handle );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ entries_data_size + 8 ] ),
+		 stored_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 checksum_data,
+		 inode->inode_number );
+
+		if( libfsext_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     checksum_data,
+		     4,
+		     io_handle->metadata_checksum_seed,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 checksum_data,
+		 inode->nfs_generation_number );
+
+		if( libfsext_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     checksum_data,
+		     4,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsext_checksum_calculate_crc32(
+		     &calculated_checksum,
+		     data,
+		     entries_data_size,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		calculated_checksum = 0xffffffffUL - calculated_checksum;
+
+		libfsext_io_handle_update_checksum_statistics(
+		 io_handle,
+		 start_time );
+
+		if( stored_checksum != calculated_checksum )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
 				 function,
-				 safe_directory_entry_index );
+				 stored_checksum,
+				 calculated_checksum );
+			}
+#endif
+			directory->is_corrupt = 1;
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
 
-				goto on_error;
+		return( -1 );
+	}
+	if( number_of_used_entries > 0 )
+	{
+		if( libcdata_array_resize(
+		     directory->entries_array,
+		     number_of_entries + number_of_used_entries,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_directory_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize entries array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry_index                = number_of_entries;
+	data_offset                = 0;
+	safe_directory_entry_index = *directory_entry_index;
+
+	while( data_offset < entries_data_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		directory_entry_size = (uint16_t) ( ( value_64bit >> 32 ) & 0x0000ffffUL );
+		name_size            = (uint8_t) ( ( value_64bit >> 48 ) & 0x000000ffUL );
+		is_used_entry        = 0;
+
+		if( ( value_64bit & 0xffffffffUL ) != 0 )
+		{
+			if( ( ( name_size != 1 )
+			  || ( data[ data_offset + 8 ] != (uint8_t) '.' ) )
+			 && ( ( name_size != 2 )
+			  || ( data[ data_offset + 8 ] != (uint8_t) '.' )
+			  || ( data[ data_offset + 9 ] != (uint8_t) '.' ) ) )
+			{
+				is_used_entry = 1;
 			}
-			break;
 		}
-		data_offset += directory_entry->size;
+		if( directory->recover_deleted_entries != 0 )
+		{
+			/* The used part of the directory entry is the 8-byte header and the name padded to a multitude of 4
+			 * the remainder is slack that can contain the directory entries that were removed after it
+			 */
+			used_data_size = 8 + ( ( (size_t) name_size + 3 ) & ~( (size_t) 3 ) );
 
+			if( ( used_data_size + 12 ) <= (size_t) directory_entry_size )
+			{
+				if( libfsext_directory_read_slack_data(
+				     directory,
+				     &( data[ data_offset + used_data_size ] ),
+				     (size_t) directory_entry_size - used_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read slack of directory entry: %" PRIu32 ".",
+					 function,
+					 safe_directory_entry_index );
+
+					goto on_error;
+				}
+			}
+		}
 /* TODO lost+found has directory entries with size but no values */
-		if( ( ( directory_entry->name_size == 2 )
-		  && ( directory_entry->name[ 0 ] == '.' ) )
-		 || ( ( directory_entry->name_size == 3 )
-		  && ( directory_entry->name[ 0 ] == '.' )
-		  && ( directory_entry->name[ 1 ] == '.' ) )
-		 || ( directory_entry->inode_number == 0 ) )
+		if( is_used_entry != 0 )
 		{
-			if( libfsext_directory_entry_free(
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading directory entry: %" PRIu32 " at offset: %" PRIzd " (0x%08" PRIzx ")\n",
+				 safe_directory_entry_index,
+				 data_offset,
+				 data_offset );
+			}
+#endif
+			if( libfsext_directory_entry_initialize(
 			     &directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entry: %" PRIu32 ".",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entry: %" PRIu32 ".",
 				 function,
 				 safe_directory_entry_index );
 
 				goto on_error;
 			}
-		}
-		else
-		{
-			if( libcdata_array_append_entry(
+			if( libfsext_directory_entry_read_data(
+			     directory_entry,
+			     &( data[ data_offset ] ),
+			     (size_t) directory_entry_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory entry: %" PRIu32 " at offset: %" PRIzd " (0x%08" PRIzx ").",
+				 function,
+				 safe_directory_entry_index,
+				 data_offset,
+				 data_offset );
+
+				goto on_error;
+			}
+			if( libcdata_array_set_entry_by_index(
 			     directory->entries_array,
-			     &entry_index,
+			     entry_index,
 			     (intptr_t *) directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append directory entry: %" PRIu32 " to array.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set directory entry: %" PRIu32 " in array.",
 				 function,
 				 safe_directory_entry_index );
 
 				goto on_error;
 			}
 			directory_entry = NULL;
+
+			entry_index++;
 		}
+		data_offset += directory_entry_size;
+
 		safe_directory_entry_index++;
 	}
 	*directory_entry_index = safe_directory_entry_index;
@@ -358,22 +711,209 @@ on_error:
 		 &directory_entry,
 		 NULL );
 	}
+	libcdata_array_resize(
+	 directory->entries_array,
+	 number_of_entries,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_directory_entry_free,
+	 NULL );
+
 	return( -1 );
 }
 
-/* Reads the directory entries from inline data
+/* Reads deleted directory entries from the slack of a directory entry
+ * The slack is scanned in steps of 4 bytes for data that resembles a directory entry,
+ * the directory entry header is checked as a single 64-bit value before any directory
+ * entry is created so that the scan adds little overhead to reading a directory
  * Returns 1 if successful or -1 on error
  */
-int libfsext_directory_read_inline_data(
+int libfsext_directory_read_slack_data(
      libfsext_directory_t *directory,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
 {
 	libfsext_directory_entry_t *directory_entry = NULL;
-	static char *function                       = "libfsext_directory_read_inline_data";
+	static char *function                       = "libfsext_directory_read_slack_data";
 	size_t data_offset                          = 0;
-	uint32_t directory_entry_index              = 0;
+	size_t name_offset                          = 0;
+	size_t used_data_size                       = 0;
+	uint64_t value_64bit                        = 0;
+	uint32_t inode_number                       = 0;
+	uint16_t directory_entry_size               = 0;
+	uint8_t file_type                           = 0;
+	uint8_t name_size                           = 0;
+	int entry_index                             = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The smallest directory entry is the 8-byte header with a name of 1 to 4 bytes
+	 */
+	while( ( data_offset + 12 ) <= data_size )
+	{
+		/* The 64-bit value contains: the inode number (bits 0 - 31), the directory entry size (bits 32 - 47),
+		 * the name size (bits 48 - 55) and the file type (bits 56 - 63)
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		inode_number         = (uint32_t) ( value_64bit & 0xffffffffUL );
+		directory_entry_size = (uint16_t) ( ( value_64bit >> 32 ) & 0x0000ffffUL );
+		name_size            = (uint8_t) ( ( value_64bit >> 48 ) & 0x000000ffUL );
+		file_type            = (uint8_t) ( value_64bit >> 56 );
+		used_data_size       = 8 + ( ( (size_t) name_size + 3 ) & ~( (size_t) 3 ) );
+
+		/* The inode number of a deleted directory entry cannot exceed the number of inodes of the volume
+		 */
+		if( ( inode_number == 0 )
+		 || ( ( directory->number_of_inodes != 0 )
+		  && ( inode_number > directory->number_of_inodes ) )
+		 || ( name_size == 0 )
+		 || ( file_type > 7 )
+		 || ( ( directory_entry_size % 4 ) != 0 )
+		 || ( (size_t) directory_entry_size < used_data_size )
+		 || ( (size_t) directory_entry_size > ( data_size - data_offset ) ) )
+		{
+			data_offset += 4;
+
+			continue;
+		}
+		for( name_offset = data_offset + 8;
+		     name_offset < ( data_offset + 8 + name_size );
+		     name_offset++ )
+		{
+			if( ( data[ name_offset ] == 0 )
+			 || ( data[ name_offset ] == (uint8_t) '/' ) )
+			{
+				break;
+			}
+		}
+		if( name_offset < ( data_offset + 8 + name_size ) )
+		{
+			data_offset += 4;
+
+			continue;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading deleted directory entry at slack offset: %" PRIzd " (0x%08" PRIzx ")\n",
+			 data_offset,
+			 data_offset );
+		}
+#endif
+		if( libfsext_directory_entry_initialize(
+		     &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create deleted directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_directory_entry_read_data(
+		     directory_entry,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read deleted directory entry at slack offset: %" PRIzd " (0x%08" PRIzx ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			goto on_error;
+		}
+		directory_entry->is_deleted = 1;
+
+		if( libcdata_array_append_entry(
+		     directory->deleted_entries_array,
+		     &entry_index,
+		     (intptr_t *) directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append deleted directory entry to array.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry = NULL;
+
+		/* Continue after the name since the slack of the deleted directory entry
+		 * can contain other deleted directory entries
+		 */
+		data_offset += used_data_size;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsext_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the directory entries from inline data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_directory_read_inline_data(
+     libfsext_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsext_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsext_directory_read_inline_data";
+	size_t data_offset                          = 0;
+	size_t used_data_size                       = 0;
+	uint32_t directory_entry_index              = 0;
 	int entry_index                             = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -494,6 +1034,33 @@ int libfsext_directory_read_inline_data(
 			}
 			break;
 		}
+		if( directory->recover_deleted_entries != 0 )
+		{
+			/* The used part of the directory entry is the 8-byte header and the name padded to a multitude of 4
+			 * the remainder is slack that can contain the directory entries that were removed after it
+			 */
+			used_data_size = 8 + ( ( (size_t) ( (fsext_directory_entry_t *) &( data[ data_offset ] ) )->name_size + 3 ) & ~( (size_t) 3 ) );
+
+			if( ( used_data_size + 12 ) <= (size_t) directory_entry->size )
+			{
+				if( libfsext_directory_read_slack_data(
+				     directory,
+				     &( data[ data_offset + used_data_size ] ),
+				     (size_t) directory_entry->size - used_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read slack of directory entry: %" PRIu32 ".",
+					 function,
+					 directory_entry_index );
+
+					goto on_error;
+				}
+			}
+		}
 		data_offset += directory_entry->size;
 
 /* TODO lost+found has directory entries with size but no values */
@@ -568,6 +1135,8 @@ int libfsext_directory_read_file_io_handle(
 	libfsext_block_t *block         = NULL;
 	static char *function           = "libfsext_directory_read_file_io_handle";
 	size_t inline_data_size         = 0;
+	uint64_t cache_misses           = 0;
+	uint64_t current_cache_misses   = 0;
 	uint32_t directory_entry_index  = 0;
 	int block_index                 = 0;
 	int number_of_blocks            = 0;
@@ -616,6 +1185,26 @@ int libfsext_directory_read_file_io_handle(
 
 		return( -1 );
 	}
+	directory->recover_deleted_entries = io_handle->recover_deleted_directory_entries;
+	directory->number_of_inodes        = io_handle->number_of_inodes;
+
+	/* Names in a directory with the casefold flag are matched ignoring case
+	 * and are always looked up using the name hash table
+	 */
+	if( ( ( io_handle->incompatible_features_flags & LIBFSEXT_INCOMPATIBLE_FEATURES_FLAG_CASEFOLD ) != 0 )
+	 && ( ( inode->flags & LIBFSEXT_INODE_FLAG_CASEFOLD ) != 0 ) )
+	{
+		directory->use_case_folding = 1;
+	}
+
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_DIRECTORY_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+	 inode->inode_number,
+	 0,
+	 inode->data_size );
+
 	if( ( io_handle->format_version == 4 )
 	 && ( ( inode->flags & LIBFSEXT_INODE_FLAG_INLINE_DATA ) != 0 ) )
 	{
@@ -695,6 +1284,22 @@ int libfsext_directory_read_file_io_handle(
 		     block_index < number_of_blocks;
 		     block_index++ )
 		{
+			if( libfsext_io_handle_get_statistics_value(
+			     io_handle,
+			     LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_MISSES,
+			     &cache_misses,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block cache misses statistics value.",
+				 function );
+
+				goto on_error;
+			}
+
 			if( libfdata_vector_get_element_value_by_index(
 			     block_vector,
 			     (intptr_t *) file_io_handle,
@@ -725,8 +1330,32 @@ int libfsext_directory_read_file_io_handle(
 
 				goto on_error;
 			}
+			if( libfsext_io_handle_get_statistics_value(
+			     io_handle,
+			     LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_MISSES,
+			     &current_cache_misses,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve block cache misses statistics value.",
+				 function );
+
+				goto on_error;
+			}
+			if( current_cache_misses == cache_misses )
+			{
+				libfsext_io_handle_increment_statistics_value(
+				 io_handle,
+				 LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_HITS,
+				 1 );
+			}
 			if( libfsext_directory_read_block_data(
 			     directory,
+			     io_handle,
+			     inode,
 			     block->data,
 			     (size_t) block->data_size,
 			     &directory_entry_index,
@@ -770,6 +1399,30 @@ int libfsext_directory_read_file_io_handle(
 			goto on_error;
 		}
 	}
+	if( directory->use_case_folding != 0 )
+	{
+		if( libfsext_directory_build_name_hash_table(
+		     directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build name hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_DIRECTORY_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 inode->inode_number,
+	 0,
+	 inode->data_size );
+
 	return( 1 );
 
 on_error:
@@ -785,18 +1438,40 @@ on_error:
 		 &block_vector,
 		 NULL );
 	}
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_DIRECTORY_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 inode->inode_number,
+	 0,
+	 inode->data_size );
+
 	return( -1 );
 }
 
-/* Retrieves the number of entries
+/* Builds the name hash table
+ * The names are case folded if the directory uses case folding
+ * Entries with a name that is not valid UTF-8 are not added to the hash table
+ * since these can only be matched exactly
+ * The name hash table is built in local buffers that are only set in the directory
+ * once complete, callers that share the directory must hold its write lock
  * Returns 1 if successful or -1 on error
  */
-int libfsext_directory_get_number_of_entries(
+int libfsext_directory_build_name_hash_table(
      libfsext_directory_t *directory,
-     int *number_of_entries,
      libcerror_error_t **error )
 {
-	static char *function = "libfsext_directory_get_number_of_entries";
+	libfsext_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsext_directory_build_name_hash_table";
+	uint32_t *name_hashes                       = NULL;
+	int *name_hash_buckets                      = NULL;
+	int *name_hash_chains                       = NULL;
+	uint32_t name_hash                          = 0;
+	int bucket_index                            = 0;
+	int entry_index                             = 0;
+	int number_of_buckets                       = 0;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
 
 	if( directory == NULL )
 	{
@@ -809,94 +1484,634 @@ int libfsext_directory_get_number_of_entries(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     directory->entries_array,
-	     number_of_entries,
-	     error ) != 1 )
+	if( directory->name_hash_buckets != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - name hash buckets value already set.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific entry
- * Returns 1 if successful or -1 on error
- */
-int libfsext_directory_get_entry_by_index(
-     libfsext_directory_t *directory,
-     int entry_index,
-     libfsext_directory_entry_t **directory_entry,
-     libcerror_error_t **error )
-{
-	static char *function = "libfsext_directory_get_entry_by_index";
-
-	if( directory == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     directory->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     directory->entries_array,
-	     entry_index,
-	     (intptr_t **) directory_entry,
-	     error ) != 1 )
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d.",
-		 function,
-		 entry_index );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
+	/* The number of buckets is a power of 2 of at least twice the number of entries
+	 */
+	number_of_buckets = 16;
 
-/* Retrieves the directory entry for an UTF-8 encoded name
- * Returns 1 if successful, 0 if not found or -1 on error
- */
-int libfsext_directory_get_entry_by_utf8_name(
-     libfsext_directory_t *directory,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsext_directory_entry_t **directory_entry,
-     libcerror_error_t **error )
-{
-	libfsext_directory_entry_t *safe_directory_entry = NULL;
-	static char *function                            = "libfsext_directory_get_entry_by_utf8_name";
-	int entry_index                                  = 0;
-	int number_of_entries                            = 0;
-	int result                                       = 0;
+	while( number_of_buckets < ( 2 * number_of_entries ) )
+	{
+		number_of_buckets *= 2;
+	}
+	name_hash_buckets = (int *) memory_allocate(
+	                     sizeof( int ) * number_of_buckets );
 
-	if( directory == NULL )
+	if( name_hash_buckets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash buckets.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_number_of_entries(
-	     directory->entries_array,
-	     &number_of_entries,
+	if( memory_set(
+	     name_hash_buckets,
+	     0,
+	     sizeof( int ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	name_hash_chains = (int *) memory_allocate(
+	                    sizeof( int ) * number_of_entries );
+
+	if( name_hash_chains == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash chains.",
+		 function );
+
+		goto on_error;
+	}
+	name_hashes = (uint32_t *) memory_allocate(
+	               sizeof( uint32_t ) * number_of_entries );
+
+	if( name_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hashes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     directory->entries_array,
+		     entry_index,
+		     (intptr_t **) &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		result = libfsext_name_get_hash_from_utf8_string(
+		          directory_entry->name,
+		          (size_t) directory_entry->name_size,
+		          directory->use_case_folding,
+		          &name_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		name_hashes[ entry_index ]      = name_hash;
+		name_hash_chains[ entry_index ] = 0;
+
+		if( result != 0 )
+		{
+			bucket_index = (int) ( name_hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+			name_hash_chains[ entry_index ]  = name_hash_buckets[ bucket_index ];
+			name_hash_buckets[ bucket_index ] = entry_index + 1;
+		}
+	}
+	directory->name_hash_buckets           = name_hash_buckets;
+	directory->name_hash_chains            = name_hash_chains;
+	directory->name_hashes                 = name_hashes;
+	directory->number_of_name_hash_buckets = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( name_hashes != NULL )
+	{
+		memory_free(
+		 name_hashes );
+	}
+	if( name_hash_chains != NULL )
+	{
+		memory_free(
+		 name_hash_chains );
+	}
+	if( name_hash_buckets != NULL )
+	{
+		memory_free(
+		 name_hash_buckets );
+	}
+	return( -1 );
+}
+
+/* Prepares the name hash table for a lookup by name
+ * The name hash table is built on the second lookup so that a directory
+ * that is looked up only once is not indexed. Since lookups share the directory
+ * the name hash table is built while holding the write lock, once set it is
+ * not changed until the directory is freed
+ * Returns 1 if the name hash table is available, 0 if not or -1 on error
+ */
+int libfsext_directory_prepare_name_hash_table(
+     libfsext_directory_t *directory,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_directory_prepare_name_hash_table";
+	int result            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     directory->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( directory->name_hash_buckets != NULL )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     directory->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     directory->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another lookup could have built the name hash table while the lock was released
+	 */
+	if( directory->name_hash_buckets == NULL )
+	{
+		if( directory->number_of_name_lookups > 0 )
+		{
+			if( libfsext_directory_build_name_hash_table(
+			     directory,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else
+		{
+			directory->number_of_name_lookups += 1;
+		}
+	}
+	if( ( result == 0 )
+	 && ( directory->name_hash_buckets != NULL ) )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     directory->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_directory_get_number_of_entries(
+     libfsext_directory_t *directory,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_directory_get_number_of_entries";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory->entries_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_directory_get_entry_by_index(
+     libfsext_directory_t *directory,
+     int entry_index,
+     libfsext_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_directory_get_entry_by_index";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     directory->entries_array,
+	     entry_index,
+	     (intptr_t **) directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of deleted entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_directory_get_number_of_deleted_entries(
+     libfsext_directory_t *directory,
+     int *number_of_deleted_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_directory_get_number_of_deleted_entries";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory->deleted_entries_array,
+	     number_of_deleted_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of deleted entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific deleted entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_directory_get_deleted_entry_by_index(
+     libfsext_directory_t *directory,
+     int entry_index,
+     libfsext_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_directory_get_deleted_entry_by_index";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     directory->deleted_entries_array,
+	     entry_index,
+	     (intptr_t **) directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve deleted entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the directory entry for an UTF-8 encoded name
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsext_directory_get_entry_by_utf8_name(
+     libfsext_directory_t *directory,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsext_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsext_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfsext_directory_get_entry_by_utf8_name";
+	uint32_t name_hash                               = 0;
+	int entry_index                                  = 0;
+	int hash_chain_index                             = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsext_directory_prepare_name_hash_table(
+	          directory,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to prepare name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libfsext_name_get_hash_from_utf8_string(
+		          utf8_string,
+		          utf8_string_length,
+		          directory->use_case_folding,
+		          &name_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		/* A string that has no hash is matched exactly
+		 */
+		else if( result != 0 )
+		{
+			hash_chain_index = directory->name_hash_buckets[ name_hash & (uint32_t) ( directory->number_of_name_hash_buckets - 1 ) ];
+
+			while( hash_chain_index > 0 )
+			{
+				entry_index = hash_chain_index - 1;
+
+				if( directory->name_hashes[ entry_index ] == name_hash )
+				{
+					if( libcdata_array_get_entry_by_index(
+					     directory->entries_array,
+					     entry_index,
+					     (intptr_t **) &safe_directory_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve entry: %d.",
+						 function,
+						 entry_index );
+
+						return( -1 );
+					}
+					if( safe_directory_entry == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing entry: %d.",
+						 function,
+						 entry_index );
+
+						return( -1 );
+					}
+					result = libfsext_name_compare_with_utf8_string(
+					          safe_directory_entry->name,
+					          (size_t) safe_directory_entry->name_size,
+					          utf8_string,
+					          utf8_string_length,
+					          directory->use_case_folding,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compare UTF-8 string with directory entry: %d.",
+						 function,
+						 entry_index );
+
+						return( -1 );
+					}
+					else if( result == LIBUNA_COMPARE_EQUAL )
+					{
+						*directory_entry = safe_directory_entry;
+
+						return( 1 );
+					}
+				}
+				hash_chain_index = directory->name_hash_chains[ entry_index ];
+			}
+			*directory_entry = NULL;
+
+			return( 0 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     directory->entries_array,
+	     &number_of_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -970,7 +2185,9 @@ int libfsext_directory_get_entry_by_utf16_name(
 {
 	libfsext_directory_entry_t *safe_directory_entry = NULL;
 	static char *function                            = "libfsext_directory_get_entry_by_utf16_name";
+	uint32_t name_hash                               = 0;
 	int entry_index                                  = 0;
+	int hash_chain_index                             = 0;
 	int number_of_entries                            = 0;
 	int result                                       = 0;
 
@@ -985,6 +2202,126 @@ int libfsext_directory_get_entry_by_utf16_name(
 
 		return( -1 );
 	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsext_directory_prepare_name_hash_table(
+	          directory,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to prepare name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libfsext_name_get_hash_from_utf16_string(
+		          utf16_string,
+		          utf16_string_length,
+		          directory->use_case_folding,
+		          &name_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		/* A string that has no hash is matched exactly
+		 */
+		else if( result != 0 )
+		{
+			hash_chain_index = directory->name_hash_buckets[ name_hash & (uint32_t) ( directory->number_of_name_hash_buckets - 1 ) ];
+
+			while( hash_chain_index > 0 )
+			{
+				entry_index = hash_chain_index - 1;
+
+				if( directory->name_hashes[ entry_index ] == name_hash )
+				{
+					if( libcdata_array_get_entry_by_index(
+					     directory->entries_array,
+					     entry_index,
+					     (intptr_t **) &safe_directory_entry,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve entry: %d.",
+						 function,
+						 entry_index );
+
+						return( -1 );
+					}
+					if( safe_directory_entry == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+						 "%s: missing entry: %d.",
+						 function,
+						 entry_index );
+
+						return( -1 );
+					}
+					result = libfsext_name_compare_with_utf16_string(
+					          safe_directory_entry->name,
+					          (size_t) safe_directory_entry->name_size,
+					          utf16_string,
+					          utf16_string_length,
+					          directory->use_case_folding,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compare UTF-16 string with directory entry: %d.",
+						 function,
+						 entry_index );
+
+						return( -1 );
+					}
+					else if( result == LIBUNA_COMPARE_EQUAL )
+					{
+						*directory_entry = safe_directory_entry;
+
+						return( 1 );
+					}
+				}
+				hash_chain_index = directory->name_hash_chains[ entry_index ];
+			}
+			*directory_entry = NULL;
+
+			return( 0 );
+		}
+	}
 	if( libcdata_array_get_number_of_entries(
 	     directory->entries_array,
 	     &number_of_entries,
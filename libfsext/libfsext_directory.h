@@ -31,6 +31,7 @@
 #include "libfsext_libbfio.h"
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
+#include "libfsext_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -43,6 +44,60 @@ struct libfsext_directory
 	/* Entries array
 	 */
 	libcdata_array_t *entries_array;
+
+	/* Deleted entries array
+	 * Contains the directory entries recovered from the slack of other directory entries
+	 */
+	libcdata_array_t *deleted_entries_array;
+
+	/* Value to indicate deleted directory entries should be recovered
+	 */
+	uint8_t recover_deleted_entries;
+
+	/* The number of inodes of the volume
+	 * Used to reject deleted directory entries with an out of bounds inode number, 0 if not set
+	 */
+	uint32_t number_of_inodes;
+
+	/* Value to indicate the names of the directory entries are case folded
+	 */
+	uint8_t use_case_folding;
+
+	/* The name hash table buckets
+	 * Contains per bucket the index of the first entry + 1 or 0 if the bucket is empty
+	 */
+	int *name_hash_buckets;
+
+	/* The number of name hash table buckets
+	 */
+	int number_of_name_hash_buckets;
+
+	/* The name hash table chains
+	 * Contains per entry the index of the next entry in the same bucket + 1 or 0 if last
+	 */
+	int *name_hash_chains;
+
+	/* The name hashes
+	 * Contains per entry the hash of its name, that is case folded if case folding is used
+	 */
+	uint32_t *name_hashes;
+
+	/* The number of lookups by name
+	 * Used to build the name hash table on the second lookup
+	 */
+	int number_of_name_lookups;
+
+	/* Value to indicate the directory is corrupt
+	 * Set when the checksum of a directory block does not match
+	 */
+	uint8_t is_corrupt;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * Protects the name hash table and the number of lookups by name
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsext_directory_initialize(
@@ -55,11 +110,19 @@ int libfsext_directory_free(
 
 int libfsext_directory_read_block_data(
      libfsext_directory_t *directory,
+     libfsext_io_handle_t *io_handle,
+     libfsext_inode_t *inode,
      const uint8_t *data,
      size_t data_size,
      uint32_t *directory_entry_index,
      libcerror_error_t **error );
 
+int libfsext_directory_read_slack_data(
+     libfsext_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsext_directory_read_inline_data(
      libfsext_directory_t *directory,
      const uint8_t *data,
@@ -73,6 +136,14 @@ int libfsext_directory_read_file_io_handle(
      libfsext_inode_t *inode,
      libcerror_error_t **error );
 
+int libfsext_directory_build_name_hash_table(
+     libfsext_directory_t *directory,
+     libcerror_error_t **error );
+
+int libfsext_directory_prepare_name_hash_table(
+     libfsext_directory_t *directory,
+     libcerror_error_t **error );
+
 int libfsext_directory_get_number_of_entries(
      libfsext_directory_t *directory,
      int *number_of_entries,
@@ -98,6 +169,17 @@ int libfsext_directory_get_entry_by_utf16_name(
      libfsext_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsext_directory_get_number_of_deleted_entries(
+     libfsext_directory_t *directory,
+     int *number_of_deleted_entries,
+     libcerror_error_t **error );
+
+int libfsext_directory_get_deleted_entry_by_index(
+     libfsext_directory_t *directory,
+     int entry_index,
+     libfsext_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -54,6 +54,10 @@ struct libfsext_directory_entry
 	/* Name size
 	 */
 	uint8_t name_size;
+
+	/* Value to indicate the directory entry was recovered from the slack of another directory entry
+	 */
+	uint8_t is_deleted;
 };
 
 int libfsext_directory_entry_initialize(
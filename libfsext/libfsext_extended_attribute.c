@@ -24,7 +24,7 @@
 #include <types.h>
 
 #include "libfsext_attribute_values.h"
-#include "libfsext_block_stream.h"
+#include "libfsext_definitions.h"
 #include "libfsext_extended_attribute.h"
 #include "libfsext_extent.h"
 #include "libfsext_inode.h"
@@ -34,7 +34,6 @@
 #include "libfsext_libcerror.h"
 #include "libfsext_libcnotify.h"
 #include "libfsext_libcthreads.h"
-#include "libfsext_libfdata.h"
 #include "libfsext_types.h"
 
 /* Creates an extended_attribute
@@ -197,22 +196,6 @@ int libfsext_extended_attribute_free(
 				result = -1;
 			}
 		}
-		if( internal_extended_attribute->data_stream != NULL )
-		{
-			if( libfdata_stream_free(
-			     &( internal_extended_attribute->data_stream ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data stream.",
-				 function );
-
-				result = -1;
-			}
-		}
 		memory_free(
 		 internal_extended_attribute );
 	}
@@ -515,15 +498,15 @@ int libfsext_extended_attribute_get_utf16_name(
 	return( result );
 }
 
-/* Determines the data stream
+/* Determines the data extents
  * Returns 1 if successful or -1 on error
  */
-int libfsext_internal_extended_attribute_get_data_stream(
+int libfsext_internal_extended_attribute_get_data_extents(
      libfsext_internal_extended_attribute_t *internal_extended_attribute,
      libcerror_error_t **error )
 {
 	libfsext_inode_t *inode = NULL;
-	static char *function   = "libfsext_internal_extended_attribute_get_data_stream";
+	static char *function   = "libfsext_internal_extended_attribute_get_data_extents";
 	int result              = 0;
 
 	if( internal_extended_attribute == NULL )
@@ -548,13 +531,13 @@ int libfsext_internal_extended_attribute_get_data_stream(
 
 		return( -1 );
 	}
-	if( internal_extended_attribute->data_stream != NULL )
+	if( internal_extended_attribute->data_extents_array != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid extended attribute - data stream value already set.",
+		 "%s: invalid extended attribute - data extents array value already set.",
 		 function );
 
 		return( -1 );
@@ -590,49 +573,31 @@ int libfsext_internal_extended_attribute_get_data_stream(
 
 			goto on_error;
 		}
-		if( libcdata_array_clone(
-		     &( internal_extended_attribute->data_extents_array ),
-		     inode->data_extents_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
-		     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfsext_extent_clone,
-		     error ) != 1 )
+		if( ( internal_extended_attribute->io_handle->format_version == 4 )
+		 && ( ( inode->flags & LIBFSEXT_INODE_FLAG_INLINE_DATA ) != 0 ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents array.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported inline data in extended attribute value inode: %" PRIu32 ".",
+			 function,
+			 internal_extended_attribute->attribute_values->value_data_inode_number );
 
 			goto on_error;
 		}
-		result = libfsext_block_stream_initialize(
-		          &( internal_extended_attribute->data_stream ),
-		          internal_extended_attribute->io_handle,
-		          inode,
-		          (size64_t) internal_extended_attribute->attribute_values->value_data_size,
+		result = libcdata_array_clone(
+		          &( internal_extended_attribute->data_extents_array ),
+		          inode->data_extents_array,
+		          (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
+		          (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfsext_extent_clone,
 		          error );
 	}
 	else
 	{
-		if( libcdata_array_initialize(
-		     &( internal_extended_attribute->data_extents_array ),
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents array.",
-			 function );
-
-			goto on_error;
-		}
-		result = libfsext_block_stream_initialize_from_data(
-		          &( internal_extended_attribute->data_stream ),
-		          internal_extended_attribute->attribute_values->value_data,
-		          (size_t) internal_extended_attribute->attribute_values->value_data_size,
+		result = libcdata_array_initialize(
+		          &( internal_extended_attribute->data_extents_array ),
+		          0,
 		          error );
 	}
 	if( result != 1 )
@@ -641,7 +606,7 @@ int libfsext_internal_extended_attribute_get_data_stream(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create block stream.",
+		 "%s: unable to create data extents array.",
 		 function );
 
 		goto on_error;
@@ -659,6 +624,289 @@ on_error:
 	return( -1 );
 }
 
+/* Reads data at a specific offset
+ * Values stored in the attribute entry are copied from the attribute values,
+ * values stored in a separate inode are read directly from its data extents
+ * into the buffer.
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsext_internal_extended_attribute_read_buffer_at_offset(
+         libfsext_internal_extended_attribute_t *internal_extended_attribute,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsext_extent_t *extent      = NULL;
+	static char *function          = "libfsext_internal_extended_attribute_read_buffer_at_offset";
+	size64_t extent_size           = 0;
+	size64_t value_data_size       = 0;
+	size_t buffer_offset           = 0;
+	size_t read_size               = 0;
+	ssize_t read_count             = 0;
+	off64_t extent_logical_offset  = 0;
+	off64_t extent_physical_offset = 0;
+	off64_t next_extent_offset     = 0;
+	int extent_index               = 0;
+	int number_of_extents          = 0;
+
+	if( internal_extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid extended attribute - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute->attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid extended attribute - missing attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	value_data_size = (size64_t) internal_extended_attribute->attribute_values->value_data_size;
+
+	if( (size64_t) offset >= value_data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( value_data_size - offset ) )
+	{
+		buffer_size = (size_t) ( value_data_size - offset );
+	}
+	if( internal_extended_attribute->attribute_values->value_data_inode_number == 0 )
+	{
+		if( internal_extended_attribute->attribute_values->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid extended attribute - invalid attribute values - missing value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( ( internal_extended_attribute->attribute_values->value_data )[ offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+	if( internal_extended_attribute->data_extents_array == NULL )
+	{
+		if( libfsext_internal_extended_attribute_get_data_extents(
+		     internal_extended_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine data extents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_extended_attribute->data_extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		read_size          = buffer_size - buffer_offset;
+		next_extent_offset = (off64_t) value_data_size;
+
+		for( extent_index = 0;
+		     extent_index < number_of_extents;
+		     extent_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_extended_attribute->data_extents_array,
+			     extent_index,
+			     (intptr_t **) &extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			if( extent == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			extent_logical_offset = (off64_t) extent->logical_block_number * internal_extended_attribute->io_handle->block_size;
+			extent_size           = (size64_t) extent->number_of_blocks * internal_extended_attribute->io_handle->block_size;
+
+			if( offset < extent_logical_offset )
+			{
+				if( extent_logical_offset < next_extent_offset )
+				{
+					next_extent_offset = extent_logical_offset;
+				}
+				continue;
+			}
+			if( (size64_t) ( offset - extent_logical_offset ) < extent_size )
+			{
+				break;
+			}
+		}
+		if( extent_index >= number_of_extents )
+		{
+			/* The offset is not covered by an extent and is considered sparse
+			 */
+			extent = NULL;
+
+			if( (size64_t) read_size > (size64_t) ( next_extent_offset - offset ) )
+			{
+				read_size = (size_t) ( next_extent_offset - offset );
+			}
+		}
+		else if( (size64_t) read_size > ( extent_size - ( offset - extent_logical_offset ) ) )
+		{
+			read_size = (size_t) ( extent_size - ( offset - extent_logical_offset ) );
+		}
+		if( ( extent == NULL )
+		 || ( ( extent->range_flags & LIBFSEXT_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			extent_physical_offset = (off64_t) ( extent->physical_block_number * internal_extended_attribute->io_handle->block_size )
+			                       + ( offset - extent_logical_offset );
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              internal_extended_attribute->file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              extent_physical_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read value data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 extent_physical_offset,
+				 extent_physical_offset );
+
+				return( -1 );
+			}
+			libfsext_io_handle_update_read_statistics(
+			 internal_extended_attribute->io_handle,
+			 LIBFSEXT_STATISTICS_VALUE_EXTENDED_ATTRIBUTES_NUMBER_OF_READS,
+			 read_size );
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
 /* Reads data at the current offset into a buffer
  * Returns the number of bytes read or -1 on error
  */
@@ -700,43 +948,27 @@ ssize_t libfsext_extended_attribute_read_buffer(
 		return( -1 );
 	}
 #endif
-	if( internal_extended_attribute->data_stream == NULL )
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              internal_extended_attribute->current_offset,
+	              error );
+
+	if( read_count < 0 )
 	{
-		if( libfsext_internal_extended_attribute_get_data_stream(
-		     internal_extended_attribute,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
 
-			read_count = -1;
-		}
+		read_count = -1;
 	}
-	if( internal_extended_attribute->data_stream != NULL )
+	else
 	{
-		read_count = libfdata_stream_read_buffer(
-		              internal_extended_attribute->data_stream,
-		              (intptr_t *) internal_extended_attribute->file_io_handle,
-		              (uint8_t *) buffer,
-		              buffer_size,
-		              0,
-		              error );
-
-		if( read_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer from data stream.",
-			 function );
-
-			read_count = -1;
-		}
+		internal_extended_attribute->current_offset += (off64_t) read_count;
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -798,44 +1030,27 @@ ssize_t libfsext_extended_attribute_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	if( internal_extended_attribute->data_stream == NULL )
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
 	{
-		if( libfsext_internal_extended_attribute_get_data_stream(
-		     internal_extended_attribute,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset.",
+		 function );
 
-			read_count = -1;
-		}
+		read_count = -1;
 	}
-	if( internal_extended_attribute->data_stream != NULL )
+	else
 	{
-		read_count = libfdata_stream_read_buffer_at_offset(
-		              internal_extended_attribute->data_stream,
-		              (intptr_t *) internal_extended_attribute->file_io_handle,
-		              (uint8_t *) buffer,
-		              buffer_size,
-		              offset,
-		              0,
-		              error );
-
-		if( read_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer at offset from data stream.",
-			 function );
-
-			read_count = -1;
-		}
+		internal_extended_attribute->current_offset = offset + (off64_t) read_count;
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -880,6 +1095,30 @@ off64_t libfsext_extended_attribute_seek_offset(
 	}
 	internal_extended_attribute = (libfsext_internal_extended_attribute_t *) extended_attribute;
 
+	if( internal_extended_attribute->attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid extended attribute - missing attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_extended_attribute->read_write_lock,
@@ -895,41 +1134,28 @@ off64_t libfsext_extended_attribute_seek_offset(
 		return( -1 );
 	}
 #endif
-	if( internal_extended_attribute->data_stream == NULL )
+	if( whence == SEEK_CUR )
 	{
-		if( libfsext_internal_extended_attribute_get_data_stream(
-		     internal_extended_attribute,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
-			 function );
-
-			offset = -1;
-		}
+		offset += internal_extended_attribute->current_offset;
 	}
-	if( internal_extended_attribute->data_stream != NULL )
+	else if( whence == SEEK_END )
 	{
-		offset = libfdata_stream_seek_offset(
-		          internal_extended_attribute->data_stream,
-		          offset,
-		          whence,
-		          error );
-
-		if( offset < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek offset in data stream.",
-			 function );
+		offset += (off64_t) internal_extended_attribute->attribute_values->value_data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
 
-			offset = -1;
-		}
+		offset = -1;
+	}
+	else
+	{
+		internal_extended_attribute->current_offset = offset;
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -959,7 +1185,6 @@ int libfsext_extended_attribute_get_offset(
 {
 	libfsext_internal_extended_attribute_t *internal_extended_attribute = NULL;
 	static char *function                                               = "libfsext_extended_attribute_get_offset";
-	int result                                                          = 1;
 
 	if( extended_attribute == NULL )
 	{
@@ -974,8 +1199,19 @@ int libfsext_extended_attribute_get_offset(
 	}
 	internal_extended_attribute = (libfsext_internal_extended_attribute_t *) extended_attribute;
 
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_extended_attribute->read_write_lock,
 	     error ) != 1 )
 	{
@@ -983,47 +1219,16 @@ int libfsext_extended_attribute_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_extended_attribute->data_stream == NULL )
-	{
-		if( libfsext_internal_extended_attribute_get_data_stream(
-		     internal_extended_attribute,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
-			 function );
+	*offset = internal_extended_attribute->current_offset;
 
-			result = -1;
-		}
-	}
-	if( internal_extended_attribute->data_stream != NULL )
-	{
-		if( libfdata_stream_get_offset(
-		     internal_extended_attribute->data_stream,
-		     offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset from data stream.",
-			 function );
-
-			result = -1;
-		}
-	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_extended_attribute->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1031,13 +1236,13 @@ int libfsext_extended_attribute_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
 /* Retrieves the size of the data stream object
@@ -1161,11 +1366,9 @@ int libfsext_extended_attribute_get_number_of_extents(
 		return( -1 );
 	}
 #endif
-	if( internal_extended_attribute->data_stream == NULL )
+	if( internal_extended_attribute->data_extents_array == NULL )
 	{
-		/* Determining the data stream will initialize the extents array
-		 */
-		if( libfsext_internal_extended_attribute_get_data_stream(
+		if( libfsext_internal_extended_attribute_get_data_extents(
 		     internal_extended_attribute,
 		     error ) != 1 )
 		{
@@ -1173,7 +1376,7 @@ int libfsext_extended_attribute_get_number_of_extents(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
+			 "%s: unable to determine data extents.",
 			 function );
 
 			result = -1;
@@ -1258,11 +1461,9 @@ int libfsext_extended_attribute_get_extent_by_index(
 		return( -1 );
 	}
 #endif
-	if( internal_extended_attribute->data_stream == NULL )
+	if( internal_extended_attribute->data_extents_array == NULL )
 	{
-		/* Determining the data stream will initialize the extents array
-		 */
-		if( libfsext_internal_extended_attribute_get_data_stream(
+		if( libfsext_internal_extended_attribute_get_data_extents(
 		     internal_extended_attribute,
 		     error ) != 1 )
 		{
@@ -1270,7 +1471,7 @@ int libfsext_extended_attribute_get_extent_by_index(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
+			 "%s: unable to determine data extents.",
 			 function );
 
 			result = -1;
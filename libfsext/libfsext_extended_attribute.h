@@ -33,7 +33,6 @@
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libcthreads.h"
-#include "libfsext_libfdata.h"
 #include "libfsext_types.h"
 
 #if defined( __cplusplus )
@@ -60,9 +59,9 @@ struct libfsext_internal_extended_attribute
 	 */
 	libfsext_attribute_values_t *attribute_values;
 
-	/* The data stream
+	/* The current offset
 	 */
-	libfdata_stream_t *data_stream;
+	off64_t current_offset;
 
 	/* Data extents array
 	 */
@@ -114,10 +113,17 @@ int libfsext_extended_attribute_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
-int libfsext_internal_extended_attribute_get_data_stream(
+int libfsext_internal_extended_attribute_get_data_extents(
      libfsext_internal_extended_attribute_t *internal_extended_attribute,
      libcerror_error_t **error );
 
+ssize_t libfsext_internal_extended_attribute_read_buffer_at_offset(
+         libfsext_internal_extended_attribute_t *internal_extended_attribute,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBFSEXT_EXTERN \
 ssize_t libfsext_extended_attribute_read_buffer(
          libfsext_extended_attribute_t *extended_attribute,
@@ -0,0 +1,597 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsext_definitions.h"
+#include "libfsext_extent.h"
+#include "libfsext_extent_map.h"
+#include "libfsext_io_handle.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+
+/* Creates an extent map
+ * Make sure the value extent_map is referencing, is set to NULL
+ * The logical block numbers of the entries are determined from the order of the extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_extent_map_initialize(
+     libfsext_extent_map_t **extent_map,
+     uint32_t block_size,
+     size64_t data_size,
+     libcdata_array_t *extents_array,
+     libcerror_error_t **error )
+{
+	libfsext_extent_map_entry_t *entry = NULL;
+	libfsext_extent_t *extent          = NULL;
+	static char *function              = "libfsext_extent_map_initialize";
+	uint64_t logical_block_number      = 0;
+	uint64_t physical_block_number     = 0;
+	int extent_index                   = 0;
+	int number_of_extents              = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_extents > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsext_extent_map_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of extents value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_map = memory_allocate_structure(
+	               libfsext_extent_map_t );
+
+	if( *extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_map,
+	     0,
+	     sizeof( libfsext_extent_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent map.",
+		 function );
+
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+
+		return( -1 );
+	}
+	if( number_of_extents > 0 )
+	{
+		( *extent_map )->entries = (libfsext_extent_map_entry_t *) memory_allocate(
+		                                                            sizeof( libfsext_extent_map_entry_t ) * number_of_extents );
+
+		if( ( *extent_map )->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent->number_of_blocks == 0 )
+		{
+			continue;
+		}
+		if( ( logical_block_number > (uint64_t) UINT32_MAX )
+		 || ( extent->number_of_blocks > ( (uint64_t) UINT32_MAX - logical_block_number + 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent: %d - invalid number of blocks value out of bounds.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		physical_block_number = 0;
+
+		if( ( extent->range_flags & LIBFSEXT_EXTENT_FLAG_IS_SPARSE ) == 0 )
+		{
+			physical_block_number = extent->physical_block_number;
+
+			if( ( physical_block_number > LIBFSEXT_EXTENT_MAP_ENTRY_MAXIMUM_PHYSICAL_BLOCK_NUMBER )
+			 || ( ( physical_block_number + extent->number_of_blocks ) > ( (uint64_t) INT64_MAX / block_size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid extent: %d - invalid physical block number value out of bounds.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+		}
+		entry = &( ( ( *extent_map )->entries )[ ( *extent_map )->number_of_entries ] );
+
+		entry->logical_block_number        = (uint32_t) logical_block_number;
+		entry->number_of_blocks            = (uint32_t) extent->number_of_blocks;
+		entry->lower_physical_block_number = (uint32_t) ( physical_block_number & 0xffffffffUL );
+		entry->upper_physical_block_number = (uint16_t) ( physical_block_number >> 32 );
+		entry->flags                       = (uint16_t) ( extent->range_flags & 0x0000ffffUL );
+
+		( *extent_map )->number_of_entries += 1;
+
+		logical_block_number += extent->number_of_blocks;
+	}
+	( *extent_map )->block_size = block_size;
+	( *extent_map )->data_size  = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *extent_map != NULL )
+	{
+		if( ( *extent_map )->entries != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->entries );
+		}
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_extent_map_free(
+     libfsext_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_extent_map_free";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		if( ( *extent_map )->entries != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->entries );
+		}
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the entry that contains a specific logical block number
+ * If no entry contains the logical block number, entry_index is set to the index
+ * of the first entry that follows it or the number of entries if there is none
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfsext_extent_map_get_entry_index_by_logical_block_number(
+     libfsext_extent_map_t *extent_map,
+     uint32_t logical_block_number,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libfsext_extent_map_entry_t *entry = NULL;
+	static char *function              = "libfsext_extent_map_get_entry_index_by_logical_block_number";
+	int lower_entry_index              = 0;
+	int middle_entry_index             = 0;
+	int upper_entry_index              = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the first entry with a logical block number larger than the one requested
+	 */
+	upper_entry_index = extent_map->number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( extent_map->entries[ middle_entry_index ].logical_block_number <= logical_block_number )
+		{
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+		}
+	}
+	if( lower_entry_index > 0 )
+	{
+		entry = &( extent_map->entries[ lower_entry_index - 1 ] );
+
+		if( ( logical_block_number - entry->logical_block_number ) < entry->number_of_blocks )
+		{
+			*entry_index = lower_entry_index - 1;
+
+			return( 1 );
+		}
+	}
+	*entry_index = lower_entry_index;
+
+	return( 0 );
+}
+
+/* Reads data at a specific offset
+ * Ranges that are sparse or not covered by an entry are filled with 0-byte values
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsext_extent_map_read_buffer_at_offset(
+         libfsext_extent_map_t *extent_map,
+         libfsext_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsext_extent_map_entry_t *entry = NULL;
+	static char *function              = "libfsext_extent_map_read_buffer_at_offset";
+	size64_t range_size                = 0;
+	size_t buffer_offset               = 0;
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	uint64_t logical_block_number      = 0;
+	uint64_t physical_block_number     = 0;
+	off64_t file_offset                = 0;
+	off64_t logical_offset             = 0;
+	uint32_t block_offset              = 0;
+	int entry_index                    = 0;
+	int result                         = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent map - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= extent_map->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( extent_map->data_size - offset ) )
+	{
+		buffer_size = (size_t) ( extent_map->data_size - offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		logical_offset       = offset + (off64_t) buffer_offset;
+		logical_block_number = (uint64_t) logical_offset / extent_map->block_size;
+		block_offset         = (uint32_t) ( (uint64_t) logical_offset % extent_map->block_size );
+
+		entry  = NULL;
+		result = 0;
+
+		if( logical_block_number <= (uint64_t) UINT32_MAX )
+		{
+			result = libfsext_extent_map_get_entry_index_by_logical_block_number(
+			          extent_map,
+			          (uint32_t) logical_block_number,
+			          &entry_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry for logical block number: %" PRIu64 ".",
+				 function,
+				 logical_block_number );
+
+				return( -1 );
+			}
+		}
+		if( result != 0 )
+		{
+			entry = &( extent_map->entries[ entry_index ] );
+
+			range_size = (size64_t) ( entry->number_of_blocks - ( (uint32_t) logical_block_number - entry->logical_block_number ) ) * extent_map->block_size;
+		}
+		else if( ( logical_block_number <= (uint64_t) UINT32_MAX )
+		      && ( entry_index < extent_map->number_of_entries ) )
+		{
+			range_size = (size64_t) ( extent_map->entries[ entry_index ].logical_block_number - (uint32_t) logical_block_number ) * extent_map->block_size;
+		}
+		else
+		{
+			range_size = (size64_t) ( buffer_size - buffer_offset ) + block_offset;
+		}
+		range_size -= block_offset;
+
+		read_size = buffer_size - buffer_offset;
+
+		if( (size64_t) read_size > range_size )
+		{
+			read_size = (size_t) range_size;
+		}
+		if( ( entry == NULL )
+		 || ( ( entry->flags & LIBFSEXT_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			physical_block_number = ( (uint64_t) entry->upper_physical_block_number << 32 )
+			                      | entry->lower_physical_block_number;
+
+			physical_block_number += (uint32_t) logical_block_number - entry->logical_block_number;
+
+			file_offset = (off64_t) ( physical_block_number * extent_map->block_size ) + block_offset;
+
+			LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+			 io_handle,
+			 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+			 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+			 0,
+			 file_offset,
+			 read_size );
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              file_offset,
+			              error );
+
+			LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+			 io_handle,
+			 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+			 LIBFSEXT_TRACE_EVENT_PHASE_END,
+			 0,
+			 file_offset,
+			 read_size );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+			libfsext_io_handle_update_read_statistics(
+			 io_handle,
+			 LIBFSEXT_STATISTICS_VALUE_DATA_NUMBER_OF_READS,
+			 read_size );
+		}
+		buffer_offset += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
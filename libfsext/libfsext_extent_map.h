@@ -0,0 +1,121 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSEXT_EXTENT_MAP_H )
+#define _LIBFSEXT_EXTENT_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsext_io_handle.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum physical block number of an extent map entry
+ */
+#define LIBFSEXT_EXTENT_MAP_ENTRY_MAXIMUM_PHYSICAL_BLOCK_NUMBER	0x0000ffffffffffffULL
+
+typedef struct libfsext_extent_map_entry libfsext_extent_map_entry_t;
+
+/* An extent map entry is 16 bytes in size
+ */
+struct libfsext_extent_map_entry
+{
+	/* Logical block number
+	 */
+	uint32_t logical_block_number;
+
+	/* Number of blocks
+	 */
+	uint32_t number_of_blocks;
+
+	/* Lower 32-bit of the physical block number
+	 */
+	uint32_t lower_physical_block_number;
+
+	/* Upper 16-bit of the physical block number
+	 */
+	uint16_t upper_physical_block_number;
+
+	/* The extent flags
+	 */
+	uint16_t flags;
+};
+
+typedef struct libfsext_extent_map libfsext_extent_map_t;
+
+struct libfsext_extent_map
+{
+	/* The entries
+	 * Sorted by logical block number
+	 */
+	libfsext_extent_map_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The data size
+	 */
+	size64_t data_size;
+};
+
+int libfsext_extent_map_initialize(
+     libfsext_extent_map_t **extent_map,
+     uint32_t block_size,
+     size64_t data_size,
+     libcdata_array_t *extents_array,
+     libcerror_error_t **error );
+
+int libfsext_extent_map_free(
+     libfsext_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libfsext_extent_map_get_entry_index_by_logical_block_number(
+     libfsext_extent_map_t *extent_map,
+     uint32_t logical_block_number,
+     int *entry_index,
+     libcerror_error_t **error );
+
+ssize_t libfsext_extent_map_read_buffer_at_offset(
+         libfsext_extent_map_t *extent_map,
+         libfsext_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSEXT_EXTENT_MAP_H ) */
+
@@ -701,7 +701,7 @@ int libfsext_extents_read_file_io_handle(
 {
 	uint8_t *data         = NULL;
 	static char *function = "libfsext_extents_read_file_io_handle";
-	ssize_t read_count    = 0;
+	int result            = 0;
 
 	if( io_handle == NULL )
 	{
@@ -751,14 +751,31 @@ int libfsext_extents_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              data,
-	              (size_t) io_handle->block_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->block_size )
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+	 0,
+	 file_offset,
+	 io_handle->block_size );
+
+	result = libfsext_io_handle_read_metadata_at_offset(
+	          io_handle,
+	          file_io_handle,
+	          data,
+	          (size_t) io_handle->block_size,
+	          file_offset,
+	          error );
+
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 0,
+	 file_offset,
+	 io_handle->block_size );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -771,6 +788,11 @@ int libfsext_extents_read_file_io_handle(
 
 		goto on_error;
 	}
+	libfsext_io_handle_update_read_statistics(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_EXTENT_INDEX_NUMBER_OF_READS,
+	 (size_t) io_handle->block_size );
+
 	if( libfsext_extents_read_data(
 	     extents_array,
 	     io_handle,
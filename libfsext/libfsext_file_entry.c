@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
@@ -30,6 +31,7 @@
 #include "libfsext_directory.h"
 #include "libfsext_directory_entry.h"
 #include "libfsext_extended_attribute.h"
+#include "libfsext_extent_map.h"
 #include "libfsext_file_entry.h"
 #include "libfsext_inode.h"
 #include "libfsext_inode_table.h"
@@ -160,8 +162,15 @@ int libfsext_file_entry_initialize(
 
 			goto on_error;
 		}
-		if( ( ( inode->file_mode & 0xf000 ) == LIBFSEXT_FILE_TYPE_REGULAR_FILE )
-		 || ( internal_file_entry->data_size >= 60 ) )
+		if( ( ( inode->file_mode & 0xf000 ) != LIBFSEXT_FILE_TYPE_REGULAR_FILE )
+		 && ( internal_file_entry->data_size < 60 ) )
+		{
+			/* The symbolic link target is stored in the inode
+			 */
+		}
+		else if( ( internal_file_entry->data_size == 0 )
+		      || ( ( io_handle->format_version == 4 )
+		       &&  ( ( inode->flags & LIBFSEXT_INODE_FLAG_INLINE_DATA ) != 0 ) ) )
 		{
 			if( libfsext_block_stream_initialize(
 			     &( internal_file_entry->data_block_stream ),
@@ -180,6 +189,28 @@ int libfsext_file_entry_initialize(
 				goto on_error;
 			}
 		}
+		else
+		{
+			/* Data stored in blocks is read directly using the extent map
+			 * instead of the generic segment mapping of a block stream
+			 */
+			if( libfsext_extent_map_initialize(
+			     &( internal_file_entry->data_extent_map ),
+			     io_handle->block_size,
+			     internal_file_entry->data_size,
+			     inode->data_extents_array,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data extent map.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
@@ -210,6 +241,12 @@ int libfsext_file_entry_initialize(
 on_error:
 	if( internal_file_entry != NULL )
 	{
+		if( internal_file_entry->data_extent_map != NULL )
+		{
+			libfsext_extent_map_free(
+			 &( internal_file_entry->data_extent_map ),
+			 NULL );
+		}
 		if( internal_file_entry->data_block_stream != NULL )
 		{
 			libfdata_stream_free(
@@ -315,6 +352,16 @@ int libfsext_file_entry_free(
 				result = -1;
 			}
 		}
+		if( internal_file_entry->extended_attributes_hash_buckets != NULL )
+		{
+			memory_free(
+			 internal_file_entry->extended_attributes_hash_buckets );
+		}
+		if( internal_file_entry->extended_attributes_hash_chains != NULL )
+		{
+			memory_free(
+			 internal_file_entry->extended_attributes_hash_chains );
+		}
 		if( internal_file_entry->directory != NULL )
 		{
 			if( libfsext_directory_free(
@@ -347,6 +394,22 @@ int libfsext_file_entry_free(
 				result = -1;
 			}
 		}
+		if( internal_file_entry->data_extent_map != NULL )
+		{
+			if( libfsext_extent_map_free(
+			     &( internal_file_entry->data_extent_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data extent map.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_file_entry->symbolic_link_data != NULL )
 		{
 			memory_free(
@@ -358,6 +421,90 @@ int libfsext_file_entry_free(
 	return( result );
 }
 
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsext_internal_file_entry_read_buffer_at_offset(
+         libfsext_internal_file_entry_t *internal_file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsext_internal_file_entry_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->data_extent_map != NULL )
+	{
+		read_count = libfsext_extent_map_read_buffer_at_offset(
+		              internal_file_entry->data_extent_map,
+		              internal_file_entry->io_handle,
+		              internal_file_entry->file_io_handle,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data extent map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( internal_file_entry->data_block_stream != NULL )
+	{
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              internal_file_entry->data_block_stream,
+		              (intptr_t *) internal_file_entry->file_io_handle,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              offset,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data block stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data block stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
 /* Determines the directory
  * Returns 1 if successful or -1 on error
  */
@@ -567,13 +714,11 @@ int libfsext_internal_file_entry_get_symbolic_link_data(
 		}
 		else
 		{
-			read_count = libfdata_stream_read_buffer_at_offset(
-			              internal_file_entry->data_block_stream,
-			              (intptr_t *) internal_file_entry->file_io_handle,
+			read_count = libfsext_internal_file_entry_read_buffer_at_offset(
+			              internal_file_entry,
 			              internal_file_entry->symbolic_link_data,
 			              (size_t) data_size,
 			              0,
-			              0,
 			              error );
 
 			if( read_count != (ssize_t) data_size )
@@ -582,7 +727,7 @@ int libfsext_internal_file_entry_get_symbolic_link_data(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read from data block stream.",
+				 "%s: unable to read symbolic link data.",
 				 function );
 
 				goto on_error;
@@ -688,6 +833,69 @@ int libfsext_file_entry_is_empty(
 	return( result );
 }
 
+/* Determines if the file entry is deleted
+ * A file entry is deleted if its directory entry was recovered from the slack of another directory entry
+ * Returns 1 if deleted, 0 if not or -1 on error
+ */
+int libfsext_file_entry_is_deleted(
+     libfsext_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsext_file_entry_is_deleted";
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file_entry->directory_entry != NULL )
+	 && ( internal_file_entry->directory_entry->is_deleted != 0 ) )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the inode number
  * Returns 1 if successful or -1 on error
  */
@@ -2332,10 +2540,26 @@ int libfsext_internal_file_entry_get_extended_attributes(
 
 		return( -1 );
 	}
+	/* The inode is shared hence its extended attributes are copied
+	 */
 	if( internal_file_entry->inode->extended_attributes_array != NULL )
 	{
-		internal_file_entry->extended_attributes_array        = internal_file_entry->inode->extended_attributes_array;
-		internal_file_entry->inode->extended_attributes_array = NULL;
+		if( libcdata_array_clone(
+		     &( internal_file_entry->extended_attributes_array ),
+		     internal_file_entry->inode->extended_attributes_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_attribute_values_free,
+		     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfsext_attribute_values_clone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extended attributes array.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	else
 	{
@@ -2370,11 +2594,13 @@ int libfsext_internal_file_entry_get_extended_attributes(
 	}
 	if( file_acl_block_number != 0 )
 	{
-		if( libfsext_attributes_block_read_file_io_handle(
-		     internal_file_entry->extended_attributes_array,
+		if( libfsext_attributes_block_get_extended_attributes(
+		     internal_file_entry->inode_table->attributes_blocks_cache,
+		     &( internal_file_entry->inode_table->attributes_blocks_cache_timestamp ),
 		     internal_file_entry->io_handle,
 		     internal_file_entry->file_io_handle,
-		     (off64_t) file_acl_block_number * internal_file_entry->io_handle->block_size,
+		     file_acl_block_number,
+		     internal_file_entry->extended_attributes_array,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2388,6 +2614,19 @@ int libfsext_internal_file_entry_get_extended_attributes(
 			goto on_error;
 		}
 	}
+	if( libfsext_internal_file_entry_build_extended_attributes_hash_table(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build extended attributes name hash table.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -2401,19 +2640,26 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the number of extended attributes
+/* Builds the extended attributes name hash table
+ * The hash table maps the name hash of an extended attribute to its index in
+ * the extended attributes array, so that a lookup by name only compares the names
+ * of the extended attributes with the same name hash
  * Returns 1 if successful or -1 on error
  */
-int libfsext_file_entry_get_number_of_extended_attributes(
-     libfsext_file_entry_t *file_entry,
-     int *number_of_extended_attributes,
+int libfsext_internal_file_entry_build_extended_attributes_hash_table(
+     libfsext_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error )
 {
-	libfsext_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsext_file_entry_get_number_of_extended_attributes";
-	int result                                          = 1;
+	libfsext_attribute_values_t *attribute_values = NULL;
+	static char *function                         = "libfsext_internal_file_entry_build_extended_attributes_hash_table";
+	int *hash_buckets                             = NULL;
+	int *hash_chains                              = NULL;
+	int attribute_index                           = 0;
+	int bucket_index                              = 0;
+	int number_of_attributes                      = 0;
+	int number_of_buckets                         = 0;
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2424,82 +2670,255 @@ int libfsext_file_entry_get_number_of_extended_attributes(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
-
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->extended_attributes_hash_buckets != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry - extended attributes hash buckets value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_file_entry->extended_attributes_array == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_file_entry->extended_attributes_array,
+	     &number_of_attributes,
+	     error ) != 1 )
 	{
-		if( libfsext_internal_file_entry_get_extended_attributes(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine extended attributes.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from extended attributes array.",
+		 function );
 
-			result = -1;
-		}
+		goto on_error;
 	}
-	if( result != -1 )
+	if( number_of_attributes == 0 )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_file_entry->extended_attributes_array,
-		     number_of_extended_attributes,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from extended attributes array.",
-			 function );
-
-			result = -1;
-		}
+		return( 1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( (size_t) number_of_attributes > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of attributes value exceeds maximum.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
-}
+	/* The number of buckets is a power of 2 of at least twice the number of extended attributes
+	 */
+	number_of_buckets = 8;
 
-/* Retrieves the extended attribute for the specific index
- * Returns 1 if successful or -1 on error
- */
-int libfsext_file_entry_get_extended_attribute_by_index(
-     libfsext_file_entry_t *file_entry,
-     int extended_attribute_index,
-     libfsext_extended_attribute_t **extended_attribute,
-     libcerror_error_t **error )
+	while( number_of_buckets < ( 2 * number_of_attributes ) )
+	{
+		number_of_buckets *= 2;
+	}
+	hash_buckets = (int *) memory_allocate(
+	                sizeof( int ) * number_of_buckets );
+
+	if( hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_buckets,
+	     0,
+	     sizeof( int ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	hash_chains = (int *) memory_allocate(
+	               sizeof( int ) * number_of_attributes );
+
+	if( hash_chains == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chains.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extended attributes are added in reverse order so that a chain
+	 * contains the first of the extended attributes with the same name first
+	 */
+	for( attribute_index = number_of_attributes - 1;
+	     attribute_index >= 0;
+	     attribute_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file_entry->extended_attributes_array,
+		     attribute_index,
+		     (intptr_t **) &attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d values.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( attribute_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing attribute: %d values.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		bucket_index = (int) ( attribute_values->name_hash & (uint32_t) ( number_of_buckets - 1 ) );
+
+		hash_chains[ attribute_index ] = hash_buckets[ bucket_index ];
+		hash_buckets[ bucket_index ]   = attribute_index + 1;
+	}
+	internal_file_entry->extended_attributes_hash_buckets           = hash_buckets;
+	internal_file_entry->extended_attributes_hash_chains            = hash_chains;
+	internal_file_entry->number_of_extended_attributes_hash_buckets = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( hash_chains != NULL )
+	{
+		memory_free(
+		 hash_chains );
+	}
+	if( hash_buckets != NULL )
+	{
+		memory_free(
+		 hash_buckets );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of extended attributes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_file_entry_get_number_of_extended_attributes(
+     libfsext_file_entry_t *file_entry,
+     int *number_of_extended_attributes,
+     libcerror_error_t **error )
+{
+	libfsext_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsext_file_entry_get_number_of_extended_attributes";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->extended_attributes_array == NULL )
+	{
+		if( libfsext_internal_file_entry_get_extended_attributes(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine extended attributes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_file_entry->extended_attributes_array,
+		     number_of_extended_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from extended attributes array.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the extended attribute for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_file_entry_get_extended_attribute_by_index(
+     libfsext_file_entry_t *file_entry,
+     int extended_attribute_index,
+     libfsext_extended_attribute_t **extended_attribute,
+     libcerror_error_t **error )
 {
 	libfsext_attribute_values_t *attribute_values       = NULL;
 	libfsext_internal_file_entry_t *internal_file_entry = NULL;
@@ -2641,8 +3060,9 @@ int libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
 {
 	libfsext_attribute_values_t *safe_attribute_values = NULL;
 	static char *function                              = "libfsext_internal_file_entry_get_attribute_values_by_utf8_name";
+	uint32_t name_hash                                 = 0;
 	int attribute_index                                = 0;
-	int number_of_attributes                           = 0;
+	int hash_chain_index                               = 0;
 	int result                                         = 0;
 
 	if( internal_file_entry == NULL )
@@ -2672,24 +3092,33 @@ int libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
 			return( -1 );
 		}
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_file_entry->extended_attributes_array,
-	     &number_of_attributes,
+	if( libfsext_attribute_values_calculate_utf8_name_hash(
+	     utf8_string,
+	     utf8_string_length,
+	     &name_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from extended attributes array.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( attribute_index = 0;
-	     attribute_index < number_of_attributes;
-	     attribute_index++ )
+	/* The hash table is not set if there are no extended attributes
+	 */
+	if( internal_file_entry->extended_attributes_hash_buckets == NULL )
+	{
+		return( 0 );
+	}
+	hash_chain_index = internal_file_entry->extended_attributes_hash_buckets[ name_hash & (uint32_t) ( internal_file_entry->number_of_extended_attributes_hash_buckets - 1 ) ];
+
+	while( hash_chain_index > 0 )
 	{
+		attribute_index = hash_chain_index - 1;
+
 		if( libcdata_array_get_entry_by_index(
 		     internal_file_entry->extended_attributes_array,
 		     attribute_index,
@@ -2706,30 +3135,34 @@ int libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
 
 			return( -1 );
 		}
-		result = libfsext_attribute_values_compare_name_with_utf8_string(
-		          safe_attribute_values,
-		          utf8_string,
-		          utf8_string_length,
-		          error );
-
-		if( result == -1 )
+		if( safe_attribute_values->name_hash == name_hash )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare UTF-8 string with name of attribute: %d values.",
-			 function,
-			 attribute_index );
+			result = libfsext_attribute_values_compare_name_with_utf8_string(
+			          safe_attribute_values,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
 
-			return( -1 );
-		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
-		{
-			*attribute_values = safe_attribute_values;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-8 string with name of attribute: %d values.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*attribute_values = safe_attribute_values;
 
-			return( 1 );
+				return( 1 );
+			}
 		}
+		hash_chain_index = internal_file_entry->extended_attributes_hash_chains[ attribute_index ];
 	}
 	return( 0 );
 }
@@ -2746,8 +3179,9 @@ int libfsext_internal_file_entry_get_attribute_values_by_utf16_name(
 {
 	libfsext_attribute_values_t *safe_attribute_values = NULL;
 	static char *function                              = "libfsext_internal_file_entry_get_attribute_values_by_utf16_name";
+	uint32_t name_hash                                 = 0;
 	int attribute_index                                = 0;
-	int number_of_attributes                           = 0;
+	int hash_chain_index                               = 0;
 	int result                                         = 0;
 
 	if( internal_file_entry == NULL )
@@ -2777,24 +3211,33 @@ int libfsext_internal_file_entry_get_attribute_values_by_utf16_name(
 			return( -1 );
 		}
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_file_entry->extended_attributes_array,
-	     &number_of_attributes,
+	if( libfsext_attribute_values_calculate_utf16_name_hash(
+	     utf16_string,
+	     utf16_string_length,
+	     &name_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from extended attributes array.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( attribute_index = 0;
-	     attribute_index < number_of_attributes;
-	     attribute_index++ )
+	/* The hash table is not set if there are no extended attributes
+	 */
+	if( internal_file_entry->extended_attributes_hash_buckets == NULL )
+	{
+		return( 0 );
+	}
+	hash_chain_index = internal_file_entry->extended_attributes_hash_buckets[ name_hash & (uint32_t) ( internal_file_entry->number_of_extended_attributes_hash_buckets - 1 ) ];
+
+	while( hash_chain_index > 0 )
 	{
+		attribute_index = hash_chain_index - 1;
+
 		if( libcdata_array_get_entry_by_index(
 		     internal_file_entry->extended_attributes_array,
 		     attribute_index,
@@ -2811,30 +3254,34 @@ int libfsext_internal_file_entry_get_attribute_values_by_utf16_name(
 
 			return( -1 );
 		}
-		result = libfsext_attribute_values_compare_name_with_utf16_string(
-		          safe_attribute_values,
-		          utf16_string,
-		          utf16_string_length,
-		          error );
-
-		if( result == -1 )
+		if( safe_attribute_values->name_hash == name_hash )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare UTF-16 string with name of attribute: %d values.",
-			 function,
-			 attribute_index );
+			result = libfsext_attribute_values_compare_name_with_utf16_string(
+			          safe_attribute_values,
+			          utf16_string,
+			          utf16_string_length,
+			          error );
 
-			return( -1 );
-		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
-		{
-			*attribute_values = safe_attribute_values;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-16 string with name of attribute: %d values.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*attribute_values = safe_attribute_values;
 
-			return( 1 );
+				return( 1 );
+			}
 		}
+		hash_chain_index = internal_file_entry->extended_attributes_hash_chains[ attribute_index ];
 	}
 	return( 0 );
 }
@@ -3032,104 +3479,915 @@ int libfsext_file_entry_get_extended_attribute_by_utf8_name(
 		 "%s: invalid extended attribute.",
 		 function );
 
-		return( -1 );
+		return( -1 );
+	}
+	if( *extended_attribute != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extended attribute value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
+	          internal_file_entry,
+	          utf8_string,
+	          utf8_string_length,
+	          &attribute_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute values for UTF-8 name.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		if( libfsext_extended_attribute_initialize(
+		     extended_attribute,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->inode_table,
+		     attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extended attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the extended attribute for an UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsext_file_entry_get_extended_attribute_by_utf16_name(
+     libfsext_file_entry_t *file_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsext_extended_attribute_t **extended_attribute,
+     libcerror_error_t **error )
+{
+	libfsext_attribute_values_t *attribute_values       = NULL;
+	libfsext_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsext_file_entry_get_extended_attribute_by_utf16_name";
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
+
+	if( extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extended_attribute != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extended attribute value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsext_internal_file_entry_get_attribute_values_by_utf16_name(
+	          internal_file_entry,
+	          utf16_string,
+	          utf16_string_length,
+	          &attribute_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute values for UTF-16 name.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		if( libfsext_extended_attribute_initialize(
+		     extended_attribute,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->inode_table,
+		     attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extended attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Copies the names and values of all extended attributes into a data buffer
+ * If data is NULL only the required data size is determined
+ *
+ * Every extended attribute is stored as a record of:
+ *   2 bytes (little-endian) UTF-8 name size including end-of-string character
+ *   1 byte flags, see LIBFSEXT_EXTENDED_ATTRIBUTE_DATA_FLAGS
+ *   1 byte unused (0)
+ *   4 bytes (little-endian) value data size
+ *   the UTF-8 encoded name including end-of-string character
+ *   the value data, if it is not stored in a separate inode
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_internal_file_entry_get_all_extended_attributes(
+     libfsext_internal_file_entry_t *internal_file_entry,
+     uint8_t *data,
+     size_t data_size,
+     size_t *required_data_size,
+     libcerror_error_t **error )
+{
+	libfsext_attribute_values_t *attribute_values = NULL;
+	static char *function                         = "libfsext_internal_file_entry_get_all_extended_attributes";
+	size_t data_offset                            = 0;
+	size_t record_size                            = 0;
+	uint32_t value_data_size                      = 0;
+	uint8_t record_flags                          = 0;
+	int attribute_index                           = 0;
+	int number_of_attributes                      = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->extended_attributes_array == NULL )
+	{
+		if( libfsext_internal_file_entry_get_extended_attributes(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine extended attributes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file_entry->extended_attributes_array,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from extended attributes array.",
+		 function );
+
+		return( -1 );
+	}
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file_entry->extended_attributes_array,
+		     attribute_index,
+		     (intptr_t **) &attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d values.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		if( attribute_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing attribute: %d values.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		if( ( attribute_values->name == NULL )
+		 || ( attribute_values->name_size == 0 )
+		 || ( attribute_values->name_size > (size_t) UINT16_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid attribute: %d values - name size value out of bounds.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		record_flags    = 0;
+		value_data_size = attribute_values->value_data_size;
+		record_size     = 8 + attribute_values->name_size;
+
+		if( attribute_values->value_data_inode_number != 0 )
+		{
+			record_flags |= LIBFSEXT_EXTENDED_ATTRIBUTE_DATA_FLAG_VALUE_IN_INODE;
+		}
+		else
+		{
+			record_size += value_data_size;
+		}
+		if( record_size > ( (size_t) SSIZE_MAX - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid required data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( data != NULL )
+		{
+			if( record_size > ( data_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( data[ data_offset ] ),
+			 (uint16_t) attribute_values->name_size );
+
+			data[ data_offset + 2 ] = record_flags;
+			data[ data_offset + 3 ] = 0;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + 4 ] ),
+			 value_data_size );
+
+			if( memory_copy(
+			     &( data[ data_offset + 8 ] ),
+			     attribute_values->name,
+			     attribute_values->name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy attribute: %d name.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( ( ( record_flags & LIBFSEXT_EXTENDED_ATTRIBUTE_DATA_FLAG_VALUE_IN_INODE ) == 0 )
+			 && ( value_data_size > 0 ) )
+			{
+				if( memory_copy(
+				     &( data[ data_offset + 8 + attribute_values->name_size ] ),
+				     attribute_values->value_data,
+				     (size_t) value_data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy attribute: %d value data.",
+					 function,
+					 attribute_index );
+
+					return( -1 );
+				}
+			}
+		}
+		data_offset += record_size;
+	}
+	*required_data_size = data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data of all extended attributes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_file_entry_get_all_extended_attributes_size(
+     libfsext_file_entry_t *file_entry,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsext_file_entry_get_all_extended_attributes_size";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsext_internal_file_entry_get_all_extended_attributes(
+	     internal_file_entry,
+	     NULL,
+	     0,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of extended attributes data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the names and values of all extended attributes in a single data buffer
+ * Values that are stored in a separate inode are not copied and need to be read
+ * using the extended attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_file_entry_get_all_extended_attributes(
+     libfsext_file_entry_t *file_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsext_file_entry_get_all_extended_attributes";
+	size_t required_data_size                           = 0;
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsext_internal_file_entry_get_all_extended_attributes(
+	     internal_file_entry,
+	     data,
+	     data_size,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extended attributes data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of sub file entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_file_entry_get_number_of_sub_file_entries(
+     libfsext_file_entry_t *file_entry,
+     int *number_of_sub_file_entries,
+     libcerror_error_t **error )
+{
+	libfsext_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsext_file_entry_get_number_of_sub_file_entries";
+	int result                                          = 1;
+	int safe_number_of_sub_file_entries                 = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
+
+	if( number_of_sub_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory == NULL )
+	{
+		if( libfsext_internal_file_entry_get_directory(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine directory.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file_entry->directory != NULL )
+	{
+		if( libfsext_directory_get_number_of_entries(
+		     internal_file_entry->directory,
+		     &safe_number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from directory.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*number_of_sub_file_entries = safe_number_of_sub_file_entries;
+	}
+	return( result );
+}
+
+/* Retrieves the sub file entry for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_internal_file_entry_get_sub_file_entry_by_index(
+     libfsext_internal_file_entry_t *internal_file_entry,
+     int sub_file_entry_index,
+     libfsext_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_directory_t *directory                  = NULL;
+	libfsext_directory_entry_t *directory_entry      = NULL;
+	libfsext_directory_entry_t *safe_directory_entry = NULL;
+	libfsext_inode_t *inode                          = NULL;
+	libfsext_inode_t *safe_inode                     = NULL;
+	static char *function                            = "libfsext_file_entry_get_sub_file_entry_by_index";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->directory == NULL )
+	{
+		if( libfsext_internal_file_entry_get_directory(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsext_directory_get_entry_by_index(
+	     internal_file_entry->directory,
+	     sub_file_entry_index,
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d from directory.",
+		 function,
+		 sub_file_entry_index );
+
+		goto on_error;
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		goto on_error;
+	}
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_file_entry->inode_table,
+	     internal_file_entry->file_io_handle,
+	     directory_entry->inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode number: %" PRIu32 ".",
+		 function,
+		 directory_entry->inode_number );
+
+		goto on_error;
 	}
-	if( *extended_attribute != NULL )
+	if( inode == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid extended attribute value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing inode: %" PRIu32 ".",
+		 function,
+		 directory_entry->inode_number );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
+	if( libfsext_inode_get_reference(
+	     &safe_inode,
+	     inode,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode reference.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	result = libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
-	          internal_file_entry,
-	          utf8_string,
-	          utf8_string_length,
-	          &attribute_values,
-	          error );
-
-	if( result == -1 )
+	if( libfsext_directory_entry_clone(
+	     &safe_directory_entry,
+	     directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve attribute values for UTF-8 name.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
 		 function );
 
-		result = -1;
-	}
-	else if( result != 0 )
-	{
-		if( libfsext_extended_attribute_initialize(
-		     extended_attribute,
-		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
-		     internal_file_entry->inode_table,
-		     attribute_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create extended attribute.",
-			 function );
-
-			result = -1;
-		}
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
+	/* libfsext_file_entry_initialize takes over management of safe_inode and safe_directory_entry
+	 */
+	if( libfsext_file_entry_initialize(
+	     sub_file_entry,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->inode_table,
+	     directory_entry->inode_number,
+	     safe_inode,
+	     safe_directory_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub file entry.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsext_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( safe_inode != NULL )
+	{
+		libfsext_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsext_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the extended attribute for an UTF-16 encoded name
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the sub file entry for the specific index
+ * Returns 1 if successful or -1 on error
  */
-int libfsext_file_entry_get_extended_attribute_by_utf16_name(
+int libfsext_file_entry_get_sub_file_entry_by_index(
      libfsext_file_entry_t *file_entry,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsext_extended_attribute_t **extended_attribute,
+     int sub_file_entry_index,
+     libfsext_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
-	libfsext_attribute_values_t *attribute_values       = NULL;
 	libfsext_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsext_file_entry_get_extended_attribute_by_utf16_name";
-	int result                                          = 0;
+	static char *function                               = "libfsext_file_entry_get_sub_file_entry_by_index";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -3144,30 +4402,30 @@ int libfsext_file_entry_get_extended_attribute_by_utf16_name(
 	}
 	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
 
-	if( extended_attribute == NULL )
+	if( sub_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid extended attribute.",
+		 "%s: invalid sub file entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( *extended_attribute != NULL )
+	if( *sub_file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid extended attribute value already set.",
+		 "%s: invalid sub file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3175,52 +4433,30 @@ int libfsext_file_entry_get_extended_attribute_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfsext_internal_file_entry_get_attribute_values_by_utf16_name(
-	          internal_file_entry,
-	          utf16_string,
-	          utf16_string_length,
-	          &attribute_values,
-	          error );
-
-	if( result == -1 )
+	if( libfsext_internal_file_entry_get_sub_file_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     sub_file_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve attribute values for UTF-16 name.",
-		 function );
+		 "%s: unable to retrieve sub file entry: %d.",
+		 function,
+		 sub_file_entry_index );
 
 		result = -1;
 	}
-	else if( result != 0 )
-	{
-		if( libfsext_extended_attribute_initialize(
-		     extended_attribute,
-		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
-		     internal_file_entry->inode_table,
-		     attribute_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create extended attribute.",
-			 function );
-
-			result = -1;
-		}
-	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3228,7 +4464,7 @@ int libfsext_file_entry_get_extended_attribute_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3237,18 +4473,19 @@ int libfsext_file_entry_get_extended_attribute_by_utf16_name(
 	return( result );
 }
 
-/* Retrieves the number of sub file entries
+/* Retrieves the number of deleted sub file entries
+ * Deleted sub file entries are only available if recovery of deleted directory entries was enabled
  * Returns 1 if successful or -1 on error
  */
-int libfsext_file_entry_get_number_of_sub_file_entries(
+int libfsext_file_entry_get_number_of_deleted_sub_file_entries(
      libfsext_file_entry_t *file_entry,
-     int *number_of_sub_file_entries,
+     int *number_of_deleted_sub_file_entries,
      libcerror_error_t **error )
 {
 	libfsext_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsext_file_entry_get_number_of_sub_file_entries";
+	static char *function                               = "libfsext_file_entry_get_number_of_deleted_sub_file_entries";
 	int result                                          = 1;
-	int safe_number_of_sub_file_entries                 = 0;
+	int safe_number_of_deleted_sub_file_entries                 = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3263,13 +4500,13 @@ int libfsext_file_entry_get_number_of_sub_file_entries(
 	}
 	internal_file_entry = (libfsext_internal_file_entry_t *) file_entry;
 
-	if( number_of_sub_file_entries == NULL )
+	if( number_of_deleted_sub_file_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of sub file entries.",
+		 "%s: invalid number of deleted sub file entries.",
 		 function );
 
 		return( -1 );
@@ -3307,16 +4544,16 @@ int libfsext_file_entry_get_number_of_sub_file_entries(
 	}
 	if( internal_file_entry->directory != NULL )
 	{
-		if( libfsext_directory_get_number_of_entries(
+		if( libfsext_directory_get_number_of_deleted_entries(
 		     internal_file_entry->directory,
-		     &safe_number_of_sub_file_entries,
+		     &safe_number_of_deleted_sub_file_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from directory.",
+			 "%s: unable to retrieve number of deleted entries from directory.",
 			 function );
 
 			result = -1;
@@ -3339,15 +4576,15 @@ int libfsext_file_entry_get_number_of_sub_file_entries(
 #endif
 	if( result == 1 )
 	{
-		*number_of_sub_file_entries = safe_number_of_sub_file_entries;
+		*number_of_deleted_sub_file_entries = safe_number_of_deleted_sub_file_entries;
 	}
 	return( result );
 }
 
-/* Retrieves the sub file entry for the specific index
+/* Retrieves the deleted sub file entry for the specific index
  * Returns 1 if successful or -1 on error
  */
-int libfsext_internal_file_entry_get_sub_file_entry_by_index(
+int libfsext_internal_file_entry_get_deleted_sub_file_entry_by_index(
      libfsext_internal_file_entry_t *internal_file_entry,
      int sub_file_entry_index,
      libfsext_file_entry_t **sub_file_entry,
@@ -3358,7 +4595,7 @@ int libfsext_internal_file_entry_get_sub_file_entry_by_index(
 	libfsext_directory_entry_t *safe_directory_entry = NULL;
 	libfsext_inode_t *inode                          = NULL;
 	libfsext_inode_t *safe_inode                     = NULL;
-	static char *function                            = "libfsext_file_entry_get_sub_file_entry_by_index";
+	static char *function                            = "libfsext_file_entry_get_deleted_sub_file_entry_by_index";
 
 	if( internal_file_entry == NULL )
 	{
@@ -3409,7 +4646,7 @@ int libfsext_internal_file_entry_get_sub_file_entry_by_index(
 			goto on_error;
 		}
 	}
-	if( libfsext_directory_get_entry_by_index(
+	if( libfsext_directory_get_deleted_entry_by_index(
 	     internal_file_entry->directory,
 	     sub_file_entry_index,
 	     &directory_entry,
@@ -3419,7 +4656,7 @@ int libfsext_internal_file_entry_get_sub_file_entry_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d from directory.",
+		 "%s: unable to retrieve deleted entry: %d from directory.",
 		 function,
 		 sub_file_entry_index );
 
@@ -3431,7 +4668,7 @@ int libfsext_internal_file_entry_get_sub_file_entry_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing directory entry: %d.",
+		 "%s: missing deleted directory entry: %d.",
 		 function,
 		 sub_file_entry_index );
 
@@ -3466,7 +4703,7 @@ int libfsext_internal_file_entry_get_sub_file_entry_by_index(
 
 		goto on_error;
 	}
-	if( libfsext_inode_clone(
+	if( libfsext_inode_get_reference(
 	     &safe_inode,
 	     inode,
 	     error ) != 1 )
@@ -3474,8 +4711,8 @@ int libfsext_internal_file_entry_get_sub_file_entry_by_index(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create inode.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode reference.",
 		 function );
 
 		goto on_error;
@@ -3539,17 +4776,17 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the sub file entry for the specific index
+/* Retrieves the deleted sub file entry for the specific index
  * Returns 1 if successful or -1 on error
  */
-int libfsext_file_entry_get_sub_file_entry_by_index(
+int libfsext_file_entry_get_deleted_sub_file_entry_by_index(
      libfsext_file_entry_t *file_entry,
      int sub_file_entry_index,
      libfsext_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
 	libfsext_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsext_file_entry_get_sub_file_entry_by_index";
+	static char *function                               = "libfsext_file_entry_get_deleted_sub_file_entry_by_index";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -3602,7 +4839,7 @@ int libfsext_file_entry_get_sub_file_entry_by_index(
 		return( -1 );
 	}
 #endif
-	if( libfsext_internal_file_entry_get_sub_file_entry_by_index(
+	if( libfsext_internal_file_entry_get_deleted_sub_file_entry_by_index(
 	     internal_file_entry,
 	     sub_file_entry_index,
 	     sub_file_entry,
@@ -3612,7 +4849,7 @@ int libfsext_file_entry_get_sub_file_entry_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub file entry: %d.",
+		 "%s: unable to retrieve deleted sub file entry: %d.",
 		 function,
 		 sub_file_entry_index );
 
@@ -4165,21 +5402,39 @@ ssize_t libfsext_file_entry_read_buffer(
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer(
-	              internal_file_entry->data_block_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              0,
-	              error );
-
+	if( internal_file_entry->data_extent_map != NULL )
+	{
+		read_count = libfsext_extent_map_read_buffer_at_offset(
+		              internal_file_entry->data_extent_map,
+		              internal_file_entry->io_handle,
+		              internal_file_entry->file_io_handle,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              internal_file_entry->current_offset,
+		              error );
+
+		if( read_count > 0 )
+		{
+			internal_file_entry->current_offset += read_count;
+		}
+	}
+	else
+	{
+		read_count = libfdata_stream_read_buffer(
+		              internal_file_entry->data_block_stream,
+		              (intptr_t *) internal_file_entry->file_io_handle,
+		              buffer,
+		              buffer_size,
+		              0,
+		              error );
+	}
 	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data block stream.",
+		 "%s: unable to read data.",
 		 function );
 
 		read_count = -1;
@@ -4266,13 +5521,11 @@ ssize_t libfsext_file_entry_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              internal_file_entry->data_block_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
+	read_count = libfsext_internal_file_entry_read_buffer_at_offset(
+	              internal_file_entry,
 	              buffer,
 	              buffer_size,
 	              offset,
-	              0,
 	              error );
 
 	if( read_count < 0 )
@@ -4281,11 +5534,15 @@ ssize_t libfsext_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data block stream.",
+		 "%s: unable to read data.",
 		 function );
 
 		read_count = -1;
 	}
+	else if( internal_file_entry->data_extent_map != NULL )
+	{
+		internal_file_entry->current_offset = offset + read_count;
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
@@ -4351,6 +5608,19 @@ off64_t libfsext_file_entry_seek_offset(
 
 		return( -1 );
 	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
@@ -4366,12 +5636,40 @@ off64_t libfsext_file_entry_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfdata_stream_seek_offset(
-	          internal_file_entry->data_block_stream,
-	          offset,
-	          whence,
-	          error );
+	if( internal_file_entry->data_extent_map != NULL )
+	{
+		if( whence == SEEK_CUR )
+		{
+			offset += internal_file_entry->current_offset;
+		}
+		else if( whence == SEEK_END )
+		{
+			offset += (off64_t) internal_file_entry->data_size;
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
 
+			offset = -1;
+		}
+		else
+		{
+			internal_file_entry->current_offset = offset;
+		}
+	}
+	else
+	{
+		offset = libfdata_stream_seek_offset(
+		          internal_file_entry->data_block_stream,
+		          offset,
+		          whence,
+		          error );
+	}
 	if( offset == -1 )
 	{
 		libcerror_error_set(
@@ -4448,6 +5746,17 @@ int libfsext_file_entry_get_offset(
 
 		return( -1 );
 	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -4463,10 +5772,14 @@ int libfsext_file_entry_get_offset(
 		return( -1 );
 	}
 #endif
-	if( libfdata_stream_get_offset(
-	     internal_file_entry->data_block_stream,
-	     offset,
-	     error ) != 1 )
+	if( internal_file_entry->data_extent_map != NULL )
+	{
+		*offset = internal_file_entry->current_offset;
+	}
+	else if( libfdata_stream_get_offset(
+	          internal_file_entry->data_block_stream,
+	          offset,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
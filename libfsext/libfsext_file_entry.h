@@ -28,6 +28,7 @@
 #include "libfsext_attribute_values.h"
 #include "libfsext_directory.h"
 #include "libfsext_directory_entry.h"
+#include "libfsext_extent_map.h"
 #include "libfsext_extern.h"
 #include "libfsext_inode.h"
 #include "libfsext_inode_table.h"
@@ -73,6 +74,20 @@ struct libfsext_internal_file_entry
 	 */
 	libcdata_array_t *extended_attributes_array;
 
+	/* The extended attributes name hash table buckets
+	 * Contains per bucket the index of the first extended attribute + 1 or 0 if the bucket is empty
+	 */
+	int *extended_attributes_hash_buckets;
+
+	/* The number of extended attributes name hash table buckets
+	 */
+	int number_of_extended_attributes_hash_buckets;
+
+	/* The extended attributes name hash table chains
+	 * Contains per extended attribute the index of the next extended attribute in the same bucket + 1 or 0 if last
+	 */
+	int *extended_attributes_hash_chains;
+
 	/* The directory
 	 */
 	libfsext_directory_t *directory;
@@ -82,9 +97,20 @@ struct libfsext_internal_file_entry
 	size64_t data_size;
 
 	/* The data block stream
+	 * Only used for inline data
 	 */
 	libfdata_stream_t *data_block_stream;
 
+	/* The data extent map
+	 * Used instead of the data block stream for data stored in blocks
+	 */
+	libfsext_extent_map_t *data_extent_map;
+
+	/* The current data offset
+	 * Only used in combination with the data extent map
+	 */
+	off64_t current_offset;
+
 	/* The symbolic link data
 	 */
 	uint8_t *symbolic_link_data;
@@ -115,6 +141,13 @@ int libfsext_file_entry_free(
      libfsext_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+ssize_t libfsext_internal_file_entry_read_buffer_at_offset(
+         libfsext_internal_file_entry_t *internal_file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int libfsext_internal_file_entry_get_directory(
      libfsext_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
@@ -128,6 +161,11 @@ int libfsext_file_entry_is_empty(
      libfsext_file_entry_t *file_entry,
      libcerror_error_t **error );
 
+LIBFSEXT_EXTERN \
+int libfsext_file_entry_is_deleted(
+     libfsext_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
 LIBFSEXT_EXTERN \
 int libfsext_file_entry_get_inode_number(
      libfsext_file_entry_t *file_entry,
@@ -257,6 +295,10 @@ int libfsext_internal_file_entry_get_extended_attributes(
      libfsext_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
 
+int libfsext_internal_file_entry_build_extended_attributes_hash_table(
+     libfsext_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
 LIBFSEXT_EXTERN \
 int libfsext_file_entry_get_number_of_extended_attributes(
      libfsext_file_entry_t *file_entry,
@@ -314,6 +356,26 @@ int libfsext_file_entry_get_extended_attribute_by_utf16_name(
      libfsext_extended_attribute_t **extended_attribute,
      libcerror_error_t **error );
 
+int libfsext_internal_file_entry_get_all_extended_attributes(
+     libfsext_internal_file_entry_t *internal_file_entry,
+     uint8_t *data,
+     size_t data_size,
+     size_t *required_data_size,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_file_entry_get_all_extended_attributes_size(
+     libfsext_file_entry_t *file_entry,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_file_entry_get_all_extended_attributes(
+     libfsext_file_entry_t *file_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBFSEXT_EXTERN \
 int libfsext_file_entry_get_number_of_sub_file_entries(
      libfsext_file_entry_t *file_entry,
@@ -333,6 +395,25 @@ int libfsext_file_entry_get_sub_file_entry_by_index(
      libfsext_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+LIBFSEXT_EXTERN \
+int libfsext_file_entry_get_number_of_deleted_sub_file_entries(
+     libfsext_file_entry_t *file_entry,
+     int *number_of_deleted_sub_file_entries,
+     libcerror_error_t **error );
+
+int libfsext_internal_file_entry_get_deleted_sub_file_entry_by_index(
+     libfsext_internal_file_entry_t *internal_file_entry,
+     int sub_file_entry_index,
+     libfsext_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_file_entry_get_deleted_sub_file_entry_by_index(
+     libfsext_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     libfsext_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
 int libfsext_internal_file_entry_get_sub_file_entry_by_utf8_name(
      libfsext_internal_file_entry_t *internal_file_entry,
      const uint8_t *utf8_string,
@@ -152,6 +152,7 @@ int libfsext_group_descriptor_read_data(
 
 	static char *function             = "libfsext_group_descriptor_read_data";
 	size_t group_descriptor_data_size = 0;
+	uint64_t start_time               = 0;
 	uint64_t value_64bit              = 0;
 	uint32_t calculated_checksum      = 0;
 	uint32_t stored_checksum          = 0;
@@ -628,6 +629,9 @@ int libfsext_group_descriptor_read_data(
 /* TODO add support for crc16 checksum */
 	if( ( io_handle->read_only_compatible_features_flags & LIBFSEXT_READ_ONLY_COMPATIBLE_FEATURES_FLAG_METADATA_CHECKSUM ) != 0 )
 	{
+		start_time = libfsext_io_handle_get_checksum_start_time(
+		              io_handle );
+
 		byte_stream_copy_from_uint32_little_endian(
 		 checksum_data,
 		 group_descriptor->group_number );
@@ -698,6 +702,10 @@ int libfsext_group_descriptor_read_data(
 		}
 		calculated_checksum = ( 0xffffffffUL - calculated_checksum ) & 0x0000ffffUL;
 
+		libfsext_io_handle_update_checksum_statistics(
+		 io_handle,
+		 start_time );
+
 		if( ( stored_checksum != 0 )
 		 && ( stored_checksum != calculated_checksum ) )
 		{
@@ -796,6 +804,11 @@ int libfsext_group_descriptor_read_file_io_handle(
 
 		goto on_error;
 	}
+	libfsext_io_handle_update_read_statistics(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_GROUP_DESCRIPTORS_NUMBER_OF_READS,
+	 group_descriptor_data_size );
+
 	if( libfsext_group_descriptor_read_data(
 	     group_descriptor,
 	     io_handle,
@@ -41,6 +41,7 @@
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libcnotify.h"
+#include "libfsext_libcthreads.h"
 #include "libfsext_libfdata.h"
 #include "libfsext_libfdatetime.h"
 #include "libfsext_unused.h"
@@ -50,6 +51,7 @@
 
 /* Creates a inode
  * Make sure the value inode is referencing, is set to NULL
+ * The inode is created with a single reference
  * Returns 1 if successful or -1 on error
  */
 int libfsext_inode_initialize(
@@ -127,11 +129,35 @@ int libfsext_inode_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *inode )->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize references mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *inode )->number_of_references = 1;
+
 	return( 1 );
 
 on_error:
 	if( *inode != NULL )
 	{
+		if( ( *inode )->data_extents_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *inode )->data_extents_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *inode );
 
@@ -141,14 +167,16 @@ on_error:
 }
 
 /* Frees a inode
+ * This releases a reference to the inode, the inode is only freed when its last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libfsext_inode_free(
      libfsext_inode_t **inode,
      libcerror_error_t **error )
 {
-	static char *function = "libfsext_inode_free";
-	int result            = 1;
+	static char *function    = "libfsext_inode_free";
+	int number_of_references = 0;
+	int result               = 1;
 
 	if( inode == NULL )
 	{
@@ -163,6 +191,61 @@ int libfsext_inode_free(
 	}
 	if( *inode != NULL )
 	{
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     ( *inode )->references_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab references mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		( *inode )->number_of_references -= 1;
+
+		number_of_references = ( *inode )->number_of_references;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     ( *inode )->references_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release references mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			*inode = NULL;
+
+			return( 1 );
+		}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *inode )->references_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free references mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( libcdata_array_free(
 		     &( ( *inode )->data_extents_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
@@ -202,15 +285,17 @@ int libfsext_inode_free(
 	return( result );
 }
 
-/* Clones an inode
+/* Retrieves an additional reference to an inode
+ * The inode is shared and must not be modified after it has been read.
+ * The reference is released with libfsext_inode_free
  * Returns 1 if successful or -1 on error
  */
-int libfsext_inode_clone(
+int libfsext_inode_get_reference(
      libfsext_inode_t **destination_inode,
      libfsext_inode_t *source_inode,
      libcerror_error_t **error )
 {
-	static char *function = "libfsext_inode_clone";
+	static char *function = "libfsext_inode_get_reference";
 
 	if( destination_inode == NULL )
 	{
@@ -240,72 +325,41 @@ int libfsext_inode_clone(
 
 		return( 1 );
 	}
-	*destination_inode = memory_allocate_structure(
-	                      libfsext_inode_t );
-
-	if( *destination_inode == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create destination inode.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     *destination_inode,
-	     source_inode,
-	     sizeof( libfsext_inode_t ) ) == NULL )
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     source_inode->references_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy source to destination inode.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	( *destination_inode )->data_extents_array        = NULL;
-	( *destination_inode )->extended_attributes_array = NULL;
+#endif
+	source_inode->number_of_references += 1;
 
-	if( libcdata_array_clone(
-	     &( ( *destination_inode )->data_extents_array ),
-	     source_inode->data_extents_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfsext_extent_clone,
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     source_inode->references_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination data extents array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
 		 function );
 
-		goto on_error;
-	}
-	/* Since the extended attribute array is only used in the file entry
-	 * do not do a full clone here.
-	 */
-	if( source_inode->extended_attributes_array != NULL )
-	{
-		( *destination_inode )->extended_attributes_array = source_inode->extended_attributes_array;
-		source_inode->extended_attributes_array           = NULL;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( *destination_inode != NULL )
-	{
-		memory_free(
-		 *destination_inode );
+#endif
+	*destination_inode = source_inode;
 
-		*destination_inode = NULL;
-	}
-	return( -1 );
+	return( 1 );
 }
 
 /* Reads the inode data
@@ -323,6 +377,7 @@ int libfsext_inode_read_data(
 
 	static char *function                = "libfsext_inode_read_data";
 	size_t data_offset                   = 0;
+	uint64_t start_time                  = 0;
 	uint32_t access_time                 = 0;
 	uint32_t calculated_checksum         = 0;
 	uint32_t creation_time               = 0;
@@ -1412,6 +1467,9 @@ int libfsext_inode_read_data(
 
 	if( ( io_handle->read_only_compatible_features_flags & LIBFSEXT_READ_ONLY_COMPATIBLE_FEATURES_FLAG_METADATA_CHECKSUM ) != 0 )
 	{
+		start_time = libfsext_io_handle_get_checksum_start_time(
+		              io_handle );
+
 		byte_stream_copy_from_uint32_little_endian(
 		 checksum_data,
 		 inode->inode_number );
@@ -1549,6 +1607,10 @@ int libfsext_inode_read_data(
 		}
 		calculated_checksum = 0xffffffffUL - calculated_checksum;
 
+		libfsext_io_handle_update_checksum_statistics(
+		 io_handle,
+		 start_time );
+
 		if( ( stored_checksum != 0 )
 		 && ( stored_checksum != calculated_checksum ) )
 		{
@@ -1683,6 +1745,7 @@ int libfsext_inode_read_data_reference(
 {
 	static char *function     = "libfsext_inode_read_data_reference";
 	uint32_t number_of_blocks = 0;
+	int result                = 0;
 
 	if( inode == NULL )
 	{
@@ -1768,14 +1831,32 @@ int libfsext_inode_read_data_reference(
 		else if( ( io_handle->format_version == 4 )
 		      && ( ( inode->flags & LIBFSEXT_INODE_FLAG_HAS_EXTENTS ) != 0 ) )
 		{
-			if( libfsext_extents_read_inode_data_reference(
-			     inode->data_extents_array,
-			     io_handle,
-			     file_io_handle,
-			     number_of_blocks,
-			     inode->data_reference,
-			     60,
-			     error ) == -1 )
+			LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+			 io_handle,
+			 LIBFSEXT_TRACE_EVENT_TYPE_EXTENTS_READ,
+			 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+			 inode->inode_number,
+			 0,
+			 inode->data_size );
+
+			result = libfsext_extents_read_inode_data_reference(
+			          inode->data_extents_array,
+			          io_handle,
+			          file_io_handle,
+			          number_of_blocks,
+			          inode->data_reference,
+			          60,
+			          error );
+
+			LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+			 io_handle,
+			 LIBFSEXT_TRACE_EVENT_TYPE_EXTENTS_READ,
+			 LIBFSEXT_TRACE_EVENT_PHASE_END,
+			 inode->inode_number,
+			 0,
+			 inode->data_size );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -1789,14 +1870,32 @@ int libfsext_inode_read_data_reference(
 		}
 		else
 		{
-			if( libfsext_data_blocks_read_inode_data_reference(
-			     inode->data_extents_array,
-			     io_handle,
-			     file_io_handle,
-			     number_of_blocks,
-			     inode->data_reference,
-			     60,
-			     error ) != 1 )
+			LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+			 io_handle,
+			 LIBFSEXT_TRACE_EVENT_TYPE_EXTENTS_READ,
+			 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+			 inode->inode_number,
+			 0,
+			 inode->data_size );
+
+			result = libfsext_data_blocks_read_inode_data_reference(
+			          inode->data_extents_array,
+			          io_handle,
+			          file_io_handle,
+			          number_of_blocks,
+			          inode->data_reference,
+			          60,
+			          error );
+
+			LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+			 io_handle,
+			 LIBFSEXT_TRACE_EVENT_TYPE_EXTENTS_READ,
+			 LIBFSEXT_TRACE_EVENT_PHASE_END,
+			 inode->inode_number,
+			 0,
+			 inode->data_size );
+
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -2478,6 +2577,14 @@ int libfsext_inode_read_element_data(
 
 		return( -1 );
 	}
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_INODE_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+	 element_index + 1,
+	 element_data_offset,
+	 element_data_size );
+
 	data = (uint8_t *) memory_allocate(
 	                    sizeof( uint8_t ) * (size_t) element_data_size );
 
@@ -2502,14 +2609,15 @@ int libfsext_inode_read_element_data(
 		 element_data_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              data,
-	              (size_t) element_data_size,
-	              element_data_offset,
-	              error );
+	result = libfsext_io_handle_read_metadata_at_offset(
+	          io_handle,
+	          file_io_handle,
+	          data,
+	          (size_t) element_data_size,
+	          element_data_offset,
+	          error );
 
-	if( read_count != (ssize_t) element_data_size )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2522,6 +2630,15 @@ int libfsext_inode_read_element_data(
 
 		goto on_error;
 	}
+	libfsext_io_handle_update_read_statistics(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_INODE_TABLE_NUMBER_OF_READS,
+	 (size_t) element_data_size );
+
+	libfsext_io_handle_increment_statistics_value(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_INODE_CACHE_MISSES,
+	 1 );
 	if( libfsext_inode_initialize(
 	     &inode,
 	     error ) != 1 )
@@ -2592,6 +2709,14 @@ int libfsext_inode_read_element_data(
 	memory_free(
 	 data );
 
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_INODE_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 element_index + 1,
+	 element_data_offset,
+	 element_data_size );
+
 	return( 1 );
 
 on_error:
@@ -2606,6 +2731,14 @@ on_error:
 		memory_free(
 		 data );
 	}
+	LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+	 io_handle,
+	 LIBFSEXT_TRACE_EVENT_TYPE_INODE_READ,
+	 LIBFSEXT_TRACE_EVENT_PHASE_END,
+	 element_index + 1,
+	 element_data_offset,
+	 element_data_size );
+
 	return( -1 );
 }
 
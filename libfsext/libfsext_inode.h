@@ -30,6 +30,7 @@
 #include "libfsext_libbfio.h"
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
+#include "libfsext_libcthreads.h"
 #include "libfsext_libfdata.h"
 
 #if defined( __cplusplus )
@@ -135,6 +136,16 @@ struct libfsext_inode
 	/* Value to indicate the inode is empty
 	 */
 	uint8_t is_empty;
+
+	/* The number of references to the inode
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	/* The references mutex
+	 */
+	libcthreads_mutex_t *references_mutex;
+#endif
 };
 
 int libfsext_inode_initialize(
@@ -145,7 +156,7 @@ int libfsext_inode_free(
      libfsext_inode_t **inode,
      libcerror_error_t **error );
 
-int libfsext_inode_clone(
+int libfsext_inode_get_reference(
      libfsext_inode_t **destination_inode,
      libfsext_inode_t *source_inode,
      libcerror_error_t **error );
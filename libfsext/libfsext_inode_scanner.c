@@ -0,0 +1,1293 @@
+/*
+ * Deleted inode scanner functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsext_definitions.h"
+#include "libfsext_extent.h"
+#include "libfsext_group_descriptor.h"
+#include "libfsext_inode.h"
+#include "libfsext_inode_scanner.h"
+#include "libfsext_io_handle.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_superblock.h"
+
+#include "fsext_extents.h"
+#include "fsext_inode.h"
+
+/* Creates a deleted inode scanner
+ * Make sure the value inode_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_inode_scanner_initialize(
+     libfsext_inode_scanner_t **inode_scanner,
+     libfsext_io_handle_t *io_handle,
+     libfsext_superblock_t *superblock,
+     libcdata_array_t *group_descriptors_array,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsext_inode_scanner_initialize";
+	size_t inode_data_size       = 0;
+	size_t inode_table_data_size = 0;
+	int number_of_block_groups   = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( superblock->number_of_blocks_per_block_group == 0 )
+	 || ( superblock->number_of_blocks_per_block_group > ( io_handle->block_size * 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid superblock - number of blocks per block group value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock->number_of_inodes_per_block_group == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid superblock - number of inodes per block group value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     group_descriptors_array,
+	     &number_of_block_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of group descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_block_groups < 0 )
+	 || ( (size_t) number_of_block_groups > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of group descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock->inode_size != 0 )
+	{
+		inode_data_size = (size_t) superblock->inode_size;
+	}
+	else
+	{
+		inode_data_size = 128;
+	}
+	if( ( inode_data_size != 128 )
+	 && ( inode_data_size != 256 )
+	 && ( inode_data_size != 512 )
+	 && ( inode_data_size != 1024 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid superblock - unsupported inode size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The inode table is read in batches of a multiple of the inode size
+	 */
+	inode_table_data_size = ( LIBFSEXT_MAXIMUM_INODE_TABLE_READ_SIZE / inode_data_size ) * inode_data_size;
+
+	if( ( (size64_t) superblock->number_of_inodes_per_block_group * inode_data_size ) < (size64_t) inode_table_data_size )
+	{
+		inode_table_data_size = (size_t) superblock->number_of_inodes_per_block_group * inode_data_size;
+	}
+	*inode_scanner = memory_allocate_structure(
+	                  libfsext_inode_scanner_t );
+
+	if( *inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_scanner,
+	     0,
+	     sizeof( libfsext_inode_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode scanner.",
+		 function );
+
+		memory_free(
+		 *inode_scanner );
+
+		*inode_scanner = NULL;
+
+		return( -1 );
+	}
+	( *inode_scanner )->inode_table_data = (uint8_t *) memory_allocate(
+	                                                    sizeof( uint8_t ) * inode_table_data_size );
+
+	if( ( *inode_scanner )->inode_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode table data.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_block_groups > 0 )
+	{
+		( *inode_scanner )->block_bitmaps = (uint8_t **) memory_allocate(
+		                                                  sizeof( uint8_t * ) * number_of_block_groups );
+
+		if( ( *inode_scanner )->block_bitmaps == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block bitmaps.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *inode_scanner )->block_bitmaps,
+		     0,
+		     sizeof( uint8_t * ) * number_of_block_groups ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block bitmaps.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *inode_scanner )->io_handle                        = io_handle;
+	( *inode_scanner )->group_descriptors_array          = group_descriptors_array;
+	( *inode_scanner )->number_of_blocks                 = superblock->number_of_blocks;
+	( *inode_scanner )->first_data_block_number          = superblock->first_data_block_number;
+	( *inode_scanner )->number_of_blocks_per_block_group = superblock->number_of_blocks_per_block_group;
+	( *inode_scanner )->number_of_inodes_per_block_group = superblock->number_of_inodes_per_block_group;
+	( *inode_scanner )->first_non_reserved_inode         = superblock->first_non_reserved_inode;
+	( *inode_scanner )->inode_data_size                  = inode_data_size;
+	( *inode_scanner )->inode_table_data_size            = inode_table_data_size;
+	( *inode_scanner )->number_of_block_bitmaps          = number_of_block_groups;
+
+	if( ( superblock->read_only_compatible_features_flags & ( LIBFSEXT_READ_ONLY_COMPATIBLE_FEATURES_FLAG_GROUP_DESCRIPTOR_CHECKSUM | LIBFSEXT_READ_ONLY_COMPATIBLE_FEATURES_FLAG_METADATA_CHECKSUM ) ) != 0 )
+	{
+		( *inode_scanner )->has_group_descriptor_checksums = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *inode_scanner != NULL )
+	{
+		if( ( *inode_scanner )->block_bitmaps != NULL )
+		{
+			memory_free(
+			 ( *inode_scanner )->block_bitmaps );
+		}
+		if( ( *inode_scanner )->inode_table_data != NULL )
+		{
+			memory_free(
+			 ( *inode_scanner )->inode_table_data );
+		}
+		memory_free(
+		 *inode_scanner );
+
+		*inode_scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a deleted inode scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_inode_scanner_free(
+     libfsext_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsext_inode_scanner_free";
+	int block_bitmap_index = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_scanner != NULL )
+	{
+		/* The IO handle and group descriptors array are referenced and freed elsewhere
+		 */
+		if( ( *inode_scanner )->block_bitmaps != NULL )
+		{
+			for( block_bitmap_index = 0;
+			     block_bitmap_index < ( *inode_scanner )->number_of_block_bitmaps;
+			     block_bitmap_index++ )
+			{
+				if( ( *inode_scanner )->block_bitmaps[ block_bitmap_index ] != NULL )
+				{
+					memory_free(
+					 ( *inode_scanner )->block_bitmaps[ block_bitmap_index ] );
+				}
+			}
+			memory_free(
+			 ( *inode_scanner )->block_bitmaps );
+		}
+		if( ( *inode_scanner )->inode_table_data != NULL )
+		{
+			memory_free(
+			 ( *inode_scanner )->inode_table_data );
+		}
+		memory_free(
+		 *inode_scanner );
+
+		*inode_scanner = NULL;
+	}
+	return( 1 );
+}
+
+/* Checks if the inode data is that of a deleted inode of which the data reference is still intact
+ * This check is done on the raw inode data to prevent parsing every inode in the inode table
+ * Returns 1 if the inode is a candidate, 0 if not or -1 on error
+ */
+int libfsext_inode_scanner_check_inode_data(
+     libfsext_inode_scanner_t *inode_scanner,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *data_reference      = NULL;
+	static char *function              = "libfsext_inode_scanner_check_inode_data";
+	uint64_t data_size_upper           = 0;
+	uint32_t block_number              = 0;
+	uint32_t data_size_lower           = 0;
+	uint32_t deletion_time             = 0;
+	uint32_t flags                     = 0;
+	uint16_t file_mode                 = 0;
+	uint16_t maximum_number_of_extents = 0;
+	uint16_t number_of_extents         = 0;
+	uint16_t number_of_links           = 0;
+	uint16_t signature                 = 0;
+	uint16_t depth                     = 0;
+	uint8_t has_block_number           = 0;
+	int block_number_index             = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsext_inode_ext2_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsext_inode_ext2_t *) data )->file_mode,
+	 file_mode );
+
+	/* Only regular files, directories and symbolic links have data blocks
+	 */
+	if( ( ( file_mode & 0xf000 ) != LIBFSEXT_FILE_TYPE_REGULAR_FILE )
+	 && ( ( file_mode & 0xf000 ) != LIBFSEXT_FILE_TYPE_DIRECTORY )
+	 && ( ( file_mode & 0xf000 ) != LIBFSEXT_FILE_TYPE_SYMBOLIC_LINK ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsext_inode_ext2_t *) data )->deletion_time,
+	 deletion_time );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsext_inode_ext2_t *) data )->number_of_links,
+	 number_of_links );
+
+	if( ( deletion_time == 0 )
+	 && ( number_of_links != 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsext_inode_ext2_t *) data )->data_size,
+	 data_size_lower );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsext_inode_ext2_t *) data )->directory_acl,
+	 data_size_upper );
+
+	if( ( inode_scanner->io_handle->format_version != 4 )
+	 && ( ( file_mode & 0xf000 ) != LIBFSEXT_FILE_TYPE_REGULAR_FILE ) )
+	{
+		data_size_upper = 0;
+	}
+	if( ( data_size_lower == 0 )
+	 && ( data_size_upper == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( ( file_mode & 0xf000 ) == LIBFSEXT_FILE_TYPE_SYMBOLIC_LINK )
+	 && ( data_size_upper == 0 )
+	 && ( data_size_lower < 60 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsext_inode_ext2_t *) data )->flags,
+	 flags );
+
+	data_reference = ( (fsext_inode_ext2_t *) data )->data_reference;
+
+	if( inode_scanner->io_handle->format_version == 4 )
+	{
+		if( ( flags & LIBFSEXT_INODE_FLAG_INLINE_DATA ) != 0 )
+		{
+			return( 0 );
+		}
+		if( ( flags & LIBFSEXT_INODE_FLAG_HAS_EXTENTS ) != 0 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (fsext_extents_header_ext4_t *) data_reference )->signature,
+			 signature );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (fsext_extents_header_ext4_t *) data_reference )->number_of_extents,
+			 number_of_extents );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (fsext_extents_header_ext4_t *) data_reference )->maximum_number_of_extents,
+			 maximum_number_of_extents );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (fsext_extents_header_ext4_t *) data_reference )->depth,
+			 depth );
+
+			/* When an inode is deleted the number of extents in the extents header is
+			 * typically set to 0, which means the data reference is no longer intact
+			 */
+			if( ( signature != 0xf30a )
+			 || ( number_of_extents == 0 )
+			 || ( number_of_extents > maximum_number_of_extents )
+			 || ( maximum_number_of_extents > 4 )
+			 || ( depth > 5 ) )
+			{
+				return( 0 );
+			}
+			return( 1 );
+		}
+	}
+	/* When an inode is deleted the block numbers are typically set to 0,
+	 * which means the data reference is no longer intact
+	 */
+	for( block_number_index = 0;
+	     block_number_index < 15;
+	     block_number_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data_reference[ block_number_index * 4 ] ),
+		 block_number );
+
+		if( block_number == 0 )
+		{
+			continue;
+		}
+		if( ( block_number < inode_scanner->first_data_block_number )
+		 || ( (uint64_t) block_number >= inode_scanner->number_of_blocks ) )
+		{
+			return( 0 );
+		}
+		has_block_number = 1;
+	}
+	if( has_block_number == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the block bitmap of a specific block group
+ * The block bitmap is read on demand and kept until the inode scanner is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_inode_scanner_get_block_bitmap(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_group_number,
+     const uint8_t **block_bitmap,
+     libcerror_error_t **error )
+{
+	libfsext_group_descriptor_t *group_descriptor = NULL;
+	uint8_t *block_bitmap_data                    = NULL;
+	static char *function                         = "libfsext_inode_scanner_get_block_bitmap";
+	off64_t file_offset                           = 0;
+	uint32_t block_size                           = 0;
+	int result                                    = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode_scanner->block_bitmaps == NULL )
+	 || ( block_group_number >= (uint32_t) inode_scanner->number_of_block_bitmaps ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block group number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_scanner->block_bitmaps[ block_group_number ] != NULL )
+	{
+		*block_bitmap = inode_scanner->block_bitmaps[ block_group_number ];
+
+		return( 1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     inode_scanner->group_descriptors_array,
+	     (int) block_group_number,
+	     (intptr_t **) &group_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group descriptor: %" PRIu32 ".",
+		 function,
+		 block_group_number );
+
+		goto on_error;
+	}
+	if( group_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing group descriptor: %" PRIu32 ".",
+		 function,
+		 block_group_number );
+
+		goto on_error;
+	}
+	block_size = inode_scanner->io_handle->block_size;
+
+	if( group_descriptor->block_bitmap_block_number > ( (uint64_t) INT64_MAX / block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid group descriptor - block bitmap block number value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	block_bitmap_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * block_size );
+
+	if( block_bitmap_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block bitmap data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The block bitmap of a block group of which the block bitmap is not initialized
+	 * is treated as if none of the blocks are allocated
+	 */
+	if( ( inode_scanner->has_group_descriptor_checksums != 0 )
+	 && ( ( group_descriptor->block_group_flags & LIBFSEXT_BLOCK_GROUP_FLAG_BLOCK_BITMAP_UNINITIALIZED ) != 0 ) )
+	{
+		if( memory_set(
+		     block_bitmap_data,
+		     0,
+		     sizeof( uint8_t ) * block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block bitmap data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		file_offset = (off64_t) group_descriptor->block_bitmap_block_number * block_size;
+
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 inode_scanner->io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+		 0,
+		 file_offset,
+		 block_size );
+
+		result = libfsext_io_handle_read_metadata_at_offset(
+		          inode_scanner->io_handle,
+		          file_io_handle,
+		          block_bitmap_data,
+		          (size_t) block_size,
+		          file_offset,
+		          error );
+
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 inode_scanner->io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_END,
+		 0,
+		 file_offset,
+		 block_size );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block bitmap at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+	}
+	inode_scanner->block_bitmaps[ block_group_number ] = block_bitmap_data;
+
+	*block_bitmap = block_bitmap_data;
+
+	return( 1 );
+
+on_error:
+	if( block_bitmap_data != NULL )
+	{
+		memory_free(
+		 block_bitmap_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of data blocks of an inode and how many of these are not allocated
+ * according to the block bitmaps
+ * Returns 1 if successful, 0 if the inode references blocks outside the volume or -1 on error
+ */
+int libfsext_inode_scanner_get_number_of_unallocated_blocks(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     libfsext_inode_t *inode,
+     uint64_t *number_of_blocks,
+     uint64_t *number_of_unallocated_blocks,
+     libcerror_error_t **error )
+{
+	const uint8_t *block_bitmap         = NULL;
+	libfsext_extent_t *extent           = NULL;
+	static char *function               = "libfsext_inode_scanner_get_number_of_unallocated_blocks";
+	uint64_t block_number               = 0;
+	uint64_t last_block_number          = 0;
+	uint64_t safe_number_of_blocks      = 0;
+	uint64_t safe_number_of_unallocated = 0;
+	uint32_t block_group_number         = 0;
+	uint32_t block_index                = 0;
+	int extent_index                    = 0;
+	int number_of_extents               = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_unallocated_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of unallocated blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     inode->data_extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data extents.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     inode->data_extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( ( extent->range_flags & LIBFSEXT_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		 || ( extent->number_of_blocks == 0 ) )
+		{
+			continue;
+		}
+		if( ( extent->physical_block_number < inode_scanner->first_data_block_number )
+		 || ( extent->physical_block_number >= inode_scanner->number_of_blocks )
+		 || ( extent->number_of_blocks > ( inode_scanner->number_of_blocks - extent->physical_block_number ) ) )
+		{
+			return( 0 );
+		}
+		last_block_number = extent->physical_block_number + extent->number_of_blocks;
+
+		for( block_number = extent->physical_block_number;
+		     block_number < last_block_number;
+		     block_number++ )
+		{
+			block_group_number = (uint32_t) ( ( block_number - inode_scanner->first_data_block_number ) / inode_scanner->number_of_blocks_per_block_group );
+			block_index        = (uint32_t) ( ( block_number - inode_scanner->first_data_block_number ) % inode_scanner->number_of_blocks_per_block_group );
+
+			if( ( block_bitmap == NULL )
+			 || ( block_index == 0 ) )
+			{
+				if( libfsext_inode_scanner_get_block_bitmap(
+				     inode_scanner,
+				     file_io_handle,
+				     block_group_number,
+				     &block_bitmap,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve block bitmap of block group: %" PRIu32 ".",
+					 function,
+					 block_group_number );
+
+					return( -1 );
+				}
+			}
+			if( ( block_bitmap[ block_index / 8 ] & ( 1 << ( block_index % 8 ) ) ) == 0 )
+			{
+				safe_number_of_unallocated++;
+			}
+			safe_number_of_blocks++;
+		}
+		/* The block bitmap of the next extent can be of a different block group
+		 */
+		block_bitmap = NULL;
+	}
+	*number_of_blocks             = safe_number_of_blocks;
+	*number_of_unallocated_blocks = safe_number_of_unallocated;
+
+	return( 1 );
+}
+
+/* Scans a candidate deleted inode and invokes the callback if its data reference is intact
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_inode_scanner_scan_inode(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t inode_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsext_inode_t *inode               = NULL;
+	static char *function                 = "libfsext_inode_scanner_scan_inode";
+	uint64_t number_of_blocks             = 0;
+	uint64_t number_of_unallocated_blocks = 0;
+	int result                            = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_scanner->callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_inode_initialize(
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		goto on_error;
+	}
+	inode->inode_number = inode_number;
+
+	/* The inode data of a deleted inode can be corrupt, in which case the inode is
+	 * not considered recoverable instead of failing the scan
+	 */
+	result = libfsext_inode_read_data(
+	          inode,
+	          inode_scanner->io_handle,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libfsext_inode_read_data_reference(
+		          inode,
+		          inode_scanner->io_handle,
+		          file_io_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 error );
+
+		result = 0;
+	}
+	else
+	{
+		result = libfsext_inode_scanner_get_number_of_unallocated_blocks(
+		          inode_scanner,
+		          file_io_handle,
+		          inode,
+		          &number_of_blocks,
+		          &number_of_unallocated_blocks,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of unallocated blocks of inode: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	if( ( result != 0 )
+	 && ( number_of_blocks > 0 ) )
+	{
+		if( inode_scanner->callback(
+		     inode_scanner->user_data,
+		     inode_number,
+		     inode->deletion_time,
+		     number_of_blocks,
+		     number_of_unallocated_blocks ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback failed for inode: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	if( libfsext_inode_free(
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsext_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the inode table of a specific block group for deleted inodes
+ * The inode table is read in batches of LIBFSEXT_MAXIMUM_INODE_TABLE_READ_SIZE
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_inode_scanner_scan_block_group(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_group_number,
+     libcerror_error_t **error )
+{
+	libfsext_group_descriptor_t *group_descriptor = NULL;
+	static char *function                         = "libfsext_inode_scanner_scan_block_group";
+	size64_t inode_table_size                     = 0;
+	size_t data_offset                            = 0;
+	size_t read_size                              = 0;
+	off64_t file_offset                           = 0;
+	uint32_t inode_number                         = 0;
+	uint32_t number_of_inodes                     = 0;
+	int result                                    = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_scanner->inode_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing inode table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     inode_scanner->group_descriptors_array,
+	     (int) block_group_number,
+	     (intptr_t **) &group_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group descriptor: %" PRIu32 ".",
+		 function,
+		 block_group_number );
+
+		return( -1 );
+	}
+	if( group_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing group descriptor: %" PRIu32 ".",
+		 function,
+		 block_group_number );
+
+		return( -1 );
+	}
+	number_of_inodes = inode_scanner->number_of_inodes_per_block_group;
+
+	/* The block group flags and number of unused inodes are only maintained
+	 * if the group descriptors are protected by checksums
+	 */
+	if( inode_scanner->has_group_descriptor_checksums != 0 )
+	{
+		if( ( group_descriptor->block_group_flags & LIBFSEXT_BLOCK_GROUP_FLAG_INODE_BITMAP_UNINITIALIZED ) != 0 )
+		{
+			return( 1 );
+		}
+		if( group_descriptor->number_of_unused_inodes < number_of_inodes )
+		{
+			number_of_inodes -= group_descriptor->number_of_unused_inodes;
+		}
+	}
+	if( group_descriptor->inode_table_block_number > ( (uint64_t) INT64_MAX / inode_scanner->io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid group descriptor - inode table block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset      = (off64_t) group_descriptor->inode_table_block_number * inode_scanner->io_handle->block_size;
+	inode_table_size = (size64_t) number_of_inodes * inode_scanner->inode_data_size;
+	inode_number     = ( block_group_number * inode_scanner->number_of_inodes_per_block_group ) + 1;
+
+	while( inode_table_size > 0 )
+	{
+		if( inode_scanner->io_handle->abort != 0 )
+		{
+			break;
+		}
+		read_size = inode_scanner->inode_table_data_size;
+
+		if( (size64_t) read_size > inode_table_size )
+		{
+			read_size = (size_t) inode_table_size;
+		}
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 inode_scanner->io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_BEGIN,
+		 0,
+		 file_offset,
+		 read_size );
+
+		result = libfsext_io_handle_read_metadata_at_offset(
+		          inode_scanner->io_handle,
+		          file_io_handle,
+		          inode_scanner->inode_table_data,
+		          read_size,
+		          file_offset,
+		          error );
+
+		LIBFSEXT_IO_HANDLE_TRACE_EVENT(
+		 inode_scanner->io_handle,
+		 LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ,
+		 LIBFSEXT_TRACE_EVENT_PHASE_END,
+		 0,
+		 file_offset,
+		 read_size );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode table at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		libfsext_io_handle_update_read_statistics(
+		 inode_scanner->io_handle,
+		 LIBFSEXT_STATISTICS_VALUE_INODE_TABLE_NUMBER_OF_READS,
+		 read_size );
+
+		for( data_offset = 0;
+		     data_offset < read_size;
+		     data_offset += inode_scanner->inode_data_size )
+		{
+			if( inode_number >= inode_scanner->first_non_reserved_inode )
+			{
+				result = libfsext_inode_scanner_check_inode_data(
+				          inode_scanner,
+				          &( inode_scanner->inode_table_data[ data_offset ] ),
+				          inode_scanner->inode_data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check data of inode: %" PRIu32 ".",
+					 function,
+					 inode_number );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					if( libfsext_inode_scanner_scan_inode(
+					     inode_scanner,
+					     file_io_handle,
+					     inode_number,
+					     &( inode_scanner->inode_table_data[ data_offset ] ),
+					     inode_scanner->inode_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to scan inode: %" PRIu32 ".",
+						 function,
+						 inode_number );
+
+						return( -1 );
+					}
+				}
+			}
+			inode_number++;
+		}
+		file_offset      += (off64_t) read_size;
+		inode_table_size -= read_size;
+	}
+	return( 1 );
+}
+
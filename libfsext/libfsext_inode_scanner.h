@@ -0,0 +1,162 @@
+/*
+ * Deleted inode scanner functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSEXT_INODE_SCANNER_H )
+#define _LIBFSEXT_INODE_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsext_inode.h"
+#include "libfsext_io_handle.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_superblock.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsext_inode_scanner libfsext_inode_scanner_t;
+
+struct libfsext_inode_scanner
+{
+	/* The IO handle
+	 */
+	libfsext_io_handle_t *io_handle;
+
+	/* The group descriptors array
+	 */
+	libcdata_array_t *group_descriptors_array;
+
+	/* The callback
+	 */
+	int (*callback)(
+	       intptr_t *user_data,
+	       uint32_t inode_number,
+	       uint32_t deletion_time,
+	       uint64_t number_of_blocks,
+	       uint64_t number_of_unallocated_blocks );
+
+	/* The callback user data
+	 */
+	intptr_t *user_data;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The first data block number
+	 */
+	uint32_t first_data_block_number;
+
+	/* The number of blocks per block group
+	 */
+	uint32_t number_of_blocks_per_block_group;
+
+	/* The number of inodes per block group
+	 */
+	uint32_t number_of_inodes_per_block_group;
+
+	/* The first non-reserved inode
+	 */
+	uint32_t first_non_reserved_inode;
+
+	/* Value to indicate the block group flags and number of unused inodes are valid
+	 */
+	uint8_t has_group_descriptor_checksums;
+
+	/* The inode data size
+	 */
+	size_t inode_data_size;
+
+	/* The inode table data
+	 * Contains multiple inodes that are read as a single batch
+	 */
+	uint8_t *inode_table_data;
+
+	/* The inode table data size
+	 */
+	size_t inode_table_data_size;
+
+	/* The block bitmaps
+	 * Contains a block bitmap per block group, that is read on demand
+	 */
+	uint8_t **block_bitmaps;
+
+	/* The number of block bitmaps
+	 */
+	int number_of_block_bitmaps;
+};
+
+int libfsext_inode_scanner_initialize(
+     libfsext_inode_scanner_t **inode_scanner,
+     libfsext_io_handle_t *io_handle,
+     libfsext_superblock_t *superblock,
+     libcdata_array_t *group_descriptors_array,
+     libcerror_error_t **error );
+
+int libfsext_inode_scanner_free(
+     libfsext_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error );
+
+int libfsext_inode_scanner_check_inode_data(
+     libfsext_inode_scanner_t *inode_scanner,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsext_inode_scanner_get_block_bitmap(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_group_number,
+     const uint8_t **block_bitmap,
+     libcerror_error_t **error );
+
+int libfsext_inode_scanner_get_number_of_unallocated_blocks(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     libfsext_inode_t *inode,
+     uint64_t *number_of_blocks,
+     uint64_t *number_of_unallocated_blocks,
+     libcerror_error_t **error );
+
+int libfsext_inode_scanner_scan_inode(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t inode_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsext_inode_scanner_scan_block_group(
+     libfsext_inode_scanner_t *inode_scanner,
+     libbfio_handle_t *file_io_handle,
+     uint32_t block_group_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSEXT_INODE_SCANNER_H ) */
+
@@ -145,6 +145,9 @@ int libfsext_inode_table_initialize(
 
 		goto on_error;
 	}
+	( *inode_table )->io_handle                        = io_handle;
+	( *inode_table )->number_of_inodes_per_block_group = superblock->number_of_inodes_per_block_group;
+
 	if( inode_size != 0 )
 	{
 		inode_data_size = (size_t) inode_size;
@@ -161,6 +164,8 @@ int libfsext_inode_table_initialize(
 	{
 		inode_data_size = sizeof( fsext_inode_ext2_t );
 	}
+	( *inode_table )->inode_data_size = inode_data_size;
+
 	if( libfdata_vector_initialize(
 	     &( ( *inode_table )->inodes_vector ),
 	     inode_data_size,
@@ -274,11 +279,31 @@ int libfsext_inode_table_initialize(
 
 		goto on_error;
 	}
+	if( libfcache_cache_initialize(
+	     &( ( *inode_table )->attributes_blocks_cache ),
+	     LIBFSEXT_MAXIMUM_CACHE_ENTRIES_ATTRIBUTES_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extended attributes blocks cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *inode_table != NULL )
 	{
+		if( ( *inode_table )->inodes_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *inode_table )->inodes_cache ),
+			 NULL );
+		}
 		if( ( *inode_table )->inodes_vector != NULL )
 		{
 			libfdata_vector_free(
@@ -342,6 +367,19 @@ int libfsext_inode_table_free(
 
 			result = -1;
 		}
+		if( libfcache_cache_free(
+		     &( ( *inode_table )->attributes_blocks_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extended attributes blocks cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *inode_table );
 
@@ -360,7 +398,9 @@ int libfsext_inode_table_get_inode_by_number(
      libfsext_inode_t **inode,
      libcerror_error_t **error )
 {
-	static char *function = "libfsext_inode_table_get_inode_by_number";
+	static char *function         = "libfsext_inode_table_get_inode_by_number";
+	uint64_t cache_misses         = 0;
+	uint64_t current_cache_misses = 0;
 
 	if( inode_table == NULL )
 	{
@@ -392,6 +432,24 @@ int libfsext_inode_table_get_inode_by_number(
 		 inode_number );
 	}
 #endif
+	if( inode_table->io_handle != NULL )
+	{
+		if( libfsext_io_handle_get_statistics_value(
+		     inode_table->io_handle,
+		     LIBFSEXT_STATISTICS_VALUE_INODE_CACHE_MISSES,
+		     &cache_misses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode cache misses statistics value.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libfdata_vector_get_element_value_by_index(
 	     inode_table->inodes_vector,
 	     (intptr_t *) file_io_handle,
@@ -411,6 +469,121 @@ int libfsext_inode_table_get_inode_by_number(
 
 		return( -1 );
 	}
+	if( inode_table->io_handle != NULL )
+	{
+		if( libfsext_io_handle_get_statistics_value(
+		     inode_table->io_handle,
+		     LIBFSEXT_STATISTICS_VALUE_INODE_CACHE_MISSES,
+		     &current_cache_misses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode cache misses statistics value.",
+			 function );
+
+			return( -1 );
+		}
+		if( current_cache_misses == cache_misses )
+		{
+			libfsext_io_handle_increment_statistics_value(
+			 inode_table->io_handle,
+			 LIBFSEXT_STATISTICS_VALUE_INODE_CACHE_HITS,
+			 1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of a specific inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_inode_table_get_inode_offset_by_number(
+     libfsext_inode_table_t *inode_table,
+     uint32_t inode_number,
+     off64_t *inode_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsext_inode_table_get_inode_offset_by_number";
+	size64_t segment_size  = 0;
+	off64_t segment_offset = 0;
+	uint32_t segment_flags = 0;
+	uint32_t inode_index   = 0;
+	int segment_file_index = 0;
+	int segment_index      = 0;
+
+	if( inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode table.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_table->number_of_inodes_per_block_group == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode table - number of inodes per block group value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid inode number value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The inodes vector contains a segment per block group
+	 */
+	segment_index = (int) ( ( inode_number - 1 ) / inode_table->number_of_inodes_per_block_group );
+	inode_index   = ( inode_number - 1 ) % inode_table->number_of_inodes_per_block_group;
+
+	if( libfdata_vector_get_segment_by_index(
+	     inode_table->inodes_vector,
+	     segment_index,
+	     &segment_file_index,
+	     &segment_offset,
+	     &segment_size,
+	     &segment_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment: %d of inodes vector.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	*inode_offset = segment_offset + (off64_t) ( (size64_t) inode_index * inode_table->inode_data_size );
+
 	return( 1 );
 }
 
@@ -42,10 +42,18 @@ typedef struct libfsext_inode_table libfsext_inode_table_t;
 
 struct libfsext_inode_table
 {
+	/* The IO handle
+	 */
+	libfsext_io_handle_t *io_handle;
+
 	/* The inode data size
 	 */
 	size_t inode_data_size;
 
+	/* The number of inodes per block group
+	 */
+	uint32_t number_of_inodes_per_block_group;
+
 	/* The inodes vector
 	 */
 	libfdata_vector_t *inodes_vector;
@@ -53,6 +61,15 @@ struct libfsext_inode_table
 	/* The inodes cache
 	 */
 	libfcache_cache_t *inodes_cache;
+
+	/* The extended attributes blocks cache
+	 */
+	libfcache_cache_t *attributes_blocks_cache;
+
+	/* The extended attributes blocks cache timestamp
+	 * Used to determine the least recently used entry of the extended attributes blocks cache
+	 */
+	int64_t attributes_blocks_cache_timestamp;
 };
 
 int libfsext_inode_table_initialize(
@@ -74,6 +91,12 @@ int libfsext_inode_table_get_inode_by_number(
      libfsext_inode_t **inode,
      libcerror_error_t **error );
 
+int libfsext_inode_table_get_inode_offset_by_number(
+     libfsext_inode_table_t *inode_table,
+     uint32_t inode_number,
+     off64_t *inode_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
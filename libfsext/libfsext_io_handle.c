@@ -25,11 +25,19 @@
 #include <system_string.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
 #include "libfsext_debug.h"
+#include "libfsext_definitions.h"
 #include "libfsext_io_handle.h"
 #include "libfsext_libbfio.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libcnotify.h"
+#include "libfsext_libcthreads.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -89,8 +97,28 @@ int libfsext_io_handle_initialize(
 		 "%s: unable to clear IO handle.",
 		 function );
 
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_initialize(
+	     &( ( *io_handle )->statistics_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize statistics lock.",
+		 function );
+
 		goto on_error;
 	}
+#endif
 	return( 1 );
 
 on_error:
@@ -127,6 +155,21 @@ int libfsext_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_lock_free(
+		     &( ( *io_handle )->statistics_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -142,7 +185,25 @@ int libfsext_io_handle_clear(
      libfsext_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfsext_io_handle_clear";
+	static char *function                     = "libfsext_io_handle_clear";
+	uint8_t recover_deleted_directory_entries = 0;
+	uint8_t time_checksum_verification        = 0;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	libcthreads_lock_t *statistics_lock       = NULL;
+#endif
+
+#if defined( HAVE_LIBFSEXT_TRACE )
+	void (*trace_callback)(
+	       intptr_t *user_data,
+	       int event_type,
+	       int event_phase,
+	       uint32_t inode_number,
+	       off64_t offset,
+	       size64_t size ) = NULL;
+
+	intptr_t *trace_user_data = NULL;
+#endif
 
 	if( io_handle == NULL )
 	{
@@ -155,6 +216,24 @@ int libfsext_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The recover deleted directory entries value is set by the user and remains set after close
+	 */
+	recover_deleted_directory_entries = io_handle->recover_deleted_directory_entries;
+	time_checksum_verification        = io_handle->time_checksum_verification;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	/* The statistics lock is created with the IO handle and remains set until it is freed
+	 */
+	statistics_lock = io_handle->statistics_lock;
+#endif
+
+#if defined( HAVE_LIBFSEXT_TRACE )
+	/* The trace callback is set by the user and remains set after close
+	 */
+	trace_callback  = io_handle->trace_callback;
+	trace_user_data = io_handle->trace_user_data;
+#endif
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -169,6 +248,391 @@ int libfsext_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->recover_deleted_directory_entries = recover_deleted_directory_entries;
+	io_handle->time_checksum_verification        = time_checksum_verification;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	io_handle->statistics_lock = statistics_lock;
+#endif
+
+#if defined( HAVE_LIBFSEXT_TRACE )
+	io_handle->trace_callback  = trace_callback;
+	io_handle->trace_user_data = trace_user_data;
+#endif
+
 	return( 1 );
 }
 
+/* Retrieves the current time of a monotonic clock in nanoseconds
+ * Returns the current time or 0 if not available
+ */
+uint64_t libfsext_io_handle_get_current_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the start time of a checksum verification
+ * Returns the current time or 0 if the checksum verification is not timed
+ */
+uint64_t libfsext_io_handle_get_checksum_start_time(
+          libfsext_io_handle_t *io_handle )
+{
+	if( ( io_handle == NULL )
+	 || ( io_handle->time_checksum_verification == 0 ) )
+	{
+		return( 0 );
+	}
+	return( libfsext_io_handle_get_current_time() );
+}
+
+/* Increments a specific statistics value
+ * The statistics values are updated while holding the statistics lock, if the statistics
+ * lock cannot be grabbed the statistics value is not updated
+ */
+void libfsext_io_handle_increment_statistics_value(
+      libfsext_io_handle_t *io_handle,
+      int statistics_value,
+      uint64_t increment )
+{
+	if( ( io_handle == NULL )
+	 || ( statistics_value < 0 )
+	 || ( statistics_value >= LIBFSEXT_NUMBER_OF_STATISTICS_VALUES ) )
+	{
+		return;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_grab(
+	     io_handle->statistics_lock,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+#endif
+	io_handle->statistics_values[ statistics_value ] += increment;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	libcthreads_lock_release(
+	 io_handle->statistics_lock,
+	 NULL );
+#endif
+}
+
+/* Updates the number of reads and read size statistics values
+ * The read size value directly follows the number of reads value
+ */
+void libfsext_io_handle_update_read_statistics(
+      libfsext_io_handle_t *io_handle,
+      int number_of_reads_value,
+      size_t read_size )
+{
+	if( ( io_handle == NULL )
+	 || ( number_of_reads_value < 0 )
+	 || ( number_of_reads_value >= ( LIBFSEXT_NUMBER_OF_STATISTICS_VALUES - 1 ) ) )
+	{
+		return;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_grab(
+	     io_handle->statistics_lock,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+#endif
+	io_handle->statistics_values[ number_of_reads_value ] += 1;
+	io_handle->statistics_values[ number_of_reads_value + 1 ] += (uint64_t) read_size;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	libcthreads_lock_release(
+	 io_handle->statistics_lock,
+	 NULL );
+#endif
+}
+
+/* Updates the checksum verification statistics values
+ * The start time is the time, as returned by libfsext_io_handle_get_checksum_start_time,
+ * the verification started. The time is only measured if the start time is set
+ */
+void libfsext_io_handle_update_checksum_statistics(
+      libfsext_io_handle_t *io_handle,
+      uint64_t start_time )
+{
+	uint64_t current_time = 0;
+
+	if( io_handle == NULL )
+	{
+		return;
+	}
+	if( start_time != 0 )
+	{
+		current_time = libfsext_io_handle_get_current_time();
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_grab(
+	     io_handle->statistics_lock,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+#endif
+	io_handle->statistics_values[ LIBFSEXT_STATISTICS_VALUE_NUMBER_OF_CHECKSUM_VERIFICATIONS ] += 1;
+
+	if( current_time > start_time )
+	{
+		io_handle->statistics_values[ LIBFSEXT_STATISTICS_VALUE_CHECKSUM_VERIFICATION_TIME ] += current_time - start_time;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	libcthreads_lock_release(
+	 io_handle->statistics_lock,
+	 NULL );
+#endif
+}
+
+/* Reads metadata from the volume and overlays the journal copies of its blocks
+ * The journal copies are only overlaid if a journal is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_io_handle_read_metadata_at_offset(
+     libfsext_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_io_handle_read_metadata_at_offset";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( io_handle->journal == NULL )
+	{
+		return( 1 );
+	}
+	if( libfsext_journal_overlay_buffer(
+	     io_handle->journal,
+	     file_io_handle,
+	     data,
+	     data_size,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to overlay journal blocks at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific statistics value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_io_handle_get_statistics_value(
+     libfsext_io_handle_t *io_handle,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_io_handle_get_statistics_value";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( statistics_value < 0 )
+	 || ( statistics_value >= LIBFSEXT_NUMBER_OF_STATISTICS_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported statistics value: %d.",
+		 function,
+		 statistics_value );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_grab(
+	     io_handle->statistics_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*value = io_handle->statistics_values[ statistics_value ];
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_release(
+	     io_handle->statistics_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Resets the statistics values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_io_handle_reset_statistics(
+     libfsext_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_io_handle_reset_statistics";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_grab(
+	     io_handle->statistics_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_set(
+	     io_handle->statistics_values,
+	     0,
+	     sizeof( uint64_t ) * LIBFSEXT_NUMBER_OF_STATISTICS_VALUES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_lock_release(
+	     io_handle->statistics_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics lock.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -25,8 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsext_definitions.h"
+#include "libfsext_journal.h"
 #include "libfsext_libbfio.h"
 #include "libfsext_libcerror.h"
+#include "libfsext_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -68,15 +71,87 @@ struct libfsext_io_handle
 	 */
 	uint32_t read_only_compatible_features_flags;
 
+	/* The number of inodes
+	 */
+	uint32_t number_of_inodes;
+
 	/* The initial metadata checksum value (or seed)
 	 */
 	uint32_t metadata_checksum_seed;
 
+	/* The journal
+	 * Set if the committed transactions of the journal are overlaid on metadata reads
+	 */
+	libfsext_journal_t *journal;
+
+	/* Value to indicate deleted directory entries should be recovered from directory entry slack
+	 */
+	uint8_t recover_deleted_directory_entries;
+
+	/* Value to indicate the time spent in checksum verification should be measured
+	 */
+	uint8_t time_checksum_verification;
+
+	/* The statistics values
+	 */
+	uint64_t statistics_values[ LIBFSEXT_NUMBER_OF_STATISTICS_VALUES ];
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	/* The statistics values lock
+	 */
+	libcthreads_lock_t *statistics_lock;
+#endif
+
+#if defined( HAVE_LIBFSEXT_TRACE )
+	/* The trace callback function
+	 */
+	void (*trace_callback)(
+	       intptr_t *user_data,
+	       int event_type,
+	       int event_phase,
+	       uint32_t inode_number,
+	       off64_t offset,
+	       size64_t size );
+
+	/* The trace callback user data
+	 */
+	intptr_t *trace_user_data;
+
+#endif /* defined( HAVE_LIBFSEXT_TRACE ) */
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
 };
 
+/* Invokes the trace callback, if set
+ * This macro compiles to nothing if trace support is not enabled
+ */
+#if defined( HAVE_LIBFSEXT_TRACE )
+#define LIBFSEXT_IO_HANDLE_TRACE_EVENT( io_handle, event_type, event_phase, inode_number, offset, size ) \
+	do \
+	{ \
+		if( ( ( io_handle ) != NULL ) \
+		 && ( ( io_handle )->trace_callback != NULL ) ) \
+		{ \
+			( io_handle )->trace_callback( \
+			 ( io_handle )->trace_user_data, \
+			 event_type, \
+			 event_phase, \
+			 (uint32_t) ( inode_number ), \
+			 (off64_t) ( offset ), \
+			 (size64_t) ( size ) ); \
+		} \
+	} \
+	while( 0 )
+#else
+#define LIBFSEXT_IO_HANDLE_TRACE_EVENT( io_handle, event_type, event_phase, inode_number, offset, size ) \
+	do \
+	{ \
+	} \
+	while( 0 )
+#endif
+
 int libfsext_io_handle_initialize(
      libfsext_io_handle_t **io_handle,
      libcerror_error_t **error );
@@ -89,6 +164,44 @@ int libfsext_io_handle_clear(
      libfsext_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+uint64_t libfsext_io_handle_get_current_time(
+          void );
+
+uint64_t libfsext_io_handle_get_checksum_start_time(
+          libfsext_io_handle_t *io_handle );
+
+void libfsext_io_handle_increment_statistics_value(
+      libfsext_io_handle_t *io_handle,
+      int statistics_value,
+      uint64_t increment );
+
+void libfsext_io_handle_update_read_statistics(
+      libfsext_io_handle_t *io_handle,
+      int number_of_reads_value,
+      size_t read_size );
+
+void libfsext_io_handle_update_checksum_statistics(
+      libfsext_io_handle_t *io_handle,
+      uint64_t start_time );
+
+int libfsext_io_handle_read_metadata_at_offset(
+     libfsext_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libfsext_io_handle_get_statistics_value(
+     libfsext_io_handle_t *io_handle,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libfsext_io_handle_reset_statistics(
+     libfsext_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1771 @@
+/*
+ * Journal (jbd2) functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsext_definitions.h"
+#include "libfsext_extent.h"
+#include "libfsext_journal.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_libcnotify.h"
+
+#include "fsext_journal.h"
+
+#define LIBFSEXT_JOURNAL_INITIAL_NUMBER_OF_BLOCK_ENTRIES	1024
+#define LIBFSEXT_JOURNAL_INITIAL_NUMBER_OF_REVOKE_ENTRIES	64
+
+const uint8_t fsext_journal_signature[ 4 ] = { 0xc0, 0x3b, 0x39, 0x98 };
+
+/* Creates a journal
+ * Make sure the value journal is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_initialize(
+     libfsext_journal_t **journal,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_journal_initialize";
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( *journal != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid journal value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*journal = memory_allocate_structure(
+	            libfsext_journal_t );
+
+	if( *journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create journal.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *journal,
+	     0,
+	     sizeof( libfsext_journal_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear journal.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *journal != NULL )
+	{
+		memory_free(
+		 *journal );
+
+		*journal = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a journal
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_free(
+     libfsext_journal_t **journal,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_journal_free";
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( *journal != NULL )
+	{
+		if( ( *journal )->revoke_entries != NULL )
+		{
+			memory_free(
+			 ( *journal )->revoke_entries );
+		}
+		if( ( *journal )->block_entries != NULL )
+		{
+			memory_free(
+			 ( *journal )->block_entries );
+		}
+		memory_free(
+		 *journal );
+
+		*journal = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the journal superblock data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_read_superblock_data(
+     libfsext_journal_t *journal,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_journal_read_superblock_data";
+	uint32_t block_type   = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsext_journal_superblock_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: journal superblock data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( fsext_journal_superblock_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     ( (fsext_journal_superblock_t *) data )->signature,
+	     fsext_journal_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid journal superblock signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsext_journal_superblock_t *) data )->block_type,
+	 block_type );
+
+	if( ( block_type != LIBFSEXT_JOURNAL_BLOCK_TYPE_SUPERBLOCK_VERSION1 )
+	 && ( block_type != LIBFSEXT_JOURNAL_BLOCK_TYPE_SUPERBLOCK_VERSION2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported journal superblock block type: %" PRIu32 ".",
+		 function,
+		 block_type );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsext_journal_superblock_t *) data )->block_size,
+	 journal->block_size );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsext_journal_superblock_t *) data )->number_of_blocks,
+	 journal->number_of_blocks );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsext_journal_superblock_t *) data )->first_log_block_number,
+	 journal->first_log_block_number );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsext_journal_superblock_t *) data )->first_sequence_number,
+	 journal->first_sequence_number );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsext_journal_superblock_t *) data )->start_log_block_number,
+	 journal->start_log_block_number );
+
+	/* The features flags are only defined in a version 2 superblock
+	 */
+	if( block_type == LIBFSEXT_JOURNAL_BLOCK_TYPE_SUPERBLOCK_VERSION2 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsext_journal_superblock_t *) data )->incompatible_features_flags,
+		 journal->incompatible_features_flags );
+	}
+	else
+	{
+		journal->incompatible_features_flags = 0;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block type\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 block_type );
+
+		libcnotify_printf(
+		 "%s: block size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 journal->block_size );
+
+		libcnotify_printf(
+		 "%s: number of blocks\t\t\t: %" PRIu32 "\n",
+		 function,
+		 journal->number_of_blocks );
+
+		libcnotify_printf(
+		 "%s: first log block number\t\t: %" PRIu32 "\n",
+		 function,
+		 journal->first_log_block_number );
+
+		libcnotify_printf(
+		 "%s: first sequence number\t\t: %" PRIu32 "\n",
+		 function,
+		 journal->first_sequence_number );
+
+		libcnotify_printf(
+		 "%s: start log block number\t\t: %" PRIu32 "\n",
+		 function,
+		 journal->start_log_block_number );
+
+		libcnotify_printf(
+		 "%s: incompatible features flags\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 journal->incompatible_features_flags );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( ( journal->block_size < 1024 )
+	 || ( journal->block_size > 65536 )
+	 || ( ( journal->block_size & ( journal->block_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported journal block size: %" PRIu32 ".",
+		 function,
+		 journal->block_size );
+
+		return( -1 );
+	}
+	if( ( journal->first_log_block_number == 0 )
+	 || ( journal->first_log_block_number >= journal->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first log block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( journal->start_log_block_number != 0 )
+	 && ( ( journal->start_log_block_number < journal->first_log_block_number )
+	  || ( journal->start_log_block_number >= journal->number_of_blocks ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start log block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the size of the block tags in the descriptor blocks
+	 */
+	if( ( journal->incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION3 ) != 0 )
+	{
+		journal->block_tag_size = sizeof( fsext_journal_block_tag3_t );
+	}
+	else
+	{
+		journal->block_tag_size = sizeof( fsext_journal_block_tag_t );
+
+		if( ( journal->incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION2 ) != 0 )
+		{
+			journal->block_tag_size += 2;
+		}
+		if( ( journal->incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT ) == 0 )
+		{
+			journal->block_tag_size -= 4;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the log block number that follows a specific log block number
+ * The log wraps around from the last block to the first log block
+ */
+static uint32_t libfsext_journal_get_next_log_block_number(
+                 libfsext_journal_t *journal,
+                 uint32_t log_block_number )
+{
+	log_block_number += 1;
+
+	if( log_block_number >= journal->number_of_blocks )
+	{
+		log_block_number = journal->first_log_block_number;
+	}
+	return( log_block_number );
+}
+
+/* Appends a block entry of the current transaction
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_append_block_entry(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     uint32_t log_block_number,
+     uint8_t is_escaped,
+     libcerror_error_t **error )
+{
+	libfsext_journal_block_entry_t *block_entry = NULL;
+	void *reallocation                          = NULL;
+	static char *function                       = "libfsext_journal_append_block_entry";
+	int number_of_allocated_block_entries       = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal->number_of_block_entries >= journal->number_of_allocated_block_entries )
+	{
+		number_of_allocated_block_entries = journal->number_of_allocated_block_entries;
+
+		if( number_of_allocated_block_entries == 0 )
+		{
+			number_of_allocated_block_entries = LIBFSEXT_JOURNAL_INITIAL_NUMBER_OF_BLOCK_ENTRIES;
+		}
+		else
+		{
+			if( (size_t) number_of_allocated_block_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libfsext_journal_block_entry_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated block entries value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_block_entries *= 2;
+		}
+		reallocation = memory_reallocate(
+		                journal->block_entries,
+		                sizeof( libfsext_journal_block_entry_t ) * number_of_allocated_block_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize block entries.",
+			 function );
+
+			return( -1 );
+		}
+		journal->block_entries                     = (libfsext_journal_block_entry_t *) reallocation;
+		journal->number_of_allocated_block_entries = number_of_allocated_block_entries;
+	}
+	block_entry = &( journal->block_entries[ journal->number_of_block_entries ] );
+
+	block_entry->block_number         = block_number;
+	block_entry->journal_block_number = (uint64_t) log_block_number;
+	block_entry->transaction_index    = journal->number_of_transactions;
+	block_entry->entry_index          = (uint32_t) journal->number_of_block_entries;
+	block_entry->is_escaped           = is_escaped;
+	block_entry->is_current           = 0;
+
+	journal->number_of_block_entries += 1;
+
+	return( 1 );
+}
+
+/* Appends a revoke entry of the current transaction
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_append_revoke_entry(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	libfsext_journal_revoke_entry_t *revoke_entry = NULL;
+	void *reallocation                            = NULL;
+	static char *function                         = "libfsext_journal_append_revoke_entry";
+	int number_of_allocated_revoke_entries        = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal->number_of_revoke_entries >= journal->number_of_allocated_revoke_entries )
+	{
+		number_of_allocated_revoke_entries = journal->number_of_allocated_revoke_entries;
+
+		if( number_of_allocated_revoke_entries == 0 )
+		{
+			number_of_allocated_revoke_entries = LIBFSEXT_JOURNAL_INITIAL_NUMBER_OF_REVOKE_ENTRIES;
+		}
+		else
+		{
+			if( (size_t) number_of_allocated_revoke_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libfsext_journal_revoke_entry_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated revoke entries value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_revoke_entries *= 2;
+		}
+		reallocation = memory_reallocate(
+		                journal->revoke_entries,
+		                sizeof( libfsext_journal_revoke_entry_t ) * number_of_allocated_revoke_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize revoke entries.",
+			 function );
+
+			return( -1 );
+		}
+		journal->revoke_entries                     = (libfsext_journal_revoke_entry_t *) reallocation;
+		journal->number_of_allocated_revoke_entries = number_of_allocated_revoke_entries;
+	}
+	revoke_entry = &( journal->revoke_entries[ journal->number_of_revoke_entries ] );
+
+	revoke_entry->block_number      = block_number;
+	revoke_entry->transaction_index = journal->number_of_transactions;
+
+	journal->number_of_revoke_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the block tags of a descriptor block
+ * The log block number contains the log block number of the descriptor block on input
+ * and the log block number of the last data block of the descriptor block on output
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_read_descriptor_block_data(
+     libfsext_journal_t *journal,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *log_block_number,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfsext_journal_read_descriptor_block_data";
+	size_t data_end_offset         = 0;
+	size_t data_offset             = 0;
+	uint64_t block_number          = 0;
+	uint32_t flags                 = 0;
+	uint32_t safe_log_block_number = 0;
+	uint32_t value_32bit           = 0;
+	uint16_t value_16bit           = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( journal->block_tag_size == 0 )
+	 || ( journal->number_of_blocks == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid journal - missing superblock values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsext_journal_block_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( log_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid log block number.",
+		 function );
+
+		return( -1 );
+	}
+	safe_log_block_number = *log_block_number;
+
+	data_offset     = sizeof( fsext_journal_block_header_t );
+	data_end_offset = data_size;
+
+	/* The descriptor block ends with a checksum if metadata checksums are used
+	 */
+	if( ( journal->incompatible_features_flags & ( LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION2 | LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION3 ) ) != 0 )
+	{
+		data_end_offset -= 4;
+	}
+	while( ( data_offset + journal->block_tag_size ) <= data_end_offset )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		block_number = value_32bit;
+
+		if( ( journal->incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION3 ) != 0 )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsext_journal_block_tag3_t *) &( data[ data_offset ] ) )->flags,
+			 flags );
+
+			if( ( journal->incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT ) != 0 )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 ( (fsext_journal_block_tag3_t *) &( data[ data_offset ] ) )->block_number_upper,
+				 value_32bit );
+
+				block_number |= (uint64_t) value_32bit << 32;
+			}
+		}
+		else
+		{
+			byte_stream_copy_to_uint16_big_endian(
+			 ( (fsext_journal_block_tag_t *) &( data[ data_offset ] ) )->flags,
+			 value_16bit );
+
+			flags = value_16bit;
+
+			if( ( journal->incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT ) != 0 )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 ( (fsext_journal_block_tag_t *) &( data[ data_offset ] ) )->block_number_upper,
+				 value_32bit );
+
+				block_number |= (uint64_t) value_32bit << 32;
+			}
+		}
+		data_offset += journal->block_tag_size;
+
+		/* The journal identifier follows the first block tag
+		 */
+		if( ( flags & LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_SAME_IDENTIFIER ) == 0 )
+		{
+			data_offset += 16;
+		}
+		safe_log_block_number = libfsext_journal_get_next_log_block_number(
+		                         journal,
+		                         safe_log_block_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: block: %" PRIu64 " in log block: %" PRIu32 " with flags: 0x%04" PRIx32 "\n",
+			 function,
+			 block_number,
+			 safe_log_block_number,
+			 flags );
+		}
+#endif
+		if( libfsext_journal_append_block_entry(
+		     journal,
+		     block_number,
+		     safe_log_block_number,
+		     (uint8_t) ( ( flags & LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_ESCAPED ) != 0 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append block entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( flags & LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_LAST_TAG ) != 0 )
+		{
+			break;
+		}
+	}
+	*log_block_number = safe_log_block_number;
+
+	return( 1 );
+}
+
+/* Reads the revoked block numbers of a revoke block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_read_revoke_block_data(
+     libfsext_journal_t *journal,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsext_journal_read_revoke_block_data";
+	size_t block_number_size      = 0;
+	size_t data_offset            = 0;
+	uint64_t block_number         = 0;
+	uint32_t number_of_bytes_used = 0;
+	uint32_t value_32bit          = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsext_journal_revoke_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsext_journal_revoke_header_t *) data )->number_of_bytes_used,
+	 number_of_bytes_used );
+
+	if( ( number_of_bytes_used < sizeof( fsext_journal_revoke_header_t ) )
+	 || ( number_of_bytes_used > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bytes used value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( journal->incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT ) != 0 )
+	{
+		block_number_size = 8;
+	}
+	else
+	{
+		block_number_size = 4;
+	}
+	for( data_offset = sizeof( fsext_journal_revoke_header_t );
+	     ( data_offset + block_number_size ) <= (size_t) number_of_bytes_used;
+	     data_offset += block_number_size )
+	{
+		if( block_number_size == 8 )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( data[ data_offset ] ),
+			 block_number );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( data[ data_offset ] ),
+			 value_32bit );
+
+			block_number = value_32bit;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: revoked block: %" PRIu64 "\n",
+			 function,
+			 block_number );
+		}
+#endif
+		if( libfsext_journal_append_revoke_entry(
+		     journal,
+		     block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append revoke entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Commits the block and revoke entries of the current transaction
+ */
+void libfsext_journal_commit_transaction(
+      libfsext_journal_t *journal )
+{
+	if( journal != NULL )
+	{
+		journal->number_of_committed_block_entries  = journal->number_of_block_entries;
+		journal->number_of_committed_revoke_entries = journal->number_of_revoke_entries;
+
+		journal->number_of_transactions += 1;
+	}
+}
+
+/* Compares two block entries by block number and their order in the log
+ * Callback function for qsort
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsext_journal_compare_block_entries(
+     const void *first_block_entry,
+     const void *second_block_entry )
+{
+	const libfsext_journal_block_entry_t *first_entry  = (const libfsext_journal_block_entry_t *) first_block_entry;
+	const libfsext_journal_block_entry_t *second_entry = (const libfsext_journal_block_entry_t *) second_block_entry;
+
+	if( first_entry->block_number < second_entry->block_number )
+	{
+		return( -1 );
+	}
+	else if( first_entry->block_number > second_entry->block_number )
+	{
+		return( 1 );
+	}
+	if( first_entry->entry_index < second_entry->entry_index )
+	{
+		return( -1 );
+	}
+	else if( first_entry->entry_index > second_entry->entry_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two revoke entries by block number and transaction index
+ * Callback function for qsort
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsext_journal_compare_revoke_entries(
+     const void *first_revoke_entry,
+     const void *second_revoke_entry )
+{
+	const libfsext_journal_revoke_entry_t *first_entry  = (const libfsext_journal_revoke_entry_t *) first_revoke_entry;
+	const libfsext_journal_revoke_entry_t *second_entry = (const libfsext_journal_revoke_entry_t *) second_revoke_entry;
+
+	if( first_entry->block_number < second_entry->block_number )
+	{
+		return( -1 );
+	}
+	else if( first_entry->block_number > second_entry->block_number )
+	{
+		return( 1 );
+	}
+	if( first_entry->transaction_index < second_entry->transaction_index )
+	{
+		return( -1 );
+	}
+	else if( first_entry->transaction_index > second_entry->transaction_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Resolves the block entries of the committed transactions
+ * Only the latest copy of every block is kept, unless it was revoked by the same or a later transaction
+ * The block entries are sorted by block number afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_resolve_block_entries(
+     libfsext_journal_t *journal,
+     libcerror_error_t **error )
+{
+	libfsext_journal_block_entry_t *block_entry = NULL;
+	static char *function                       = "libfsext_journal_resolve_block_entries";
+	int block_entry_index                       = 0;
+	int revoke_entry_index                      = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	/* Discard the entries of a transaction that was not committed
+	 */
+	journal->number_of_block_entries  = journal->number_of_committed_block_entries;
+	journal->number_of_revoke_entries = journal->number_of_committed_revoke_entries;
+
+	if( journal->number_of_block_entries > 1 )
+	{
+		qsort(
+		 journal->block_entries,
+		 (size_t) journal->number_of_block_entries,
+		 sizeof( libfsext_journal_block_entry_t ),
+		 &libfsext_journal_compare_block_entries );
+	}
+	if( journal->number_of_revoke_entries > 1 )
+	{
+		qsort(
+		 journal->revoke_entries,
+		 (size_t) journal->number_of_revoke_entries,
+		 sizeof( libfsext_journal_revoke_entry_t ),
+		 &libfsext_journal_compare_revoke_entries );
+	}
+	/* Both arrays are sorted by block number, hence they can be merged in a single pass
+	 * where the last entry of a block number is the latest. The older entries are retained
+	 * as the history of the block.
+	 */
+	journal->number_of_current_block_entries = 0;
+
+	for( block_entry_index = 0;
+	     block_entry_index < journal->number_of_block_entries;
+	     block_entry_index++ )
+	{
+		block_entry = &( journal->block_entries[ block_entry_index ] );
+
+		block_entry->is_current = 0;
+
+		if( ( ( block_entry_index + 1 ) < journal->number_of_block_entries )
+		 && ( journal->block_entries[ block_entry_index + 1 ].block_number == block_entry->block_number ) )
+		{
+			continue;
+		}
+		while( ( revoke_entry_index < journal->number_of_revoke_entries )
+		    && ( journal->revoke_entries[ revoke_entry_index ].block_number < block_entry->block_number ) )
+		{
+			revoke_entry_index++;
+		}
+		while( ( ( revoke_entry_index + 1 ) < journal->number_of_revoke_entries )
+		    && ( journal->revoke_entries[ revoke_entry_index + 1 ].block_number == block_entry->block_number ) )
+		{
+			revoke_entry_index++;
+		}
+		if( ( revoke_entry_index < journal->number_of_revoke_entries )
+		 && ( journal->revoke_entries[ revoke_entry_index ].block_number == block_entry->block_number )
+		 && ( journal->revoke_entries[ revoke_entry_index ].transaction_index >= block_entry->transaction_index ) )
+		{
+			continue;
+		}
+		block_entry->is_current = 1;
+
+		journal->number_of_current_block_entries += 1;
+	}
+	/* The revoke entries are no longer needed
+	 */
+	if( journal->revoke_entries != NULL )
+	{
+		memory_free(
+		 journal->revoke_entries );
+
+		journal->revoke_entries = NULL;
+	}
+	journal->number_of_revoke_entries           = 0;
+	journal->number_of_committed_revoke_entries = 0;
+	journal->number_of_allocated_revoke_entries = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the physical block number of a logical block number in the extents
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsext_journal_get_physical_block_number(
+     libcdata_array_t *extents_array,
+     uint64_t logical_block_number,
+     uint64_t *physical_block_number,
+     libcerror_error_t **error )
+{
+	libfsext_extent_t *extent = NULL;
+	static char *function     = "libfsext_journal_get_physical_block_number";
+	int extent_index          = 0;
+	int lower_index           = 0;
+	int number_of_extents     = 0;
+	int upper_index           = 0;
+
+	if( physical_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical block number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extents are stored in logical block number order
+	 */
+	upper_index = number_of_extents;
+
+	while( lower_index < upper_index )
+	{
+		extent_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     extents_array,
+		     extent_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( logical_block_number < (uint64_t) extent->logical_block_number )
+		{
+			upper_index = extent_index;
+		}
+		else if( ( logical_block_number - extent->logical_block_number ) >= extent->number_of_blocks )
+		{
+			lower_index = extent_index + 1;
+		}
+		else
+		{
+			if( ( extent->range_flags & LIBFSEXT_EXTENT_FLAG_IS_SPARSE ) != 0 )
+			{
+				return( 0 );
+			}
+			*physical_block_number = extent->physical_block_number + ( logical_block_number - extent->logical_block_number );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads the journal
+ * The log is read in a single pass from the start log block onwards, only the
+ * descriptor, commit and revoke blocks are read, the data blocks are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_read_file_io_handle(
+     libfsext_journal_t *journal,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *extents_array,
+     uint32_t block_size,
+     libcerror_error_t **error )
+{
+	libfsext_journal_block_entry_t *block_entry = NULL;
+	uint8_t *data                               = NULL;
+	static char *function                       = "libfsext_journal_read_file_io_handle";
+	ssize_t read_count                          = 0;
+	off64_t block_offset                        = 0;
+	uint64_t physical_block_number              = 0;
+	uint32_t block_type                         = 0;
+	uint32_t log_block_number                   = 0;
+	uint32_t number_of_log_blocks               = 0;
+	uint32_t sequence_number                    = 0;
+	uint32_t transaction_sequence_number        = 0;
+	int block_entry_index                       = 0;
+	int number_of_block_entries                 = 0;
+	int result                                  = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size < 1024 )
+	 || ( block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * block_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The journal superblock is stored in the first log block
+	 */
+	log_block_number = 0;
+
+	do
+	{
+		result = libfsext_journal_get_physical_block_number(
+		          extents_array,
+		          (uint64_t) log_block_number,
+		          &physical_block_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical block number of log block: %" PRIu32 ".",
+			 function,
+			 log_block_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( log_block_number == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing journal superblock.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		block_offset = (off64_t) ( physical_block_number * block_size );
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              data,
+		              (size_t) block_size,
+		              block_offset,
+		              error );
+
+		if( read_count != (ssize_t) block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read log block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 log_block_number,
+			 block_offset,
+			 block_offset );
+
+			goto on_error;
+		}
+		if( log_block_number == 0 )
+		{
+			if( libfsext_journal_read_superblock_data(
+			     journal,
+			     data,
+			     (size_t) block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read journal superblock.",
+				 function );
+
+				goto on_error;
+			}
+			if( journal->block_size != block_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported journal block size: %" PRIu32 " that differs from file system block size.",
+				 function,
+				 journal->block_size );
+
+				goto on_error;
+			}
+			/* A start log block number of 0 indicates the journal is clean
+			 */
+			if( journal->start_log_block_number == 0 )
+			{
+				break;
+			}
+			log_block_number = journal->start_log_block_number;
+			sequence_number  = journal->first_sequence_number;
+
+			continue;
+		}
+		if( memory_compare(
+		     ( (fsext_journal_block_header_t *) data )->signature,
+		     fsext_journal_signature,
+		     4 ) != 0 )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsext_journal_block_header_t *) data )->block_type,
+		 block_type );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsext_journal_block_header_t *) data )->sequence_number,
+		 transaction_sequence_number );
+
+		/* The end of the log is reached at the first block of a transaction that was not expected
+		 */
+		if( transaction_sequence_number != sequence_number )
+		{
+			break;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: log block: %" PRIu32 " of type: %" PRIu32 " in transaction: %" PRIu32 "\n",
+			 function,
+			 log_block_number,
+			 block_type,
+			 transaction_sequence_number );
+		}
+#endif
+		if( block_type == LIBFSEXT_JOURNAL_BLOCK_TYPE_DESCRIPTOR )
+		{
+			if( libfsext_journal_read_descriptor_block_data(
+			     journal,
+			     data,
+			     (size_t) block_size,
+			     &log_block_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read descriptor block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( block_type == LIBFSEXT_JOURNAL_BLOCK_TYPE_COMMIT )
+		{
+			libfsext_journal_commit_transaction(
+			 journal );
+
+			sequence_number += 1;
+		}
+		else if( block_type == LIBFSEXT_JOURNAL_BLOCK_TYPE_REVOKE )
+		{
+			if( libfsext_journal_read_revoke_block_data(
+			     journal,
+			     data,
+			     (size_t) block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read revoke block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			break;
+		}
+		log_block_number = libfsext_journal_get_next_log_block_number(
+		                    journal,
+		                    log_block_number );
+
+		number_of_log_blocks++;
+	}
+	while( number_of_log_blocks < journal->number_of_blocks );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	if( libfsext_journal_resolve_block_entries(
+	     journal,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to resolve block entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* Map the log block numbers of the block entries onto file system block numbers
+	 */
+	journal->number_of_current_block_entries = 0;
+
+	for( block_entry_index = 0;
+	     block_entry_index < journal->number_of_block_entries;
+	     block_entry_index++ )
+	{
+		block_entry = &( journal->block_entries[ block_entry_index ] );
+
+		result = libfsext_journal_get_physical_block_number(
+		          extents_array,
+		          block_entry->journal_block_number,
+		          &physical_block_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical block number of log block: %" PRIu64 ".",
+			 function,
+			 block_entry->journal_block_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		block_entry->journal_block_number = physical_block_number;
+
+		if( block_entry->is_current != 0 )
+		{
+			journal->number_of_current_block_entries += 1;
+		}
+		if( number_of_block_entries != block_entry_index )
+		{
+			journal->block_entries[ number_of_block_entries ] = *block_entry;
+		}
+		number_of_block_entries++;
+	}
+	journal->number_of_block_entries           = number_of_block_entries;
+	journal->number_of_committed_block_entries = number_of_block_entries;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of committed transactions\t: %" PRIu32 "\n",
+		 function,
+		 journal->number_of_transactions );
+
+		libcnotify_printf(
+		 "%s: number of journal blocks\t\t: %d\n",
+		 function,
+		 journal->number_of_current_block_entries );
+
+		libcnotify_printf(
+		 "%s: number of journal block copies\t: %d\n",
+		 function,
+		 journal->number_of_block_entries );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	journal->number_of_block_entries           = 0;
+	journal->number_of_committed_block_entries = 0;
+	journal->number_of_current_block_entries   = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the block entries of a specific (file system) block number
+ * The block entries are stored consecutively in the order they were committed
+ * Returns 1 if successful, 0 if no such block entries or -1 on error
+ */
+int libfsext_journal_get_block_entries_by_block_number(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     int *first_block_entry_index,
+     int *number_of_block_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_journal_get_block_entries_by_block_number";
+	int entry_index       = 0;
+	int lower_index       = 0;
+	int upper_index       = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_block_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first block entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_block_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of block entries.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the first block entry with a block number that is equal or greater
+	 */
+	upper_index = journal->number_of_block_entries;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( journal->block_entries[ entry_index ].block_number < block_number )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	entry_index = lower_index;
+
+	while( ( entry_index < journal->number_of_block_entries )
+	    && ( journal->block_entries[ entry_index ].block_number == block_number ) )
+	{
+		entry_index++;
+	}
+	if( entry_index == lower_index )
+	{
+		return( 0 );
+	}
+	*first_block_entry_index = lower_index;
+	*number_of_block_entries = entry_index - lower_index;
+
+	return( 1 );
+}
+
+/* Retrieves the block entry with the most recent committed copy of a specific (file system) block number
+ * Returns 1 if successful, 0 if no such block entry or -1 on error
+ */
+int libfsext_journal_get_block_entry_by_block_number(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     libfsext_journal_block_entry_t **block_entry,
+     libcerror_error_t **error )
+{
+	libfsext_journal_block_entry_t *safe_block_entry = NULL;
+	static char *function                            = "libfsext_journal_get_block_entry_by_block_number";
+	int first_block_entry_index                      = 0;
+	int number_of_block_entries                      = 0;
+	int result                                       = 0;
+
+	if( block_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsext_journal_get_block_entries_by_block_number(
+	          journal,
+	          block_number,
+	          &first_block_entry_index,
+	          &number_of_block_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block entries: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* Only the last block entry of a block number can be the most recent copy
+	 */
+	safe_block_entry = &( journal->block_entries[ first_block_entry_index + number_of_block_entries - 1 ] );
+
+	if( safe_block_entry->is_current == 0 )
+	{
+		return( 0 );
+	}
+	*block_entry = safe_block_entry;
+
+	return( 1 );
+}
+
+/* Overlays the journal copies of the blocks in a buffer read from the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_journal_overlay_buffer(
+     libfsext_journal_t *journal,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfsext_journal_block_entry_t *block_entry = NULL;
+	static char *function                       = "libfsext_journal_overlay_buffer";
+	size_t buffer_offset                        = 0;
+	size_t read_size                            = 0;
+	ssize_t read_count                          = 0;
+	off64_t journal_offset                      = 0;
+	uint64_t block_number                       = 0;
+	uint32_t block_offset                       = 0;
+	int result                                  = 0;
+
+	if( journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( journal->number_of_current_block_entries == 0 )
+	 || ( journal->block_size == 0 ) )
+	{
+		return( 1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		block_number = (uint64_t) ( file_offset + buffer_offset ) / journal->block_size;
+		block_offset = (uint32_t) ( (uint64_t) ( file_offset + buffer_offset ) % journal->block_size );
+		read_size    = journal->block_size - block_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		result = libfsext_journal_get_block_entry_by_block_number(
+		          journal,
+		          block_number,
+		          &block_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block entry: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			journal_offset = (off64_t) ( block_entry->journal_block_number * journal->block_size ) + block_offset;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              journal_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read journal copy of block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_number,
+				 journal_offset,
+				 journal_offset );
+
+				return( -1 );
+			}
+			/* The journal signature at the start of an escaped block was replaced by zero bytes
+			 */
+			if( ( block_entry->is_escaped != 0 )
+			 && ( block_offset < 4 ) )
+			{
+				while( ( block_offset < 4 )
+				    && ( read_size > 0 ) )
+				{
+					buffer[ buffer_offset ] = fsext_journal_signature[ block_offset ];
+
+					block_offset++;
+					buffer_offset++;
+					read_size--;
+				}
+			}
+		}
+		buffer_offset += read_size;
+	}
+	return( 1 );
+}
+
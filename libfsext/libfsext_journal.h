@@ -0,0 +1,248 @@
+/*
+ * Journal (jbd2) functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSEXT_JOURNAL_H )
+#define _LIBFSEXT_JOURNAL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t fsext_journal_signature[ 4 ];
+
+typedef struct libfsext_journal_block_entry libfsext_journal_block_entry_t;
+
+struct libfsext_journal_block_entry
+{
+	/* The (file system) block number
+	 */
+	uint64_t block_number;
+
+	/* The journal block number
+	 * Contains the log block number while the journal is read
+	 * and the (file system) block number of the copy afterwards
+	 */
+	uint64_t journal_block_number;
+
+	/* The index of the transaction in the log
+	 */
+	uint32_t transaction_index;
+
+	/* The index of the entry in the log
+	 */
+	uint32_t entry_index;
+
+	/* Value to indicate the signature in the copy was escaped
+	 */
+	uint8_t is_escaped;
+
+	/* Value to indicate the copy is the most recent committed copy of the block
+	 */
+	uint8_t is_current;
+};
+
+typedef struct libfsext_journal_revoke_entry libfsext_journal_revoke_entry_t;
+
+struct libfsext_journal_revoke_entry
+{
+	/* The (file system) block number
+	 */
+	uint64_t block_number;
+
+	/* The index of the transaction in the log
+	 */
+	uint32_t transaction_index;
+};
+
+typedef struct libfsext_journal libfsext_journal_t;
+
+struct libfsext_journal
+{
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The number of blocks
+	 */
+	uint32_t number_of_blocks;
+
+	/* The first log block number
+	 */
+	uint32_t first_log_block_number;
+
+	/* The first transaction sequence number
+	 */
+	uint32_t first_sequence_number;
+
+	/* The start log block number
+	 */
+	uint32_t start_log_block_number;
+
+	/* The incompatible features flags
+	 */
+	uint32_t incompatible_features_flags;
+
+	/* The block tag size
+	 */
+	size_t block_tag_size;
+
+	/* The number of committed transactions
+	 */
+	uint32_t number_of_transactions;
+
+	/* The block entries
+	 */
+	libfsext_journal_block_entry_t *block_entries;
+
+	/* The number of block entries
+	 */
+	int number_of_block_entries;
+
+	/* The number of block entries of committed transactions
+	 */
+	int number_of_committed_block_entries;
+
+	/* The number of allocated block entries
+	 */
+	int number_of_allocated_block_entries;
+
+	/* The number of block entries that contain the most recent committed copy of a block
+	 */
+	int number_of_current_block_entries;
+
+	/* The revoke entries
+	 */
+	libfsext_journal_revoke_entry_t *revoke_entries;
+
+	/* The number of revoke entries
+	 */
+	int number_of_revoke_entries;
+
+	/* The number of revoke entries of committed transactions
+	 */
+	int number_of_committed_revoke_entries;
+
+	/* The number of allocated revoke entries
+	 */
+	int number_of_allocated_revoke_entries;
+};
+
+int libfsext_journal_initialize(
+     libfsext_journal_t **journal,
+     libcerror_error_t **error );
+
+int libfsext_journal_free(
+     libfsext_journal_t **journal,
+     libcerror_error_t **error );
+
+int libfsext_journal_read_superblock_data(
+     libfsext_journal_t *journal,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsext_journal_append_block_entry(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     uint32_t log_block_number,
+     uint8_t is_escaped,
+     libcerror_error_t **error );
+
+int libfsext_journal_append_revoke_entry(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+int libfsext_journal_read_descriptor_block_data(
+     libfsext_journal_t *journal,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *log_block_number,
+     libcerror_error_t **error );
+
+int libfsext_journal_read_revoke_block_data(
+     libfsext_journal_t *journal,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+void libfsext_journal_commit_transaction(
+      libfsext_journal_t *journal );
+
+int libfsext_journal_compare_block_entries(
+     const void *first_block_entry,
+     const void *second_block_entry );
+
+int libfsext_journal_compare_revoke_entries(
+     const void *first_revoke_entry,
+     const void *second_revoke_entry );
+
+int libfsext_journal_resolve_block_entries(
+     libfsext_journal_t *journal,
+     libcerror_error_t **error );
+
+int libfsext_journal_get_physical_block_number(
+     libcdata_array_t *extents_array,
+     uint64_t logical_block_number,
+     uint64_t *physical_block_number,
+     libcerror_error_t **error );
+
+int libfsext_journal_read_file_io_handle(
+     libfsext_journal_t *journal,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *extents_array,
+     uint32_t block_size,
+     libcerror_error_t **error );
+
+int libfsext_journal_get_block_entries_by_block_number(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     int *first_block_entry_index,
+     int *number_of_block_entries,
+     libcerror_error_t **error );
+
+int libfsext_journal_get_block_entry_by_block_number(
+     libfsext_journal_t *journal,
+     uint64_t block_number,
+     libfsext_journal_block_entry_t **block_entry,
+     libcerror_error_t **error );
+
+int libfsext_journal_overlay_buffer(
+     libfsext_journal_t *journal,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSEXT_JOURNAL_H ) */
+
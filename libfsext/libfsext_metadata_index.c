@@ -0,0 +1,1502 @@
+/*
+ * Metadata index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsext_checksum.h"
+#include "libfsext_definitions.h"
+#include "libfsext_directory_entry.h"
+#include "libfsext_group_descriptor.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_libcnotify.h"
+#include "libfsext_metadata_index.h"
+#include "libfsext_superblock.h"
+
+#include "fsext_metadata_index.h"
+
+const char *fsext_metadata_index_signature = "fsextidx";
+
+/* Creates a metadata index
+ * Make sure the value metadata_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_initialize(
+     libfsext_metadata_index_t **metadata_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_metadata_index_initialize";
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_index = memory_allocate_structure(
+	                   libfsext_metadata_index_t );
+
+	if( *metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_index,
+	     0,
+	     sizeof( libfsext_metadata_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *metadata_index != NULL )
+	{
+		memory_free(
+		 *metadata_index );
+
+		*metadata_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_free(
+     libfsext_metadata_index_t **metadata_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_metadata_index_free";
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_index != NULL )
+	{
+		if( ( *metadata_index )->data != NULL )
+		{
+			memory_free(
+			 ( *metadata_index )->data );
+		}
+		memory_free(
+		 *metadata_index );
+
+		*metadata_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if a section of the metadata index data is within bounds
+ * Returns 1 if within bounds or 0 if not
+ */
+int libfsext_metadata_index_section_is_within_bounds(
+     size_t data_size,
+     uint64_t section_offset,
+     uint64_t number_of_records,
+     size_t record_size )
+{
+	if( ( section_offset < sizeof( fsext_metadata_index_file_header_t ) )
+	 || ( section_offset > (uint64_t) data_size )
+	 || ( ( section_offset % 8 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( number_of_records > ( ( (uint64_t) data_size - section_offset ) / record_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the metadata index file header from the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_read_file_header(
+     libfsext_metadata_index_t *metadata_index,
+     libcerror_error_t **error )
+{
+	fsext_metadata_index_file_header_t *file_header = NULL;
+	static char *function                           = "libfsext_metadata_index_read_file_header";
+	uint64_t file_size                              = 0;
+	uint64_t group_descriptors_offset               = 0;
+	uint64_t names_offset                           = 0;
+	uint64_t names_size                             = 0;
+	uint64_t stat_records_offset                    = 0;
+	uint64_t tree_entries_offset                    = 0;
+	uint32_t calculated_checksum                    = 0;
+	uint32_t format_version                         = 0;
+	uint32_t header_size                            = 0;
+	uint32_t stored_checksum                        = 0;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metadata index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index->data_size < sizeof( fsext_metadata_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata index - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (fsext_metadata_index_file_header_t *) metadata_index->data;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file header data:\n",
+		 function );
+		libcnotify_print_data(
+		 metadata_index->data,
+		 sizeof( fsext_metadata_index_file_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     file_header->signature,
+	     fsext_metadata_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->checksum,
+	 stored_checksum );
+
+	if( format_version != LIBFSEXT_METADATA_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( header_size != (uint32_t) sizeof( fsext_metadata_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported header size: %" PRIu32 ".",
+		 function,
+		 header_size );
+
+		return( -1 );
+	}
+	if( file_size != (uint64_t) metadata_index->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch between file size: %" PRIu64 " and data size: %" PRIzd ".",
+		 function,
+		 file_size,
+		 metadata_index->data_size );
+
+		return( -1 );
+	}
+	if( libfsext_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     metadata_index->data,
+	     sizeof( fsext_metadata_index_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     &( metadata_index->data[ sizeof( fsext_metadata_index_file_header_t ) ] ),
+	     metadata_index->data_size - sizeof( fsext_metadata_index_file_header_t ),
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     metadata_index->file_system_identifier,
+	     file_header->file_system_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file system identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->last_written_time,
+	 metadata_index->last_written_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_inodes,
+	 metadata_index->number_of_inodes );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_block_groups,
+	 metadata_index->number_of_block_groups );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->block_size,
+	 metadata_index->block_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->group_descriptors_offset,
+	 group_descriptors_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_group_descriptors,
+	 metadata_index->number_of_group_descriptors );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_tree_entries,
+	 metadata_index->number_of_tree_entries );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->tree_entries_offset,
+	 tree_entries_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->names_offset,
+	 names_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->names_size,
+	 names_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->stat_records_offset,
+	 stat_records_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_stat_records,
+	 metadata_index->number_of_stat_records );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: last written time\t\t: %" PRIu32 "\n",
+		 function,
+		 metadata_index->last_written_time );
+
+		libcnotify_printf(
+		 "%s: number of group descriptors\t: %" PRIu32 "\n",
+		 function,
+		 metadata_index->number_of_group_descriptors );
+
+		libcnotify_printf(
+		 "%s: number of tree entries\t\t: %" PRIu32 "\n",
+		 function,
+		 metadata_index->number_of_tree_entries );
+
+		libcnotify_printf(
+		 "%s: names size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 names_size );
+
+		libcnotify_printf(
+		 "%s: number of stat records\t\t: %" PRIu32 "\n",
+		 function,
+		 metadata_index->number_of_stat_records );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfsext_metadata_index_section_is_within_bounds(
+	     metadata_index->data_size,
+	     group_descriptors_offset,
+	     (uint64_t) metadata_index->number_of_group_descriptors,
+	     sizeof( fsext_metadata_index_group_descriptor_t ) ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid group descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_metadata_index_section_is_within_bounds(
+	     metadata_index->data_size,
+	     tree_entries_offset,
+	     (uint64_t) metadata_index->number_of_tree_entries,
+	     sizeof( fsext_metadata_index_tree_entry_t ) ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tree entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_metadata_index_section_is_within_bounds(
+	     metadata_index->data_size,
+	     stat_records_offset,
+	     (uint64_t) metadata_index->number_of_stat_records,
+	     sizeof( fsext_metadata_index_stat_record_t ) ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stat records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_metadata_index_section_is_within_bounds(
+	     metadata_index->data_size,
+	     names_offset,
+	     names_size,
+	     1 ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid names value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	metadata_index->group_descriptors_offset = (size_t) group_descriptors_offset;
+	metadata_index->tree_entries_offset      = (size_t) tree_entries_offset;
+	metadata_index->names_offset             = (size_t) names_offset;
+	metadata_index->names_size               = (size_t) names_size;
+	metadata_index->stat_records_offset      = (size_t) stat_records_offset;
+
+	return( 1 );
+}
+
+/* Reads the metadata index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_read_data(
+     libfsext_metadata_index_t *metadata_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_metadata_index_read_data";
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsext_metadata_index_file_header_t ) )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	metadata_index->data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * data_size );
+
+	if( metadata_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	metadata_index->data_size = data_size;
+
+	if( memory_copy(
+	     metadata_index->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_metadata_index_read_file_header(
+	     metadata_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( metadata_index->data != NULL )
+	{
+		memory_free(
+		 metadata_index->data );
+
+		metadata_index->data = NULL;
+	}
+	metadata_index->data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the metadata index
+ * The entire file is read with a single read into one buffer that is used as-is for lookups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_read_file_io_handle(
+     libfsext_metadata_index_t *metadata_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_metadata_index_read_file_io_handle";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_size < (size64_t) sizeof( fsext_metadata_index_file_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	metadata_index->data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * (size_t) file_size );
+
+	if( metadata_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	metadata_index->data_size = (size_t) file_size;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              metadata_index->data,
+	              metadata_index->data_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) metadata_index->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_metadata_index_read_file_header(
+	     metadata_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( metadata_index->data != NULL )
+	{
+		memory_free(
+		 metadata_index->data );
+
+		metadata_index->data = NULL;
+	}
+	metadata_index->data_size = 0;
+
+	return( -1 );
+}
+
+/* Determines if the metadata index was created for the volume of the superblock
+ * The index is considered stale when the file system identifier, last written time
+ * or the layout of the volume differs
+ * Returns 1 if the metadata index matches, 0 if not or -1 on error
+ */
+int libfsext_metadata_index_matches_superblock(
+     libfsext_metadata_index_t *metadata_index,
+     libfsext_superblock_t *superblock,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_metadata_index_matches_superblock";
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     metadata_index->file_system_identifier,
+	     superblock->file_system_identifier,
+	     16 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( metadata_index->last_written_time != superblock->last_written_time )
+	 || ( metadata_index->number_of_inodes != superblock->number_of_inodes )
+	 || ( metadata_index->number_of_block_groups != superblock->number_of_block_groups )
+	 || ( metadata_index->block_size != superblock->block_size ) )
+	{
+		return( 0 );
+	}
+	if( metadata_index->number_of_group_descriptors < superblock->number_of_block_groups )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the group descriptors
+ * The group descriptors are appended to the array
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_get_group_descriptors(
+     libfsext_metadata_index_t *metadata_index,
+     libcdata_array_t *group_descriptors_array,
+     libcerror_error_t **error )
+{
+	fsext_metadata_index_group_descriptor_t *group_descriptor_data = NULL;
+	libfsext_group_descriptor_t *group_descriptor                  = NULL;
+	static char *function                                          = "libfsext_metadata_index_get_group_descriptors";
+	uint32_t group_descriptor_index                                = 0;
+	int entry_index                                                = 0;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metadata index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	group_descriptor_data = (fsext_metadata_index_group_descriptor_t *) &( metadata_index->data[ metadata_index->group_descriptors_offset ] );
+
+	for( group_descriptor_index = 0;
+	     group_descriptor_index < metadata_index->number_of_group_descriptors;
+	     group_descriptor_index++ )
+	{
+		if( libfsext_group_descriptor_initialize(
+		     &group_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create group descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 group_descriptor_data->group_number,
+		 group_descriptor->group_number );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 group_descriptor_data->block_group_flags,
+		 group_descriptor->block_group_flags );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 group_descriptor_data->block_bitmap_block_number,
+		 group_descriptor->block_bitmap_block_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 group_descriptor_data->inode_bitmap_block_number,
+		 group_descriptor->inode_bitmap_block_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 group_descriptor_data->inode_table_block_number,
+		 group_descriptor->inode_table_block_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 group_descriptor_data->exclude_bitmap_block_number,
+		 group_descriptor->exclude_bitmap_block_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 group_descriptor_data->number_of_unallocated_blocks,
+		 group_descriptor->number_of_unallocated_blocks );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 group_descriptor_data->number_of_unallocated_inodes,
+		 group_descriptor->number_of_unallocated_inodes );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 group_descriptor_data->number_of_directories,
+		 group_descriptor->number_of_directories );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 group_descriptor_data->number_of_unused_inodes,
+		 group_descriptor->number_of_unused_inodes );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 group_descriptor_data->block_bitmap_checksum,
+		 group_descriptor->block_bitmap_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 group_descriptor_data->inode_bitmap_checksum,
+		 group_descriptor->inode_bitmap_checksum );
+
+		if( group_descriptor->group_number != group_descriptor_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid group descriptor: %" PRIu32 " - group number value out of bounds.",
+			 function,
+			 group_descriptor_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     group_descriptors_array,
+		     &entry_index,
+		     (intptr_t *) group_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append group descriptor: %" PRIu32 " to array.",
+			 function,
+			 group_descriptor_index );
+
+			goto on_error;
+		}
+		group_descriptor = NULL;
+
+		group_descriptor_data++;
+	}
+	return( 1 );
+
+on_error:
+	if( group_descriptor != NULL )
+	{
+		libfsext_group_descriptor_free(
+		 &group_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the tree entry of a specific name in a specific parent directory
+ * The tree entries are sorted by parent inode number and name, which allows for a binary search
+ * Returns 1 if successful, 0 if no such tree entry or -1 on error
+ */
+int libfsext_metadata_index_get_tree_entry_by_utf8_name(
+     libfsext_metadata_index_t *metadata_index,
+     uint32_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint8_t **tree_entry_data,
+     libcerror_error_t **error )
+{
+	fsext_metadata_index_tree_entry_t *tree_entry = NULL;
+	static char *function                         = "libfsext_metadata_index_get_tree_entry_by_utf8_name";
+	size_t compare_size                           = 0;
+	uint32_t entry_parent_inode_number            = 0;
+	uint32_t lower_index                          = 0;
+	uint32_t middle_index                         = 0;
+	uint32_t name_offset                          = 0;
+	uint32_t upper_index                          = 0;
+	int compare_result                            = 0;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metadata index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree_entry_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree entry data.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = metadata_index->number_of_tree_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		tree_entry = (fsext_metadata_index_tree_entry_t *) &( metadata_index->data[ metadata_index->tree_entries_offset + ( (size_t) middle_index * sizeof( fsext_metadata_index_tree_entry_t ) ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 tree_entry->parent_inode_number,
+		 entry_parent_inode_number );
+
+		if( entry_parent_inode_number < parent_inode_number )
+		{
+			compare_result = -1;
+		}
+		else if( entry_parent_inode_number > parent_inode_number )
+		{
+			compare_result = 1;
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 tree_entry->name_offset,
+			 name_offset );
+
+			if( ( (size_t) name_offset > metadata_index->names_size )
+			 || ( (size_t) tree_entry->name_size > ( metadata_index->names_size - name_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tree entry: %" PRIu32 " - name value out of bounds.",
+				 function,
+				 middle_index );
+
+				return( -1 );
+			}
+			compare_size = (size_t) tree_entry->name_size;
+
+			if( compare_size > utf8_string_length )
+			{
+				compare_size = utf8_string_length;
+			}
+			compare_result = memory_compare(
+			                  &( metadata_index->data[ metadata_index->names_offset + name_offset ] ),
+			                  utf8_string,
+			                  compare_size );
+
+			if( compare_result == 0 )
+			{
+				if( (size_t) tree_entry->name_size < utf8_string_length )
+				{
+					compare_result = -1;
+				}
+				else if( (size_t) tree_entry->name_size > utf8_string_length )
+				{
+					compare_result = 1;
+				}
+			}
+		}
+		if( compare_result == 0 )
+		{
+			*tree_entry_data = (const uint8_t *) tree_entry;
+
+			return( 1 );
+		}
+		else if( compare_result < 0 )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the directory entry for an UTF-8 encoded path
+ * The directory entry is not set for the root directory
+ * Returns 1 if successful, 0 if no such directory entry or -1 on error
+ */
+int libfsext_metadata_index_get_directory_entry_by_utf8_path(
+     libfsext_metadata_index_t *metadata_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *inode_number,
+     libfsext_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	fsext_metadata_index_tree_entry_t *tree_entry = NULL;
+	const uint8_t *tree_entry_data                = NULL;
+	const uint8_t *utf8_string_segment            = NULL;
+	static char *function                         = "libfsext_metadata_index_get_directory_entry_by_utf8_path";
+	size_t utf8_string_index                      = 0;
+	size_t utf8_string_segment_length             = 0;
+	uint32_t name_offset                          = 0;
+	uint32_t safe_inode_number                    = 0;
+	int result                                    = 1;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSEXT_SEPARATOR )
+		{
+			utf8_string_index++;
+		}
+	}
+	safe_inode_number = LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY;
+
+	if( utf8_string_length > 1 )
+	{
+		while( utf8_string_index < utf8_string_length )
+		{
+			utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
+			utf8_string_segment_length = 0;
+
+			while( utf8_string_index < utf8_string_length )
+			{
+				if( ( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSEXT_SEPARATOR )
+				 || ( utf8_string[ utf8_string_index ] == 0 ) )
+				{
+					utf8_string_index++;
+
+					break;
+				}
+				utf8_string_index++;
+
+				utf8_string_segment_length++;
+			}
+			if( utf8_string_segment_length == 0 )
+			{
+				result = 0;
+			}
+			else
+			{
+				result = libfsext_metadata_index_get_tree_entry_by_utf8_name(
+				          metadata_index,
+				          safe_inode_number,
+				          utf8_string_segment,
+				          utf8_string_segment_length,
+				          &tree_entry_data,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve tree entry by UTF-8 name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+			tree_entry = (fsext_metadata_index_tree_entry_t *) tree_entry_data;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 tree_entry->inode_number,
+			 safe_inode_number );
+		}
+	}
+	if( tree_entry != NULL )
+	{
+		if( libfsext_directory_entry_initialize(
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 tree_entry->name_offset,
+		 name_offset );
+
+		( *directory_entry )->name = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * ( tree_entry->name_size + 1 ) );
+
+		if( ( *directory_entry )->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *directory_entry )->name,
+		     &( metadata_index->data[ metadata_index->names_offset + name_offset ] ),
+		     tree_entry->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		( ( *directory_entry )->name )[ tree_entry->name_size ] = 0;
+
+		( *directory_entry )->name_size    = tree_entry->name_size + 1;
+		( *directory_entry )->inode_number = safe_inode_number;
+		( *directory_entry )->file_type    = tree_entry->file_type;
+	}
+	*inode_number = safe_inode_number;
+
+	return( 1 );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfsext_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the stat values of a specific inode
+ * The stat records are sorted by inode number, which allows for a binary search
+ * Returns 1 if successful, 0 if no such inode or -1 on error
+ */
+int libfsext_metadata_index_get_stat_by_inode_number(
+     libfsext_metadata_index_t *metadata_index,
+     uint32_t inode_number,
+     uint16_t *file_mode,
+     uint16_t *number_of_links,
+     uint32_t *owner_identifier,
+     uint32_t *group_identifier,
+     uint64_t *data_size,
+     int64_t *access_time,
+     int64_t *modification_time,
+     int64_t *inode_change_time,
+     int64_t *creation_time,
+     libcerror_error_t **error )
+{
+	fsext_metadata_index_stat_record_t *stat_record = NULL;
+	static char *function                           = "libfsext_metadata_index_get_stat_by_inode_number";
+	uint64_t value_64bit                            = 0;
+	uint32_t flags                                  = 0;
+	uint32_t lower_index                            = 0;
+	uint32_t middle_index                           = 0;
+	uint32_t record_inode_number                    = 0;
+	uint32_t upper_index                            = 0;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid metadata index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_mode == NULL )
+	 || ( number_of_links == NULL )
+	 || ( owner_identifier == NULL )
+	 || ( group_identifier == NULL )
+	 || ( data_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_time == NULL )
+	 || ( modification_time == NULL )
+	 || ( inode_change_time == NULL )
+	 || ( creation_time == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time value.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = metadata_index->number_of_stat_records;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		stat_record = (fsext_metadata_index_stat_record_t *) &( metadata_index->data[ metadata_index->stat_records_offset + ( (size_t) middle_index * sizeof( fsext_metadata_index_stat_record_t ) ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 stat_record->inode_number,
+		 record_inode_number );
+
+		if( record_inode_number == inode_number )
+		{
+			break;
+		}
+		else if( record_inode_number < inode_number )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( lower_index >= upper_index )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 stat_record->file_mode,
+	 *file_mode );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 stat_record->number_of_links,
+	 *number_of_links );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 stat_record->owner_identifier,
+	 *owner_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 stat_record->group_identifier,
+	 *group_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 stat_record->data_size,
+	 *data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 stat_record->access_time,
+	 value_64bit );
+
+	*access_time = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 stat_record->modification_time,
+	 value_64bit );
+
+	*modification_time = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 stat_record->inode_change_time,
+	 value_64bit );
+
+	*inode_change_time = (int64_t) value_64bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 stat_record->flags,
+	 flags );
+
+	if( ( flags & LIBFSEXT_METADATA_INDEX_STAT_FLAG_HAS_CREATION_TIME ) != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 stat_record->creation_time,
+		 value_64bit );
+
+		*creation_time = (int64_t) value_64bit;
+	}
+	else
+	{
+		*creation_time = 0;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,183 @@
+/*
+ * Metadata index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSEXT_METADATA_INDEX_H )
+#define _LIBFSEXT_METADATA_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsext_directory_entry.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_superblock.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBFSEXT_METADATA_INDEX_FORMAT_VERSION		1
+
+#define LIBFSEXT_METADATA_INDEX_STAT_FLAG_HAS_CREATION_TIME	0x00000001UL
+
+extern const char *fsext_metadata_index_signature;
+
+typedef struct libfsext_metadata_index libfsext_metadata_index_t;
+
+struct libfsext_metadata_index
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* File system identifier
+	 */
+	uint8_t file_system_identifier[ 16 ];
+
+	/* Last written time
+	 */
+	uint32_t last_written_time;
+
+	/* Number of inodes
+	 */
+	uint32_t number_of_inodes;
+
+	/* Number of block groups
+	 */
+	uint32_t number_of_block_groups;
+
+	/* Block size
+	 */
+	uint32_t block_size;
+
+	/* Group descriptors offset
+	 */
+	size_t group_descriptors_offset;
+
+	/* Number of group descriptors
+	 */
+	uint32_t number_of_group_descriptors;
+
+	/* Tree entries offset
+	 */
+	size_t tree_entries_offset;
+
+	/* Number of tree entries
+	 */
+	uint32_t number_of_tree_entries;
+
+	/* Names offset
+	 */
+	size_t names_offset;
+
+	/* Names size
+	 */
+	size_t names_size;
+
+	/* Stat records offset
+	 */
+	size_t stat_records_offset;
+
+	/* Number of stat records
+	 */
+	uint32_t number_of_stat_records;
+};
+
+int libfsext_metadata_index_initialize(
+     libfsext_metadata_index_t **metadata_index,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_free(
+     libfsext_metadata_index_t **metadata_index,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_section_is_within_bounds(
+     size_t data_size,
+     uint64_t section_offset,
+     uint64_t number_of_records,
+     size_t record_size );
+
+int libfsext_metadata_index_read_file_header(
+     libfsext_metadata_index_t *metadata_index,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_read_data(
+     libfsext_metadata_index_t *metadata_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_read_file_io_handle(
+     libfsext_metadata_index_t *metadata_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_matches_superblock(
+     libfsext_metadata_index_t *metadata_index,
+     libfsext_superblock_t *superblock,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_get_group_descriptors(
+     libfsext_metadata_index_t *metadata_index,
+     libcdata_array_t *group_descriptors_array,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_get_tree_entry_by_utf8_name(
+     libfsext_metadata_index_t *metadata_index,
+     uint32_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint8_t **tree_entry_data,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_get_directory_entry_by_utf8_path(
+     libfsext_metadata_index_t *metadata_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *inode_number,
+     libfsext_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_get_stat_by_inode_number(
+     libfsext_metadata_index_t *metadata_index,
+     uint32_t inode_number,
+     uint16_t *file_mode,
+     uint16_t *number_of_links,
+     uint32_t *owner_identifier,
+     uint32_t *group_identifier,
+     uint64_t *data_size,
+     int64_t *access_time,
+     int64_t *modification_time,
+     int64_t *inode_change_time,
+     int64_t *creation_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSEXT_METADATA_INDEX_H ) */
+
@@ -0,0 +1,1161 @@
+/*
+ * Metadata index writer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsext_checksum.h"
+#include "libfsext_directory_entry.h"
+#include "libfsext_group_descriptor.h"
+#include "libfsext_inode.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_metadata_index.h"
+#include "libfsext_metadata_index_writer.h"
+#include "libfsext_superblock.h"
+
+#include "fsext_metadata_index.h"
+
+#define LIBFSEXT_METADATA_INDEX_WRITER_INITIAL_NUMBER_OF_ENTRIES	1024
+
+/* Creates a metadata index writer
+ * Make sure the value metadata_index_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_writer_initialize(
+     libfsext_metadata_index_writer_t **metadata_index_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_metadata_index_writer_initialize";
+
+	if( metadata_index_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_index_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata index writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_index_writer = memory_allocate_structure(
+	                          libfsext_metadata_index_writer_t );
+
+	if( *metadata_index_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata index writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_index_writer,
+	     0,
+	     sizeof( libfsext_metadata_index_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata index writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *metadata_index_writer != NULL )
+	{
+		memory_free(
+		 *metadata_index_writer );
+
+		*metadata_index_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata index writer
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_writer_free(
+     libfsext_metadata_index_writer_t **metadata_index_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_metadata_index_writer_free";
+
+	if( metadata_index_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_index_writer != NULL )
+	{
+		if( ( *metadata_index_writer )->stat_records_data != NULL )
+		{
+			memory_free(
+			 ( *metadata_index_writer )->stat_records_data );
+		}
+		if( ( *metadata_index_writer )->names != NULL )
+		{
+			memory_free(
+			 ( *metadata_index_writer )->names );
+		}
+		if( ( *metadata_index_writer )->tree_entries != NULL )
+		{
+			memory_free(
+			 ( *metadata_index_writer )->tree_entries );
+		}
+		memory_free(
+		 *metadata_index_writer );
+
+		*metadata_index_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a tree entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_writer_append_tree_entry(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     uint32_t parent_inode_number,
+     libfsext_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	libfsext_metadata_index_writer_tree_entry_t *tree_entry = NULL;
+	void *reallocation                                      = NULL;
+	static char *function                                   = "libfsext_metadata_index_writer_append_tree_entry";
+	size_t allocated_names_size                             = 0;
+	size_t name_size                                        = 0;
+	uint32_t number_of_allocated_tree_entries               = 0;
+
+	if( metadata_index_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_entry->name == NULL )
+	 || ( directory_entry->name_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory entry - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	/* The directory entry name size includes the end-of-string character
+	 */
+	name_size = (size_t) directory_entry->name_size - 1;
+
+	if( metadata_index_writer->number_of_tree_entries == UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata index writer - number of tree entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index_writer->names_size > ( (size_t) UINT32_MAX - name_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata index writer - names size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index_writer->number_of_tree_entries >= metadata_index_writer->number_of_allocated_tree_entries )
+	{
+		if( metadata_index_writer->number_of_allocated_tree_entries == 0 )
+		{
+			number_of_allocated_tree_entries = LIBFSEXT_METADATA_INDEX_WRITER_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else if( metadata_index_writer->number_of_allocated_tree_entries > ( UINT32_MAX / 2 ) )
+		{
+			number_of_allocated_tree_entries = UINT32_MAX;
+		}
+		else
+		{
+			number_of_allocated_tree_entries = metadata_index_writer->number_of_allocated_tree_entries * 2;
+		}
+		if( (size_t) number_of_allocated_tree_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsext_metadata_index_writer_tree_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated tree entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                metadata_index_writer->tree_entries,
+		                sizeof( libfsext_metadata_index_writer_tree_entry_t ) * number_of_allocated_tree_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tree entries.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_index_writer->tree_entries                     = (libfsext_metadata_index_writer_tree_entry_t *) reallocation;
+		metadata_index_writer->number_of_allocated_tree_entries = number_of_allocated_tree_entries;
+	}
+	if( ( metadata_index_writer->names_size + name_size ) > metadata_index_writer->allocated_names_size )
+	{
+		allocated_names_size = metadata_index_writer->allocated_names_size;
+
+		if( allocated_names_size == 0 )
+		{
+			allocated_names_size = 16 * LIBFSEXT_METADATA_INDEX_WRITER_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		while( ( metadata_index_writer->names_size + name_size ) > allocated_names_size )
+		{
+			allocated_names_size *= 2;
+		}
+		if( allocated_names_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid allocated names size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                metadata_index_writer->names,
+		                sizeof( uint8_t ) * allocated_names_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_index_writer->names                = (uint8_t *) reallocation;
+		metadata_index_writer->allocated_names_size = allocated_names_size;
+	}
+	if( memory_copy(
+	     &( metadata_index_writer->names[ metadata_index_writer->names_size ] ),
+	     directory_entry->name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	tree_entry = &( metadata_index_writer->tree_entries[ metadata_index_writer->number_of_tree_entries ] );
+
+	tree_entry->parent_inode_number = parent_inode_number;
+	tree_entry->inode_number        = directory_entry->inode_number;
+	tree_entry->name_offset         = (uint32_t) metadata_index_writer->names_size;
+	tree_entry->name_size           = (uint8_t) name_size;
+	tree_entry->file_type           = directory_entry->file_type;
+	tree_entry->name                = NULL;
+
+	metadata_index_writer->names_size             += name_size;
+	metadata_index_writer->number_of_tree_entries += 1;
+
+	return( 1 );
+}
+
+/* Appends a stat record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_writer_append_stat_record(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     uint32_t inode_number,
+     libfsext_inode_t *inode,
+     libcerror_error_t **error )
+{
+	fsext_metadata_index_stat_record_t *stat_record = NULL;
+	void *reallocation                              = NULL;
+	static char *function                           = "libfsext_metadata_index_writer_append_stat_record";
+	uint32_t flags                                  = 0;
+	uint32_t number_of_allocated_stat_records       = 0;
+
+	if( metadata_index_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index_writer->number_of_stat_records == UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata index writer - number of stat records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_index_writer->number_of_stat_records >= metadata_index_writer->number_of_allocated_stat_records )
+	{
+		if( metadata_index_writer->number_of_allocated_stat_records == 0 )
+		{
+			number_of_allocated_stat_records = LIBFSEXT_METADATA_INDEX_WRITER_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else if( metadata_index_writer->number_of_allocated_stat_records > ( UINT32_MAX / 2 ) )
+		{
+			number_of_allocated_stat_records = UINT32_MAX;
+		}
+		else
+		{
+			number_of_allocated_stat_records = metadata_index_writer->number_of_allocated_stat_records * 2;
+		}
+		if( (size_t) number_of_allocated_stat_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( fsext_metadata_index_stat_record_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated stat records value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                metadata_index_writer->stat_records_data,
+		                sizeof( fsext_metadata_index_stat_record_t ) * number_of_allocated_stat_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize stat records.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_index_writer->stat_records_data                = (uint8_t *) reallocation;
+		metadata_index_writer->number_of_allocated_stat_records = number_of_allocated_stat_records;
+	}
+	stat_record = &( ( (fsext_metadata_index_stat_record_t *) metadata_index_writer->stat_records_data )[ metadata_index_writer->number_of_stat_records ] );
+
+	if( memory_set(
+	     stat_record,
+	     0,
+	     sizeof( fsext_metadata_index_stat_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat record.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->has_creation_time != 0 )
+	{
+		flags |= LIBFSEXT_METADATA_INDEX_STAT_FLAG_HAS_CREATION_TIME;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 stat_record->inode_number,
+	 inode_number );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 stat_record->file_mode,
+	 inode->file_mode );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 stat_record->number_of_links,
+	 inode->number_of_links );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 stat_record->owner_identifier,
+	 inode->owner_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 stat_record->group_identifier,
+	 inode->group_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 stat_record->data_size,
+	 inode->data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 stat_record->access_time,
+	 (uint64_t) inode->access_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 stat_record->modification_time,
+	 (uint64_t) inode->modification_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 stat_record->inode_change_time,
+	 (uint64_t) inode->inode_change_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 stat_record->creation_time,
+	 (uint64_t) inode->creation_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 stat_record->flags,
+	 flags );
+
+	metadata_index_writer->number_of_stat_records += 1;
+
+	return( 1 );
+}
+
+/* Compares two tree entries by parent inode number and name
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsext_metadata_index_writer_compare_tree_entries(
+     const void *first_tree_entry,
+     const void *second_tree_entry )
+{
+	const libfsext_metadata_index_writer_tree_entry_t *first_entry  = (const libfsext_metadata_index_writer_tree_entry_t *) first_tree_entry;
+	const libfsext_metadata_index_writer_tree_entry_t *second_entry = (const libfsext_metadata_index_writer_tree_entry_t *) second_tree_entry;
+	size_t compare_size                                             = 0;
+	int compare_result                                              = 0;
+
+	if( first_entry->parent_inode_number < second_entry->parent_inode_number )
+	{
+		return( -1 );
+	}
+	else if( first_entry->parent_inode_number > second_entry->parent_inode_number )
+	{
+		return( 1 );
+	}
+	compare_size = (size_t) first_entry->name_size;
+
+	if( compare_size > (size_t) second_entry->name_size )
+	{
+		compare_size = (size_t) second_entry->name_size;
+	}
+	compare_result = memory_compare(
+	                  first_entry->name,
+	                  second_entry->name,
+	                  compare_size );
+
+	if( compare_result < 0 )
+	{
+		return( -1 );
+	}
+	else if( compare_result > 0 )
+	{
+		return( 1 );
+	}
+	if( first_entry->name_size < second_entry->name_size )
+	{
+		return( -1 );
+	}
+	else if( first_entry->name_size > second_entry->name_size )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two stat records by inode number
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsext_metadata_index_writer_compare_stat_records(
+     const void *first_stat_record,
+     const void *second_stat_record )
+{
+	uint32_t first_inode_number  = 0;
+	uint32_t second_inode_number = 0;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (const fsext_metadata_index_stat_record_t *) first_stat_record )->inode_number,
+	 first_inode_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (const fsext_metadata_index_stat_record_t *) second_stat_record )->inode_number,
+	 second_inode_number );
+
+	if( first_inode_number < second_inode_number )
+	{
+		return( -1 );
+	}
+	else if( first_inode_number > second_inode_number )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Writes the metadata index to a buffer
+ * The tree entries and stat records are sorted and stat records of inodes
+ * that are referenced by multiple directory entries are stored only once
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_writer_write_data(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     libfsext_superblock_t *superblock,
+     libcdata_array_t *group_descriptors_array,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	fsext_metadata_index_file_header_t *file_header                = NULL;
+	fsext_metadata_index_group_descriptor_t *group_descriptor_data = NULL;
+	fsext_metadata_index_stat_record_t *stat_records               = NULL;
+	fsext_metadata_index_tree_entry_t *tree_entry_data             = NULL;
+	libfsext_group_descriptor_t *group_descriptor                  = NULL;
+	libfsext_metadata_index_writer_tree_entry_t *tree_entry        = NULL;
+	uint8_t *safe_data                                             = NULL;
+	static char *function                                          = "libfsext_metadata_index_writer_write_data";
+	size_t group_descriptors_offset                                = 0;
+	size_t names_offset                                            = 0;
+	size_t safe_data_size                                          = 0;
+	size_t stat_records_offset                                     = 0;
+	size_t tree_entries_offset                                     = 0;
+	uint32_t checksum                                              = 0;
+	uint32_t number_of_stat_records                                = 0;
+	uint32_t previous_inode_number                                 = 0;
+	uint32_t record_inode_number                                   = 0;
+	uint32_t record_index                                          = 0;
+	int group_descriptor_index                                     = 0;
+	int number_of_group_descriptors                                = 0;
+
+	if( metadata_index_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     group_descriptors_array,
+	     &number_of_group_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of group descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the tree entries by parent inode number and name so that they can be
+	 * searched with a binary search
+	 */
+	if( metadata_index_writer->number_of_tree_entries > 0 )
+	{
+		for( record_index = 0;
+		     record_index < metadata_index_writer->number_of_tree_entries;
+		     record_index++ )
+		{
+			tree_entry = &( metadata_index_writer->tree_entries[ record_index ] );
+
+			tree_entry->name = &( metadata_index_writer->names[ tree_entry->name_offset ] );
+		}
+		qsort(
+		 metadata_index_writer->tree_entries,
+		 (size_t) metadata_index_writer->number_of_tree_entries,
+		 sizeof( libfsext_metadata_index_writer_tree_entry_t ),
+		 &libfsext_metadata_index_writer_compare_tree_entries );
+	}
+	/* Sort the stat records by inode number and remove the duplicates of hard linked inodes
+	 */
+	if( metadata_index_writer->number_of_stat_records > 0 )
+	{
+		stat_records = (fsext_metadata_index_stat_record_t *) metadata_index_writer->stat_records_data;
+
+		qsort(
+		 stat_records,
+		 (size_t) metadata_index_writer->number_of_stat_records,
+		 sizeof( fsext_metadata_index_stat_record_t ),
+		 &libfsext_metadata_index_writer_compare_stat_records );
+
+		for( record_index = 0;
+		     record_index < metadata_index_writer->number_of_stat_records;
+		     record_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 stat_records[ record_index ].inode_number,
+			 record_inode_number );
+
+			if( ( number_of_stat_records > 0 )
+			 && ( record_inode_number == previous_inode_number ) )
+			{
+				continue;
+			}
+			if( number_of_stat_records != record_index )
+			{
+				if( memory_copy(
+				     &( stat_records[ number_of_stat_records ] ),
+				     &( stat_records[ record_index ] ),
+				     sizeof( fsext_metadata_index_stat_record_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy stat record.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			previous_inode_number   = record_inode_number;
+			number_of_stat_records += 1;
+		}
+		metadata_index_writer->number_of_stat_records = number_of_stat_records;
+	}
+	group_descriptors_offset = sizeof( fsext_metadata_index_file_header_t );
+	tree_entries_offset      = group_descriptors_offset + ( (size_t) number_of_group_descriptors * sizeof( fsext_metadata_index_group_descriptor_t ) );
+	stat_records_offset      = tree_entries_offset + ( (size_t) metadata_index_writer->number_of_tree_entries * sizeof( fsext_metadata_index_tree_entry_t ) );
+	names_offset             = stat_records_offset + ( (size_t) metadata_index_writer->number_of_stat_records * sizeof( fsext_metadata_index_stat_record_t ) );
+
+	if( metadata_index_writer->names_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - names_offset - 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Pad the names to a multiple of 8 bytes
+	 */
+	safe_data_size = names_offset + metadata_index_writer->names_size;
+
+	if( ( safe_data_size % 8 ) != 0 )
+	{
+		safe_data_size += 8 - ( safe_data_size % 8 );
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * safe_data_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_data,
+	     0,
+	     safe_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	file_header = (fsext_metadata_index_file_header_t *) safe_data;
+
+	if( memory_copy(
+	     file_header->signature,
+	     fsext_metadata_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_header->file_system_identifier,
+	     superblock->file_system_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file system identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->format_version,
+	 LIBFSEXT_METADATA_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->header_size,
+	 (uint32_t) sizeof( fsext_metadata_index_file_header_t ) );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->file_size,
+	 (uint64_t) safe_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->last_written_time,
+	 superblock->last_written_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_inodes,
+	 superblock->number_of_inodes );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_block_groups,
+	 superblock->number_of_block_groups );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->block_size,
+	 superblock->block_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->group_descriptors_offset,
+	 (uint64_t) group_descriptors_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_group_descriptors,
+	 (uint32_t) number_of_group_descriptors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_tree_entries,
+	 metadata_index_writer->number_of_tree_entries );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->tree_entries_offset,
+	 (uint64_t) tree_entries_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->names_offset,
+	 (uint64_t) names_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->names_size,
+	 (uint64_t) metadata_index_writer->names_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header->stat_records_offset,
+	 (uint64_t) stat_records_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_stat_records,
+	 metadata_index_writer->number_of_stat_records );
+
+	group_descriptor_data = (fsext_metadata_index_group_descriptor_t *) &( safe_data[ group_descriptors_offset ] );
+
+	for( group_descriptor_index = 0;
+	     group_descriptor_index < number_of_group_descriptors;
+	     group_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     group_descriptors_array,
+		     group_descriptor_index,
+		     (intptr_t **) &group_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve group descriptor: %d.",
+			 function,
+			 group_descriptor_index );
+
+			goto on_error;
+		}
+		if( group_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing group descriptor: %d.",
+			 function,
+			 group_descriptor_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 group_descriptor_data->group_number,
+		 group_descriptor->group_number );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 group_descriptor_data->block_group_flags,
+		 group_descriptor->block_group_flags );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 group_descriptor_data->block_bitmap_block_number,
+		 group_descriptor->block_bitmap_block_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 group_descriptor_data->inode_bitmap_block_number,
+		 group_descriptor->inode_bitmap_block_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 group_descriptor_data->inode_table_block_number,
+		 group_descriptor->inode_table_block_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 group_descriptor_data->exclude_bitmap_block_number,
+		 group_descriptor->exclude_bitmap_block_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 group_descriptor_data->number_of_unallocated_blocks,
+		 group_descriptor->number_of_unallocated_blocks );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 group_descriptor_data->number_of_unallocated_inodes,
+		 group_descriptor->number_of_unallocated_inodes );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 group_descriptor_data->number_of_directories,
+		 group_descriptor->number_of_directories );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 group_descriptor_data->number_of_unused_inodes,
+		 group_descriptor->number_of_unused_inodes );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 group_descriptor_data->block_bitmap_checksum,
+		 group_descriptor->block_bitmap_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 group_descriptor_data->inode_bitmap_checksum,
+		 group_descriptor->inode_bitmap_checksum );
+
+		group_descriptor_data++;
+	}
+	tree_entry_data = (fsext_metadata_index_tree_entry_t *) &( safe_data[ tree_entries_offset ] );
+
+	for( record_index = 0;
+	     record_index < metadata_index_writer->number_of_tree_entries;
+	     record_index++ )
+	{
+		tree_entry = &( metadata_index_writer->tree_entries[ record_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 tree_entry_data->parent_inode_number,
+		 tree_entry->parent_inode_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 tree_entry_data->inode_number,
+		 tree_entry->inode_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 tree_entry_data->name_offset,
+		 tree_entry->name_offset );
+
+		tree_entry_data->name_size = tree_entry->name_size;
+		tree_entry_data->file_type = tree_entry->file_type;
+
+		tree_entry->name = NULL;
+
+		tree_entry_data++;
+	}
+	if( metadata_index_writer->number_of_stat_records > 0 )
+	{
+		if( memory_copy(
+		     &( safe_data[ stat_records_offset ] ),
+		     metadata_index_writer->stat_records_data,
+		     (size_t) metadata_index_writer->number_of_stat_records * sizeof( fsext_metadata_index_stat_record_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy stat records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( metadata_index_writer->names_size > 0 )
+	{
+		if( memory_copy(
+		     &( safe_data[ names_offset ] ),
+		     metadata_index_writer->names,
+		     metadata_index_writer->names_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy names.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsext_checksum_calculate_crc32(
+	     &checksum,
+	     safe_data,
+	     sizeof( fsext_metadata_index_file_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_checksum_calculate_crc32(
+	     &checksum,
+	     &( safe_data[ sizeof( fsext_metadata_index_file_header_t ) ] ),
+	     safe_data_size - sizeof( fsext_metadata_index_file_header_t ),
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->checksum,
+	 checksum );
+
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	return( -1 );
+}
+
+/* Writes the metadata index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_metadata_index_writer_write_file_io_handle(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     libfsext_superblock_t *superblock,
+     libcdata_array_t *group_descriptors_array,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libfsext_metadata_index_writer_write_file_io_handle";
+	size_t data_size      = 0;
+	ssize_t write_count   = 0;
+
+	if( libfsext_metadata_index_writer_write_data(
+	     metadata_index_writer,
+	     superblock,
+	     group_descriptors_array,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata index data.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata index data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
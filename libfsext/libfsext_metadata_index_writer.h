@@ -0,0 +1,158 @@
+/*
+ * Metadata index writer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSEXT_METADATA_INDEX_WRITER_H )
+#define _LIBFSEXT_METADATA_INDEX_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsext_directory_entry.h"
+#include "libfsext_inode.h"
+#include "libfsext_libbfio.h"
+#include "libfsext_libcdata.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_superblock.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsext_metadata_index_writer_tree_entry libfsext_metadata_index_writer_tree_entry_t;
+
+struct libfsext_metadata_index_writer_tree_entry
+{
+	/* Parent inode number
+	 */
+	uint32_t parent_inode_number;
+
+	/* Inode number
+	 */
+	uint32_t inode_number;
+
+	/* Name offset
+	 */
+	uint32_t name_offset;
+
+	/* Name size
+	 */
+	uint8_t name_size;
+
+	/* File type
+	 */
+	uint8_t file_type;
+
+	/* Name
+	 * Only set while the tree entries are sorted
+	 */
+	const uint8_t *name;
+};
+
+typedef struct libfsext_metadata_index_writer libfsext_metadata_index_writer_t;
+
+struct libfsext_metadata_index_writer
+{
+	/* The tree entries
+	 */
+	libfsext_metadata_index_writer_tree_entry_t *tree_entries;
+
+	/* The number of tree entries
+	 */
+	uint32_t number_of_tree_entries;
+
+	/* The number of allocated tree entries
+	 */
+	uint32_t number_of_allocated_tree_entries;
+
+	/* The names
+	 */
+	uint8_t *names;
+
+	/* The names size
+	 */
+	size_t names_size;
+
+	/* The allocated names size
+	 */
+	size_t allocated_names_size;
+
+	/* The stat records data
+	 */
+	uint8_t *stat_records_data;
+
+	/* The number of stat records
+	 */
+	uint32_t number_of_stat_records;
+
+	/* The number of allocated stat records
+	 */
+	uint32_t number_of_allocated_stat_records;
+};
+
+int libfsext_metadata_index_writer_initialize(
+     libfsext_metadata_index_writer_t **metadata_index_writer,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_writer_free(
+     libfsext_metadata_index_writer_t **metadata_index_writer,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_writer_append_tree_entry(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     uint32_t parent_inode_number,
+     libfsext_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_writer_append_stat_record(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     uint32_t inode_number,
+     libfsext_inode_t *inode,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_writer_compare_tree_entries(
+     const void *first_tree_entry,
+     const void *second_tree_entry );
+
+int libfsext_metadata_index_writer_compare_stat_records(
+     const void *first_stat_record,
+     const void *second_stat_record );
+
+int libfsext_metadata_index_writer_write_data(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     libfsext_superblock_t *superblock,
+     libcdata_array_t *group_descriptors_array,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libfsext_metadata_index_writer_write_file_io_handle(
+     libfsext_metadata_index_writer_t *metadata_index_writer,
+     libfsext_superblock_t *superblock,
+     libcdata_array_t *group_descriptors_array,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSEXT_METADATA_INDEX_WRITER_H ) */
+
@@ -0,0 +1,592 @@
+/*
+ * Name functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsext_libcerror.h"
+#include "libfsext_libuna.h"
+#include "libfsext_name.h"
+
+/* Retrieves the case folded Unicode character
+ * This applies the simple case folding of the Latin, Greek, Cyrillic and Armenian scripts
+ * and the full width Latin letters, other characters are returned unchanged
+ * Returns the case folded Unicode character
+ */
+libuna_unicode_character_t libfsext_name_get_case_folded_character(
+                            libuna_unicode_character_t unicode_character )
+{
+	if( unicode_character < 0x00000080UL )
+	{
+		if( ( unicode_character >= 0x00000041UL )
+		 && ( unicode_character <= 0x0000005aUL ) )
+		{
+			unicode_character += 0x00000020UL;
+		}
+	}
+	else if( unicode_character < 0x00000100UL )
+	{
+		if( unicode_character == 0x000000b5UL )
+		{
+			unicode_character = 0x000003bcUL;
+		}
+		else if( ( unicode_character >= 0x000000c0UL )
+		      && ( unicode_character <= 0x000000deUL )
+		      && ( unicode_character != 0x000000d7UL ) )
+		{
+			unicode_character += 0x00000020UL;
+		}
+	}
+	else if( unicode_character < 0x00000180UL )
+	{
+		if( unicode_character == 0x00000178UL )
+		{
+			unicode_character = 0x000000ffUL;
+		}
+		else if( unicode_character == 0x0000017fUL )
+		{
+			unicode_character = 0x00000073UL;
+		}
+		else if( ( ( unicode_character >= 0x00000139UL )
+		       &&  ( unicode_character <= 0x00000148UL ) )
+		      || ( ( unicode_character >= 0x00000179UL )
+		       &&  ( unicode_character <= 0x0000017eUL ) ) )
+		{
+			if( ( unicode_character % 2 ) != 0 )
+			{
+				unicode_character += 1;
+			}
+		}
+		else if( ( unicode_character != 0x00000130UL )
+		      && ( unicode_character != 0x00000138UL )
+		      && ( unicode_character != 0x00000149UL ) )
+		{
+			if( ( unicode_character % 2 ) == 0 )
+			{
+				unicode_character += 1;
+			}
+		}
+	}
+	else if( ( unicode_character >= 0x00000386UL )
+	      && ( unicode_character <= 0x000003abUL ) )
+	{
+		if( unicode_character == 0x00000386UL )
+		{
+			unicode_character = 0x000003acUL;
+		}
+		else if( ( unicode_character >= 0x00000388UL )
+		      && ( unicode_character <= 0x0000038aUL ) )
+		{
+			unicode_character += 0x00000025UL;
+		}
+		else if( unicode_character == 0x0000038cUL )
+		{
+			unicode_character = 0x000003ccUL;
+		}
+		else if( ( unicode_character == 0x0000038eUL )
+		      || ( unicode_character == 0x0000038fUL ) )
+		{
+			unicode_character += 0x0000003fUL;
+		}
+		else if( ( unicode_character >= 0x00000391UL )
+		      && ( unicode_character != 0x000003a2UL ) )
+		{
+			unicode_character += 0x00000020UL;
+		}
+	}
+	else if( unicode_character == 0x000003c2UL )
+	{
+		unicode_character = 0x000003c3UL;
+	}
+	else if( ( unicode_character >= 0x00000400UL )
+	      && ( unicode_character <= 0x0000052fUL ) )
+	{
+		if( unicode_character <= 0x0000040fUL )
+		{
+			unicode_character += 0x00000050UL;
+		}
+		else if( unicode_character <= 0x0000042fUL )
+		{
+			unicode_character += 0x00000020UL;
+		}
+		else if( unicode_character == 0x000004c0UL )
+		{
+			unicode_character = 0x000004cfUL;
+		}
+		else if( ( unicode_character >= 0x000004c1UL )
+		      && ( unicode_character <= 0x000004ceUL ) )
+		{
+			if( ( unicode_character % 2 ) != 0 )
+			{
+				unicode_character += 1;
+			}
+		}
+		else if( ( ( unicode_character >= 0x00000460UL )
+		       &&  ( unicode_character <= 0x00000481UL ) )
+		      || ( unicode_character >= 0x0000048aUL ) )
+		{
+			if( ( unicode_character % 2 ) == 0 )
+			{
+				unicode_character += 1;
+			}
+		}
+	}
+	else if( ( unicode_character >= 0x00000531UL )
+	      && ( unicode_character <= 0x00000556UL ) )
+	{
+		unicode_character += 0x00000030UL;
+	}
+	else if( ( ( unicode_character >= 0x00001e00UL )
+	       &&  ( unicode_character <= 0x00001e95UL ) )
+	      || ( ( unicode_character >= 0x00001ea0UL )
+	       &&  ( unicode_character <= 0x00001effUL ) ) )
+	{
+		if( ( unicode_character % 2 ) == 0 )
+		{
+			unicode_character += 1;
+		}
+	}
+	else if( ( unicode_character >= 0x0000ff21UL )
+	      && ( unicode_character <= 0x0000ff3aUL ) )
+	{
+		unicode_character += 0x00000020UL;
+	}
+	return( unicode_character );
+}
+
+/* Retrieves the hash of an UTF-8 encoded string
+ * The hash is a 32-bit FNV-1a of the Unicode characters, that are case folded if requested,
+ * so that an UTF-8 and UTF-16 encoded string of the same name have the same hash
+ * Returns 1 if successful, 0 if the string is not valid UTF-8 or -1 on error
+ */
+int libfsext_name_get_hash_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsext_name_get_hash_from_utf8_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_name_hash                      = 0x811c9dc5UL;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		/* A string that is not valid UTF-8 has no hash
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( use_case_folding != 0 )
+		{
+			unicode_character = libfsext_name_get_case_folded_character(
+			                     unicode_character );
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 0x01000193UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the hash of an UTF-16 encoded string
+ * The hash is a 32-bit FNV-1a of the Unicode characters, that are case folded if requested,
+ * so that an UTF-8 and UTF-16 encoded string of the same name have the same hash
+ * Returns 1 if successful, 0 if the string is not valid UTF-16 or -1 on error
+ */
+int libfsext_name_get_hash_from_utf16_string(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsext_name_get_hash_from_utf16_string";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_name_hash                      = 0x811c9dc5UL;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		/* A string that is not valid UTF-16 has no hash
+		 */
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( use_case_folding != 0 )
+		{
+			unicode_character = libfsext_name_get_case_folded_character(
+			                     unicode_character );
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= 0x01000193UL;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Compares an UTF-8 string with an UTF-8 encoded name
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsext_name_compare_with_utf8_string(
+     const uint8_t *name,
+     size_t name_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	static char *function                               = "libfsext_name_compare_with_utf8_string";
+	libuna_unicode_character_t name_unicode_character   = 0;
+	libuna_unicode_character_t string_unicode_character = 0;
+	size_t name_index                                   = 0;
+	size_t utf8_string_index                            = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A character value of 0 is used to indicate the end of the name or string
+	 */
+	do
+	{
+		name_unicode_character   = 0;
+		string_unicode_character = 0;
+
+		if( name_index < name_size )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &name_unicode_character,
+			     name,
+			     name_size,
+			     &name_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy name to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &string_unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( use_case_folding != 0 )
+		{
+			name_unicode_character = libfsext_name_get_case_folded_character(
+			                          name_unicode_character );
+
+			string_unicode_character = libfsext_name_get_case_folded_character(
+			                            string_unicode_character );
+		}
+
+		if( string_unicode_character < name_unicode_character )
+		{
+			return( LIBUNA_COMPARE_LESS );
+		}
+		else if( string_unicode_character > name_unicode_character )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+	}
+	while( name_unicode_character != 0 );
+
+	return( LIBUNA_COMPARE_EQUAL );
+}
+
+/* Compares an UTF-16 string with an UTF-8 encoded name
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsext_name_compare_with_utf16_string(
+     const uint8_t *name,
+     size_t name_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	static char *function                               = "libfsext_name_compare_with_utf16_string";
+	libuna_unicode_character_t name_unicode_character   = 0;
+	libuna_unicode_character_t string_unicode_character = 0;
+	size_t name_index                                   = 0;
+	size_t utf16_string_index                           = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A character value of 0 is used to indicate the end of the name or string
+	 */
+	do
+	{
+		name_unicode_character   = 0;
+		string_unicode_character = 0;
+
+		if( name_index < name_size )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &name_unicode_character,
+			     name,
+			     name_size,
+			     &name_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy name to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &string_unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( use_case_folding != 0 )
+		{
+			name_unicode_character = libfsext_name_get_case_folded_character(
+			                          name_unicode_character );
+
+			string_unicode_character = libfsext_name_get_case_folded_character(
+			                            string_unicode_character );
+		}
+
+		if( string_unicode_character < name_unicode_character )
+		{
+			return( LIBUNA_COMPARE_LESS );
+		}
+		else if( string_unicode_character > name_unicode_character )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+	}
+	while( name_unicode_character != 0 );
+
+	return( LIBUNA_COMPARE_EQUAL );
+}
+
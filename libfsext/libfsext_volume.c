@@ -29,17 +29,24 @@
 #include "libfsext_checksum.h"
 #include "libfsext_debug.h"
 #include "libfsext_definitions.h"
+#include "libfsext_directory.h"
+#include "libfsext_directory_entry.h"
 #include "libfsext_group_descriptor.h"
 #include "libfsext_file_entry.h"
 #include "libfsext_inode_table.h"
 #include "libfsext_io_handle.h"
+#include "libfsext_journal.h"
+#include "libfsext_libbfio.h"
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libcnotify.h"
 #include "libfsext_libcthreads.h"
 #include "libfsext_libuna.h"
+#include "libfsext_metadata_index.h"
+#include "libfsext_metadata_index_writer.h"
 #include "libfsext_superblock.h"
 #include "libfsext_volume.h"
+#include "libfsext_walker.h"
 
 /* Creates a volume
  * Make sure the value volume is referencing, is set to NULL
@@ -210,6 +217,22 @@ int libfsext_volume_free(
 		}
 		*volume = NULL;
 
+		if( internal_volume->metadata_index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_volume->metadata_index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free metadata index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 		if( libcthreads_read_write_lock_free(
 		     &( internal_volume->read_write_lock ),
@@ -973,6 +996,38 @@ int libfsext_volume_close(
 			result = -1;
 		}
 	}
+	if( internal_volume->metadata_index != NULL )
+	{
+		if( libfsext_metadata_index_free(
+		     &( internal_volume->metadata_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->journal != NULL )
+	{
+		if( libfsext_journal_free(
+		     &( internal_volume->journal ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free journal.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -1000,6 +1055,7 @@ int libfsext_internal_volume_open_read(
      libcerror_error_t **error )
 {
 	static char *function = "libfsext_internal_volume_open_read";
+	int result            = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -1023,19 +1079,44 @@ int libfsext_internal_volume_open_read(
 
 		return( -1 );
 	}
-	if( libfsext_internal_volume_read_block_groups(
-	     internal_volume,
-	     file_io_handle,
-	     error ) != 1 )
+	/* The metadata index reflects the volume without the journal
+	 */
+	if( ( internal_volume->metadata_index_file_io_handle != NULL )
+	 && ( internal_volume->use_journal == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block groups.",
-		 function );
+		result = libfsext_internal_volume_read_metadata_index(
+		          internal_volume,
+		          file_io_handle,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		if( libfsext_internal_volume_read_block_groups(
+		     internal_volume,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block groups.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libfsext_inode_table_initialize(
 	     &( internal_volume->inode_table ),
@@ -1054,15 +1135,46 @@ int libfsext_internal_volume_open_read(
 
 		goto on_error;
 	}
+	if( internal_volume->use_journal != 0 )
+	{
+		if( libfsext_internal_volume_read_journal(
+		     internal_volume,
+		     file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read journal.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
+	internal_volume->io_handle->journal = NULL;
+
+	if( internal_volume->journal != NULL )
+	{
+		libfsext_journal_free(
+		 &( internal_volume->journal ),
+		 NULL );
+	}
 	if( internal_volume->inode_table != NULL )
 	{
 		libfsext_inode_table_free(
 		 &( internal_volume->inode_table ),
 		 NULL );
 	}
+	if( internal_volume->metadata_index != NULL )
+	{
+		libfsext_metadata_index_free(
+		 &( internal_volume->metadata_index ),
+		 NULL );
+	}
 	libcdata_array_empty(
 	 internal_volume->group_descriptors_array,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_group_descriptor_free,
@@ -1077,6 +1189,92 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the superblock and the IO handle values derived from it
+ * The volume takes over management of the superblock on success
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_internal_volume_set_superblock(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_superblock_t *superblock,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_internal_volume_set_superblock";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - superblock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_checksum_calculate_crc32(
+	     &( internal_volume->io_handle->metadata_checksum_seed ),
+	     superblock->file_system_identifier,
+	     16,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume->io_handle->block_size                          = superblock->block_size;
+	internal_volume->io_handle->inode_size                          = superblock->inode_size;
+	internal_volume->io_handle->group_descriptor_size               = superblock->group_descriptor_size;
+	internal_volume->io_handle->number_of_inodes                    = superblock->number_of_inodes;
+	internal_volume->io_handle->format_revision                     = superblock->format_revision;
+	internal_volume->io_handle->compatible_features_flags           = superblock->compatible_features_flags;
+	internal_volume->io_handle->incompatible_features_flags         = superblock->incompatible_features_flags;
+	internal_volume->io_handle->read_only_compatible_features_flags = superblock->read_only_compatible_features_flags;
+	internal_volume->io_handle->format_version                      = superblock->format_version;
+
+	internal_volume->superblock = superblock;
+
+	return( 1 );
+}
+
 /* Reads the block groups
  * Returns 1 if successful or -1 on error
  */
@@ -1238,6 +1436,13 @@ int libfsext_internal_volume_read_block_groups(
 			          superblock_offset,
 			          error );
 
+			if( result != -1 )
+			{
+				libfsext_io_handle_update_read_statistics(
+				 internal_volume->io_handle,
+				 LIBFSEXT_STATISTICS_VALUE_SUPERBLOCK_NUMBER_OF_READS,
+				 1024 );
+			}
 			if( block_group_number == 0 )
 			{
 				if( result != 1 )
@@ -1284,33 +1489,21 @@ int libfsext_internal_volume_read_block_groups(
 					}
 					metadata_block_group_start_block_number = superblock->first_metadata_block_group * number_of_blocks_per_meta_group;
 				}
-				internal_volume->io_handle->block_size                          = superblock->block_size;
-				internal_volume->io_handle->inode_size                          = superblock->inode_size;
-				internal_volume->io_handle->group_descriptor_size               = superblock->group_descriptor_size;
-				internal_volume->io_handle->format_revision                     = superblock->format_revision;
-				internal_volume->io_handle->compatible_features_flags           = superblock->compatible_features_flags;
-				internal_volume->io_handle->incompatible_features_flags         = superblock->incompatible_features_flags;
-				internal_volume->io_handle->read_only_compatible_features_flags = superblock->read_only_compatible_features_flags;
-				internal_volume->io_handle->format_version                      = superblock->format_version;
-
-				if( libfsext_checksum_calculate_crc32(
-				     &( internal_volume->io_handle->metadata_checksum_seed ),
-				     superblock->file_system_identifier,
-				     16,
-				     0,
+				if( libfsext_internal_volume_set_superblock(
+				     internal_volume,
+				     superblock,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to calculate CRC-32.",
+					 "%s: unable to set superblock.",
 					 function );
 
 					goto on_error;
 				}
-				internal_volume->superblock = superblock;
-				superblock                  = NULL;
+				superblock = NULL;
 
 				has_sparse_superblock = ( internal_volume->io_handle->read_only_compatible_features_flags & LIBFSEXT_READ_ONLY_COMPATIBLE_FEATURES_FLAG_SPARSE_SUPERBLOCK ) != 0;
 			}
@@ -1660,387 +1853,3928 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the format version
- * Returns 1 if successful or -1 on error
+/* Reads the superblock and group descriptors from the metadata index
+ * The metadata index is only used when it matches the primary superblock
+ * of the volume, otherwise it is ignored
+ * Returns 1 if successful, 0 if the metadata index is not usable or -1 on error
  */
-int libfsext_volume_get_format_version(
-     libfsext_volume_t *volume,
-     uint8_t *format_version,
+int libfsext_internal_volume_read_metadata_index(
+     libfsext_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_format_version";
+	libfsext_metadata_index_t *metadata_index = NULL;
+	libfsext_superblock_t *superblock         = NULL;
+	static char *function                     = "libfsext_internal_volume_read_metadata_index";
+	int result                                = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid internal volume.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
 	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 "%s: invalid internal volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( internal_volume->metadata_index_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing metadata index file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->metadata_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal volume - metadata index value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*format_version = internal_volume->io_handle->format_version;
+	result = libbfio_handle_exists(
+	          internal_volume->metadata_index_file_io_handle,
+	          error );
 
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if metadata index exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsext_superblock_initialize(
+	     &superblock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create superblock.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( 1 );
-}
-
-/* Retrieves the feature flags
- * Returns 1 if successful or -1 on error
- */
-int libfsext_volume_get_features_flags(
-     libfsext_volume_t *volume,
-     uint32_t *compatible_features_flags,
-     uint32_t *incompatible_features_flags,
-     uint32_t *read_only_compatible_features_flags,
-     libcerror_error_t **error )
-{
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_features_flags";
-
-	if( volume == NULL )
+	if( libfsext_superblock_read_file_io_handle(
+	     superblock,
+	     file_io_handle,
+	     1024,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock at offset: 1024 (0x00000400).",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
+	libfsext_io_handle_update_read_statistics(
+	 internal_volume->io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_SUPERBLOCK_NUMBER_OF_READS,
+	 1024 );
 
-	if( internal_volume->superblock == NULL )
+	if( libfsext_metadata_index_initialize(
+	     &metadata_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( compatible_features_flags == NULL )
+	if( libbfio_handle_open(
+	     internal_volume->metadata_index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compatible features flags.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open metadata index file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( incompatible_features_flags == NULL )
+	result = libfsext_metadata_index_read_file_io_handle(
+	          metadata_index,
+	          internal_volume->metadata_index_file_io_handle,
+	          error );
+
+	if( libbfio_handle_close(
+	     internal_volume->metadata_index_file_io_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid incompatible features flags.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close metadata index file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( read_only_compatible_features_flags == NULL )
+	if( result != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid read-only compatible features flags.",
-		 function );
+		/* A corrupted or unsupported metadata index is not fatal, since the
+		 * volume metadata can be read from the volume instead
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
 
-		return( -1 );
+		result = 0;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	else
+	{
+		result = libfsext_metadata_index_matches_superblock(
+		          metadata_index,
+		          superblock,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if metadata index matches superblock.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: ignoring stale or invalid metadata index.\n",
+			 function );
+		}
+#endif
+		if( libfsext_metadata_index_free(
+		     &metadata_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata index.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_superblock_free(
+		     &superblock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free superblock.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libfsext_metadata_index_get_group_descriptors(
+	     metadata_index,
+	     internal_volume->group_descriptors_array,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group descriptors from metadata index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	*compatible_features_flags           = internal_volume->superblock->compatible_features_flags;
-	*incompatible_features_flags         = internal_volume->superblock->incompatible_features_flags;
-	*read_only_compatible_features_flags = internal_volume->superblock->read_only_compatible_features_flags;
-
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsext_internal_volume_set_superblock(
+	     internal_volume,
+	     superblock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to set superblock.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
+	internal_volume->metadata_index = metadata_index;
+
 	return( 1 );
+
+on_error:
+	libcdata_array_empty(
+	 internal_volume->group_descriptors_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_group_descriptor_free,
+	 NULL );
+
+	if( metadata_index != NULL )
+	{
+		libfsext_metadata_index_free(
+		 &metadata_index,
+		 NULL );
+	}
+	if( superblock != NULL )
+	{
+		libfsext_superblock_free(
+		 &superblock,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the identifier
- * The identifier is an UUID stored in big-endian and is 16 bytes of size
+/* Writes the metadata index
+ * The directory hierarchy is traversed iteratively, starting at the root directory,
+ * and every directory inode is visited only once
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_identifier(
-     libfsext_volume_t *volume,
-     uint8_t *uuid_data,
-     size_t uuid_data_size,
+int libfsext_internal_volume_write_metadata_index(
+     libfsext_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_identifier";
-	int result                                  = 1;
+	libfsext_directory_t *directory                         = NULL;
+	libfsext_directory_entry_t *directory_entry             = NULL;
+	libfsext_inode_t *inode                                 = NULL;
+	libfsext_metadata_index_writer_t *metadata_index_writer = NULL;
+	uint32_t *directory_stack                               = NULL;
+	uint8_t *visited_directories                            = NULL;
+	void *reallocation                                      = NULL;
+	static char *function                                   = "libfsext_internal_volume_write_metadata_index";
+	size_t visited_directories_size                         = 0;
+	uint32_t directory_inode_number                         = 0;
+	uint32_t inode_number                                   = 0;
+	uint32_t maximum_number_of_stack_entries                = 0;
+	uint32_t number_of_stack_entries                        = 0;
+	int entry_index                                         = 0;
+	int number_of_entries                                   = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid internal volume.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 "%s: invalid internal volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfsext_superblock_get_file_system_identifier(
-	     internal_volume->superblock,
-	     uuid_data,
-	     uuid_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file system identifier.",
-		 function );
+	visited_directories_size = ( (size_t) internal_volume->superblock->number_of_inodes / 8 ) + 1;
 
-		result = -1;
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( visited_directories_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid visited directories size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-}
+	visited_directories = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * visited_directories_size );
 
-/* Retrieves the size of the UTF-8 encoded label
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfsext_volume_get_utf8_label_size(
-     libfsext_volume_t *volume,
-     size_t *utf8_string_size,
-     libcerror_error_t **error )
-{
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf8_label_size";
-	size_t safe_utf8_string_size                = 1;
-	int result                                  = 1;
-
-	if( volume == NULL )
+	if( visited_directories == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create visited directories.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
-	if( utf8_string_size == NULL )
+	if( memory_set(
+	     visited_directories,
+	     0,
+	     visited_directories_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear visited directories.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsext_metadata_index_writer_initialize(
+	     &metadata_index_writer,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata index writer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( internal_volume->superblock != NULL )
-	{
-		if( libfsext_superblock_get_utf8_volume_label_size(
-		     internal_volume->superblock,
-		     &safe_utf8_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UTF-8 volume label string size.",
-			 function );
+	inode_number = LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY;
 
-			result = -1;
-		}
-	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     internal_volume->file_io_handle,
+	     inode_number,
+	     &inode,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( safe_utf8_string_size < 1 )
+	if( libfsext_metadata_index_writer_append_stat_record(
+	     metadata_index_writer,
+	     inode_number,
+	     inode,
+	     error ) != 1 )
 	{
-		safe_utf8_string_size = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append stat record of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
 	}
-	*utf8_string_size = safe_utf8_string_size;
+	maximum_number_of_stack_entries = 256;
 
-	return( result );
-}
+	directory_stack = (uint32_t *) memory_allocate(
+	                               sizeof( uint32_t ) * maximum_number_of_stack_entries );
 
-/* Retrieves the UTF-8 encoded label
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+	if( directory_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory stack.",
+		 function );
+
+		goto on_error;
+	}
+	visited_directories[ inode_number / 8 ] |= (uint8_t) ( 1 << ( inode_number % 8 ) );
+
+	directory_stack[ number_of_stack_entries++ ] = inode_number;
+
+	while( number_of_stack_entries > 0 )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		directory_inode_number = directory_stack[ --number_of_stack_entries ];
+
+		if( libfsext_inode_table_get_inode_by_number(
+		     internal_volume->inode_table,
+		     internal_volume->file_io_handle,
+		     directory_inode_number,
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu32 ".",
+			 function,
+			 directory_inode_number );
+
+			goto on_error;
+		}
+		if( libfsext_directory_initialize(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_directory_read_file_io_handle(
+		     directory,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory from inode: %" PRIu32 ".",
+			 function,
+			 directory_inode_number );
+
+			goto on_error;
+		}
+		if( libfsext_directory_get_number_of_entries(
+		     directory,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of directory: %" PRIu32 ".",
+			 function,
+			 directory_inode_number );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libfsext_directory_get_entry_by_index(
+			     directory,
+			     entry_index,
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libfsext_metadata_index_writer_append_tree_entry(
+			     metadata_index_writer,
+			     directory_inode_number,
+			     directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append tree entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			inode_number = directory_entry->inode_number;
+
+			if( ( inode_number == 0 )
+			 || ( inode_number > internal_volume->superblock->number_of_inodes ) )
+			{
+				continue;
+			}
+			if( libfsext_inode_table_get_inode_by_number(
+			     internal_volume->inode_table,
+			     internal_volume->file_io_handle,
+			     inode_number,
+			     &inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve inode: %" PRIu32 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( libfsext_metadata_index_writer_append_stat_record(
+			     metadata_index_writer,
+			     inode_number,
+			     inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append stat record of inode: %" PRIu32 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( ( inode->file_mode & 0xf000 ) != LIBFSEXT_FILE_TYPE_DIRECTORY )
+			{
+				continue;
+			}
+			if( ( visited_directories[ inode_number / 8 ] & (uint8_t) ( 1 << ( inode_number % 8 ) ) ) != 0 )
+			{
+				continue;
+			}
+			visited_directories[ inode_number / 8 ] |= (uint8_t) ( 1 << ( inode_number % 8 ) );
+
+			if( number_of_stack_entries >= maximum_number_of_stack_entries )
+			{
+				if( maximum_number_of_stack_entries > ( (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( uint32_t ) ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid maximum number of stack entries value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				maximum_number_of_stack_entries *= 2;
+
+				reallocation = memory_reallocate(
+				                directory_stack,
+				                sizeof( uint32_t ) * maximum_number_of_stack_entries );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize directory stack.",
+					 function );
+
+					goto on_error;
+				}
+				directory_stack = (uint32_t *) reallocation;
+			}
+			directory_stack[ number_of_stack_entries++ ] = inode_number;
+		}
+		if( libfsext_directory_free(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 directory_stack );
+
+	directory_stack = NULL;
+
+	memory_free(
+	 visited_directories );
+
+	visited_directories = NULL;
+
+	if( libfsext_metadata_index_writer_write_file_io_handle(
+	     metadata_index_writer,
+	     internal_volume->superblock,
+	     internal_volume->group_descriptors_array,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_metadata_index_writer_free(
+	     &metadata_index_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free metadata index writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory != NULL )
+	{
+		libfsext_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( directory_stack != NULL )
+	{
+		memory_free(
+		 directory_stack );
+	}
+	if( metadata_index_writer != NULL )
+	{
+		libfsext_metadata_index_writer_free(
+		 &metadata_index_writer,
+		 NULL );
+	}
+	if( visited_directories != NULL )
+	{
+		memory_free(
+		 visited_directories );
+	}
+	return( -1 );
+}
+
+/* Reads the journal and overlays its committed transactions on the metadata reads
+ * Only a journal stored in an inode of the volume is supported
+ * Returns 1 if successful, 0 if the volume has no (supported) journal or -1 on error
+ */
+int libfsext_internal_volume_read_journal(
+     libfsext_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsext_inode_t *inode = NULL;
+	static char *function   = "libfsext_internal_volume_read_journal";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->journal != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal volume - journal value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_volume->superblock->compatible_features_flags & LIBFSEXT_COMPATIBLE_FEATURES_FLAG_HAS_JOURNAL ) == 0 )
+	 || ( internal_volume->superblock->journal_inode == 0 ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: volume has no journal inode.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     file_io_handle,
+	     internal_volume->superblock->journal_inode,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve journal inode: %" PRIu32 ".",
+		 function,
+		 internal_volume->superblock->journal_inode );
+
+		goto on_error;
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing journal inode: %" PRIu32 ".",
+		 function,
+		 internal_volume->superblock->journal_inode );
+
+		goto on_error;
+	}
+	if( libfsext_journal_initialize(
+	     &( internal_volume->journal ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create journal.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_journal_read_file_io_handle(
+	     internal_volume->journal,
+	     file_io_handle,
+	     inode->data_extents_array,
+	     internal_volume->io_handle->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read journal.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->io_handle->journal = internal_volume->journal;
+
+	return( 1 );
+
+on_error:
+	if( internal_volume->journal != NULL )
+	{
+		libfsext_journal_free(
+		 &( internal_volume->journal ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_format_version(
+     libfsext_volume_t *volume,
+     uint8_t *format_version,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_format_version";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*format_version = internal_volume->io_handle->format_version;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the feature flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_features_flags(
+     libfsext_volume_t *volume,
+     uint32_t *compatible_features_flags,
+     uint32_t *incompatible_features_flags,
+     uint32_t *read_only_compatible_features_flags,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_features_flags";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( compatible_features_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compatible features flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( incompatible_features_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid incompatible features flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_only_compatible_features_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-only compatible features flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*compatible_features_flags           = internal_volume->superblock->compatible_features_flags;
+	*incompatible_features_flags         = internal_volume->superblock->incompatible_features_flags;
+	*read_only_compatible_features_flags = internal_volume->superblock->read_only_compatible_features_flags;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the identifier
+ * The identifier is an UUID stored in big-endian and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_identifier(
+     libfsext_volume_t *volume,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_identifier";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsext_superblock_get_file_system_identifier(
+	     internal_volume->superblock,
+	     uuid_data,
+	     uuid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file system identifier.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded label
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf8_label_size(
+     libfsext_volume_t *volume,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf8_label_size";
+	size_t safe_utf8_string_size                = 1;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock != NULL )
+	{
+		if( libfsext_superblock_get_utf8_volume_label_size(
+		     internal_volume->superblock,
+		     &safe_utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 volume label string size.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_utf8_string_size < 1 )
+	{
+		safe_utf8_string_size = 1;
+	}
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded label
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf8_label(
+     libfsext_volume_t *volume,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf8_label";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock == NULL )
+	{
+		utf8_string[ 0 ] = 0;
+	}
+	else if( libfsext_superblock_get_utf8_volume_label(
+	          internal_volume->superblock,
+	          utf8_string,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 volume label string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded label
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf16_label_size(
+     libfsext_volume_t *volume,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf16_label_size";
+	size_t safe_utf16_string_size               = 1;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock != NULL )
+	{
+		if( libfsext_superblock_get_utf16_volume_label_size(
+		     internal_volume->superblock,
+		     &safe_utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 volume label string size.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_utf16_string_size < 1 )
+	{
+		safe_utf16_string_size = 1;
+	}
+	*utf16_string_size = safe_utf16_string_size;
+
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded label
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf16_label(
+     libfsext_volume_t *volume,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf16_label";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-16 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock == NULL )
+	{
+		utf16_string[ 0 ] = 0;
+	}
+	else if( libfsext_superblock_get_utf16_volume_label(
+	          internal_volume->superblock,
+	          utf16_string,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 volume label string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded last mount path
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf8_last_mount_path_size(
+     libfsext_volume_t *volume,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf8_last_mount_path_size";
+	size_t safe_utf8_string_size                = 1;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock != NULL )
+	{
+		if( libfsext_superblock_get_utf8_last_mount_path_size(
+		     internal_volume->superblock,
+		     &safe_utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 volume last mount path string size.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*utf8_string_size = safe_utf8_string_size;
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded last mount path
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf8_last_mount_path(
+     libfsext_volume_t *volume,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf8_last_mount_path";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock == NULL )
+	{
+		utf8_string[ 0 ] = 0;
+	}
+	else if( libfsext_superblock_get_utf8_last_mount_path(
+	          internal_volume->superblock,
+	          utf8_string,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 volume last mount path string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded last mount path
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf16_last_mount_path_size(
+     libfsext_volume_t *volume,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf16_last_mount_path_size";
+	size_t safe_utf16_string_size               = 1;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock != NULL )
+	{
+		if( libfsext_superblock_get_utf16_last_mount_path_size(
+		     internal_volume->superblock,
+		     &safe_utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 volume last mount path string size.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*utf16_string_size = safe_utf16_string_size;
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded last mount path
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_utf16_last_mount_path(
+     libfsext_volume_t *volume,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_utf16_last_mount_path";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-16 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->superblock == NULL )
+	{
+		utf16_string[ 0 ] = 0;
+	}
+	else if( libfsext_superblock_get_utf16_last_mount_path(
+	          internal_volume->superblock,
+	          utf16_string,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 volume last mount path string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the last mount time
+ * The timestamp is a signed 32-bit POSIX date and time value in number of seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_last_mount_time(
+     libfsext_volume_t *volume,
+     int32_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_last_mount_time";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid posix time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*posix_time = (int32_t) internal_volume->superblock->last_mount_time;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the last written time
+ * The timestamp is a signed 32-bit POSIX date and time value in number of seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_last_written_time(
+     libfsext_volume_t *volume,
+     int32_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_last_mount_time";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid posix time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*posix_time = (int32_t) internal_volume->superblock->last_written_time;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific statistics value
+ * The statistics values are defined by LIBFSEXT_STATISTICS_VALUES
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_statistics(
+     libfsext_volume_t *volume,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_statistics";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsext_io_handle_get_statistics_value(
+	     internal_volume->io_handle,
+	     statistics_value,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics value: %d.",
+		 function,
+		 statistics_value );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Resets the statistics values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_reset_statistics(
+     libfsext_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_reset_statistics";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsext_io_handle_reset_statistics(
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset statistics values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_LIBFSEXT_TRACE )
+
+/* Sets the trace callback
+ * The callback is invoked at the begin and end of inode, directory, extents and block reads
+ * Set the callback to NULL to disable tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_set_trace_callback(
+     libfsext_volume_t *volume,
+     void (*trace_callback)(
+            intptr_t *user_data,
+            int event_type,
+            int event_phase,
+            uint32_t inode_number,
+            off64_t offset,
+            size64_t size ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_set_trace_callback";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->io_handle->trace_callback  = trace_callback;
+	internal_volume->io_handle->trace_user_data = user_data;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSEXT_TRACE ) */
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsext_internal_volume_get_root_directory(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_inode_t *inode      = NULL;
+	libfsext_inode_t *safe_inode = NULL;
+	static char *function        = "libfsext_internal_volume_get_root_directory";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock->number_of_inodes < LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY )
+	{
+		return( 0 );
+	}
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     internal_volume->file_io_handle,
+	     LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %d.",
+		 function,
+		 LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY );
+
+		goto on_error;
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing inode: %d.",
+		 function,
+		 LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY );
+
+		goto on_error;
+	}
+	if( libfsext_inode_get_reference(
+	     &safe_inode,
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode reference.",
+		 function );
+
+		goto on_error;
+	}
+	/* libfsext_file_entry_initialize takes over management of inode
+	 */
+	if( libfsext_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->inode_table,
+	     LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY,
+	     safe_inode,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsext_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsext_volume_get_root_directory(
+     libfsext_volume_t *volume,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_root_directory";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsext_internal_volume_get_root_directory(
+	          internal_volume,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsext_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of file entries (inodes)
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_number_of_file_entries(
+     libfsext_volume_t *volume,
+     uint32_t *number_of_file_entries,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_number_of_file_entries";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_file_entries = internal_volume->superblock->number_of_inodes;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of block groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_number_of_block_groups(
+     libfsext_volume_t *volume,
+     uint32_t *number_of_block_groups,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_number_of_block_groups";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_block_groups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of block groups.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_block_groups = internal_volume->superblock->number_of_block_groups;
+
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the file entry of a specific inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_internal_volume_get_file_entry_by_inode(
+     libfsext_internal_volume_t *internal_volume,
+     uint32_t inode_number,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_inode_t *inode      = NULL;
+	libfsext_inode_t *safe_inode = NULL;
+	static char *function        = "libfsext_internal_volume_get_file_entry_by_inode";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     internal_volume->file_io_handle,
+	     inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	if( libfsext_inode_get_reference(
+	     &safe_inode,
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode reference.",
+		 function );
+
+		goto on_error;
+	}
+	/* libfsext_file_entry_initialize takes over management of safe_inode
+	 */
+	if( libfsext_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->inode_table,
+	     inode_number,
+	     safe_inode,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsext_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry of a specific inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_file_entry_by_inode(
+     libfsext_volume_t *volume,
+     uint32_t inode_number,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_file_entry_by_inode";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsext_internal_volume_get_file_entry_by_inode(
+	     internal_volume,
+	     inode_number,
+	     file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsext_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path from the metadata index
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsext_internal_volume_get_file_entry_from_metadata_index_by_utf8_path(
+     libfsext_internal_volume_t *internal_volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_directory_entry_t *safe_directory_entry = NULL;
+	libfsext_inode_t *inode                          = NULL;
+	libfsext_inode_t *safe_inode                     = NULL;
+	static char *function                            = "libfsext_internal_volume_get_file_entry_from_metadata_index_by_utf8_path";
+	uint32_t inode_number                            = 0;
+	int result                                       = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsext_metadata_index_get_directory_entry_by_utf8_path(
+	          internal_volume->metadata_index,
+	          utf8_string,
+	          utf8_string_length,
+	          &inode_number,
+	          &safe_directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 path from metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     internal_volume->file_io_handle,
+	     inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	if( libfsext_inode_get_reference(
+	     &safe_inode,
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode reference.",
+		 function );
+
+		goto on_error;
+	}
+	/* libfsext_file_entry_initialize takes over management of safe_inode and safe_directory_entry
+	 */
+	if( libfsext_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->inode_table,
+	     inode_number,
+	     safe_inode,
+	     safe_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsext_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	if( safe_directory_entry != NULL )
+	{
+		libfsext_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsext_internal_volume_get_file_entry_by_utf8_path(
+     libfsext_internal_volume_t *internal_volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_directory_t *directory                  = NULL;
+	libfsext_directory_entry_t *directory_entry      = NULL;
+	libfsext_directory_entry_t *safe_directory_entry = NULL;
+	libfsext_inode_t *inode                          = NULL;
+	libfsext_inode_t *safe_inode                     = NULL;
+	const uint8_t *utf8_string_segment               = NULL;
+	static char *function                            = "libfsext_internal_volume_get_file_entry_by_utf8_path";
+	libuna_unicode_character_t unicode_character     = 0;
+	size_t utf8_string_index                         = 0;
+	size_t utf8_string_segment_length                = 0;
+	uint32_t inode_number                            = 0;
+	int result                                       = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The metadata index reflects the volume without the journal and contains
+	 * the names as stored in the directory entries, hence it is not used when
+	 * the journal is overlaid or for volumes with the casefold feature, where
+	 * names are matched ignoring case. A path that is not in the metadata index
+	 * is looked up in the directories.
+	 */
+	if( ( internal_volume->metadata_index != NULL )
+	 && ( internal_volume->io_handle->journal == NULL )
+	 && ( ( internal_volume->io_handle->incompatible_features_flags & LIBFSEXT_INCOMPATIBLE_FEATURES_FLAG_CASEFOLD ) == 0 ) )
+	{
+		result = libfsext_internal_volume_get_file_entry_from_metadata_index_by_utf8_path(
+		          internal_volume,
+		          utf8_string,
+		          utf8_string_length,
+		          file_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry from metadata index.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( utf8_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSEXT_SEPARATOR )
+		{
+			utf8_string_index++;
+		}
+	}
+	inode_number = LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY;
+
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     internal_volume->file_io_handle,
+	     inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length == 1 ) )
+	{
+		result = 1;
+	}
+	else while( utf8_string_index < utf8_string_length )
+	{
+		if( directory != NULL )
+		{
+			if( libfsext_directory_free(
+			     &directory,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsext_directory_initialize(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_directory_read_file_io_handle(
+		     directory,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory from inode: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
+		utf8_string_segment_length = utf8_string_index;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBFSEXT_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf8_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+
+		if( utf8_string_segment_length == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			result = libfsext_directory_get_entry_by_utf8_name(
+			          directory,
+			          utf8_string_segment,
+			          utf8_string_segment_length,
+			          &directory_entry,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry by UTF-8 name.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsext_directory_entry_get_inode_number(
+		     directory_entry,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number from directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_inode_table_get_inode_by_number(
+		     internal_volume->inode_table,
+		     internal_volume->file_io_handle,
+		     inode_number,
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libfsext_inode_get_reference(
+		     &safe_inode,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode reference.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_directory_entry_clone(
+		     &safe_directory_entry,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( directory != NULL )
+	{
+		if( libfsext_directory_free(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		/* libfsext_file_entry_initialize takes over management of safe_inode and safe_directory_entry
+		 */
+		if( libfsext_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->inode_table,
+		     inode_number,
+		     safe_inode,
+		     safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsext_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( safe_inode != NULL )
+	{
+		libfsext_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsext_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsext_volume_get_file_entry_by_utf8_path(
+     libfsext_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_file_entry_by_utf8_path";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsext_internal_volume_get_file_entry_by_utf8_path(
+	          internal_volume,
+	          utf8_string,
+	          utf8_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsext_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsext_internal_volume_get_file_entry_by_utf16_path(
+     libfsext_internal_volume_t *internal_volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_directory_t *directory                  = NULL;
+	libfsext_directory_entry_t *directory_entry      = NULL;
+	libfsext_directory_entry_t *safe_directory_entry = NULL;
+	libfsext_inode_t *inode                          = NULL;
+	libfsext_inode_t *safe_inode                     = NULL;
+	const uint16_t *utf16_string_segment             = NULL;
+	static char *function                            = "libfsext_internal_volume_get_file_entry_by_utf16_path";
+	libuna_unicode_character_t unicode_character     = 0;
+	size_t utf16_string_index                        = 0;
+	size_t utf16_string_segment_length               = 0;
+	uint32_t inode_number                            = 0;
+	int result                                       = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSEXT_SEPARATOR )
+		{
+			utf16_string_index++;
+		}
+	}
+	inode_number = LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY;
+
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     internal_volume->file_io_handle,
+	     inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length == 1 ) )
+	{
+		result = 1;
+	}
+	else while( utf16_string_index < utf16_string_length )
+	{
+		if( directory != NULL )
+		{
+			if( libfsext_directory_free(
+			     &directory,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsext_directory_initialize(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_directory_read_file_io_handle(
+		     directory,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory from inode: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
+		utf16_string_segment_length = utf16_string_index;
+
+		while( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBFSEXT_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf16_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+
+		if( utf16_string_segment_length == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			result = libfsext_directory_get_entry_by_utf16_name(
+			          directory,
+			          utf16_string_segment,
+			          utf16_string_segment_length,
+			          &directory_entry,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry by UTF-16 name.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsext_directory_entry_get_inode_number(
+		     directory_entry,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number from directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_inode_table_get_inode_by_number(
+		     internal_volume->inode_table,
+		     internal_volume->file_io_handle,
+		     inode_number,
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libfsext_inode_get_reference(
+		     &safe_inode,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode reference.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_directory_entry_clone(
+		     &safe_directory_entry,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( directory != NULL )
+	{
+		if( libfsext_directory_free(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		/* libfsext_file_entry_initialize takes over management of safe_inode and safe_directory_entry
+		 */
+		if( libfsext_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->inode_table,
+		     inode_number,
+		     safe_inode,
+		     safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsext_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	if( safe_inode != NULL )
+	{
+		libfsext_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsext_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libfsext_volume_get_utf8_label(
+int libfsext_volume_get_file_entry_by_utf16_path(
      libfsext_volume_t *volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsext_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf8_label";
-	int result                                  = 1;
+	static char *function                       = "libfsext_volume_get_file_entry_by_utf16_path";
+	int result                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -2055,41 +5789,30 @@ int libfsext_volume_get_utf8_label(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( utf8_string == NULL )
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf8_string_size == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid UTF-8 string size value too small.",
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2097,33 +5820,32 @@ int libfsext_volume_get_utf8_label(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_volume->superblock == NULL )
-	{
-		utf8_string[ 0 ] = 0;
-	}
-	else if( libfsext_superblock_get_utf8_volume_label(
-	          internal_volume->superblock,
-	          utf8_string,
-	          utf8_string_size,
-	          error ) != 1 )
+	result = libfsext_internal_volume_get_file_entry_by_utf16_path(
+	          internal_volume,
+	          utf16_string,
+	          utf16_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 volume label string.",
+		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2131,28 +5853,80 @@ int libfsext_volume_get_utf8_label(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsext_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+
+/* Sets if the journal should be used
+ * If set, the committed transactions of the journal are overlaid on the metadata
+ * when the volume is opened. The journal itself is never modified.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_set_use_journal(
+     libfsext_volume_t *volume,
+     uint8_t use_journal,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_set_use_journal";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	if( use_journal != 0 )
+	{
+		internal_volume->use_journal = 1;
+	}
+	else
+	{
+		internal_volume->use_journal = 0;
+	}
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded label
- * The returned size includes the end of string character
+/* Sets if deleted directory entries should be recovered
+ * If set, the slack of the directory entries is scanned for the directory entries
+ * that were removed, when a directory is read
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_utf16_label_size(
+int libfsext_volume_set_recover_deleted_directory_entries(
      libfsext_volume_t *volume,
-     size_t *utf16_string_size,
+     uint8_t recover_deleted_directory_entries,
      libcerror_error_t **error )
 {
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf16_label_size";
-	size_t safe_utf16_string_size               = 1;
-	int result                                  = 1;
+	static char *function                       = "libfsext_volume_set_recover_deleted_directory_entries";
 
 	if( volume == NULL )
 	{
@@ -2167,86 +5941,50 @@ int libfsext_volume_get_utf16_label_size(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( utf16_string_size == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->superblock != NULL )
-	{
-		if( libfsext_superblock_get_utf16_volume_label_size(
-		     internal_volume->superblock,
-		     &safe_utf16_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UTF-16 volume label string size.",
-			 function );
-
-			result = -1;
-		}
-	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( recover_deleted_directory_entries != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
+		internal_volume->io_handle->recover_deleted_directory_entries = 1;
 	}
-#endif
-	if( safe_utf16_string_size < 1 )
+	else
 	{
-		safe_utf16_string_size = 1;
+		internal_volume->io_handle->recover_deleted_directory_entries = 0;
 	}
-	*utf16_string_size = safe_utf16_string_size;
-
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded label
- * The size should include the end of string character
+/* Sets if the time spent in checksum verification should be measured
+ * Measuring the time requires reading the clock for every checksum verification
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_utf16_label(
+int libfsext_volume_set_time_checksum_verification(
      libfsext_volume_t *volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint8_t time_checksum_verification,
      libcerror_error_t **error )
 {
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf16_label";
-	int result                                  = 1;
+	static char *function                       = "libfsext_volume_set_time_checksum_verification";
 
 	if( volume == NULL )
 	{
@@ -2261,35 +5999,71 @@ int libfsext_volume_get_utf16_label(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( utf16_string == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_size == 0 )
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_checksum_verification != 0 )
+	{
+		internal_volume->io_handle->time_checksum_verification = 1;
+	}
+	else
+	{
+		internal_volume->io_handle->time_checksum_verification = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of journal blocks
+ * This is the number of blocks of which the journal contains a more recent committed copy
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_get_number_of_journal_blocks(
+     libfsext_volume_t *volume,
+     int *number_of_journal_blocks,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_number_of_journal_blocks";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid UTF-16 string size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_size > (size_t) SSIZE_MAX )
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( number_of_journal_blocks == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of journal blocks.",
 		 function );
 
 		return( -1 );
@@ -2309,24 +6083,13 @@ int libfsext_volume_get_utf16_label(
 		return( -1 );
 	}
 #endif
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->journal != NULL )
 	{
-		utf16_string[ 0 ] = 0;
+		*number_of_journal_blocks = internal_volume->journal->number_of_current_block_entries;
 	}
-	else if( libfsext_superblock_get_utf16_volume_label(
-	          internal_volume->superblock,
-	          utf16_string,
-	          utf16_string_size,
-	          error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 volume label string.",
-		 function );
-
-		result = -1;
+		*number_of_journal_blocks = 0;
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -2343,24 +6106,26 @@ int libfsext_volume_get_utf16_label(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded last mount path
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the journal block entries of the block that contains a specific inode
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsext_volume_get_utf8_last_mount_path_size(
-     libfsext_volume_t *volume,
-     size_t *utf8_string_size,
+int libfsext_internal_volume_get_inode_block_entries(
+     libfsext_internal_volume_t *internal_volume,
+     uint32_t inode_number,
+     int *first_block_entry_index,
+     int *number_of_block_entries,
+     size_t *inode_data_offset,
      libcerror_error_t **error )
 {
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf8_last_mount_path_size";
-	size_t safe_utf8_string_size                = 1;
-	int result                                  = 1;
+	static char *function = "libfsext_internal_volume_get_inode_block_entries";
+	off64_t inode_offset  = 0;
+	uint64_t block_number = 0;
+	int result            = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2371,88 +6136,111 @@ int libfsext_volume_get_utf8_last_mount_path_size(
 
 		return( -1 );
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
-	if( utf8_string_size == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->io_handle->block_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume - invalid IO handle - block size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->superblock != NULL )
+	if( inode_data_offset == NULL )
 	{
-		if( libfsext_superblock_get_utf8_last_mount_path_size(
-		     internal_volume->superblock,
-		     &safe_utf8_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UTF-8 volume last mount path string size.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode data offset.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( internal_volume->journal == NULL )
+	{
+		return( 0 );
+	}
+	if( libfsext_inode_table_get_inode_offset_by_number(
+	     internal_volume->inode_table,
+	     inode_number,
+	     &inode_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
 
 		return( -1 );
 	}
-#endif
-	if( result == 1 )
+	block_number = (uint64_t) inode_offset / internal_volume->io_handle->block_size;
+
+	result = libfsext_journal_get_block_entries_by_block_number(
+	          internal_volume->journal,
+	          block_number,
+	          first_block_entry_index,
+	          number_of_block_entries,
+	          error );
+
+	if( result == -1 )
 	{
-		*utf8_string_size = safe_utf8_string_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve journal block entries of block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*inode_data_offset = (size_t) ( (uint64_t) inode_offset % internal_volume->io_handle->block_size );
 	}
 	return( result );
 }
 
-/* Retrieves the UTF-8 encoded last mount path
- * The size should include the end of string character
+/* Retrieves a specific version of an inode from the journal
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_utf8_last_mount_path(
-     libfsext_volume_t *volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+int libfsext_internal_volume_get_inode_version_by_index(
+     libfsext_internal_volume_t *internal_volume,
+     uint32_t inode_number,
+     int version_index,
+     uint32_t *transaction_sequence_number,
+     libfsext_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf8_last_mount_path";
-	int result                                  = 1;
+	libfsext_inode_t *inode                     = NULL;
+	libfsext_journal_block_entry_t *block_entry = NULL;
+	uint8_t *data                               = NULL;
+	static char *function                       = "libfsext_internal_volume_get_inode_version_by_index";
+	size_t inode_data_offset                    = 0;
+	size_t inode_data_size                      = 0;
+	ssize_t read_count                          = 0;
+	off64_t journal_offset                      = 0;
+	int first_block_entry_index                 = 0;
+	int number_of_block_entries                 = 0;
+	int result                                  = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2463,198 +6251,266 @@ int libfsext_volume_get_utf8_last_mount_path(
 
 		return( -1 );
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
-	if( utf8_string == NULL )
+	if( internal_volume->inode_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing inode table.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size == 0 )
+	if( transaction_sequence_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid UTF-8 string size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction sequence number.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->superblock == NULL )
-	{
-		utf8_string[ 0 ] = 0;
-	}
-	else if( libfsext_superblock_get_utf8_last_mount_path(
-	          internal_volume->superblock,
-	          utf8_string,
-	          utf8_string_size,
-	          error ) != 1 )
+	result = libfsext_internal_volume_get_inode_block_entries(
+	          internal_volume,
+	          inode_number,
+	          &first_block_entry_index,
+	          &number_of_block_entries,
+	          &inode_data_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 volume last mount path string.",
-		 function );
+		 "%s: unable to retrieve journal block entries of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( ( result == 0 )
+	 || ( version_index < 0 )
+	 || ( version_index >= number_of_block_entries ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid version index value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
-}
+	block_entry = &( internal_volume->journal->block_entries[ first_block_entry_index + version_index ] );
 
-/* Retrieves the size of the UTF-16 encoded last mount path
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfsext_volume_get_utf16_last_mount_path_size(
-     libfsext_volume_t *volume,
-     size_t *utf16_string_size,
-     libcerror_error_t **error )
-{
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf16_last_mount_path_size";
-	size_t safe_utf16_string_size               = 1;
-	int result                                  = 1;
+	inode_data_size = internal_volume->inode_table->inode_data_size;
 
-	if( volume == NULL )
+	if( ( inode_data_size == 0 )
+	 || ( inode_data_size > ( (size_t) internal_volume->io_handle->block_size - inode_data_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode data size value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * inode_data_size );
 
-	if( utf16_string_size == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	journal_offset = (off64_t) ( block_entry->journal_block_number * internal_volume->io_handle->block_size ) + inode_data_offset;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              internal_volume->file_io_handle,
+	              data,
+	              inode_data_size,
+	              journal_offset,
+	              error );
+
+	if( read_count != (ssize_t) inode_data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read journal copy of inode: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 inode_number,
+		 journal_offset,
+		 journal_offset );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( internal_volume->superblock != NULL )
+	/* The journal signature at the start of an escaped block was replaced by zero bytes
+	 */
+	if( ( block_entry->is_escaped != 0 )
+	 && ( inode_data_offset == 0 ) )
 	{
-		if( libfsext_superblock_get_utf16_last_mount_path_size(
-		     internal_volume->superblock,
-		     &safe_utf16_string_size,
-		     error ) != 1 )
+		if( memory_copy(
+		     data,
+		     fsext_journal_signature,
+		     4 ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UTF-16 volume last mount path string size.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy journal signature.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsext_inode_initialize(
+	     &inode,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( result == 1 )
+	inode->inode_number = inode_number;
+
+	if( libfsext_inode_read_data(
+	     inode,
+	     internal_volume->io_handle,
+	     data,
+	     inode_data_size,
+	     error ) != 1 )
 	{
-		*utf16_string_size = safe_utf16_string_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read journal copy of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
 	}
-	return( result );
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	if( libfsext_inode_read_data_reference(
+	     inode,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data reference of journal copy of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	/* libfsext_file_entry_initialize takes over management of inode
+	 */
+	if( libfsext_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->inode_table,
+	     inode_number,
+	     inode,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	*transaction_sequence_number = internal_volume->journal->first_sequence_number + block_entry->transaction_index;
+
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsext_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
 }
 
-/* Retrieves the UTF-16 encoded last mount path
- * The size should include the end of string character
+/* Retrieves the number of versions of a specific inode
+ * This is the number of committed copies of the inode that are stored in the journal,
+ * which requires the journal to be used
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_utf16_last_mount_path(
+int libfsext_volume_get_number_of_inode_versions(
      libfsext_volume_t *volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint32_t inode_number,
+     int *number_of_inode_versions,
      libcerror_error_t **error )
 {
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_utf16_last_mount_path";
-	int result                                  = 1;
+	static char *function                       = "libfsext_volume_get_number_of_inode_versions";
+	size_t inode_data_offset                    = 0;
+	int first_block_entry_index                 = 0;
+	int number_of_block_entries                 = 0;
+	int result                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -2669,35 +6525,13 @@ int libfsext_volume_get_utf16_last_mount_path(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( utf16_string == NULL )
+	if( number_of_inode_versions == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf16_string_size == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid UTF-16 string size value too small.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf16_string_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 "%s: invalid number of inode versions.",
 		 function );
 
 		return( -1 );
@@ -2717,24 +6551,27 @@ int libfsext_volume_get_utf16_last_mount_path(
 		return( -1 );
 	}
 #endif
-	if( internal_volume->superblock == NULL )
-	{
-		utf16_string[ 0 ] = 0;
-	}
-	else if( libfsext_superblock_get_utf16_last_mount_path(
-	          internal_volume->superblock,
-	          utf16_string,
-	          utf16_string_size,
-	          error ) != 1 )
+	result = libfsext_internal_volume_get_inode_block_entries(
+	          internal_volume,
+	          inode_number,
+	          &first_block_entry_index,
+	          &number_of_block_entries,
+	          &inode_data_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 volume last mount path string.",
-		 function );
-
-		result = -1;
+		 "%s: unable to retrieve journal block entries of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+	}
+	else if( result == 0 )
+	{
+		number_of_block_entries = 0;
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -2751,58 +6588,46 @@ int libfsext_volume_get_utf16_last_mount_path(
 		return( -1 );
 	}
 #endif
-	return( result );
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	*number_of_inode_versions = number_of_block_entries;
+
+	return( 1 );
 }
 
-/* Retrieves the last mount time
- * The timestamp is a signed 32-bit POSIX date and time value in number of seconds
+/* Retrieves a specific version of an inode
+ * The versions are stored in the order they were committed to the journal
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_last_mount_time(
+int libfsext_volume_get_inode_version_by_index(
      libfsext_volume_t *volume,
-     int32_t *posix_time,
-     libcerror_error_t **error )
-{
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_last_mount_time";
-
-	if( volume == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
-		 function );
-
-		return( -1 );
-	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
-	if( internal_volume->superblock == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
-		 function );
+     uint32_t inode_number,
+     int version_index,
+     uint32_t *transaction_sequence_number,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_inode_version_by_index";
+	int result                                  = 1;
 
-		return( -1 );
-	}
-	if( posix_time == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid posix time.",
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2810,16 +6635,33 @@ int libfsext_volume_get_last_mount_time(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*posix_time = (int32_t) internal_volume->superblock->last_mount_time;
+	if( libfsext_internal_volume_get_inode_version_by_index(
+	     internal_volume,
+	     inode_number,
+	     version_index,
+	     transaction_sequence_number,
+	     file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve version: %d of inode: %" PRIu32 ".",
+		 function,
+		 version_index,
+		 inode_number );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2827,26 +6669,32 @@ int libfsext_volume_get_last_mount_time(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsext_file_entry_free(
+		 file_entry,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the last written time
- * The timestamp is a signed 32-bit POSIX date and time value in number of seconds
+/* Sets the metadata index filename
+ * The metadata index is read when the volume is opened and used instead of
+ * the volume metadata when it matches the superblock of the volume
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_last_written_time(
+int libfsext_volume_set_metadata_index(
      libfsext_volume_t *volume,
-     int32_t *posix_time,
+     const char *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle            = NULL;
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_last_mount_time";
+	static char *function                       = "libfsext_volume_set_metadata_index";
 
 	if( volume == NULL )
 	{
@@ -2861,76 +6709,104 @@ int libfsext_volume_get_last_written_time(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( posix_time == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid posix time.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata index file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	*posix_time = (int32_t) internal_volume->superblock->last_written_time;
-
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to set filename in metadata index file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
+	if( internal_volume->metadata_index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->metadata_index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_volume->metadata_index_file_io_handle = file_io_handle;
+
 	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the root directory file entry
- * Returns 1 if successful, 0 if not available or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the metadata index filename
+ * The metadata index is read when the volume is opened and used instead of
+ * the volume metadata when it matches the superblock of the volume
+ * Returns 1 if successful or -1 on error
  */
-int libfsext_internal_volume_get_root_directory(
-     libfsext_internal_volume_t *internal_volume,
-     libfsext_file_entry_t **file_entry,
+int libfsext_volume_set_metadata_index_wide(
+     libfsext_volume_t *volume,
+     const wchar_t *filename,
      libcerror_error_t **error )
 {
-	libfsext_inode_t *inode      = NULL;
-	libfsext_inode_t *safe_inode = NULL;
-	static char *function        = "libfsext_internal_volume_get_root_directory";
+	libbfio_handle_t *file_io_handle            = NULL;
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_set_metadata_index_wide";
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2941,107 +6817,100 @@ int libfsext_internal_volume_get_root_directory(
 
 		return( -1 );
 	}
-	if( internal_volume->superblock == NULL )
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->superblock->number_of_inodes < LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY )
-	{
-		return( 0 );
-	}
-	if( libfsext_inode_table_get_inode_by_number(
-	     internal_volume->inode_table,
-	     internal_volume->file_io_handle,
-	     LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY,
-	     &inode,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %d.",
-		 function,
-		 LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY );
-
-		goto on_error;
-	}
-	if( inode == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing inode: %d.",
-		 function,
-		 LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsext_inode_clone(
-	     &safe_inode,
-	     inode,
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create inode.",
+		 "%s: unable to create metadata index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	/* libfsext_file_entry_initialize takes over management of inode
-	 */
-	if( libfsext_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->inode_table,
-	     LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY,
-	     safe_inode,
-	     NULL,
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in metadata index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
+	if( internal_volume->metadata_index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->metadata_index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_volume->metadata_index_file_io_handle = file_io_handle;
+
 	return( 1 );
 
 on_error:
-	if( safe_inode != NULL )
+	if( file_io_handle != NULL )
 	{
-		libfsext_inode_free(
-		 &safe_inode,
+		libbfio_handle_free(
+		 &file_io_handle,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the root directory file entry
- * Returns 1 if successful, 0 if not available or -1 on error
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Determines if the volume was opened using the metadata index
+ * Returns 1 if the metadata index is used, 0 if not or -1 on error
  */
-int libfsext_volume_get_root_directory(
+int libfsext_volume_has_metadata_index(
      libfsext_volume_t *volume,
-     libfsext_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_root_directory";
+	static char *function                       = "libfsext_volume_has_metadata_index";
 	int result                                  = 0;
 
 	if( volume == NULL )
@@ -3057,30 +6926,8 @@ int libfsext_volume_get_root_directory(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3088,30 +6935,18 @@ int libfsext_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfsext_internal_volume_get_root_directory(
-	          internal_volume,
-	          file_entry,
-	          error );
-
-	if( result == -1 )
+	if( internal_volume->metadata_index != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root directory.",
-		 function );
-
-		result = -1;
+		result = 1;
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3119,29 +6954,26 @@ int libfsext_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		libfsext_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the number of file entries (inodes)
+/* Writes the metadata index of the volume to the metadata index file
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_number_of_file_entries(
+int libfsext_volume_write_metadata_index(
      libfsext_volume_t *volume,
-     uint32_t *number_of_file_entries,
      libcerror_error_t **error )
 {
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_number_of_file_entries";
+	static char *function                       = "libfsext_volume_write_metadata_index";
+	uint8_t file_io_handle_is_open              = 0;
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -3156,30 +6988,30 @@ int libfsext_volume_get_number_of_file_entries(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 "%s: invalid volume - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_file_entries == NULL )
+	if( internal_volume->metadata_index_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of file entries.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing metadata index file IO handle.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3187,16 +7019,65 @@ int libfsext_volume_get_number_of_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*number_of_file_entries = internal_volume->superblock->number_of_inodes;
+	if( libbfio_handle_open(
+	     internal_volume->metadata_index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open metadata index file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		file_io_handle_is_open = 1;
+	}
+	if( result == 1 )
+	{
+		if( libfsext_internal_volume_write_metadata_index(
+		     internal_volume,
+		     internal_volume->metadata_index_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write metadata index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( file_io_handle_is_open != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->metadata_index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close metadata index file IO handle.",
+			 function );
 
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3204,29 +7085,39 @@ int libfsext_volume_get_number_of_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the file entry of a specific inode
- * Returns 1 if successful or -1 on error
+/* Retrieves the stat values of a specific inode from the metadata index
+ * The times are POSIX timestamps in number of nanoseconds, the creation time
+ * is 0 if not available
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsext_internal_volume_get_file_entry_by_inode(
-     libfsext_internal_volume_t *internal_volume,
+int libfsext_volume_get_metadata_index_stat(
+     libfsext_volume_t *volume,
      uint32_t inode_number,
-     libfsext_file_entry_t **file_entry,
+     uint16_t *file_mode,
+     uint16_t *number_of_links,
+     uint32_t *owner_identifier,
+     uint32_t *group_identifier,
+     uint64_t *size,
+     int64_t *access_time,
+     int64_t *modification_time,
+     int64_t *inode_change_time,
+     int64_t *creation_time,
      libcerror_error_t **error )
 {
-	libfsext_inode_t *inode      = NULL;
-	libfsext_inode_t *safe_inode = NULL;
-	static char *function        = "libfsext_internal_volume_get_file_entry_by_inode";
+	libfsext_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsext_volume_get_metadata_index_stat";
+	int result                                  = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3237,118 +7128,83 @@ int libfsext_internal_volume_get_file_entry_by_inode(
 
 		return( -1 );
 	}
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
+	internal_volume = (libfsext_internal_volume_t *) volume;
 
-		return( -1 );
-	}
-	if( *file_entry != NULL )
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsext_inode_table_get_inode_by_number(
-	     internal_volume->inode_table,
-	     internal_volume->file_io_handle,
-	     inode_number,
-	     &inode,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu32 ".",
-		 function,
-		 inode_number );
-
-		goto on_error;
-	}
-	if( inode == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing inode: %" PRIu32 ".",
-		 function,
-		 inode_number );
-
-		goto on_error;
-	}
-	if( libfsext_inode_clone(
-	     &safe_inode,
-	     inode,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create inode.",
-		 function );
+#endif
+	if( internal_volume->metadata_index != NULL )
+	{
+		result = libfsext_metadata_index_get_stat_by_inode_number(
+		          internal_volume->metadata_index,
+		          inode_number,
+		          file_mode,
+		          number_of_links,
+		          owner_identifier,
+		          group_identifier,
+		          size,
+		          access_time,
+		          modification_time,
+		          inode_change_time,
+		          creation_time,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stat values of inode: %" PRIu32 " from metadata index.",
+			 function,
+			 inode_number );
+		}
 	}
-	/* libfsext_file_entry_initialize takes over management of safe_inode
-	 */
-	if( libfsext_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->inode_table,
-	     inode_number,
-	     safe_inode,
-	     NULL,
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( safe_inode != NULL )
-	{
-		libfsext_inode_free(
-		 &safe_inode,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the file entry of a specific inode
+/* Reads the directory of a specific inode for a walk
+ * This function grabs the read/write lock since the inode table is shared with the volume
  * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_file_entry_by_inode(
-     libfsext_volume_t *volume,
+int libfsext_internal_volume_walk_read_directory(
+     libfsext_internal_volume_t *internal_volume,
      uint32_t inode_number,
-     libfsext_file_entry_t **file_entry,
+     libfsext_directory_t **directory,
      libcerror_error_t **error )
 {
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_file_entry_by_inode";
-	int result                                  = 1;
+	libfsext_inode_t *inode = NULL;
+	static char *function   = "libfsext_internal_volume_walk_read_directory";
+	int result              = 1;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3359,26 +7215,24 @@ int libfsext_volume_get_file_entry_by_inode(
 
 		return( -1 );
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
-	if( file_entry == NULL )
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( *directory != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 "%s: invalid directory value already set.",
 		 function );
 
 		return( -1 );
@@ -3398,10 +7252,11 @@ int libfsext_volume_get_file_entry_by_inode(
 		return( -1 );
 	}
 #endif
-	if( libfsext_internal_volume_get_file_entry_by_inode(
-	     internal_volume,
+	if( libfsext_inode_table_get_inode_by_number(
+	     internal_volume->inode_table,
+	     internal_volume->file_io_handle,
 	     inode_number,
-	     file_entry,
+	     &inode,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3414,6 +7269,40 @@ int libfsext_volume_get_file_entry_by_inode(
 
 		result = -1;
 	}
+	else if( libfsext_directory_initialize(
+	          directory,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsext_directory_read_file_io_handle(
+	          *directory,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          inode,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory from inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		libfsext_directory_free(
+		 directory,
+		 NULL );
+
+		result = -1;
+	}
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -3426,8 +7315,8 @@ int libfsext_volume_get_file_entry_by_inode(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		libfsext_file_entry_free(
-		 file_entry,
+		libfsext_directory_free(
+		 directory,
 		 NULL );
 
 		return( -1 );
@@ -3436,28 +7325,20 @@ int libfsext_volume_get_file_entry_by_inode(
 	return( result );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the file type of a directory entry for a walk
+ * The file type is read from the inode if the directory entry does not contain it
+ * This function grabs the read/write lock when the inode needs to be read
+ * Returns 1 if successful or -1 on error
  */
-int libfsext_internal_volume_get_file_entry_by_utf8_path(
+int libfsext_internal_volume_walk_get_file_type(
      libfsext_internal_volume_t *internal_volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsext_file_entry_t **file_entry,
+     libfsext_directory_entry_t *directory_entry,
+     uint16_t *file_type,
      libcerror_error_t **error )
-{
-	libfsext_directory_t *directory                  = NULL;
-	libfsext_directory_entry_t *directory_entry      = NULL;
-	libfsext_directory_entry_t *safe_directory_entry = NULL;
-	libfsext_inode_t *inode                          = NULL;
-	libfsext_inode_t *safe_inode                     = NULL;
-	const uint8_t *utf8_string_segment               = NULL;
-	static char *function                            = "libfsext_internal_volume_get_file_entry_by_utf8_path";
-	libuna_unicode_character_t unicode_character     = 0;
-	size_t utf8_string_index                         = 0;
-	size_t utf8_string_segment_length                = 0;
-	uint32_t inode_number                            = 0;
-	int result                                       = 0;
+{
+	libfsext_inode_t *inode = NULL;
+	static char *function   = "libfsext_internal_volume_walk_get_file_type";
+	int result              = 1;
 
 	if( internal_volume == NULL )
 	{
@@ -3470,65 +7351,80 @@ int libfsext_internal_volume_get_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( directory_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid directory entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+	if( file_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_entry == NULL )
+	switch( directory_entry->file_type )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
+		case 1:
+			*file_type = LIBFSEXT_FILE_TYPE_REGULAR_FILE;
+			return( 1 );
 
-		return( -1 );
+		case 2:
+			*file_type = LIBFSEXT_FILE_TYPE_DIRECTORY;
+			return( 1 );
+
+		case 3:
+			*file_type = LIBFSEXT_FILE_TYPE_CHARACTER_DEVICE;
+			return( 1 );
+
+		case 4:
+			*file_type = LIBFSEXT_FILE_TYPE_BLOCK_DEVICE;
+			return( 1 );
+
+		case 5:
+			*file_type = LIBFSEXT_FILE_TYPE_FIFO;
+			return( 1 );
+
+		case 6:
+			*file_type = LIBFSEXT_FILE_TYPE_SOCKET;
+			return( 1 );
+
+		case 7:
+			*file_type = LIBFSEXT_FILE_TYPE_SYMBOLIC_LINK;
+			return( 1 );
+
+		default:
+			break;
 	}
-	if( *file_entry != NULL )
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > 0 )
-	{
-		/* Ignore a leading separator
-		 */
-		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSEXT_SEPARATOR )
-		{
-			utf8_string_index++;
-		}
-	}
-	inode_number = LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY;
-
+#endif
 	if( libfsext_inode_table_get_inode_by_number(
 	     internal_volume->inode_table,
 	     internal_volume->file_io_handle,
-	     inode_number,
+	     directory_entry->inode_number,
 	     &inode,
 	     error ) != 1 )
 	{
@@ -3538,375 +7434,540 @@ int libfsext_internal_volume_get_file_entry_by_utf8_path(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve inode: %" PRIu32 ".",
 		 function,
-		 inode_number );
+		 directory_entry->inode_number );
 
-		goto on_error;
+		result = -1;
 	}
-	if( ( utf8_string_length == 0 )
-	 || ( utf8_string_length == 1 ) )
+	else
 	{
-		result = 1;
+		*file_type = inode->file_mode & 0xf000;
 	}
-	else while( utf8_string_index < utf8_string_length )
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( directory != NULL )
-		{
-			if( libfsext_directory_free(
-			     &directory,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		if( libfsext_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
+		return( -1 );
+	}
+#endif
+	return( result );
+}
 
-			goto on_error;
-		}
-		if( libfsext_directory_read_file_io_handle(
-		     directory,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu32 ".",
-			 function,
-			 inode_number );
+/* Visits an entry during a walk
+ * The pre-order callback is invoked if the file type matches the filter. If the entry is
+ * a directory that has not been visited before and is within the maximum depth, a frame
+ * is appended for it. For a depth-first walk its entries are read immediately, for
+ * a breadth-first walk the path is queued and the entries are read when the frame is
+ * removed from the queue.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_internal_volume_walk_visit_entry(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_walker_t *walker,
+     uint32_t inode_number,
+     uint16_t file_type,
+     int depth,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	libfsext_walker_frame_t *frame = NULL;
+	static char *function          = "libfsext_internal_volume_walk_visit_entry";
+	size_t path_offset             = 0;
+	int matches_filter             = 0;
+	int result                     = 1;
 
-			goto on_error;
-		}
-		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
-		utf8_string_segment_length = utf8_string_index;
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-		while( utf8_string_index < utf8_string_length )
-		{
-			if( libuna_unicode_character_copy_from_utf8(
-			     &unicode_character,
-			     utf8_string,
-			     utf8_string_length,
-			     &utf8_string_index,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-8 string to Unicode character.",
-				 function );
+		return( -1 );
+	}
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
 
-				goto on_error;
-			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBFSEXT_SEPARATOR )
-			 || ( unicode_character == 0 ) )
-			{
-				utf8_string_segment_length += 1;
+		return( -1 );
+	}
+	matches_filter = libfsext_walker_file_type_matches_filter(
+	                  walker,
+	                  file_type );
 
-				break;
-			}
-		}
-		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+	if( ( matches_filter != 0 )
+	 && ( walker->pre_order_callback != NULL ) )
+	{
+		result = walker->pre_order_callback(
+		          walker->user_data,
+		          walker->path,
+		          path_length,
+		          inode_number,
+		          file_type,
+		          depth );
 
-		if( utf8_string_segment_length == 0 )
-		{
-			result = 0;
-		}
-		else
-		{
-			result = libfsext_directory_get_entry_by_utf8_name(
-			          directory,
-			          utf8_string_segment,
-			          utf8_string_segment_length,
-			          &directory_entry,
-			          error );
-		}
 		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-8 name.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfsext_directory_entry_get_inode_number(
-		     directory_entry,
-		     &inode_number,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode number from directory entry.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsext_inode_table_get_inode_by_number(
-		     internal_volume->inode_table,
-		     internal_volume->file_io_handle,
-		     inode_number,
-		     &inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode: %" PRIu32 ".",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: pre-order callback failed for inode: %" PRIu32 ".",
 			 function,
 			 inode_number );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( result != 0 )
+	/* A pre-order callback return value of 0 indicates the sub entries should not be visited
+	 */
+	if( ( result == 0 )
+	 || ( file_type != LIBFSEXT_FILE_TYPE_DIRECTORY ) )
 	{
-		if( libfsext_inode_clone(
-		     &safe_inode,
-		     inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode.",
-			 function );
+		return( 1 );
+	}
+	if( ( walker->maximum_depth >= 0 )
+	 && ( depth >= walker->maximum_depth ) )
+	{
+		return( 1 );
+	}
+	if( ( inode_number == 0 )
+	 || ( inode_number > internal_volume->superblock->number_of_inodes ) )
+	{
+		return( 1 );
+	}
+	result = libfsext_walker_set_directory_visited(
+	          walker,
+	          inode_number,
+	          error );
 
-			goto on_error;
-		}
-		if( libfsext_directory_entry_clone(
-		     &safe_directory_entry,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry.",
-			 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark directory: %" PRIu32 " as visited.",
+		 function,
+		 inode_number );
 
-			goto on_error;
-		}
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
 	}
-	if( directory != NULL )
+	if( ( walker->walk_flags & LIBFSEXT_WALK_FLAG_BREADTH_FIRST ) != 0 )
 	{
-		if( libfsext_directory_free(
-		     &directory,
+		if( libfsext_walker_append_queued_path(
+		     walker,
+		     path_length,
+		     &path_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to queue path of directory: %" PRIu32 ".",
+			 function,
+			 inode_number );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( result != 0 )
+	if( libfsext_walker_append_frame(
+	     walker,
+	     inode_number,
+	     depth,
+	     path_length,
+	     &frame,
+	     error ) != 1 )
 	{
-		/* libfsext_file_entry_initialize takes over management of safe_inode and safe_directory_entry
-		 */
-		if( libfsext_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->inode_table,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append frame of directory: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	frame->path_offset = path_offset;
+
+	if( ( matches_filter != 0 )
+	 && ( walker->post_order_callback != NULL ) )
+	{
+		frame->invoke_post_order_callback = 1;
+	}
+	if( ( walker->walk_flags & LIBFSEXT_WALK_FLAG_BREADTH_FIRST ) == 0 )
+	{
+		if( libfsext_internal_volume_walk_read_directory(
+		     internal_volume,
 		     inode_number,
-		     safe_inode,
-		     safe_directory_entry,
+		     &( frame->directory ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory: %" PRIu32 ".",
+			 function,
+			 inode_number );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	return( result );
+		if( libfsext_walker_append_entries(
+		     walker,
+		     frame,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entries of directory: %" PRIu32 ".",
+			 function,
+			 inode_number );
 
-on_error:
-	if( safe_directory_entry != NULL )
-	{
-		libfsext_directory_entry_free(
-		 &safe_directory_entry,
-		 NULL );
-	}
-	if( safe_inode != NULL )
-	{
-		libfsext_inode_free(
-		 &safe_inode,
-		 NULL );
-	}
-	if( directory != NULL )
-	{
-		libfsext_directory_free(
-		 &directory,
-		 NULL );
+			return( -1 );
+		}
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Visits the next entry of a frame during a walk
+ * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_file_entry_by_utf8_path(
-     libfsext_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsext_file_entry_t **file_entry,
+int libfsext_internal_volume_walk_visit_next_entry(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_walker_t *walker,
+     libfsext_walker_frame_t *frame,
      libcerror_error_t **error )
 {
-	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_file_entry_by_utf8_path";
-	int result                                  = 0;
+	libfsext_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsext_internal_volume_walk_visit_next_entry";
+	size_t name_length                          = 0;
+	size_t path_length                          = 0;
+	uint32_t inode_number                       = 0;
+	uint16_t file_type                          = 0;
+	int depth                                   = 0;
+	int directory_entry_index                   = 0;
 
-	if( volume == NULL )
+	if( walker == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid walker.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsext_internal_volume_t *) volume;
-
-	if( file_entry == NULL )
+	if( frame == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid frame.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	directory_entry_index = walker->entries[ frame->entries_offset + frame->entry_index ].directory_entry_index;
+
+	frame->entry_index += 1;
+
+	if( libfsext_directory_get_entry_by_index(
+	     frame->directory,
+	     directory_entry_index,
+	     &directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry: %d.",
+		 function,
+		 directory_entry_index );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing directory entry: %d.",
+		 function,
+		 directory_entry_index );
+
+		return( -1 );
+	}
+	if( directory_entry->name_size > 0 )
+	{
+		name_length = (size_t) directory_entry->name_size - 1;
+	}
+	if( libfsext_walker_set_path(
+	     walker,
+	     frame->path_length,
+	     directory_entry->name,
+	     name_length,
+	     &path_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
+		 "%s: unable to set path of directory entry: %d.",
+		 function,
+		 directory_entry_index );
 
 		return( -1 );
 	}
-#endif
-	result = libfsext_internal_volume_get_file_entry_by_utf8_path(
-	          internal_volume,
-	          utf8_string,
-	          utf8_string_length,
-	          file_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfsext_internal_volume_walk_get_file_type(
+	     internal_volume,
+	     directory_entry,
+	     &file_type,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
-		 function );
+		 "%s: unable to retrieve file type of directory entry: %d.",
+		 function,
+		 directory_entry_index );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
+	inode_number = directory_entry->inode_number;
+	depth        = frame->depth + 1;
+
+	/* Note that frame is no longer valid after libfsext_internal_volume_walk_visit_entry
+	 */
+	if( libfsext_internal_volume_walk_visit_entry(
+	     internal_volume,
+	     walker,
+	     inode_number,
+	     file_type,
+	     depth,
+	     path_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Invokes the post-order callback of a frame if required
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_internal_volume_walk_leave_frame(
+     libfsext_walker_t *walker,
+     libfsext_walker_frame_t *frame,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_internal_volume_walk_leave_frame";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
 		 function );
 
-		libfsext_file_entry_free(
-		 file_entry,
-		 NULL );
+		return( -1 );
+	}
+	if( frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame.",
+		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	if( frame->directory != NULL )
+	{
+		if( libfsext_directory_free(
+		     &( frame->directory ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory: %" PRIu32 ".",
+			 function,
+			 frame->inode_number );
+
+			return( -1 );
+		}
+	}
+	walker->number_of_entries = frame->entries_offset;
+
+	if( frame->invoke_post_order_callback != 0 )
+	{
+		/* The sub entry paths were written after the path of the directory
+		 */
+		walker->path[ frame->path_length ] = 0;
+
+		if( walker->post_order_callback(
+		     walker->user_data,
+		     walker->path,
+		     frame->path_length,
+		     frame->inode_number,
+		     LIBFSEXT_FILE_TYPE_DIRECTORY,
+		     frame->depth ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: post-order callback failed for inode: %" PRIu32 ".",
+			 function,
+			 frame->inode_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Walks the file system hierarchy in depth-first order
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_internal_volume_walk_depth_first(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_walker_t *walker,
+     libcerror_error_t **error )
+{
+	libfsext_walker_frame_t *frame = NULL;
+	static char *function          = "libfsext_internal_volume_walk_depth_first";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	while( walker->number_of_frames > 0 )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
+		frame = &( walker->frames[ walker->number_of_frames - 1 ] );
+
+		if( frame->entry_index < frame->number_of_entries )
+		{
+			if( libfsext_internal_volume_walk_visit_next_entry(
+			     internal_volume,
+			     walker,
+			     frame,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to visit entry: %d of directory: %" PRIu32 ".",
+				 function,
+				 frame->entry_index,
+				 frame->inode_number );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( libfsext_internal_volume_walk_leave_frame(
+		     walker,
+		     frame,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to leave directory: %" PRIu32 ".",
+			 function,
+			 frame->inode_number );
+
+			return( -1 );
+		}
+		walker->number_of_frames -= 1;
+	}
+	return( 1 );
+}
+
+/* Walks the file system hierarchy in breadth-first order
+ * Returns 1 if successful or -1 on error
  */
-int libfsext_internal_volume_get_file_entry_by_utf16_path(
+int libfsext_internal_volume_walk_breadth_first(
      libfsext_internal_volume_t *internal_volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsext_file_entry_t **file_entry,
+     libfsext_walker_t *walker,
      libcerror_error_t **error )
 {
-	libfsext_directory_t *directory                  = NULL;
-	libfsext_directory_entry_t *directory_entry      = NULL;
-	libfsext_directory_entry_t *safe_directory_entry = NULL;
-	libfsext_inode_t *inode                          = NULL;
-	libfsext_inode_t *safe_inode                     = NULL;
-	const uint16_t *utf16_string_segment             = NULL;
-	static char *function                            = "libfsext_internal_volume_get_file_entry_by_utf16_path";
-	libuna_unicode_character_t unicode_character     = 0;
-	size_t utf16_string_index                        = 0;
-	size_t utf16_string_segment_length               = 0;
-	uint32_t inode_number                            = 0;
-	int result                                       = 0;
+	libfsext_walker_frame_t frame;
+	static char *function = "libfsext_internal_volume_walk_breadth_first";
+	size_t path_length    = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -3919,330 +7980,422 @@ int libfsext_internal_volume_get_file_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string length value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( file_entry == NULL )
+	if( walker == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid walker.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( memory_set(
+	     &frame,
+	     0,
+	     sizeof( libfsext_walker_frame_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frame.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > 0 )
+	while( walker->first_frame_index < walker->number_of_frames )
 	{
-		/* Ignore a leading separator
-		 */
-		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSEXT_SEPARATOR )
+		if( internal_volume->io_handle->abort != 0 )
 		{
-			utf16_string_index++;
-		}
-	}
-	inode_number = LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
 
-	if( libfsext_inode_table_get_inode_by_number(
-	     internal_volume->inode_table,
-	     internal_volume->file_io_handle,
-	     inode_number,
-	     &inode,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu32 ".",
-		 function,
-		 inode_number );
+			goto on_error;
+		}
+		/* Remove the frame from the queue since appending frames can move the queue
+		 */
+		frame = walker->frames[ walker->first_frame_index ];
 
-		goto on_error;
-	}
-	if( ( utf16_string_length == 0 )
-	 || ( utf16_string_length == 1 ) )
-	{
-		result = 1;
-	}
-	else while( utf16_string_index < utf16_string_length )
-	{
-		if( directory != NULL )
-		{
-			if( libfsext_directory_free(
-			     &directory,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
-				 function );
+		walker->first_frame_index += 1;
 
-				goto on_error;
-			}
-		}
-		if( libfsext_directory_initialize(
-		     &directory,
+		if( libfsext_walker_set_path(
+		     walker,
+		     0,
+		     &( walker->queued_paths[ frame.path_offset ] ),
+		     frame.path_length,
+		     &path_length,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path of directory: %" PRIu32 ".",
+			 function,
+			 frame.inode_number );
 
 			goto on_error;
 		}
-		if( libfsext_directory_read_file_io_handle(
-		     directory,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     inode,
+		if( libfsext_internal_volume_walk_read_directory(
+		     internal_volume,
+		     frame.inode_number,
+		     &( frame.directory ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu32 ".",
+			 "%s: unable to read directory: %" PRIu32 ".",
 			 function,
-			 inode_number );
+			 frame.inode_number );
 
 			goto on_error;
 		}
-		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
-		utf16_string_segment_length = utf16_string_index;
+		walker->number_of_entries = 0;
 
-		while( utf16_string_index < utf16_string_length )
+		if( libfsext_walker_append_entries(
+		     walker,
+		     &frame,
+		     error ) != 1 )
 		{
-			if( libuna_unicode_character_copy_from_utf16(
-			     &unicode_character,
-			     utf16_string,
-			     utf16_string_length,
-			     &utf16_string_index,
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entries of directory: %" PRIu32 ".",
+			 function,
+			 frame.inode_number );
+
+			goto on_error;
+		}
+		while( frame.entry_index < frame.number_of_entries )
+		{
+			if( libfsext_internal_volume_walk_visit_next_entry(
+			     internal_volume,
+			     walker,
+			     &frame,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-16 string to Unicode character.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to visit entry: %d of directory: %" PRIu32 ".",
+				 function,
+				 frame.entry_index,
+				 frame.inode_number );
 
 				goto on_error;
 			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBFSEXT_SEPARATOR )
-			 || ( unicode_character == 0 ) )
-			{
-				utf16_string_segment_length += 1;
-
-				break;
-			}
-		}
-		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
-
-		if( utf16_string_segment_length == 0 )
-		{
-			result = 0;
-		}
-		else
-		{
-			result = libfsext_directory_get_entry_by_utf16_name(
-			          directory,
-			          utf16_string_segment,
-			          utf16_string_segment_length,
-			          &directory_entry,
-			          error );
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-16 name.",
-			 function );
-
-			goto on_error;
 		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfsext_directory_entry_get_inode_number(
-		     directory_entry,
-		     &inode_number,
+		if( libfsext_internal_volume_walk_leave_frame(
+		     walker,
+		     &frame,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode number from directory entry.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to leave directory: %" PRIu32 ".",
+			 function,
+			 frame.inode_number );
 
 			goto on_error;
 		}
-		if( libfsext_inode_table_get_inode_by_number(
-		     internal_volume->inode_table,
-		     internal_volume->file_io_handle,
-		     inode_number,
-		     &inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode: %" PRIu32 ".",
-			 function,
-			 inode_number );
+	}
+	return( 1 );
+
+on_error:
+	if( frame.directory != NULL )
+	{
+		libfsext_directory_free(
+		 &( frame.directory ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Walks the file system hierarchy
+ * The walk starts at the root directory, which has the path "/" and depth 0
+ * The pre-order callback is invoked for every entry that matches the file type filter,
+ * before the sub entries of a directory are visited. It returns 1 to continue, 0 to skip
+ * the sub entries of a directory or -1 to stop the walk with an error
+ * The post-order callback is invoked for every directory that matches the file type filter
+ * after its sub entries have been visited. It returns 1 to continue or -1 to stop the walk
+ * with an error
+ * The path passed to the callbacks is only valid during the callback
+ * Directories that are referenced more than once are only visited once
+ * A maximum depth of -1 represents no maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_volume_walk(
+     libfsext_volume_t *volume,
+     int (*pre_order_callback)(
+            intptr_t *user_data,
+            const uint8_t *utf8_path,
+            size_t utf8_path_length,
+            uint32_t inode_number,
+            uint16_t file_type,
+            int depth ),
+     int (*post_order_callback)(
+            intptr_t *user_data,
+            const uint8_t *utf8_path,
+            size_t utf8_path_length,
+            uint32_t inode_number,
+            uint16_t file_type,
+            int depth ),
+     intptr_t *user_data,
+     int maximum_depth,
+     uint16_t file_type_filter,
+     uint8_t walk_flags,
+     libcerror_error_t **error )
+{
+	libfsext_internal_volume_t *internal_volume = NULL;
+	libfsext_walker_t *walker                   = NULL;
+	static char *function                       = "libfsext_volume_walk";
+	size_t path_length                          = 0;
+	uint32_t number_of_inodes                   = 0;
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsext_internal_volume_t *) volume;
+
+	if( ( pre_order_callback == NULL )
+	 && ( post_order_callback == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pre-order and post-order callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_depth < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum depth value less than -1.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( walk_flags & ~( LIBFSEXT_WALK_FLAG_BREADTH_FIRST | LIBFSEXT_WALK_FLAG_SORT_BY_INODE_NUMBER ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported walk flags: 0x%02" PRIx8 ".",
+		 function,
+		 walk_flags );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( result != 0 )
+#endif
+	if( internal_volume->superblock != NULL )
 	{
-		if( libfsext_inode_clone(
-		     &safe_inode,
-		     inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode.",
-			 function );
+		number_of_inodes = internal_volume->superblock->number_of_inodes;
+	}
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfsext_directory_entry_clone(
-		     &safe_directory_entry,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry.",
-			 function );
+		return( -1 );
+	}
+#endif
+	if( number_of_inodes < LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock or root directory.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( directory != NULL )
+	/* The walker is allocated once per walk and its buffers are reused for all entries
+	 */
+	if( libfsext_walker_initialize(
+	     &walker,
+	     number_of_inodes,
+	     error ) != 1 )
 	{
-		if( libfsext_directory_free(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create walker.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( result != 0 )
+	walker->pre_order_callback  = pre_order_callback;
+	walker->post_order_callback = post_order_callback;
+	walker->user_data           = user_data;
+	walker->maximum_depth       = maximum_depth;
+	walker->file_type_filter    = file_type_filter;
+	walker->walk_flags          = walk_flags;
+
+	if( libfsext_walker_set_path(
+	     walker,
+	     0,
+	     (uint8_t *) "/",
+	     1,
+	     &path_length,
+	     error ) != 1 )
 	{
-		/* libfsext_file_entry_initialize takes over management of safe_inode and safe_directory_entry
-		 */
-		if( libfsext_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->inode_table,
-		     inode_number,
-		     safe_inode,
-		     safe_directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path of root directory.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	return( result );
+	if( libfsext_internal_volume_walk_visit_entry(
+	     internal_volume,
+	     walker,
+	     LIBFSEXT_INODE_NUMBER_ROOT_DIRECTORY,
+	     LIBFSEXT_FILE_TYPE_DIRECTORY,
+	     0,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit root directory.",
+		 function );
 
-on_error:
-	if( safe_directory_entry != NULL )
+		goto on_error;
+	}
+	if( ( walk_flags & LIBFSEXT_WALK_FLAG_BREADTH_FIRST ) != 0 )
 	{
-		libfsext_directory_entry_free(
-		 &safe_directory_entry,
-		 NULL );
+		result = libfsext_internal_volume_walk_breadth_first(
+		          internal_volume,
+		          walker,
+		          error );
 	}
-	if( safe_inode != NULL )
+	else
 	{
-		libfsext_inode_free(
-		 &safe_inode,
-		 NULL );
+		result = libfsext_internal_volume_walk_depth_first(
+		          internal_volume,
+		          walker,
+		          error );
 	}
-	if( directory != NULL )
+	if( result != 1 )
 	{
-		libfsext_directory_free(
-		 &directory,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk file system hierarchy.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_walker_free(
+	     &walker,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free walker.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Scans the inode tables of a range of block groups for deleted inodes
+ * The callback is invoked for every deleted inode, with a deletion time or without links,
+ * of which the extents header or block numbers are still intact. It returns 1 to continue
+ * or -1 to stop the scan with an error
+ * The number of unallocated blocks is the number of data blocks of the inode that are
+ * not allocated according to the block bitmaps and hence were not reused
+ * The scan does not hold the volume lock while reading, so disjoint ranges of block groups
+ * can be scanned concurrently from multiple threads
+ * Returns 1 if successful or -1 on error
  */
-int libfsext_volume_get_file_entry_by_utf16_path(
+int libfsext_volume_scan_deleted_inodes(
      libfsext_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsext_file_entry_t **file_entry,
+     uint32_t first_block_group_number,
+     uint32_t number_of_block_groups,
+     int (*callback)(
+            intptr_t *user_data,
+            uint32_t inode_number,
+            uint32_t deletion_time,
+            uint64_t number_of_blocks,
+            uint64_t number_of_unallocated_blocks ),
+     intptr_t *user_data,
      libcerror_error_t **error )
 {
+	libfsext_inode_scanner_t *inode_scanner     = NULL;
 	libfsext_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsext_volume_get_file_entry_by_utf16_path";
-	int result                                  = 0;
+	libbfio_handle_t *file_io_handle            = NULL;
+	static char *function                       = "libfsext_volume_scan_deleted_inodes";
+	uint32_t block_group_number                 = 0;
+	uint32_t last_block_group_number            = 0;
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -4257,63 +8410,75 @@ int libfsext_volume_get_file_entry_by_utf16_path(
 	}
 	internal_volume = (libfsext_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid callback.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+#endif
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	result = libfsext_internal_volume_get_file_entry_by_utf16_path(
-	          internal_volume,
-	          utf16_string,
-	          utf16_string_length,
-	          file_entry,
-	          error );
+	else if( ( first_block_group_number > internal_volume->superblock->number_of_block_groups )
+	      || ( number_of_block_groups > ( internal_volume->superblock->number_of_block_groups - first_block_group_number ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block group range value out of bounds.",
+		 function );
 
-	if( result == -1 )
+		result = -1;
+	}
+	else if( libfsext_inode_scanner_initialize(
+	          &inode_scanner,
+	          internal_volume->io_handle,
+	          internal_volume->superblock,
+	          internal_volume->group_descriptors_array,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode scanner.",
 		 function );
 
 		result = -1;
 	}
+	file_io_handle = internal_volume->file_io_handle;
+
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4321,16 +8486,66 @@ int libfsext_volume_get_file_entry_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		libfsext_file_entry_free(
-		 file_entry,
-		 NULL );
-
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	return( result );
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	inode_scanner->callback  = callback;
+	inode_scanner->user_data = user_data;
+
+	last_block_group_number = first_block_group_number + number_of_block_groups;
+
+	/* The block groups are scanned in order so that the inode tables are read sequentially
+	 */
+	for( block_group_number = first_block_group_number;
+	     block_group_number < last_block_group_number;
+	     block_group_number++ )
+	{
+		if( libfsext_inode_scanner_scan_block_group(
+		     inode_scanner,
+		     file_io_handle,
+		     block_group_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan block group: %" PRIu32 ".",
+			 function,
+			 block_group_number );
+
+			goto on_error;
+		}
+	}
+	if( libfsext_inode_scanner_free(
+	     &inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode_scanner != NULL )
+	{
+		libfsext_inode_scanner_free(
+		 &inode_scanner,
+		 NULL );
+	}
+	return( -1 );
 }
 
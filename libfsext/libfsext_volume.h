@@ -25,16 +25,22 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsext_directory.h"
+#include "libfsext_directory_entry.h"
 #include "libfsext_extern.h"
 #include "libfsext_inode.h"
+#include "libfsext_inode_scanner.h"
 #include "libfsext_inode_table.h"
 #include "libfsext_io_handle.h"
+#include "libfsext_journal.h"
 #include "libfsext_libbfio.h"
 #include "libfsext_libcdata.h"
 #include "libfsext_libcerror.h"
 #include "libfsext_libcthreads.h"
+#include "libfsext_metadata_index.h"
 #include "libfsext_superblock.h"
 #include "libfsext_types.h"
+#include "libfsext_walker.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -72,6 +78,22 @@ struct libfsext_internal_volume
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The metadata index file IO handle
+	 */
+	libbfio_handle_t *metadata_index_file_io_handle;
+
+	/* The metadata index
+	 */
+	libfsext_metadata_index_t *metadata_index;
+
+	/* Value to indicate the journal should be overlaid on metadata reads
+	 */
+	uint8_t use_journal;
+
+	/* The journal
+	 */
+	libfsext_journal_t *journal;
+
 #if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -129,11 +151,31 @@ int libfsext_internal_volume_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsext_internal_volume_set_superblock(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_superblock_t *superblock,
+     libcerror_error_t **error );
+
 int libfsext_internal_volume_read_block_groups(
      libfsext_internal_volume_t *internal_volume,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsext_internal_volume_read_metadata_index(
+     libfsext_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_write_metadata_index(
+     libfsext_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_read_journal(
+     libfsext_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBFSEXT_EXTERN \
 int libfsext_volume_get_format_version(
      libfsext_volume_t *volume,
@@ -219,6 +261,35 @@ int libfsext_volume_get_last_written_time(
      int32_t *posix_time,
      libcerror_error_t **error );
 
+LIBFSEXT_EXTERN \
+int libfsext_volume_get_statistics(
+     libfsext_volume_t *volume,
+     int statistics_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_reset_statistics(
+     libfsext_volume_t *volume,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSEXT_TRACE )
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_set_trace_callback(
+     libfsext_volume_t *volume,
+     void (*trace_callback)(
+            intptr_t *user_data,
+            int event_type,
+            int event_phase,
+            uint32_t inode_number,
+            off64_t offset,
+            size64_t size ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSEXT_TRACE ) */
+
 int libfsext_internal_volume_get_root_directory(
      libfsext_internal_volume_t *internal_volume,
      libfsext_file_entry_t **file_entry,
@@ -236,6 +307,12 @@ int libfsext_volume_get_number_of_file_entries(
      uint32_t *number_of_file_entries,
      libcerror_error_t **error );
 
+LIBFSEXT_EXTERN \
+int libfsext_volume_get_number_of_block_groups(
+     libfsext_volume_t *volume,
+     uint32_t *number_of_block_groups,
+     libcerror_error_t **error );
+
 int libfsext_internal_volume_get_file_entry_by_inode(
      libfsext_internal_volume_t *internal_volume,
      uint32_t inode_number,
@@ -249,6 +326,13 @@ int libfsext_volume_get_file_entry_by_inode(
      libfsext_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsext_internal_volume_get_file_entry_from_metadata_index_by_utf8_path(
+     libfsext_internal_volume_t *internal_volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
 int libfsext_internal_volume_get_file_entry_by_utf8_path(
      libfsext_internal_volume_t *internal_volume,
      const uint8_t *utf8_string,
@@ -279,6 +363,182 @@ int libfsext_volume_get_file_entry_by_utf16_path(
      libfsext_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSEXT_EXTERN \
+int libfsext_volume_set_use_journal(
+     libfsext_volume_t *volume,
+     uint8_t use_journal,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_set_recover_deleted_directory_entries(
+     libfsext_volume_t *volume,
+     uint8_t recover_deleted_directory_entries,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_set_time_checksum_verification(
+     libfsext_volume_t *volume,
+     uint8_t time_checksum_verification,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_get_number_of_journal_blocks(
+     libfsext_volume_t *volume,
+     int *number_of_journal_blocks,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_get_inode_block_entries(
+     libfsext_internal_volume_t *internal_volume,
+     uint32_t inode_number,
+     int *first_block_entry_index,
+     int *number_of_block_entries,
+     size_t *inode_data_offset,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_get_inode_version_by_index(
+     libfsext_internal_volume_t *internal_volume,
+     uint32_t inode_number,
+     int version_index,
+     uint32_t *transaction_sequence_number,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_get_number_of_inode_versions(
+     libfsext_volume_t *volume,
+     uint32_t inode_number,
+     int *number_of_inode_versions,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_get_inode_version_by_index(
+     libfsext_volume_t *volume,
+     uint32_t inode_number,
+     int version_index,
+     uint32_t *transaction_sequence_number,
+     libfsext_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_set_metadata_index(
+     libfsext_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_set_metadata_index_wide(
+     libfsext_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_has_metadata_index(
+     libfsext_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_write_metadata_index(
+     libfsext_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_get_metadata_index_stat(
+     libfsext_volume_t *volume,
+     uint32_t inode_number,
+     uint16_t *file_mode,
+     uint16_t *number_of_links,
+     uint32_t *owner_identifier,
+     uint32_t *group_identifier,
+     uint64_t *size,
+     int64_t *access_time,
+     int64_t *modification_time,
+     int64_t *inode_change_time,
+     int64_t *creation_time,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_walk_read_directory(
+     libfsext_internal_volume_t *internal_volume,
+     uint32_t inode_number,
+     libfsext_directory_t **directory,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_walk_get_file_type(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_directory_entry_t *directory_entry,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_walk_visit_entry(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_walker_t *walker,
+     uint32_t inode_number,
+     uint16_t file_type,
+     int depth,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_walk_visit_next_entry(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_walker_t *walker,
+     libfsext_walker_frame_t *frame,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_walk_leave_frame(
+     libfsext_walker_t *walker,
+     libfsext_walker_frame_t *frame,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_walk_depth_first(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_walker_t *walker,
+     libcerror_error_t **error );
+
+int libfsext_internal_volume_walk_breadth_first(
+     libfsext_internal_volume_t *internal_volume,
+     libfsext_walker_t *walker,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_walk(
+     libfsext_volume_t *volume,
+     int (*pre_order_callback)(
+            intptr_t *user_data,
+            const uint8_t *utf8_path,
+            size_t utf8_path_length,
+            uint32_t inode_number,
+            uint16_t file_type,
+            int depth ),
+     int (*post_order_callback)(
+            intptr_t *user_data,
+            const uint8_t *utf8_path,
+            size_t utf8_path_length,
+            uint32_t inode_number,
+            uint16_t file_type,
+            int depth ),
+     intptr_t *user_data,
+     int maximum_depth,
+     uint16_t file_type_filter,
+     uint8_t walk_flags,
+     libcerror_error_t **error );
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_scan_deleted_inodes(
+     libfsext_volume_t *volume,
+     uint32_t first_block_group_number,
+     uint32_t number_of_block_groups,
+     int (*callback)(
+            intptr_t *user_data,
+            uint32_t inode_number,
+            uint32_t deletion_time,
+            uint64_t number_of_blocks,
+            uint64_t number_of_unallocated_blocks ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,913 @@
+/*
+ * Hierarchy walker functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsext_definitions.h"
+#include "libfsext_directory.h"
+#include "libfsext_directory_entry.h"
+#include "libfsext_libcerror.h"
+#include "libfsext_walker.h"
+
+#define LIBFSEXT_WALKER_INITIAL_PATH_SIZE		256
+#define LIBFSEXT_WALKER_INITIAL_NUMBER_OF_FRAMES	64
+#define LIBFSEXT_WALKER_INITIAL_NUMBER_OF_ENTRIES	1024
+
+/* Creates a walker
+ * Make sure the value walker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_walker_initialize(
+     libfsext_walker_t **walker,
+     uint32_t number_of_inodes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_walker_initialize";
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *walker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid walker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) number_of_inodes / 8 ) >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of inodes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*walker = memory_allocate_structure(
+	           libfsext_walker_t );
+
+	if( *walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create walker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *walker,
+	     0,
+	     sizeof( libfsext_walker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear walker.",
+		 function );
+
+		memory_free(
+		 *walker );
+
+		*walker = NULL;
+
+		return( -1 );
+	}
+	( *walker )->visited_directories_size = ( (size_t) number_of_inodes / 8 ) + 1;
+
+	( *walker )->visited_directories = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * ( *walker )->visited_directories_size );
+
+	if( ( *walker )->visited_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create visited directories.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *walker )->visited_directories,
+	     0,
+	     sizeof( uint8_t ) * ( *walker )->visited_directories_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear visited directories.",
+		 function );
+
+		goto on_error;
+	}
+	( *walker )->maximum_depth    = -1;
+	( *walker )->file_type_filter = LIBFSEXT_WALK_FILE_TYPE_FILTER_ALL;
+
+	return( 1 );
+
+on_error:
+	if( *walker != NULL )
+	{
+		if( ( *walker )->visited_directories != NULL )
+		{
+			memory_free(
+			 ( *walker )->visited_directories );
+		}
+		memory_free(
+		 *walker );
+
+		*walker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a walker
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_walker_free(
+     libfsext_walker_t **walker,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_walker_free";
+	int frame_index       = 0;
+	int result            = 1;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *walker != NULL )
+	{
+		if( ( *walker )->frames != NULL )
+		{
+			for( frame_index = ( *walker )->first_frame_index;
+			     frame_index < ( *walker )->number_of_frames;
+			     frame_index++ )
+			{
+				if( ( *walker )->frames[ frame_index ].directory != NULL )
+				{
+					if( libfsext_directory_free(
+					     &( ( *walker )->frames[ frame_index ].directory ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free directory of frame: %d.",
+						 function,
+						 frame_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *walker )->frames );
+		}
+		if( ( *walker )->entries != NULL )
+		{
+			memory_free(
+			 ( *walker )->entries );
+		}
+		if( ( *walker )->path != NULL )
+		{
+			memory_free(
+			 ( *walker )->path );
+		}
+		if( ( *walker )->queued_paths != NULL )
+		{
+			memory_free(
+			 ( *walker )->queued_paths );
+		}
+		if( ( *walker )->visited_directories != NULL )
+		{
+			memory_free(
+			 ( *walker )->visited_directories );
+		}
+		memory_free(
+		 *walker );
+
+		*walker = NULL;
+	}
+	return( result );
+}
+
+/* Determines if a file type matches the file type filter
+ * Returns 1 if the file type matches, 0 if not
+ */
+int libfsext_walker_file_type_matches_filter(
+     libfsext_walker_t *walker,
+     uint16_t file_type )
+{
+	if( walker == NULL )
+	{
+		return( 0 );
+	}
+	if( ( walker->file_type_filter & (uint16_t) ( 1 << ( ( file_type & 0xf000 ) >> 12 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Marks a directory as visited
+ * Returns 1 if successful, 0 if the directory was already visited or -1 on error
+ */
+int libfsext_walker_set_directory_visited(
+     libfsext_walker_t *walker,
+     uint32_t inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsext_walker_set_directory_visited";
+	size_t byte_index     = 0;
+	uint8_t bit_mask      = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( walker->visited_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid walker - missing visited directories.",
+		 function );
+
+		return( -1 );
+	}
+	byte_index = (size_t) inode_number / 8;
+	bit_mask   = (uint8_t) ( 1 << ( inode_number % 8 ) );
+
+	if( byte_index >= walker->visited_directories_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( walker->visited_directories[ byte_index ] & bit_mask ) != 0 )
+	{
+		return( 0 );
+	}
+	walker->visited_directories[ byte_index ] |= bit_mask;
+
+	return( 1 );
+}
+
+/* Sets the path to the parent path followed by a name
+ * The parent path is the first parent_path_length bytes of the current path
+ * The path is terminated by an end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_walker_set_path(
+     libfsext_walker_t *walker,
+     size_t parent_path_length,
+     const uint8_t *name,
+     size_t name_size,
+     size_t *path_length,
+     libcerror_error_t **error )
+{
+	void *reallocation      = NULL;
+	static char *function   = "libfsext_walker_set_path";
+	size_t path_size        = 0;
+	size_t safe_path_length = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_path_length > 0 )
+	 && ( parent_path_length >= walker->path_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parent path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path length.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path_length = parent_path_length;
+
+	/* Add a separator if the parent path does not end with one
+	 */
+	if( ( parent_path_length > 0 )
+	 && ( walker->path[ parent_path_length - 1 ] != (uint8_t) LIBFSEXT_SEPARATOR ) )
+	{
+		safe_path_length += 1;
+	}
+	safe_path_length += name_size;
+
+	if( ( safe_path_length + 1 ) > walker->path_size )
+	{
+		path_size = walker->path_size;
+
+		if( path_size == 0 )
+		{
+			path_size = LIBFSEXT_WALKER_INITIAL_PATH_SIZE;
+		}
+		while( path_size < ( safe_path_length + 1 ) )
+		{
+			if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid path size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			path_size *= 2;
+		}
+		reallocation = memory_reallocate(
+		                walker->path,
+		                sizeof( uint8_t ) * path_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		walker->path      = (uint8_t *) reallocation;
+		walker->path_size = path_size;
+	}
+	if( ( safe_path_length - name_size ) > parent_path_length )
+	{
+		walker->path[ parent_path_length ] = (uint8_t) LIBFSEXT_SEPARATOR;
+	}
+	if( name_size > 0 )
+	{
+		if( memory_copy(
+		     &( walker->path[ safe_path_length - name_size ] ),
+		     name,
+		     name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	walker->path[ safe_path_length ] = 0;
+
+	*path_length = safe_path_length;
+
+	return( 1 );
+}
+
+/* Appends a frame
+ * The frame is valid until the next frame is appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_walker_append_frame(
+     libfsext_walker_t *walker,
+     uint32_t inode_number,
+     int depth,
+     size_t path_length,
+     libfsext_walker_frame_t **frame,
+     libcerror_error_t **error )
+{
+	void *reallocation             = NULL;
+	static char *function          = "libfsext_walker_append_frame";
+	int frame_index                = 0;
+	int number_of_allocated_frames = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reclaim the space of frames that have been removed from the front of the queue
+	 */
+	if( ( walker->first_frame_index > 0 )
+	 && ( walker->number_of_frames >= walker->number_of_allocated_frames ) )
+	{
+		for( frame_index = walker->first_frame_index;
+		     frame_index < walker->number_of_frames;
+		     frame_index++ )
+		{
+			walker->frames[ frame_index - walker->first_frame_index ] = walker->frames[ frame_index ];
+		}
+		walker->number_of_frames -= walker->first_frame_index;
+		walker->first_frame_index = 0;
+	}
+	if( walker->number_of_frames >= walker->number_of_allocated_frames )
+	{
+		number_of_allocated_frames = walker->number_of_allocated_frames;
+
+		if( number_of_allocated_frames == 0 )
+		{
+			number_of_allocated_frames = LIBFSEXT_WALKER_INITIAL_NUMBER_OF_FRAMES;
+		}
+		else
+		{
+			if( (size_t) number_of_allocated_frames > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libfsext_walker_frame_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated frames value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_frames *= 2;
+		}
+		reallocation = memory_reallocate(
+		                walker->frames,
+		                sizeof( libfsext_walker_frame_t ) * number_of_allocated_frames );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize frames.",
+			 function );
+
+			return( -1 );
+		}
+		walker->frames                     = (libfsext_walker_frame_t *) reallocation;
+		walker->number_of_allocated_frames = number_of_allocated_frames;
+	}
+	*frame = &( walker->frames[ walker->number_of_frames ] );
+
+	if( memory_set(
+	     *frame,
+	     0,
+	     sizeof( libfsext_walker_frame_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frame.",
+		 function );
+
+		*frame = NULL;
+
+		return( -1 );
+	}
+	( *frame )->inode_number   = inode_number;
+	( *frame )->depth          = depth;
+	( *frame )->path_length    = path_length;
+	( *frame )->entries_offset = walker->number_of_entries;
+
+	walker->number_of_frames += 1;
+
+	return( 1 );
+}
+
+/* Appends the first path_length bytes of the current path to the queued paths
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_walker_append_queued_path(
+     libfsext_walker_t *walker,
+     size_t path_length,
+     size_t *path_offset,
+     libcerror_error_t **error )
+{
+	void *reallocation                 = NULL;
+	static char *function              = "libfsext_walker_append_queued_path";
+	size_t allocated_queued_paths_size = 0;
+	size_t queued_paths_offset         = 0;
+	size_t reclaimed_size              = 0;
+	int frame_index                    = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > walker->path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reclaim the space of paths of frames that have been removed from the front of the queue
+	 */
+	if( ( ( walker->queued_paths_size + path_length ) > walker->allocated_queued_paths_size )
+	 && ( walker->first_frame_index < walker->number_of_frames ) )
+	{
+		reclaimed_size = walker->frames[ walker->first_frame_index ].path_offset;
+
+		if( reclaimed_size > 0 )
+		{
+			for( queued_paths_offset = reclaimed_size;
+			     queued_paths_offset < walker->queued_paths_size;
+			     queued_paths_offset++ )
+			{
+				walker->queued_paths[ queued_paths_offset - reclaimed_size ] = walker->queued_paths[ queued_paths_offset ];
+			}
+			for( frame_index = walker->first_frame_index;
+			     frame_index < walker->number_of_frames;
+			     frame_index++ )
+			{
+				walker->frames[ frame_index ].path_offset -= reclaimed_size;
+			}
+			walker->queued_paths_size -= reclaimed_size;
+		}
+	}
+	else if( walker->first_frame_index >= walker->number_of_frames )
+	{
+		walker->queued_paths_size = 0;
+	}
+	if( ( walker->queued_paths_size + path_length ) > walker->allocated_queued_paths_size )
+	{
+		allocated_queued_paths_size = walker->allocated_queued_paths_size;
+
+		if( allocated_queued_paths_size == 0 )
+		{
+			allocated_queued_paths_size = LIBFSEXT_WALKER_INITIAL_PATH_SIZE * 16;
+		}
+		while( allocated_queued_paths_size < ( walker->queued_paths_size + path_length ) )
+		{
+			if( allocated_queued_paths_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid allocated queued paths size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			allocated_queued_paths_size *= 2;
+		}
+		reallocation = memory_reallocate(
+		                walker->queued_paths,
+		                sizeof( uint8_t ) * allocated_queued_paths_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize queued paths.",
+			 function );
+
+			return( -1 );
+		}
+		walker->queued_paths                = (uint8_t *) reallocation;
+		walker->allocated_queued_paths_size = allocated_queued_paths_size;
+	}
+	if( path_length > 0 )
+	{
+		if( memory_copy(
+		     &( walker->queued_paths[ walker->queued_paths_size ] ),
+		     walker->path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*path_offset = walker->queued_paths_size;
+
+	walker->queued_paths_size += path_length;
+
+	return( 1 );
+}
+
+/* Compares two walker entries by inode number
+ * Returns -1, 0 or 1
+ */
+int libfsext_walker_compare_entries(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libfsext_walker_entry_t *first_walker_entry  = (const libfsext_walker_entry_t *) first_entry;
+	const libfsext_walker_entry_t *second_walker_entry = (const libfsext_walker_entry_t *) second_entry;
+
+	if( first_walker_entry->inode_number < second_walker_entry->inode_number )
+	{
+		return( -1 );
+	}
+	else if( first_walker_entry->inode_number > second_walker_entry->inode_number )
+	{
+		return( 1 );
+	}
+	if( first_walker_entry->directory_entry_index < second_walker_entry->directory_entry_index )
+	{
+		return( -1 );
+	}
+	else if( first_walker_entry->directory_entry_index > second_walker_entry->directory_entry_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Appends the entries of the directory of a frame
+ * The entries are sorted by inode number if LIBFSEXT_WALK_FLAG_SORT_BY_INODE_NUMBER is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsext_walker_append_entries(
+     libfsext_walker_t *walker,
+     libfsext_walker_frame_t *frame,
+     libcerror_error_t **error )
+{
+	libfsext_directory_entry_t *directory_entry = NULL;
+	void *reallocation                          = NULL;
+	static char *function                       = "libfsext_walker_append_entries";
+	int entry_index                             = 0;
+	int number_of_allocated_entries             = 0;
+	int number_of_entries                       = 0;
+
+	if( walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_directory_get_number_of_entries(
+	     frame->directory,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries > ( (int) INT32_MAX - walker->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( walker->number_of_entries + number_of_entries ) > walker->number_of_allocated_entries )
+	{
+		number_of_allocated_entries = walker->number_of_allocated_entries;
+
+		if( number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBFSEXT_WALKER_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		while( number_of_allocated_entries < ( walker->number_of_entries + number_of_entries ) )
+		{
+			if( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libfsext_walker_entry_t ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated entries value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_entries *= 2;
+		}
+		reallocation = memory_reallocate(
+		                walker->entries,
+		                sizeof( libfsext_walker_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		walker->entries                     = (libfsext_walker_entry_t *) reallocation;
+		walker->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	frame->entries_offset    = walker->number_of_entries;
+	frame->number_of_entries = number_of_entries;
+	frame->entry_index       = 0;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfsext_directory_get_entry_by_index(
+		     frame->directory,
+		     entry_index,
+		     &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		walker->entries[ walker->number_of_entries ].inode_number          = directory_entry->inode_number;
+		walker->entries[ walker->number_of_entries ].directory_entry_index = entry_index;
+
+		walker->number_of_entries += 1;
+	}
+	if( ( ( walker->walk_flags & LIBFSEXT_WALK_FLAG_SORT_BY_INODE_NUMBER ) != 0 )
+	 && ( number_of_entries > 1 ) )
+	{
+		qsort(
+		 &( walker->entries[ frame->entries_offset ] ),
+		 (size_t) number_of_entries,
+		 sizeof( libfsext_walker_entry_t ),
+		 &libfsext_walker_compare_entries );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,242 @@
+/*
+ * Hierarchy walker functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSEXT_WALKER_H )
+#define _LIBFSEXT_WALKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsext_directory.h"
+#include "libfsext_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsext_walker_frame libfsext_walker_frame_t;
+
+struct libfsext_walker_frame
+{
+	/* The directory
+	 */
+	libfsext_directory_t *directory;
+
+	/* The inode number of the directory
+	 */
+	uint32_t inode_number;
+
+	/* The depth of the directory
+	 */
+	int depth;
+
+	/* The offset of the path in the queued paths
+	 * Only used for breadth-first walks
+	 */
+	size_t path_offset;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The offset of the first entry in the walker entries
+	 */
+	int entries_offset;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The index of the next entry to visit
+	 */
+	int entry_index;
+
+	/* Value to indicate the post-order callback should be invoked
+	 */
+	uint8_t invoke_post_order_callback;
+};
+
+typedef struct libfsext_walker_entry libfsext_walker_entry_t;
+
+struct libfsext_walker_entry
+{
+	/* The inode number
+	 */
+	uint32_t inode_number;
+
+	/* The index of the directory entry
+	 */
+	int directory_entry_index;
+};
+
+typedef struct libfsext_walker libfsext_walker_t;
+
+struct libfsext_walker
+{
+	/* The pre-order callback
+	 */
+	int (*pre_order_callback)(
+	       intptr_t *user_data,
+	       const uint8_t *utf8_path,
+	       size_t utf8_path_length,
+	       uint32_t inode_number,
+	       uint16_t file_type,
+	       int depth );
+
+	/* The post-order callback
+	 */
+	int (*post_order_callback)(
+	       intptr_t *user_data,
+	       const uint8_t *utf8_path,
+	       size_t utf8_path_length,
+	       uint32_t inode_number,
+	       uint16_t file_type,
+	       int depth );
+
+	/* The callback user data
+	 */
+	intptr_t *user_data;
+
+	/* The maximum depth, where -1 represents no maximum
+	 */
+	int maximum_depth;
+
+	/* The file type filter
+	 */
+	uint16_t file_type_filter;
+
+	/* The walk flags
+	 */
+	uint8_t walk_flags;
+
+	/* The path
+	 */
+	uint8_t *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The frames
+	 * Used as a stack for depth-first and as a queue for breadth-first walks
+	 */
+	libfsext_walker_frame_t *frames;
+
+	/* The index of the first frame
+	 */
+	int first_frame_index;
+
+	/* The number of frames
+	 */
+	int number_of_frames;
+
+	/* The number of allocated frames
+	 */
+	int number_of_allocated_frames;
+
+	/* The entries
+	 */
+	libfsext_walker_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The queued paths
+	 */
+	uint8_t *queued_paths;
+
+	/* The queued paths size
+	 */
+	size_t queued_paths_size;
+
+	/* The allocated queued paths size
+	 */
+	size_t allocated_queued_paths_size;
+
+	/* The visited directories bitmap
+	 */
+	uint8_t *visited_directories;
+
+	/* The visited directories bitmap size
+	 */
+	size_t visited_directories_size;
+};
+
+int libfsext_walker_initialize(
+     libfsext_walker_t **walker,
+     uint32_t number_of_inodes,
+     libcerror_error_t **error );
+
+int libfsext_walker_free(
+     libfsext_walker_t **walker,
+     libcerror_error_t **error );
+
+int libfsext_walker_file_type_matches_filter(
+     libfsext_walker_t *walker,
+     uint16_t file_type );
+
+int libfsext_walker_set_directory_visited(
+     libfsext_walker_t *walker,
+     uint32_t inode_number,
+     libcerror_error_t **error );
+
+int libfsext_walker_set_path(
+     libfsext_walker_t *walker,
+     size_t parent_path_length,
+     const uint8_t *name,
+     size_t name_size,
+     size_t *path_length,
+     libcerror_error_t **error );
+
+int libfsext_walker_append_frame(
+     libfsext_walker_t *walker,
+     uint32_t inode_number,
+     int depth,
+     size_t path_length,
+     libfsext_walker_frame_t **frame,
+     libcerror_error_t **error );
+
+int libfsext_walker_append_queued_path(
+     libfsext_walker_t *walker,
+     size_t path_length,
+     size_t *path_offset,
+     libcerror_error_t **error );
+
+int libfsext_walker_compare_entries(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfsext_walker_append_entries(
+     libfsext_walker_t *walker,
+     libfsext_walker_frame_t *frame,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSEXT_WALKER_H ) */
+
@@ -93,6 +93,12 @@ AC_DEFUN([AX_FSEXTTOOLS_CHECK_LOCAL],
     [AC_CHECK_FUNCS([clock_gettime getegid geteuid time])
   ])
 
+  dnl Functions included in fsexttools/bodyfile_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([open_memstream])
+  ])
+
   AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE
 ])
 
@@ -33,6 +33,7 @@
 #include "pyfsext_extended_attributes.h"
 #include "pyfsext_file_entries.h"
 #include "pyfsext_file_entry.h"
+#include "pyfsext_file_entry_records.h"
 #include "pyfsext_file_object_io_handle.h"
 #include "pyfsext_libbfio.h"
 #include "pyfsext_libcerror.h"
@@ -675,6 +676,45 @@ PyMODINIT_FUNC initpyfsext(
 	 "file_entry",
 	 (PyObject *) &pyfsext_file_entry_type_object );
 
+	/* Setup the file_entry_record type object
+	 */
+#if PY_VERSION_HEX >= 0x03040000
+	if( PyStructSequence_InitType2(
+	     &pyfsext_file_entry_record_type_object,
+	     &pyfsext_file_entry_record_description ) != 0 )
+	{
+		goto on_error;
+	}
+#else
+	PyStructSequence_InitType(
+	 &pyfsext_file_entry_record_type_object,
+	 &pyfsext_file_entry_record_description );
+#endif
+	Py_IncRef(
+	 (PyObject *) &pyfsext_file_entry_record_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "file_entry_record",
+	 (PyObject *) &pyfsext_file_entry_record_type_object );
+
+	/* Setup the file_entry_records type object
+	 */
+	pyfsext_file_entry_records_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsext_file_entry_records_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsext_file_entry_records_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "file_entry_records",
+	 (PyObject *) &pyfsext_file_entry_records_type_object );
+
 	/* Setup the volume type object
 	 */
 	pyfsext_volume_type_object.tp_new = PyType_GenericNew;
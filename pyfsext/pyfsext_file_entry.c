@@ -33,6 +33,7 @@
 #include "pyfsext_extended_attributes.h"
 #include "pyfsext_file_entries.h"
 #include "pyfsext_file_entry.h"
+#include "pyfsext_file_entry_records.h"
 #include "pyfsext_integer.h"
 #include "pyfsext_libcerror.h"
 #include "pyfsext_libfsext.h"
@@ -223,6 +224,14 @@ PyMethodDef pyfsext_file_entry_object_methods[] = {
 	  "\n"
 	  "Retrieves the sub file entry for an UTF-8 encoded name specified by the name." },
 
+	{ "scandir",
+	  (PyCFunction) pyfsext_file_entry_scandir,
+	  METH_NOARGS,
+	  "scandir() -> Object\n"
+	  "\n"
+	  "Retrieves an iterator of file entry records of the sub file entries.\n"
+	  "The records are read in batches with the GIL released." },
+
 	{ "read_buffer",
 	  (PyCFunction) pyfsext_file_entry_read_buffer,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -237,6 +246,20 @@ PyMethodDef pyfsext_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at a specific offset." },
 
+	{ "read_buffer_into",
+	  (PyCFunction) pyfsext_file_entry_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_into(buffer)-> Integer\n"
+	  "\n"
+	  "Reads data at the current offset into a writable buffer object and returns the number of bytes read." },
+
+	{ "read_buffer_at_offset_into",
+	  (PyCFunction) pyfsext_file_entry_read_buffer_at_offset_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_into(buffer, offset)-> Integer\n"
+	  "\n"
+	  "Reads data at a specific offset into a writable buffer object and returns the number of bytes read." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyfsext_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -258,6 +281,13 @@ PyMethodDef pyfsext_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at the current offset." },
 
+	{ "readinto",
+	  (PyCFunction) pyfsext_file_entry_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer)-> Integer\n"
+	  "\n"
+	  "Reads data at the current offset into a writable buffer object and returns the number of bytes read." },
+
 	{ "seek",
 	  (PyCFunction) pyfsext_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -2615,6 +2645,39 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves an iterator of file entry records of the sub file entries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_file_entry_scandir(
+           pyfsext_file_entry_t *pyfsext_file_entry,
+           PyObject *arguments PYFSEXT_ATTRIBUTE_UNUSED )
+{
+	PyObject *records_object = NULL;
+	static char *function    = "pyfsext_file_entry_scandir";
+
+	PYFSEXT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsext_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	/* The file entry remains owned by the file entry object
+	 */
+	records_object = pyfsext_file_entry_records_new(
+	                  (PyObject *) pyfsext_file_entry,
+	                  pyfsext_file_entry->file_entry,
+	                  0,
+	                  1,
+	                  0 );
+
+	return( records_object );
+}
+
 /* Reads data at the current offset into a buffer
  * Returns a Python object if successful or NULL on error
  */
@@ -3044,6 +3107,155 @@ PyObject *pyfsext_file_entry_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data at the current offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_file_entry_read_buffer_into(
+           pyfsext_file_entry_t *pyfsext_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsext_file_entry_read_buffer_into";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pyfsext_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer ) == 0 )
+	{
+		return( NULL );
+	}
+	/* The data is read directly into the buffer of the object
+	 */
+	if( buffer.len > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		read_count = libfsext_file_entry_read_buffer(
+		              pyfsext_file_entry->file_entry,
+		              (uint8_t *) buffer.buf,
+		              (size_t) buffer.len,
+		              &error );
+
+		Py_END_ALLOW_THREADS
+	}
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count == -1 )
+	{
+		pyfsext_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyfsext_integer_signed_new_from_64bit(
+	         (int64_t) read_count ) );
+}
+
+/* Reads data at a specific offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_file_entry_read_buffer_at_offset_into(
+           pyfsext_file_entry_t *pyfsext_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsext_file_entry_read_buffer_at_offset_into";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	ssize_t read_count          = 0;
+	off64_t read_offset         = 0;
+
+	if( pyfsext_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*L",
+	     keyword_list,
+	     &buffer,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyBuffer_Release(
+		 &buffer );
+
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	/* The data is read directly into the buffer of the object
+	 */
+	if( buffer.len > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		read_count = libfsext_file_entry_read_buffer_at_offset(
+		              pyfsext_file_entry->file_entry,
+		              (uint8_t *) buffer.buf,
+		              (size_t) buffer.len,
+		              read_offset,
+		              &error );
+
+		Py_END_ALLOW_THREADS
+	}
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count == -1 )
+	{
+		pyfsext_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyfsext_integer_signed_new_from_64bit(
+	         (int64_t) read_count ) );
+}
+
 /* Seeks a certain offset
  * Returns a Python object if successful or NULL on error
  */
@@ -187,6 +187,10 @@ PyObject *pyfsext_file_entry_get_sub_file_entry_by_name(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsext_file_entry_scandir(
+           pyfsext_file_entry_t *pyfsext_file_entry,
+           PyObject *arguments );
+
 PyObject *pyfsext_file_entry_read_buffer(
            pyfsext_file_entry_t *pyfsext_file_entry,
            PyObject *arguments,
@@ -197,6 +201,16 @@ PyObject *pyfsext_file_entry_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsext_file_entry_read_buffer_into(
+           pyfsext_file_entry_t *pyfsext_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsext_file_entry_read_buffer_at_offset_into(
+           pyfsext_file_entry_t *pyfsext_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsext_file_entry_seek_offset(
            pyfsext_file_entry_t *pyfsext_file_entry,
            PyObject *arguments,
@@ -0,0 +1,1361 @@
+/*
+ * Python object definition of the iterator object of file entry records
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsext_error.h"
+#include "pyfsext_file_entry_records.h"
+#include "pyfsext_integer.h"
+#include "pyfsext_libcerror.h"
+#include "pyfsext_libfsext.h"
+#include "pyfsext_python.h"
+
+PyTypeObject pyfsext_file_entry_records_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsext.file_entry_records",
+	/* tp_basicsize */
+	sizeof( pyfsext_file_entry_records_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsext_file_entry_records_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyfsext iterator object of file entry records",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyfsext_file_entry_records_iter,
+	/* tp_iternext */
+	(iternextfunc) pyfsext_file_entry_records_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsext_file_entry_records_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+PyStructSequence_Field pyfsext_file_entry_record_fields[] = {
+	{ "name",
+	  "The name" },
+	{ "path",
+	  "The path relative to the start of the walk or None if not available" },
+	{ "depth",
+	  "The depth relative to the start of the walk or None if not available" },
+	{ "inode_number",
+	  "The inode number" },
+	{ "file_mode",
+	  "The file mode" },
+	{ "size",
+	  "The size of the data" },
+	{ "number_of_links",
+	  "The number of (hard) links" },
+	{ "owner_identifier",
+	  "The owner identifier" },
+	{ "group_identifier",
+	  "The group identifier" },
+	{ "access_time",
+	  "The access date and time as a 64-bit integer containing a POSIX timestamp value in nano seconds" },
+	{ "modification_time",
+	  "The modification date and time as a 64-bit integer containing a POSIX timestamp value in nano seconds" },
+	{ "inode_change_time",
+	  "The inode change date and time as a 64-bit integer containing a POSIX timestamp value in nano seconds" },
+	{ "creation_time",
+	  "The creation date and time as a 64-bit integer containing a POSIX timestamp value in nano seconds or None if not available" },
+
+	/* Sentinel */
+	{ NULL, NULL }
+};
+
+PyStructSequence_Desc pyfsext_file_entry_record_description = {
+	/* name */
+	"pyfsext.file_entry_record",
+	/* doc */
+	"pyfsext file entry record",
+	/* fields */
+	pyfsext_file_entry_record_fields,
+	/* n_in_sequence */
+	13
+};
+
+PyTypeObject pyfsext_file_entry_record_type_object;
+
+/* Creates a new file entry records iterator object
+ * The records of the sub file entries of the root file entry are returned
+ * up to the maximum depth, where a maximum depth of 1 only returns the direct sub file entries
+ * and a maximum depth of -1 represents no maximum
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_file_entry_records_new(
+           PyObject *parent_object,
+           libfsext_file_entry_t *root_file_entry,
+           uint8_t free_root_file_entry,
+           int maximum_depth,
+           uint8_t include_path )
+{
+	pyfsext_file_entry_records_t *pyfsext_file_entry_records = NULL;
+	static char *function                                    = "pyfsext_file_entry_records_new";
+
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( maximum_depth < -1 )
+	 || ( maximum_depth == 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid maximum depth value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the file entry records values are initialized
+	 */
+	pyfsext_file_entry_records = PyObject_New(
+	                              struct pyfsext_file_entry_records,
+	                              &pyfsext_file_entry_records_type_object );
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file entry records.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsext_file_entry_records->parent_object              = parent_object;
+	pyfsext_file_entry_records->root_file_entry            = root_file_entry;
+	pyfsext_file_entry_records->free_root_file_entry       = free_root_file_entry;
+	pyfsext_file_entry_records->maximum_depth              = maximum_depth;
+	pyfsext_file_entry_records->include_path               = include_path;
+	pyfsext_file_entry_records->is_started                 = 0;
+	pyfsext_file_entry_records->frames                     = NULL;
+	pyfsext_file_entry_records->number_of_frames           = 0;
+	pyfsext_file_entry_records->number_of_allocated_frames = 0;
+	pyfsext_file_entry_records->path                       = NULL;
+	pyfsext_file_entry_records->path_size                  = 0;
+	pyfsext_file_entry_records->record_values              = NULL;
+	pyfsext_file_entry_records->number_of_record_values    = 0;
+	pyfsext_file_entry_records->record_values_index        = 0;
+	pyfsext_file_entry_records->strings_data               = NULL;
+	pyfsext_file_entry_records->strings_data_size          = 0;
+	pyfsext_file_entry_records->used_strings_data_size     = 0;
+
+	Py_IncRef(
+	 (PyObject *) pyfsext_file_entry_records->parent_object );
+
+	return( (PyObject *) pyfsext_file_entry_records );
+
+on_error:
+	if( pyfsext_file_entry_records != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsext_file_entry_records );
+	}
+	return( NULL );
+}
+
+/* Initializes a file entry records iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsext_file_entry_records_init(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records )
+{
+	static char *function = "pyfsext_file_entry_records_init";
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the file entry records values are initialized
+	 */
+	pyfsext_file_entry_records->parent_object        = NULL;
+	pyfsext_file_entry_records->root_file_entry      = NULL;
+	pyfsext_file_entry_records->free_root_file_entry = 0;
+	pyfsext_file_entry_records->frames               = NULL;
+	pyfsext_file_entry_records->number_of_frames     = 0;
+	pyfsext_file_entry_records->path                 = NULL;
+	pyfsext_file_entry_records->record_values        = NULL;
+	pyfsext_file_entry_records->strings_data         = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of file entry records not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a file entry records iterator object
+ */
+void pyfsext_file_entry_records_free(
+      pyfsext_file_entry_records_t *pyfsext_file_entry_records )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyfsext_file_entry_records_free";
+	int frame_index             = 0;
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsext_file_entry_records );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsext_file_entry_records->frames != NULL )
+	{
+		/* The file entry of the first frame is the root file entry
+		 */
+		for( frame_index = 1;
+		     frame_index < pyfsext_file_entry_records->number_of_frames;
+		     frame_index++ )
+		{
+			libfsext_file_entry_free(
+			 &( pyfsext_file_entry_records->frames[ frame_index ].file_entry ),
+			 NULL );
+		}
+		memory_free(
+		 pyfsext_file_entry_records->frames );
+	}
+	if( ( pyfsext_file_entry_records->free_root_file_entry != 0 )
+	 && ( pyfsext_file_entry_records->root_file_entry != NULL ) )
+	{
+		libfsext_file_entry_free(
+		 &( pyfsext_file_entry_records->root_file_entry ),
+		 NULL );
+	}
+	if( pyfsext_file_entry_records->path != NULL )
+	{
+		memory_free(
+		 pyfsext_file_entry_records->path );
+	}
+	if( pyfsext_file_entry_records->record_values != NULL )
+	{
+		memory_free(
+		 pyfsext_file_entry_records->record_values );
+	}
+	if( pyfsext_file_entry_records->strings_data != NULL )
+	{
+		memory_free(
+		 pyfsext_file_entry_records->strings_data );
+	}
+	if( pyfsext_file_entry_records->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsext_file_entry_records->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsext_file_entry_records );
+}
+
+/* Pushes a frame of a directory file entry onto the stack
+ * The frame takes over the file entry if successful
+ * Returns 1 if successful, 0 if the directory is already on the stack or -1 on error
+ */
+int pyfsext_file_entry_records_push_frame(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+     libfsext_file_entry_t *file_entry,
+     uint32_t inode_number,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	pyfsext_file_entry_records_frame_t *frame = NULL;
+	void *reallocation                        = NULL;
+	static char *function                     = "pyfsext_file_entry_records_push_frame";
+	size_t frames_size                        = 0;
+	int frame_index                           = 0;
+	int number_of_allocated_frames            = 0;
+	int number_of_sub_file_entries            = 0;
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return( -1 );
+	}
+	/* A directory that is also one of its own parents is not visited again
+	 * to prevent a corrupted file system from causing an endless walk
+	 */
+	for( frame_index = 0;
+	     frame_index < pyfsext_file_entry_records->number_of_frames;
+	     frame_index++ )
+	{
+		if( pyfsext_file_entry_records->frames[ frame_index ].inode_number == inode_number )
+		{
+			return( 0 );
+		}
+	}
+	if( libfsext_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries of inode: %" PRIu32 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	if( pyfsext_file_entry_records->number_of_frames >= pyfsext_file_entry_records->number_of_allocated_frames )
+	{
+		number_of_allocated_frames = pyfsext_file_entry_records->number_of_allocated_frames + 16;
+
+		frames_size = sizeof( pyfsext_file_entry_records_frame_t ) * number_of_allocated_frames;
+
+		if( frames_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid frames size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                pyfsext_file_entry_records->frames,
+		                frames_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize frames.",
+			 function );
+
+			return( -1 );
+		}
+		pyfsext_file_entry_records->frames                     = (pyfsext_file_entry_records_frame_t *) reallocation;
+		pyfsext_file_entry_records->number_of_allocated_frames = number_of_allocated_frames;
+	}
+	frame = &( pyfsext_file_entry_records->frames[ pyfsext_file_entry_records->number_of_frames ] );
+
+	frame->file_entry                 = file_entry;
+	frame->inode_number               = inode_number;
+	frame->path_length                = path_length;
+	frame->number_of_sub_file_entries = number_of_sub_file_entries;
+	frame->sub_file_entry_index       = 0;
+
+	pyfsext_file_entry_records->number_of_frames += 1;
+
+	return( 1 );
+}
+
+/* Reads the record values of a file entry
+ * The path of the file entry is appended to the strings data of the current batch
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsext_file_entry_records_read_record_values(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+     libfsext_file_entry_t *file_entry,
+     size_t parent_path_length,
+     int depth,
+     pyfsext_file_entry_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "pyfsext_file_entry_records_read_record_values";
+	size_t name_size      = 0;
+	size_t path_length    = 0;
+	size_t required_size  = 0;
+	int result            = 0;
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_utf8_name_size(
+	     file_entry,
+	     &name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - parent_path_length - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The path consists of the parent path, a separator and the name
+	 * where the name size includes the end-of-string character
+	 */
+	path_length = parent_path_length + name_size;
+
+	if( ( path_length + 1 ) > pyfsext_file_entry_records->path_size )
+	{
+		required_size = path_length + 1 + 256;
+
+		reallocation = memory_reallocate(
+		                pyfsext_file_entry_records->path,
+		                sizeof( uint8_t ) * required_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		pyfsext_file_entry_records->path      = (uint8_t *) reallocation;
+		pyfsext_file_entry_records->path_size = required_size;
+	}
+	pyfsext_file_entry_records->path[ parent_path_length ] = (uint8_t) '/';
+
+	if( libfsext_file_entry_get_utf8_name(
+	     file_entry,
+	     &( pyfsext_file_entry_records->path[ parent_path_length + 1 ] ),
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		return( -1 );
+	}
+	required_size = pyfsext_file_entry_records->used_strings_data_size + path_length;
+
+	if( required_size > pyfsext_file_entry_records->strings_data_size )
+	{
+		if( required_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid strings data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		required_size *= 2;
+
+		reallocation = memory_reallocate(
+		                pyfsext_file_entry_records->strings_data,
+		                sizeof( uint8_t ) * required_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize strings data.",
+			 function );
+
+			return( -1 );
+		}
+		pyfsext_file_entry_records->strings_data      = (uint8_t *) reallocation;
+		pyfsext_file_entry_records->strings_data_size = required_size;
+	}
+	if( memory_copy(
+	     &( pyfsext_file_entry_records->strings_data[ pyfsext_file_entry_records->used_strings_data_size ] ),
+	     pyfsext_file_entry_records->path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		return( -1 );
+	}
+	record_values->path_offset = pyfsext_file_entry_records->used_strings_data_size;
+	record_values->path_length = path_length;
+	record_values->name_offset = parent_path_length + 1;
+	record_values->depth       = depth;
+
+	pyfsext_file_entry_records->used_strings_data_size += path_length;
+
+	if( libfsext_file_entry_get_inode_number(
+	     file_entry,
+	     &( record_values->inode_number ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_file_mode(
+	     file_entry,
+	     &( record_values->file_mode ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_number_of_links(
+	     file_entry,
+	     &( record_values->number_of_links ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of (hard) links.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_owner_identifier(
+	     file_entry,
+	     &( record_values->owner_identifier ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve owner identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_group_identifier(
+	     file_entry,
+	     &( record_values->group_identifier ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_size(
+	     file_entry,
+	     &( record_values->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_access_time(
+	     file_entry,
+	     &( record_values->access_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access date and time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_modification_time(
+	     file_entry,
+	     &( record_values->modification_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification date and time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsext_file_entry_get_inode_change_time(
+	     file_entry,
+	     &( record_values->inode_change_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode change date and time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsext_file_entry_get_creation_time(
+	          file_entry,
+	          &( record_values->creation_time ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation date and time.",
+		 function );
+
+		return( -1 );
+	}
+	record_values->has_creation_time = (uint8_t) result;
+
+	return( 1 );
+}
+
+/* Reads the next batch of record values
+ * The sub file entries are visited depth-first, where the sub file entries of
+ * a directory are visited directly after the record values of the directory
+ * This function does not use the Python API hence it can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsext_file_entry_records_read_batch(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+     libcerror_error_t **error )
+{
+	pyfsext_file_entry_record_values_t *record_values = NULL;
+	pyfsext_file_entry_records_frame_t *frame         = NULL;
+	libfsext_file_entry_t *sub_file_entry             = NULL;
+	static char *function                             = "pyfsext_file_entry_records_read_batch";
+	uint32_t inode_number                             = 0;
+	int depth                                         = 0;
+	int result                                        = 0;
+	int sub_file_entry_index                          = 0;
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyfsext_file_entry_records->record_values == NULL )
+	{
+		pyfsext_file_entry_records->record_values = (pyfsext_file_entry_record_values_t *) memory_allocate(
+		                                             sizeof( pyfsext_file_entry_record_values_t ) * PYFSEXT_FILE_ENTRY_RECORDS_BATCH_SIZE );
+
+		if( pyfsext_file_entry_records->record_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	pyfsext_file_entry_records->number_of_record_values = 0;
+	pyfsext_file_entry_records->record_values_index     = 0;
+	pyfsext_file_entry_records->used_strings_data_size  = 0;
+
+	if( pyfsext_file_entry_records->is_started == 0 )
+	{
+		if( pyfsext_file_entry_records->root_file_entry != NULL )
+		{
+			if( libfsext_file_entry_get_inode_number(
+			     pyfsext_file_entry_records->root_file_entry,
+			     &inode_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve inode number of root file entry.",
+				 function );
+
+				goto on_error;
+			}
+			if( pyfsext_file_entry_records_push_frame(
+			     pyfsext_file_entry_records,
+			     pyfsext_file_entry_records->root_file_entry,
+			     inode_number,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push frame of root file entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		pyfsext_file_entry_records->is_started = 1;
+	}
+	while( ( pyfsext_file_entry_records->number_of_record_values < PYFSEXT_FILE_ENTRY_RECORDS_BATCH_SIZE )
+	    && ( pyfsext_file_entry_records->number_of_frames > 0 ) )
+	{
+		frame = &( pyfsext_file_entry_records->frames[ pyfsext_file_entry_records->number_of_frames - 1 ] );
+
+		if( frame->sub_file_entry_index >= frame->number_of_sub_file_entries )
+		{
+			/* The file entry of the first frame is the root file entry
+			 */
+			if( pyfsext_file_entry_records->number_of_frames > 1 )
+			{
+				if( libfsext_file_entry_free(
+				     &( frame->file_entry ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file entry of inode: %" PRIu32 ".",
+					 function,
+					 frame->inode_number );
+
+					goto on_error;
+				}
+			}
+			pyfsext_file_entry_records->number_of_frames -= 1;
+
+			continue;
+		}
+		sub_file_entry_index = frame->sub_file_entry_index;
+
+		frame->sub_file_entry_index += 1;
+
+		if( libfsext_file_entry_get_sub_file_entry_by_index(
+		     frame->file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d of inode: %" PRIu32 ".",
+			 function,
+			 sub_file_entry_index,
+			 frame->inode_number );
+
+			goto on_error;
+		}
+		depth = pyfsext_file_entry_records->number_of_frames;
+
+		record_values = &( pyfsext_file_entry_records->record_values[ pyfsext_file_entry_records->number_of_record_values ] );
+
+		if( pyfsext_file_entry_records_read_record_values(
+		     pyfsext_file_entry_records,
+		     sub_file_entry,
+		     frame->path_length,
+		     depth,
+		     record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read record values of sub file entry: %d of inode: %" PRIu32 ".",
+			 function,
+			 sub_file_entry_index,
+			 frame->inode_number );
+
+			goto on_error;
+		}
+		pyfsext_file_entry_records->number_of_record_values += 1;
+
+		if( ( ( record_values->file_mode & 0xf000 ) == LIBFSEXT_FILE_TYPE_DIRECTORY )
+		 && ( ( pyfsext_file_entry_records->maximum_depth == -1 )
+		  ||  ( depth < pyfsext_file_entry_records->maximum_depth ) ) )
+		{
+			result = pyfsext_file_entry_records_push_frame(
+			          pyfsext_file_entry_records,
+			          sub_file_entry,
+			          record_values->inode_number,
+			          record_values->path_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push frame of inode: %" PRIu32 ".",
+				 function,
+				 record_values->inode_number );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				sub_file_entry = NULL;
+			}
+		}
+		if( sub_file_entry != NULL )
+		{
+			if( libfsext_file_entry_free(
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a file entry record object from record values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_file_entry_records_get_record(
+           pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+           pyfsext_file_entry_record_values_t *record_values )
+{
+	PyObject *record_object = NULL;
+	PyObject *value_object  = NULL;
+	uint8_t *path           = NULL;
+	static char *function   = "pyfsext_file_entry_records_get_record";
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return( NULL );
+	}
+	if( record_values == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record values.",
+		 function );
+
+		return( NULL );
+	}
+	record_object = PyStructSequence_New(
+	                 &pyfsext_file_entry_record_type_object );
+
+	if( record_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create record object.",
+		 function );
+
+		goto on_error;
+	}
+	path = &( pyfsext_file_entry_records->strings_data[ record_values->path_offset ] );
+
+	value_object = PyUnicode_DecodeUTF8(
+	                (char *) &( path[ record_values->name_offset ] ),
+	                (Py_ssize_t) ( record_values->path_length - record_values->name_offset ),
+	                NULL );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 0,
+	 value_object );
+
+	if( pyfsext_file_entry_records->include_path == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		PyStructSequence_SET_ITEM(
+		 record_object,
+		 1,
+		 Py_None );
+
+		Py_IncRef(
+		 Py_None );
+
+		PyStructSequence_SET_ITEM(
+		 record_object,
+		 2,
+		 Py_None );
+	}
+	else
+	{
+		value_object = PyUnicode_DecodeUTF8(
+		                (char *) path,
+		                (Py_ssize_t) record_values->path_length,
+		                NULL );
+
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		PyStructSequence_SET_ITEM(
+		 record_object,
+		 1,
+		 value_object );
+
+#if PY_MAJOR_VERSION >= 3
+		value_object = PyLong_FromLong(
+		                (long) record_values->depth );
+#else
+		value_object = PyInt_FromLong(
+		                (long) record_values->depth );
+#endif
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		PyStructSequence_SET_ITEM(
+		 record_object,
+		 2,
+		 value_object );
+	}
+	value_object = pyfsext_integer_unsigned_new_from_64bit(
+	                (uint64_t) record_values->inode_number );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 3,
+	 value_object );
+
+	value_object = pyfsext_integer_unsigned_new_from_64bit(
+	                (uint64_t) record_values->file_mode );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 4,
+	 value_object );
+
+	value_object = pyfsext_integer_unsigned_new_from_64bit(
+	                (uint64_t) record_values->size );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 5,
+	 value_object );
+
+	value_object = pyfsext_integer_unsigned_new_from_64bit(
+	                (uint64_t) record_values->number_of_links );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 6,
+	 value_object );
+
+	value_object = pyfsext_integer_unsigned_new_from_64bit(
+	                (uint64_t) record_values->owner_identifier );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 7,
+	 value_object );
+
+	value_object = pyfsext_integer_unsigned_new_from_64bit(
+	                (uint64_t) record_values->group_identifier );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 8,
+	 value_object );
+
+	value_object = pyfsext_integer_signed_new_from_64bit(
+	                record_values->access_time );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 9,
+	 value_object );
+
+	value_object = pyfsext_integer_signed_new_from_64bit(
+	                record_values->modification_time );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 10,
+	 value_object );
+
+	value_object = pyfsext_integer_signed_new_from_64bit(
+	                record_values->inode_change_time );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 11,
+	 value_object );
+
+	if( record_values->has_creation_time == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	else
+	{
+		value_object = pyfsext_integer_signed_new_from_64bit(
+		                record_values->creation_time );
+
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 12,
+	 value_object );
+
+	return( record_object );
+
+on_error:
+	if( record_object != NULL )
+	{
+		Py_DecRef(
+		 record_object );
+	}
+	return( NULL );
+}
+
+/* The file entry records iter() function
+ */
+PyObject *pyfsext_file_entry_records_iter(
+           pyfsext_file_entry_records_t *pyfsext_file_entry_records )
+{
+	static char *function = "pyfsext_file_entry_records_iter";
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyfsext_file_entry_records );
+
+	return( (PyObject *) pyfsext_file_entry_records );
+}
+
+/* The file entry records iternext() function
+ * The record values are read in batches with the GIL released
+ */
+PyObject *pyfsext_file_entry_records_iternext(
+           pyfsext_file_entry_records_t *pyfsext_file_entry_records )
+{
+	PyObject *record_object  = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsext_file_entry_records_iternext";
+	int result               = 0;
+
+	if( pyfsext_file_entry_records == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry records.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsext_file_entry_records->record_values_index >= pyfsext_file_entry_records->number_of_record_values )
+	{
+		if( ( pyfsext_file_entry_records->is_started != 0 )
+		 && ( pyfsext_file_entry_records->number_of_frames == 0 ) )
+		{
+			PyErr_SetNone(
+			 PyExc_StopIteration );
+
+			return( NULL );
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = pyfsext_file_entry_records_read_batch(
+		          pyfsext_file_entry_records,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsext_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to read batch of file entry records.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( pyfsext_file_entry_records->number_of_record_values == 0 )
+		{
+			PyErr_SetNone(
+			 PyExc_StopIteration );
+
+			return( NULL );
+		}
+	}
+	record_object = pyfsext_file_entry_records_get_record(
+	                 pyfsext_file_entry_records,
+	                 &( pyfsext_file_entry_records->record_values[ pyfsext_file_entry_records->record_values_index ] ) );
+
+	if( record_object != NULL )
+	{
+		pyfsext_file_entry_records->record_values_index++;
+	}
+	return( record_object );
+}
+
@@ -0,0 +1,266 @@
+/*
+ * Python object definition of the iterator object of file entry records
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _PYFSEXT_FILE_ENTRY_RECORDS_H )
+#define _PYFSEXT_FILE_ENTRY_RECORDS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsext_libcerror.h"
+#include "pyfsext_libfsext.h"
+#include "pyfsext_python.h"
+
+#if PY_MAJOR_VERSION < 3
+#include <structseq.h>
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of file entry records that are read in a single batch
+ */
+#define PYFSEXT_FILE_ENTRY_RECORDS_BATCH_SIZE	256
+
+typedef struct pyfsext_file_entry_record_values pyfsext_file_entry_record_values_t;
+
+struct pyfsext_file_entry_record_values
+{
+	/* The offset of the path in the strings data
+	 */
+	size_t path_offset;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The offset of the name relative to the start of the path
+	 */
+	size_t name_offset;
+
+	/* The depth relative to the start of the walk
+	 */
+	int depth;
+
+	/* The inode number
+	 */
+	uint32_t inode_number;
+
+	/* The file mode
+	 */
+	uint16_t file_mode;
+
+	/* The number of links
+	 */
+	uint16_t number_of_links;
+
+	/* The owner identifier
+	 */
+	uint32_t owner_identifier;
+
+	/* The group identifier
+	 */
+	uint32_t group_identifier;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The access time
+	 */
+	int64_t access_time;
+
+	/* The modification time
+	 */
+	int64_t modification_time;
+
+	/* The inode change time
+	 */
+	int64_t inode_change_time;
+
+	/* The creation time
+	 */
+	int64_t creation_time;
+
+	/* Value to indicate the creation time is set
+	 */
+	uint8_t has_creation_time;
+};
+
+typedef struct pyfsext_file_entry_records_frame pyfsext_file_entry_records_frame_t;
+
+struct pyfsext_file_entry_records_frame
+{
+	/* The directory file entry
+	 */
+	libfsext_file_entry_t *file_entry;
+
+	/* The inode number of the directory
+	 */
+	uint32_t inode_number;
+
+	/* The length of the path of the directory
+	 */
+	size_t path_length;
+
+	/* The number of sub file entries
+	 */
+	int number_of_sub_file_entries;
+
+	/* The index of the next sub file entry
+	 */
+	int sub_file_entry_index;
+};
+
+typedef struct pyfsext_file_entry_records pyfsext_file_entry_records_t;
+
+struct pyfsext_file_entry_records
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+
+	/* The file entry of which the sub file entries are iterated
+	 */
+	libfsext_file_entry_t *root_file_entry;
+
+	/* Value to indicate the root file entry is owned by the records object
+	 */
+	uint8_t free_root_file_entry;
+
+	/* The maximum depth, where -1 represents no maximum
+	 */
+	int maximum_depth;
+
+	/* Value to indicate the path and depth should be included in the records
+	 */
+	uint8_t include_path;
+
+	/* Value to indicate the iteration has started
+	 */
+	uint8_t is_started;
+
+	/* The frames
+	 * Used as a stack of the directories that are being iterated
+	 */
+	pyfsext_file_entry_records_frame_t *frames;
+
+	/* The number of frames
+	 */
+	int number_of_frames;
+
+	/* The number of allocated frames
+	 */
+	int number_of_allocated_frames;
+
+	/* The path
+	 */
+	uint8_t *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The record values of the current batch
+	 */
+	pyfsext_file_entry_record_values_t *record_values;
+
+	/* The number of record values in the current batch
+	 */
+	int number_of_record_values;
+
+	/* The index of the next record values in the current batch
+	 */
+	int record_values_index;
+
+	/* The strings data of the current batch
+	 */
+	uint8_t *strings_data;
+
+	/* The strings data size
+	 */
+	size_t strings_data_size;
+
+	/* The used strings data size
+	 */
+	size_t used_strings_data_size;
+};
+
+extern PyTypeObject pyfsext_file_entry_records_type_object;
+
+extern PyStructSequence_Desc pyfsext_file_entry_record_description;
+
+extern PyTypeObject pyfsext_file_entry_record_type_object;
+
+PyObject *pyfsext_file_entry_records_new(
+           PyObject *parent_object,
+           libfsext_file_entry_t *root_file_entry,
+           uint8_t free_root_file_entry,
+           int maximum_depth,
+           uint8_t include_path );
+
+int pyfsext_file_entry_records_init(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records );
+
+void pyfsext_file_entry_records_free(
+      pyfsext_file_entry_records_t *pyfsext_file_entry_records );
+
+int pyfsext_file_entry_records_push_frame(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+     libfsext_file_entry_t *file_entry,
+     uint32_t inode_number,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int pyfsext_file_entry_records_read_record_values(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+     libfsext_file_entry_t *file_entry,
+     size_t parent_path_length,
+     int depth,
+     pyfsext_file_entry_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int pyfsext_file_entry_records_read_batch(
+     pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+     libcerror_error_t **error );
+
+PyObject *pyfsext_file_entry_records_get_record(
+           pyfsext_file_entry_records_t *pyfsext_file_entry_records,
+           pyfsext_file_entry_record_values_t *record_values );
+
+PyObject *pyfsext_file_entry_records_iter(
+           pyfsext_file_entry_records_t *pyfsext_file_entry_records );
+
+PyObject *pyfsext_file_entry_records_iternext(
+           pyfsext_file_entry_records_t *pyfsext_file_entry_records );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSEXT_FILE_ENTRY_RECORDS_H ) */
+
@@ -30,7 +30,9 @@
 #include "pyfsext_datetime.h"
 #include "pyfsext_error.h"
 #include "pyfsext_file_entry.h"
+#include "pyfsext_file_entry_records.h"
 #include "pyfsext_file_object_io_handle.h"
+#include "pyfsext_integer.h"
 #include "pyfsext_libbfio.h"
 #include "pyfsext_libcerror.h"
 #include "pyfsext_libfsext.h"
@@ -121,6 +123,28 @@ PyMethodDef pyfsext_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the last written time as a 32-bit integer containing a POSIX timestamp value." },
 
+	{ "get_statistics",
+	  (PyCFunction) pyfsext_volume_get_statistics,
+	  METH_NOARGS,
+	  "get_statistics() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the I/O and cache statistics." },
+
+	{ "reset_statistics",
+	  (PyCFunction) pyfsext_volume_reset_statistics,
+	  METH_NOARGS,
+	  "reset_statistics() -> None\n"
+	  "\n"
+	  "Resets the I/O and cache statistics." },
+
+	{ "set_time_checksum_verification",
+	  (PyCFunction) pyfsext_volume_set_time_checksum_verification,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_time_checksum_verification(time_checksum_verification) -> None\n"
+	  "\n"
+	  "Sets if the time spent in checksum verification should be measured.\n"
+	  "This must be set before the volume is opened." },
+
 	{ "get_number_of_file_entries",
 	  (PyCFunction) pyfsext_volume_get_number_of_file_entries,
 	  METH_NOARGS,
@@ -149,6 +173,15 @@ PyMethodDef pyfsext_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the file entry for an UTF-8 encoded path specified by the path." },
 
+	{ "walk",
+	  (PyCFunction) pyfsext_volume_walk,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "walk(maximum_depth=-1) -> Object\n"
+	  "\n"
+	  "Retrieves an iterator of file entry records of the file entries below the root directory.\n"
+	  "The file entries are walked depth-first and the records are read in batches with the GIL released.\n"
+	  "A maximum depth of -1 represents no maximum." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -1362,6 +1395,236 @@ PyObject *pyfsext_volume_get_last_written_time_as_integer(
 	return( integer_object );
 }
 
+/* Retrieves the I/O and cache statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_volume_get_statistics(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments PYFSEXT_ATTRIBUTE_UNUSED )
+{
+	static const char *statistics_value_names[] = {
+		"superblock_number_of_reads",
+		"superblock_read_size",
+		"group_descriptors_number_of_reads",
+		"group_descriptors_read_size",
+		"inode_table_number_of_reads",
+		"inode_table_read_size",
+		"directory_number_of_reads",
+		"directory_read_size",
+		"extent_index_number_of_reads",
+		"extent_index_read_size",
+		"data_number_of_reads",
+		"data_read_size",
+		"extended_attributes_number_of_reads",
+		"extended_attributes_read_size",
+		"inode_cache_hits",
+		"inode_cache_misses",
+		"block_cache_hits",
+		"block_cache_misses",
+		"number_of_checksum_verifications",
+		"checksum_verification_time",
+		NULL };
+
+	PyObject *dictionary_object = NULL;
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsext_volume_get_statistics";
+	uint64_t value_64bit        = 0;
+	int result                  = 0;
+	int statistics_value        = 0;
+
+	PYFSEXT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsext_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		return( NULL );
+	}
+	for( statistics_value = 0;
+	     statistics_value_names[ statistics_value ] != NULL;
+	     statistics_value++ )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfsext_volume_get_statistics(
+		          pyfsext_volume->volume,
+		          statistics_value,
+		          &value_64bit,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsext_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve statistics value: %d.",
+			 function,
+			 statistics_value );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		integer_object = pyfsext_integer_unsigned_new_from_64bit(
+		                  value_64bit );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PyDict_SetItemString(
+		     dictionary_object,
+		     statistics_value_names[ statistics_value ],
+		     integer_object ) != 0 )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 integer_object );
+
+		integer_object = NULL;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	Py_DecRef(
+	 dictionary_object );
+
+	return( NULL );
+}
+
+/* Resets the I/O and cache statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_volume_reset_statistics(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments PYFSEXT_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsext_volume_reset_statistics";
+	int result               = 0;
+
+	PYFSEXT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsext_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsext_volume_reset_statistics(
+	          pyfsext_volume->volume,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsext_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to reset statistics.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Sets if the time spent in checksum verification should be measured
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_volume_set_time_checksum_verification(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error       = NULL;
+	static char *function          = "pyfsext_volume_set_time_checksum_verification";
+	static char *keyword_list[]    = { "time_checksum_verification", NULL };
+	int result                     = 0;
+	int time_checksum_verification = 0;
+
+	if( pyfsext_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &time_checksum_verification ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsext_volume_set_time_checksum_verification(
+	          pyfsext_volume->volume,
+	          (uint8_t) ( time_checksum_verification != 0 ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsext_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set time checksum verification.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Retrieves the number of file entries (MFT entries)
  * Returns a Python object if successful or NULL on error
  */
@@ -1676,3 +1939,95 @@ on_error:
 	return( NULL );
 }
 
+/* Walks the file entries below the root directory
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsext_volume_walk(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *records_object              = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsext_file_entry_t *root_directory = NULL;
+	static char *function                 = "pyfsext_volume_walk";
+	static char *keyword_list[]           = { "maximum_depth", NULL };
+	int maximum_depth                     = -1;
+	int result                            = 0;
+
+	if( pyfsext_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|i",
+	     keyword_list,
+	     &maximum_depth ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( maximum_depth < -1 )
+	 || ( maximum_depth == 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid maximum depth value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsext_volume_get_root_directory(
+	          pyfsext_volume->volume,
+	          &root_directory,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsext_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve root directory file entry.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* A volume without a root directory results in an empty iterator
+	 * otherwise the records object takes over the root directory
+	 */
+	records_object = pyfsext_file_entry_records_new(
+	                  (PyObject *) pyfsext_volume,
+	                  root_directory,
+	                  1,
+	                  maximum_depth,
+	                  1 );
+
+	if( records_object == NULL )
+	{
+		goto on_error;
+	}
+	return( records_object );
+
+on_error:
+	if( root_directory != NULL )
+	{
+		libfsext_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( NULL );
+}
+
@@ -101,6 +101,19 @@ PyObject *pyfsext_volume_get_last_written_time_as_integer(
            pyfsext_volume_t *pyfsext_volume,
            PyObject *arguments );
 
+PyObject *pyfsext_volume_get_statistics(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments );
+
+PyObject *pyfsext_volume_reset_statistics(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments );
+
+PyObject *pyfsext_volume_set_time_checksum_verification(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsext_volume_get_number_of_file_entries(
            pyfsext_volume_t *pyfsext_volume,
            PyObject *arguments );
@@ -119,6 +132,11 @@ PyObject *pyfsext_volume_get_file_entry_by_path(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsext_volume_walk(
+           pyfsext_volume_t *pyfsext_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
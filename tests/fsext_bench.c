@@ -0,0 +1,1929 @@
+/*
+ * Library benchmark program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "fsext_test_functions.h"
+#include "fsext_test_getopt.h"
+#include "fsext_test_libbfio.h"
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+
+#if !defined( LIBFSEXT_HAVE_BFIO )
+
+LIBFSEXT_EXTERN \
+int libfsext_volume_open_file_io_handle(
+     libfsext_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsext_error_t **error );
+
+#endif /* !defined( LIBFSEXT_HAVE_BFIO ) */
+
+#define FSEXT_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	10
+#define FSEXT_BENCH_MAXIMUM_NUMBER_OF_PATHS		1024
+#define FSEXT_BENCH_MAXIMUM_PATH_SIZE			4096
+#define FSEXT_BENCH_NUMBER_OF_RANDOM_READS		4096
+#define FSEXT_BENCH_RANDOM_READ_SIZE			4096
+#define FSEXT_BENCH_SEQUENTIAL_READ_SIZE		65536
+
+typedef struct fsext_bench_result fsext_bench_result_t;
+
+struct fsext_bench_result
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The number of operations
+	 */
+	uint64_t number_of_operations;
+
+	/* The number of bytes
+	 */
+	uint64_t number_of_bytes;
+
+	/* The number of failed operations
+	 */
+	uint64_t number_of_failures;
+
+	/* The elapsed time in nanoseconds
+	 */
+	uint64_t elapsed_time;
+};
+
+typedef struct fsext_bench_context fsext_bench_context_t;
+
+struct fsext_bench_context
+{
+	/* The source
+	 */
+	const system_character_t *source;
+
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The volume
+	 */
+	libfsext_volume_t *volume;
+
+	/* The paths of regular files found during the hierarchy walk
+	 */
+	char *paths[ FSEXT_BENCH_MAXIMUM_NUMBER_OF_PATHS ];
+
+	/* The sizes of the regular files found during the hierarchy walk
+	 */
+	size64_t file_sizes[ FSEXT_BENCH_MAXIMUM_NUMBER_OF_PATHS ];
+
+	/* The number of paths
+	 */
+	int number_of_paths;
+
+	/* The read buffer
+	 */
+	uint8_t read_buffer[ FSEXT_BENCH_SEQUENTIAL_READ_SIZE ];
+
+	/* The pseudo random number generator state
+	 */
+	uint64_t random_state;
+
+	/* The trace stream
+	 */
+	FILE *trace_stream;
+
+	/* The time tracing started
+	 */
+	uint64_t trace_start_time;
+
+	/* The number of trace events
+	 */
+	uint64_t number_of_trace_events;
+};
+
+/* Retrieves the current time in nanoseconds of a monotonic clock
+ * Returns the current time
+ */
+uint64_t fsext_bench_get_current_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( (uint64_t) time( NULL ) * 1000000000UL );
+#endif
+}
+
+/* Retrieves the next pseudo random number
+ * Returns the pseudo random number
+ */
+uint64_t fsext_bench_get_random_number(
+          fsext_bench_context_t *bench_context )
+{
+	/* Linear congruential generator with the constants of Knuth's MMIX
+	 */
+	bench_context->random_state = ( bench_context->random_state * 6364136223846793005ULL ) + 1442695040888963407ULL;
+
+	return( bench_context->random_state >> 16 );
+}
+
+#if defined( LIBFSEXT_HAVE_TRACE )
+
+/* Writes a trace event as Chrome trace event JSON
+ * Callback for the libfsext trace events
+ */
+void fsext_bench_trace_callback(
+      intptr_t *user_data,
+      int event_type,
+      int event_phase,
+      uint32_t inode_number,
+      off64_t offset,
+      size64_t size )
+{
+	fsext_bench_context_t *bench_context = NULL;
+	const char *event_name               = NULL;
+	uint64_t timestamp                   = 0;
+
+	bench_context = (fsext_bench_context_t *) user_data;
+
+	if( ( bench_context == NULL )
+	 || ( bench_context->trace_stream == NULL ) )
+	{
+		return;
+	}
+	switch( event_type )
+	{
+		case LIBFSEXT_TRACE_EVENT_TYPE_INODE_READ:
+			event_name = "inode_read";
+			break;
+
+		case LIBFSEXT_TRACE_EVENT_TYPE_DIRECTORY_READ:
+			event_name = "directory_read";
+			break;
+
+		case LIBFSEXT_TRACE_EVENT_TYPE_EXTENTS_READ:
+			event_name = "extents_read";
+			break;
+
+		case LIBFSEXT_TRACE_EVENT_TYPE_BLOCK_READ:
+			event_name = "block_read";
+			break;
+
+		default:
+			event_name = "unknown";
+			break;
+	}
+	timestamp = fsext_bench_get_current_time() - bench_context->trace_start_time;
+
+	/* The Chrome trace event timestamps are in microseconds
+	 */
+	fprintf(
+	 bench_context->trace_stream,
+	 "%s\n    {\"name\": \"%s\", \"cat\": \"libfsext\", \"ph\": \"%c\", \"ts\": %" PRIu64 ".%03" PRIu64 ", \"pid\": 1, \"tid\": 1, "
+	 "\"args\": {\"inode_number\": %" PRIu32 ", \"offset\": %" PRIi64 ", \"size\": %" PRIu64 "}}",
+	 ( bench_context->number_of_trace_events > 0 ) ? "," : "",
+	 event_name,
+	 (char) event_phase,
+	 timestamp / 1000,
+	 timestamp % 1000,
+	 inode_number,
+	 offset,
+	 size );
+
+	bench_context->number_of_trace_events += 1;
+}
+
+#endif /* defined( LIBFSEXT_HAVE_TRACE ) */
+
+/* Opens the volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_open_volume(
+     fsext_bench_context_t *bench_context,
+     libcerror_error_t **error )
+{
+	static char *function = "fsext_bench_open_volume";
+	size_t string_length  = 0;
+
+	if( libbfio_file_range_initialize(
+	     &( bench_context->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	string_length = system_string_length(
+	                 bench_context->source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     bench_context->file_io_handle,
+	     bench_context->source,
+	     string_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     bench_context->file_io_handle,
+	     bench_context->source,
+	     string_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     bench_context->file_io_handle,
+	     bench_context->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle range.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_volume_initialize(
+	     &( bench_context->volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBFSEXT_HAVE_TRACE )
+	if( bench_context->trace_stream != NULL )
+	{
+		if( libfsext_volume_set_trace_callback(
+		     bench_context->volume,
+		     &fsext_bench_trace_callback,
+		     (intptr_t *) bench_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set trace callback.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( libfsext_volume_open_file_io_handle(
+	     bench_context->volume,
+	     bench_context->file_io_handle,
+	     LIBFSEXT_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bench_context->volume != NULL )
+	{
+		libfsext_volume_free(
+		 &( bench_context->volume ),
+		 NULL );
+	}
+	if( bench_context->file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( bench_context->file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the volume
+ * Returns 0 if successful or -1 on error
+ */
+int fsext_bench_close_volume(
+     fsext_bench_context_t *bench_context,
+     libcerror_error_t **error )
+{
+	static char *function = "fsext_bench_close_volume";
+	int result            = 0;
+
+	if( bench_context->volume != NULL )
+	{
+		if( libfsext_volume_close(
+		     bench_context->volume,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close volume.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsext_volume_free(
+		     &( bench_context->volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( bench_context->file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( bench_context->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Benchmarks opening and closing the volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_volume_open(
+     fsext_bench_context_t *bench_context,
+     int number_of_iterations,
+     fsext_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	static char *function = "fsext_bench_volume_open";
+	uint64_t start_time   = 0;
+	int iteration         = 0;
+
+	result->name = "volume_open";
+
+	start_time = fsext_bench_get_current_time();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( fsext_bench_open_volume(
+		     bench_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open volume.",
+			 function );
+
+			return( -1 );
+		}
+		if( fsext_bench_close_volume(
+		     bench_context,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close volume.",
+			 function );
+
+			return( -1 );
+		}
+		result->number_of_operations += 1;
+	}
+	result->elapsed_time = fsext_bench_get_current_time() - start_time;
+
+	return( 1 );
+}
+
+/* Benchmarks retrieving every file entry by inode number
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_inode_scan(
+     fsext_bench_context_t *bench_context,
+     fsext_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsext_file_entry_t *file_entry = NULL;
+	static char *function             = "fsext_bench_inode_scan";
+	uint64_t start_time               = 0;
+	uint32_t inode_number             = 0;
+	uint32_t number_of_file_entries   = 0;
+
+	result->name = "inode_scan";
+
+	if( libfsext_volume_get_number_of_file_entries(
+	     bench_context->volume,
+	     &number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = fsext_bench_get_current_time();
+
+	for( inode_number = 1;
+	     inode_number <= number_of_file_entries;
+	     inode_number++ )
+	{
+		if( libfsext_volume_get_file_entry_by_inode(
+		     bench_context->volume,
+		     inode_number,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			result->number_of_failures += 1;
+		}
+		else if( libfsext_file_entry_free(
+		          &file_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			return( -1 );
+		}
+		result->number_of_operations += 1;
+	}
+	result->elapsed_time = fsext_bench_get_current_time() - start_time;
+
+	return( 1 );
+}
+
+/* Walks the sub file entries of a directory
+ * The paths of regular files are collected for the path lookup and read benchmarks
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_walk_sub_file_entries(
+     fsext_bench_context_t *bench_context,
+     libfsext_file_entry_t *file_entry,
+     char *path,
+     size_t path_length,
+     fsext_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsext_file_entry_t *sub_file_entry = NULL;
+	static char *function                 = "fsext_bench_walk_sub_file_entries";
+	size64_t file_size                    = 0;
+	size_t name_size                      = 0;
+	uint16_t file_mode                    = 0;
+	int number_of_sub_file_entries        = 0;
+	int sub_file_entry_index              = 0;
+
+	if( libfsext_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libfsext_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			result->number_of_failures += 1;
+
+			continue;
+		}
+		result->number_of_operations += 1;
+
+		if( libfsext_file_entry_get_file_mode(
+		     sub_file_entry,
+		     &file_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file mode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsext_file_entry_get_utf8_name_size(
+		     sub_file_entry,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( name_size > 1 )
+		 && ( ( path_length + name_size + 1 ) <= FSEXT_BENCH_MAXIMUM_PATH_SIZE ) )
+		{
+			path[ path_length ] = '/';
+
+			if( libfsext_file_entry_get_utf8_name(
+			     sub_file_entry,
+			     (uint8_t *) &( path[ path_length + 1 ] ),
+			     name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( file_mode & 0xf000 ) == LIBFSEXT_FILE_TYPE_DIRECTORY )
+			{
+				if( fsext_bench_walk_sub_file_entries(
+				     bench_context,
+				     sub_file_entry,
+				     path,
+				     path_length + name_size,
+				     result,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to walk sub file entries.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( ( ( file_mode & 0xf000 ) == LIBFSEXT_FILE_TYPE_REGULAR_FILE )
+			      && ( bench_context->number_of_paths < FSEXT_BENCH_MAXIMUM_NUMBER_OF_PATHS ) )
+			{
+				if( libfsext_file_entry_get_size(
+				     sub_file_entry,
+				     &file_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve size.",
+					 function );
+
+					goto on_error;
+				}
+				bench_context->paths[ bench_context->number_of_paths ] = narrow_string_allocate(
+				                                                          path_length + name_size + 1 );
+
+				if( bench_context->paths[ bench_context->number_of_paths ] == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create path.",
+					 function );
+
+					goto on_error;
+				}
+				if( narrow_string_copy(
+				     bench_context->paths[ bench_context->number_of_paths ],
+				     path,
+				     path_length + name_size + 1 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy path.",
+					 function );
+
+					goto on_error;
+				}
+				bench_context->file_sizes[ bench_context->number_of_paths ] = file_size;
+
+				bench_context->number_of_paths += 1;
+			}
+			path[ path_length ] = 0;
+		}
+		if( libfsext_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks a recursive walk of the directory hierarchy
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_hierarchy_walk(
+     fsext_bench_context_t *bench_context,
+     fsext_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	char path[ FSEXT_BENCH_MAXIMUM_PATH_SIZE ];
+
+	libfsext_file_entry_t *root_directory = NULL;
+	static char *function                 = "fsext_bench_hierarchy_walk";
+	uint64_t start_time                   = 0;
+
+	result->name = "hierarchy_walk";
+
+	path[ 0 ] = 0;
+
+	start_time = fsext_bench_get_current_time();
+
+	if( libfsext_volume_get_root_directory(
+	     bench_context->volume,
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsext_bench_walk_sub_file_entries(
+	     bench_context,
+	     root_directory,
+	     path,
+	     0,
+	     result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to walk root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsext_file_entry_free(
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory.",
+		 function );
+
+		goto on_error;
+	}
+	result->elapsed_time = fsext_bench_get_current_time() - start_time;
+
+	return( 1 );
+
+on_error:
+	if( root_directory != NULL )
+	{
+		libfsext_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Looks up a file entry by path
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int fsext_bench_lookup_path(
+     fsext_bench_context_t *bench_context,
+     const char *path,
+     libcerror_error_t **error )
+{
+	libfsext_file_entry_t *file_entry = NULL;
+	static char *function             = "fsext_bench_lookup_path";
+	int result                        = 0;
+
+	result = libfsext_volume_get_file_entry_by_utf8_path(
+	          bench_context->volume,
+	          (uint8_t *) path,
+	          narrow_string_length(
+	           path ),
+	          &file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfsext_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Benchmarks path lookups
+ * A cold lookup is the first lookup after the volume was opened, a hot lookup
+ * is a repeated lookup of the same path
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_path_lookup(
+     fsext_bench_context_t *bench_context,
+     const char *path,
+     int number_of_iterations,
+     fsext_bench_result_t *cold_result,
+     fsext_bench_result_t *hot_result,
+     libcerror_error_t **error )
+{
+	static char *function = "fsext_bench_path_lookup";
+	uint64_t start_time   = 0;
+	int iteration         = 0;
+	int path_index        = 0;
+	int result            = 0;
+
+	cold_result->name = "path_lookup_cold";
+	hot_result->name  = "path_lookup_hot";
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( fsext_bench_close_volume(
+		     bench_context,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close volume.",
+			 function );
+
+			return( -1 );
+		}
+		if( fsext_bench_open_volume(
+		     bench_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open volume.",
+			 function );
+
+			return( -1 );
+		}
+		start_time = fsext_bench_get_current_time();
+
+		result = fsext_bench_lookup_path(
+		          bench_context,
+		          path,
+		          error );
+
+		cold_result->elapsed_time += fsext_bench_get_current_time() - start_time;
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			cold_result->number_of_failures += 1;
+		}
+		cold_result->number_of_operations += 1;
+	}
+	start_time = fsext_bench_get_current_time();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < bench_context->number_of_paths;
+		     path_index++ )
+		{
+			result = fsext_bench_lookup_path(
+			          bench_context,
+			          bench_context->paths[ path_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				hot_result->number_of_failures += 1;
+			}
+			hot_result->number_of_operations += 1;
+		}
+	}
+	hot_result->elapsed_time = fsext_bench_get_current_time() - start_time;
+
+	return( 1 );
+}
+
+/* Benchmarks sequential and random reads of the regular files found during the hierarchy walk
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_file_read(
+     fsext_bench_context_t *bench_context,
+     fsext_bench_result_t *sequential_result,
+     fsext_bench_result_t *random_result,
+     libcerror_error_t **error )
+{
+	libfsext_file_entry_t *file_entries[ FSEXT_BENCH_MAXIMUM_NUMBER_OF_PATHS ];
+
+	static char *function = "fsext_bench_file_read";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+	uint64_t start_time   = 0;
+	off64_t read_offset   = 0;
+	int path_index        = 0;
+	int read_index        = 0;
+	int result            = -1;
+
+	sequential_result->name = "file_read_sequential";
+	random_result->name     = "file_read_random";
+
+	if( memory_set(
+	     file_entries,
+	     0,
+	     sizeof( libfsext_file_entry_t * ) * FSEXT_BENCH_MAXIMUM_NUMBER_OF_PATHS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < bench_context->number_of_paths;
+	     path_index++ )
+	{
+		if( libfsext_volume_get_file_entry_by_utf8_path(
+		     bench_context->volume,
+		     (uint8_t *) bench_context->paths[ path_index ],
+		     narrow_string_length(
+		      bench_context->paths[ path_index ] ),
+		     &( file_entries[ path_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %s.",
+			 function,
+			 bench_context->paths[ path_index ] );
+
+			goto on_error;
+		}
+	}
+	start_time = fsext_bench_get_current_time();
+
+	for( path_index = 0;
+	     path_index < bench_context->number_of_paths;
+	     path_index++ )
+	{
+		read_offset = 0;
+
+		while( (size64_t) read_offset < bench_context->file_sizes[ path_index ] )
+		{
+			read_count = libfsext_file_entry_read_buffer_at_offset(
+			              file_entries[ path_index ],
+			              bench_context->read_buffer,
+			              FSEXT_BENCH_SEQUENTIAL_READ_SIZE,
+			              read_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file entry: %s.",
+				 function,
+				 bench_context->paths[ path_index ] );
+
+				goto on_error;
+			}
+			else if( read_count == 0 )
+			{
+				break;
+			}
+			read_offset += read_count;
+
+			sequential_result->number_of_operations += 1;
+			sequential_result->number_of_bytes      += (uint64_t) read_count;
+		}
+	}
+	sequential_result->elapsed_time = fsext_bench_get_current_time() - start_time;
+
+	if( bench_context->number_of_paths > 0 )
+	{
+		start_time = fsext_bench_get_current_time();
+
+		for( read_index = 0;
+		     read_index < FSEXT_BENCH_NUMBER_OF_RANDOM_READS;
+		     read_index++ )
+		{
+			path_index = (int) ( fsext_bench_get_random_number(
+			                      bench_context ) % (uint64_t) bench_context->number_of_paths );
+
+			file_size = bench_context->file_sizes[ path_index ];
+
+			if( file_size <= FSEXT_BENCH_RANDOM_READ_SIZE )
+			{
+				read_offset = 0;
+			}
+			else
+			{
+				read_offset = (off64_t) ( fsext_bench_get_random_number(
+				                           bench_context ) % ( file_size / FSEXT_BENCH_RANDOM_READ_SIZE ) ) * FSEXT_BENCH_RANDOM_READ_SIZE;
+			}
+			read_count = libfsext_file_entry_read_buffer_at_offset(
+			              file_entries[ path_index ],
+			              bench_context->read_buffer,
+			              FSEXT_BENCH_RANDOM_READ_SIZE,
+			              read_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file entry: %s.",
+				 function,
+				 bench_context->paths[ path_index ] );
+
+				goto on_error;
+			}
+			random_result->number_of_operations += 1;
+			random_result->number_of_bytes      += (uint64_t) read_count;
+		}
+		random_result->elapsed_time = fsext_bench_get_current_time() - start_time;
+	}
+	result = 1;
+
+on_error:
+	for( path_index = 0;
+	     path_index < bench_context->number_of_paths;
+	     path_index++ )
+	{
+		if( file_entries[ path_index ] != NULL )
+		{
+			libfsext_file_entry_free(
+			 &( file_entries[ path_index ] ),
+			 NULL );
+		}
+	}
+	return( result );
+}
+
+/* Benchmarks extended attribute enumeration of every file entry
+ * The enumeration is done per extended attribute and using the bulk retrieval
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_bench_extended_attributes(
+     fsext_bench_context_t *bench_context,
+     fsext_bench_result_t *per_attribute_result,
+     fsext_bench_result_t *bulk_result,
+     libcerror_error_t **error )
+{
+	libfsext_extended_attribute_t *extended_attribute = NULL;
+	libfsext_file_entry_t *file_entry                 = NULL;
+	uint8_t *data                                     = NULL;
+	static char *function                             = "fsext_bench_extended_attributes";
+	size_t data_size                                  = 0;
+	size_t name_size                                  = 0;
+	uint64_t start_time                               = 0;
+	uint32_t inode_number                             = 0;
+	uint32_t number_of_file_entries                   = 0;
+	int extended_attribute_index                      = 0;
+	int number_of_extended_attributes                 = 0;
+
+	per_attribute_result->name = "xattr_enumeration";
+	bulk_result->name          = "xattr_enumeration_bulk";
+
+	if( libfsext_volume_get_number_of_file_entries(
+	     bench_context->volume,
+	     &number_of_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file entries.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * FSEXT_BENCH_SEQUENTIAL_READ_SIZE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	for( inode_number = 1;
+	     inode_number <= number_of_file_entries;
+	     inode_number++ )
+	{
+		if( libfsext_volume_get_file_entry_by_inode(
+		     bench_context->volume,
+		     inode_number,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			continue;
+		}
+		start_time = fsext_bench_get_current_time();
+
+		if( libfsext_file_entry_get_number_of_extended_attributes(
+		     file_entry,
+		     &number_of_extended_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			per_attribute_result->number_of_failures += 1;
+
+			number_of_extended_attributes = 0;
+		}
+		for( extended_attribute_index = 0;
+		     extended_attribute_index < number_of_extended_attributes;
+		     extended_attribute_index++ )
+		{
+			if( libfsext_file_entry_get_extended_attribute_by_index(
+			     file_entry,
+			     extended_attribute_index,
+			     &extended_attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extended attribute: %d.",
+				 function,
+				 extended_attribute_index );
+
+				goto on_error;
+			}
+			if( libfsext_extended_attribute_get_utf8_name_size(
+			     extended_attribute,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extended attribute: %d name size.",
+				 function,
+				 extended_attribute_index );
+
+				goto on_error;
+			}
+			if( libfsext_extended_attribute_free(
+			     &extended_attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extended attribute: %d.",
+				 function,
+				 extended_attribute_index );
+
+				goto on_error;
+			}
+			per_attribute_result->number_of_operations += 1;
+			per_attribute_result->number_of_bytes      += (uint64_t) name_size;
+		}
+		per_attribute_result->elapsed_time += fsext_bench_get_current_time() - start_time;
+
+		if( libfsext_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		/* Use a new file entry for the bulk retrieval so that the extended
+		 * attributes are not already determined
+		 */
+		if( libfsext_volume_get_file_entry_by_inode(
+		     bench_context->volume,
+		     inode_number,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			continue;
+		}
+		start_time = fsext_bench_get_current_time();
+
+		if( libfsext_file_entry_get_all_extended_attributes_size(
+		     file_entry,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			bulk_result->number_of_failures += 1;
+
+			data_size = 0;
+		}
+		if( ( data_size > 0 )
+		 && ( data_size <= FSEXT_BENCH_SEQUENTIAL_READ_SIZE ) )
+		{
+			if( libfsext_file_entry_get_all_extended_attributes(
+			     file_entry,
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extended attributes data.",
+				 function );
+
+				goto on_error;
+			}
+			bulk_result->number_of_operations += 1;
+			bulk_result->number_of_bytes      += (uint64_t) data_size;
+		}
+		bulk_result->elapsed_time += fsext_bench_get_current_time() - start_time;
+
+		if( libfsext_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry: %" PRIu32 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( extended_attribute != NULL )
+	{
+		libfsext_extended_attribute_free(
+		 &extended_attribute,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsext_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Prints a JSON string value
+ */
+void fsext_bench_print_json_string(
+      FILE *stream,
+      const char *string )
+{
+	fprintf(
+	 stream,
+	 "\"" );
+
+	while( *string != 0 )
+	{
+		if( ( *string == '"' )
+		 || ( *string == '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%c",
+			 *string );
+		}
+		else if( (uint8_t) *string < 0x20 )
+		{
+			fprintf(
+			 stream,
+			 "\\u%04" PRIx8 "",
+			 (uint8_t) *string );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%c",
+			 *string );
+		}
+		string++;
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+}
+
+/* Prints the benchmark results as JSON
+ */
+void fsext_bench_print_results(
+      FILE *stream,
+      const char *source,
+      fsext_bench_result_t *results,
+      int number_of_results )
+{
+	double elapsed_seconds = 0.0;
+	int result_index       = 0;
+
+	fprintf(
+	 stream,
+	 "{\n  \"source\": " );
+
+	fsext_bench_print_json_string(
+	 stream,
+	 source );
+
+	fprintf(
+	 stream,
+	 ",\n  \"benchmarks\": [\n" );
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		elapsed_seconds = (double) results[ result_index ].elapsed_time / 1000000000.0;
+
+		fprintf(
+		 stream,
+		 "    {\"name\": \"%s\", \"operations\": %" PRIu64 ", \"failures\": %" PRIu64 ", \"bytes\": %" PRIu64 ", \"elapsed_ns\": %" PRIu64 "",
+		 results[ result_index ].name,
+		 results[ result_index ].number_of_operations,
+		 results[ result_index ].number_of_failures,
+		 results[ result_index ].number_of_bytes,
+		 results[ result_index ].elapsed_time );
+
+		if( results[ result_index ].elapsed_time > 0 )
+		{
+			fprintf(
+			 stream,
+			 ", \"operations_per_second\": %.2f, \"bytes_per_second\": %.2f",
+			 (double) results[ result_index ].number_of_operations / elapsed_seconds,
+			 (double) results[ result_index ].number_of_bytes / elapsed_seconds );
+		}
+		if( results[ result_index ].number_of_operations > 0 )
+		{
+			fprintf(
+			 stream,
+			 ", \"mean_latency_ns\": %" PRIu64 "",
+			 results[ result_index ].elapsed_time / results[ result_index ].number_of_operations );
+		}
+		fprintf(
+		 stream,
+		 "}%s\n",
+		 ( result_index + 1 < number_of_results ) ? "," : "" );
+	}
+	fprintf(
+	 stream,
+	 "  ]\n}\n" );
+}
+
+/* Prints usage information
+ */
+void fsext_bench_usage_fprint(
+      FILE *stream )
+{
+	fprintf(
+	 stream,
+	 "Use fsext_bench to benchmark the core volume operations of libfsext.\n\n" );
+
+	fprintf(
+	 stream,
+	 "Usage: fsext_bench [ -i iterations ] [ -o offset ] [ -p path ]\n"
+	 "                   [ -t trace_file ] [ -h ] source\n\n" );
+
+	fprintf(
+	 stream,
+	 "\tsource: the source file or device\n\n" );
+
+	fprintf(
+	 stream,
+	 "\t-h:     shows this help\n" );
+
+	fprintf(
+	 stream,
+	 "\t-i:     number of iterations of the volume open and path lookup\n"
+	 "\t        benchmarks, default is %d\n",
+	 FSEXT_BENCH_DEFAULT_NUMBER_OF_ITERATIONS );
+
+	fprintf(
+	 stream,
+	 "\t-o:     specify the volume offset\n" );
+
+	fprintf(
+	 stream,
+	 "\t-p:     path of the file entry used for the cold path lookup, by default\n"
+	 "\t        the first regular file found in the hierarchy is used\n" );
+
+	fprintf(
+	 stream,
+	 "\t-t:     write the libfsext trace events as Chrome trace event JSON to\n"
+	 "\t        trace_file, requires libfsext to be compiled with trace support\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	char narrow_source[ 256 ];
+
+	fsext_bench_result_t results[ 10 ];
+
+	fsext_bench_context_t *bench_context  = NULL;
+	libcerror_error_t *error              = NULL;
+	system_character_t *option_iterations = NULL;
+	system_character_t *option_offset     = NULL;
+	system_character_t *option_path       = NULL;
+	system_character_t *option_trace_file = NULL;
+	const char *lookup_path               = NULL;
+	char *narrow_option_path              = NULL;
+	system_integer_t option               = 0;
+	size_t string_length                  = 0;
+	uint64_t value_64bit                  = 0;
+	int number_of_iterations              = FSEXT_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	int path_index                        = 0;
+	int result                            = EXIT_FAILURE;
+
+	while( ( option = fsext_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:o:p:t:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				fsext_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				fsext_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_path = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_trace_file = optarg;
+
+				break;
+		}
+	}
+	if( optind >= argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		fsext_bench_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	bench_context = (fsext_bench_context_t *) memory_allocate(
+	                                           sizeof( fsext_bench_context_t ) );
+
+	if( bench_context == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create bench context.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( memory_set(
+	     bench_context,
+	     0,
+	     sizeof( fsext_bench_context_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear bench context.\n" );
+
+		memory_free(
+		 bench_context );
+
+		return( EXIT_FAILURE );
+	}
+	if( memory_set(
+	     results,
+	     0,
+	     sizeof( fsext_bench_result_t ) * 10 ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear results.\n" );
+
+		goto on_error;
+	}
+	bench_context->source       = argv[ optind ];
+	bench_context->random_state = 0x5eedUL;
+
+	if( option_iterations != NULL )
+	{
+		string_length = system_string_length(
+		                 option_iterations );
+
+		if( ( fsext_test_system_string_copy_from_64_bit_in_decimal(
+		       option_iterations,
+		       string_length + 1,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations.\n" );
+
+			goto on_error;
+		}
+		number_of_iterations = (int) value_64bit;
+	}
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		if( fsext_test_system_string_copy_from_64_bit_in_decimal(
+		     option_offset,
+		     string_length + 1,
+		     (uint64_t *) &( bench_context->volume_offset ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_path != NULL )
+	{
+		string_length = system_string_length(
+		                 option_path );
+
+		narrow_option_path = narrow_string_allocate(
+		                      string_length + 1 );
+
+		if( narrow_option_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create path.\n" );
+
+			goto on_error;
+		}
+		if( fsext_test_get_narrow_source(
+		     option_path,
+		     narrow_option_path,
+		     string_length + 1,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported path.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fsext_test_get_narrow_source(
+	     bench_context->source,
+	     narrow_source,
+	     256,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported source.\n" );
+
+		goto on_error;
+	}
+	if( option_trace_file != NULL )
+	{
+#if defined( LIBFSEXT_HAVE_TRACE )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		bench_context->trace_stream = file_stream_open_wide(
+		                               option_trace_file,
+		                               L"w" );
+#else
+		bench_context->trace_stream = file_stream_open(
+		                               option_trace_file,
+		                               "w" );
+#endif
+		if( bench_context->trace_stream == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open trace file: %" PRIs_SYSTEM ".\n",
+			 option_trace_file );
+
+			goto on_error;
+		}
+		fprintf(
+		 bench_context->trace_stream,
+		 "{\n  \"traceEvents\": [" );
+
+		bench_context->trace_start_time = fsext_bench_get_current_time();
+#else
+		fprintf(
+		 stderr,
+		 "Unable to trace, libfsext was not compiled with trace support.\n" );
+
+		goto on_error;
+#endif
+	}
+	if( fsext_bench_volume_open(
+	     bench_context,
+	     number_of_iterations,
+	     &( results[ 0 ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark volume open.\n" );
+
+		goto on_error;
+	}
+	if( fsext_bench_open_volume(
+	     bench_context,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open volume.\n" );
+
+		goto on_error;
+	}
+	if( fsext_bench_inode_scan(
+	     bench_context,
+	     &( results[ 1 ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark inode scan.\n" );
+
+		goto on_error;
+	}
+	if( fsext_bench_hierarchy_walk(
+	     bench_context,
+	     &( results[ 2 ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark hierarchy walk.\n" );
+
+		goto on_error;
+	}
+	if( narrow_option_path != NULL )
+	{
+		lookup_path = narrow_option_path;
+	}
+	else if( bench_context->number_of_paths > 0 )
+	{
+		lookup_path = bench_context->paths[ 0 ];
+	}
+	else
+	{
+		lookup_path = "/";
+	}
+	if( fsext_bench_path_lookup(
+	     bench_context,
+	     lookup_path,
+	     number_of_iterations,
+	     &( results[ 3 ] ),
+	     &( results[ 4 ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark path lookup.\n" );
+
+		goto on_error;
+	}
+	if( fsext_bench_file_read(
+	     bench_context,
+	     &( results[ 5 ] ),
+	     &( results[ 6 ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark file read.\n" );
+
+		goto on_error;
+	}
+	if( fsext_bench_extended_attributes(
+	     bench_context,
+	     &( results[ 7 ] ),
+	     &( results[ 8 ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark extended attributes enumeration.\n" );
+
+		goto on_error;
+	}
+	fsext_bench_print_results(
+	 stdout,
+	 narrow_source,
+	 results,
+	 9 );
+
+	result = EXIT_SUCCESS;
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	fsext_bench_close_volume(
+	 bench_context,
+	 NULL );
+
+	if( bench_context->trace_stream != NULL )
+	{
+		fprintf(
+		 bench_context->trace_stream,
+		 "\n  ]\n}\n" );
+
+		file_stream_close(
+		 bench_context->trace_stream );
+	}
+	for( path_index = 0;
+	     path_index < bench_context->number_of_paths;
+	     path_index++ )
+	{
+		memory_free(
+		 bench_context->paths[ path_index ] );
+	}
+	if( narrow_option_path != NULL )
+	{
+		memory_free(
+		 narrow_option_path );
+	}
+	memory_free(
+	 bench_context );
+
+	return( result );
+}
+
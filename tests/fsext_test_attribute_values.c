@@ -431,6 +431,277 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsext_attribute_values_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_attribute_values_clone(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfsext_attribute_values_t *destination_attribute_values = NULL;
+	libfsext_attribute_values_t *source_attribute_values      = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_attribute_values_initialize(
+	          &source_attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "source_attribute_values",
+	 source_attribute_values );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_attribute_values_read_data(
+	          source_attribute_values,
+	          fsext_test_attribute_values_data1,
+	          24,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_attribute_values_clone(
+	          &destination_attribute_values,
+	          source_attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_attribute_values",
+	 destination_attribute_values );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_attribute_values->name_size",
+	 destination_attribute_values->name_size,
+	 source_attribute_values->name_size );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_attribute_values->name_hash",
+	 destination_attribute_values->name_hash,
+	 source_attribute_values->name_hash );
+
+	result = libfsext_attribute_values_free(
+	          &destination_attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "destination_attribute_values",
+	 destination_attribute_values );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_attribute_values_clone(
+	          &destination_attribute_values,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "destination_attribute_values",
+	 destination_attribute_values );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_attribute_values_clone(
+	          NULL,
+	          source_attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_attribute_values_free(
+	          &source_attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "source_attribute_values",
+	 source_attribute_values );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_attribute_values != NULL )
+	{
+		libfsext_attribute_values_free(
+		 &destination_attribute_values,
+		 NULL );
+	}
+	if( source_attribute_values != NULL )
+	{
+		libfsext_attribute_values_free(
+		 &source_attribute_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_attribute_values_calculate_utf8_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_attribute_values_calculate_utf8_name_hash(
+     libfsext_attribute_values_t *attribute_values )
+{
+	uint8_t utf8_string[ 14 ] = { 'u', 's', 'e', 'r', '.', 'm', 'y', 'x', 'a', 't', 't', 'r', '1', 0 };
+	libcerror_error_t *error  = NULL;
+	uint32_t name_hash        = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_attribute_values_calculate_utf8_name_hash(
+	          utf8_string,
+	          13,
+	          &name_hash,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 attribute_values->name_hash );
+
+	/* Test error cases
+	 */
+	result = libfsext_attribute_values_calculate_utf8_name_hash(
+	          NULL,
+	          13,
+	          &name_hash,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_attribute_values_calculate_utf8_name_hash(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &name_hash,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_attribute_values_calculate_utf8_name_hash(
+	          utf8_string,
+	          13,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsext_attribute_values_compare_name_with_utf8_string function
  * Returns 1 if successful or 0 if not
  */
@@ -693,6 +964,106 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsext_attribute_values_calculate_utf16_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_attribute_values_calculate_utf16_name_hash(
+     libfsext_attribute_values_t *attribute_values )
+{
+	uint16_t utf16_string[ 14 ] = { 'u', 's', 'e', 'r', '.', 'm', 'y', 'x', 'a', 't', 't', 'r', '1', 0 };
+	libcerror_error_t *error    = NULL;
+	uint32_t name_hash          = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_attribute_values_calculate_utf16_name_hash(
+	          utf16_string,
+	          13,
+	          &name_hash,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 attribute_values->name_hash );
+
+	/* Test error cases
+	 */
+	result = libfsext_attribute_values_calculate_utf16_name_hash(
+	          NULL,
+	          13,
+	          &name_hash,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_attribute_values_calculate_utf16_name_hash(
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &name_hash,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_attribute_values_calculate_utf16_name_hash(
+	          utf16_string,
+	          13,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsext_attribute_values_compare_name_with_utf16_string function
  * Returns 1 if successful or 0 if not
  */
@@ -992,6 +1363,10 @@ int main(
 	 "libfsext_attribute_values_read_data",
 	 fsext_test_attribute_values_read_data );
 
+	FSEXT_TEST_RUN(
+	 "libfsext_attribute_values_clone",
+	 fsext_test_attribute_values_clone );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize attribute_values for tests
@@ -1030,6 +1405,11 @@ int main(
 
 	/* Run tests
 	 */
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_attribute_values_calculate_utf8_name_hash",
+	 fsext_test_attribute_values_calculate_utf8_name_hash,
+	 attribute_values );
+
 	FSEXT_TEST_RUN_WITH_ARGS(
 	 "libfsext_attribute_values_compare_name_with_utf8_string",
 	 fsapfs_test_attribute_values_compare_name_with_utf8_string,
@@ -1045,6 +1425,11 @@ int main(
 	 fsext_test_attribute_values_get_utf8_name,
 	 attribute_values );
 
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_attribute_values_calculate_utf16_name_hash",
+	 fsext_test_attribute_values_calculate_utf16_name_hash,
+	 attribute_values );
+
 	FSEXT_TEST_RUN_WITH_ARGS(
 	 "libfsext_attribute_values_compare_name_with_utf16_string",
 	 fsapfs_test_attribute_values_compare_name_with_utf16_string,
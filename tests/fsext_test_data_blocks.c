@@ -0,0 +1,559 @@
+/*
+ * Library data_blocks functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsext_test_functions.h"
+#include "fsext_test_libbfio.h"
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+#include "fsext_test_macros.h"
+#include "fsext_test_memory.h"
+#include "fsext_test_unused.h"
+
+#include "../libfsext/libfsext_data_blocks.h"
+#include "../libfsext/libfsext_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Tests the libfsext_data_blocks_compare_indirect_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_data_blocks_compare_indirect_blocks(
+     void )
+{
+	libfsext_data_blocks_indirect_block_t indirect_blocks[ 3 ];
+	libfsext_data_blocks_indirect_block_t *sorted_indirect_blocks[ 3 ];
+
+	int result = 0;
+
+	/* Initialize test
+	 */
+	indirect_blocks[ 0 ].block_number = 5;
+	indirect_blocks[ 0 ].entry_offset = 0;
+	indirect_blocks[ 1 ].block_number = 7;
+	indirect_blocks[ 1 ].entry_offset = 4;
+	indirect_blocks[ 2 ].block_number = 5;
+	indirect_blocks[ 2 ].entry_offset = 8;
+
+	sorted_indirect_blocks[ 0 ] = &( indirect_blocks[ 0 ] );
+	sorted_indirect_blocks[ 1 ] = &( indirect_blocks[ 1 ] );
+	sorted_indirect_blocks[ 2 ] = &( indirect_blocks[ 2 ] );
+
+	/* Test regular cases
+	 */
+	result = libfsext_data_blocks_compare_indirect_blocks(
+	          &( sorted_indirect_blocks[ 0 ] ),
+	          &( sorted_indirect_blocks[ 1 ] ) );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfsext_data_blocks_compare_indirect_blocks(
+	          &( sorted_indirect_blocks[ 1 ] ),
+	          &( sorted_indirect_blocks[ 0 ] ) );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Indirect blocks with the same block number are ordered by their position in the parent block
+	 */
+	result = libfsext_data_blocks_compare_indirect_blocks(
+	          &( sorted_indirect_blocks[ 0 ] ),
+	          &( sorted_indirect_blocks[ 2 ] ) );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfsext_data_blocks_compare_indirect_blocks(
+	          &( sorted_indirect_blocks[ 2 ] ),
+	          &( sorted_indirect_blocks[ 0 ] ) );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_data_blocks_compare_indirect_blocks(
+	          &( sorted_indirect_blocks[ 0 ] ),
+	          &( sorted_indirect_blocks[ 0 ] ) );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsext_data_blocks_read_indirect_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_data_blocks_read_indirect_blocks(
+     void )
+{
+	libfsext_data_blocks_indirect_block_t indirect_blocks[ 4 ];
+	libfsext_data_blocks_indirect_block_t *sorted_indirect_blocks[ 4 ];
+	uint8_t indirect_blocks_data[ 4 * 1024 ];
+	uint8_t volume_data[ 8 * 1024 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsext_io_handle_t *io_handle  = NULL;
+	int block_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 * Every block of the volume data is filled with its block number + 1
+	 */
+	for( block_index = 0;
+	     block_index < 8;
+	     block_index++ )
+	{
+		memory_set(
+		 &( volume_data[ block_index * 1024 ] ),
+		 block_index + 1,
+		 1024 );
+	}
+	result = libfsext_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 1024;
+
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          volume_data,
+	          8 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Blocks 2 to 4 are adjacent and read with a single read, block 6 is read separately
+	 */
+	indirect_blocks[ 0 ].block_number = 6;
+	indirect_blocks[ 0 ].entry_offset = 0;
+	indirect_blocks[ 1 ].block_number = 2;
+	indirect_blocks[ 1 ].entry_offset = 4;
+	indirect_blocks[ 2 ].block_number = 3;
+	indirect_blocks[ 2 ].entry_offset = 8;
+	indirect_blocks[ 3 ].block_number = 4;
+	indirect_blocks[ 3 ].entry_offset = 12;
+
+	for( block_index = 0;
+	     block_index < 4;
+	     block_index++ )
+	{
+		sorted_indirect_blocks[ block_index ] = &( indirect_blocks[ block_index ] );
+	}
+	memory_set(
+	 indirect_blocks_data,
+	 0,
+	 4 * 1024 );
+
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          4,
+	          indirect_blocks_data,
+	          4 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The indirect blocks are sorted by block number and their data is stored in that order
+	 */
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "sorted_indirect_blocks[ 0 ]->block_number",
+	 sorted_indirect_blocks[ 0 ]->block_number,
+	 2 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "sorted_indirect_blocks[ 3 ]->block_number",
+	 sorted_indirect_blocks[ 3 ]->block_number,
+	 6 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "indirect_blocks[ 0 ].data_offset",
+	 indirect_blocks[ 0 ].data_offset,
+	 (size_t) 3072 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "indirect_blocks[ 1 ].data_offset",
+	 indirect_blocks[ 1 ].data_offset,
+	 (size_t) 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "indirect_blocks[ 2 ].data_offset",
+	 indirect_blocks[ 2 ].data_offset,
+	 (size_t) 1024 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "indirect_blocks[ 3 ].data_offset",
+	 indirect_blocks[ 3 ].data_offset,
+	 (size_t) 2048 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "indirect_blocks_data[ 0 ]",
+	 indirect_blocks_data[ 0 ],
+	 3 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "indirect_blocks_data[ 1023 ]",
+	 indirect_blocks_data[ 1023 ],
+	 3 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "indirect_blocks_data[ 1024 ]",
+	 indirect_blocks_data[ 1024 ],
+	 4 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "indirect_blocks_data[ 2048 ]",
+	 indirect_blocks_data[ 2048 ],
+	 5 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "indirect_blocks_data[ 3072 ]",
+	 indirect_blocks_data[ 3072 ],
+	 7 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "indirect_blocks_data[ 4095 ]",
+	 indirect_blocks_data[ 4095 ],
+	 7 );
+
+	/* Test reading no indirect blocks
+	 */
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          0,
+	          indirect_blocks_data,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          NULL,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          4,
+	          indirect_blocks_data,
+	          4 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->block_size = 0;
+
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          4,
+	          indirect_blocks_data,
+	          4 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->block_size = 1024;
+
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          4,
+	          indirect_blocks_data,
+	          4 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          -1,
+	          indirect_blocks_data,
+	          4 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          4,
+	          NULL,
+	          4 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          4,
+	          indirect_blocks_data,
+	          3 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading an indirect block beyond the end of the volume data
+	 */
+	sorted_indirect_blocks[ 0 ]->block_number = 8;
+
+	result = libfsext_data_blocks_read_indirect_blocks(
+	          io_handle,
+	          file_io_handle,
+	          sorted_indirect_blocks,
+	          1,
+	          indirect_blocks_data,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsext_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	FSEXT_TEST_RUN(
+	 "libfsext_data_blocks_compare_indirect_blocks",
+	 fsext_test_data_blocks_compare_indirect_blocks );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_data_blocks_read_indirect_blocks",
+	 fsext_test_data_blocks_read_indirect_blocks );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,6 +35,7 @@
 #include "fsext_test_memory.h"
 #include "fsext_test_unused.h"
 
+#include "../libfsext/libfsext_definitions.h"
 #include "../libfsext/libfsext_directory.h"
 
 /* Define to make fsext_test_directory generate verbose output
@@ -179,6 +181,22 @@ uint8_t fsext_test_directory_data1[ 2048 ] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
+uint8_t fsext_test_directory_block_data1[ 64 ] = {
+	0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x02, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x02, 0x02, 0x2e, 0x2e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x05, 0x01,
+	0x66, 0x69, 0x6c, 0x65, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fsext_test_directory_block_data2[ 64 ] = {
+	0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x02, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x02, 0x02, 0x2e, 0x2e, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x05, 0x01,
+	0x66, 0x69, 0x6c, 0x65, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xde, 0x7a, 0x54, 0x32, 0x7f };
+
+uint8_t fsext_test_directory_slack_data1[ 24 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x05, 0x01,
+	0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
 
 /* Tests the libfsext_directory_initialize function
@@ -788,245 +806,179 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsext_directory_get_number_of_entries function
+/* Tests the libfsext_directory_read_block_data function
  * Returns 1 if successful or 0 if not
  */
-int fsext_test_directory_get_number_of_entries(
-     libfsext_directory_t *directory )
+int fsext_test_directory_read_block_data(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_entries    = 0;
-	int result               = 0;
+	uint8_t block_data[ 64 ];
 
-	/* Test regular cases
+	libcerror_error_t *error        = NULL;
+	libfsext_directory_t *directory = NULL;
+	libfsext_inode_t *inode         = NULL;
+	libfsext_io_handle_t *io_handle = NULL;
+	uint32_t directory_entry_index  = 0;
+	int number_of_entries           = 0;
+	int result                      = 0;
+
+	/* Initialize test
 	 */
-	result = libfsext_directory_get_number_of_entries(
-	          directory,
-	          &number_of_entries,
+	result = libfsext_io_handle_initialize(
+	          &io_handle,
 	          &error );
 
-	FSEXT_TEST_ASSERT_NOT_EQUAL_INT(
+	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
 	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsext_directory_get_number_of_entries(
-	          NULL,
-	          &number_of_entries,
+	io_handle->format_version                      = 4;
+	io_handle->block_size                          = 1024;
+	io_handle->read_only_compatible_features_flags = LIBFSEXT_READ_ONLY_COMPATIBLE_FEATURES_FLAG_METADATA_CHECKSUM;
+
+	result = libfsext_inode_initialize(
+	          &inode,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	inode->inode_number = 2;
 
-	result = libfsext_directory_get_number_of_entries(
-	          directory,
-	          NULL,
+	result = libfsext_directory_initialize(
+	          &directory,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfsext_directory_get_entry_by_index function
- * Returns 1 if successful or 0 if not
- */
-int fsext_test_directory_get_entry_by_index(
-     libfsext_directory_t *directory )
-{
-	libcerror_error_t *error                    = NULL;
-	libfsext_directory_entry_t *directory_entry = 0;
-	int result                                  = 0;
-
 	/* Test regular cases
 	 */
-	result = libfsext_directory_get_entry_by_index(
+	result = libfsext_directory_read_block_data(
 	          directory,
-	          0,
-	          &directory_entry,
+	          io_handle,
+	          inode,
+	          fsext_test_directory_block_data2,
+	          64,
+	          &directory_entry_index,
 	          &error );
 
-	FSEXT_TEST_ASSERT_NOT_EQUAL_INT(
+	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	FSEXT_TEST_ASSERT_IS_NOT_NULL(
-	 "directory_entry",
-	 directory_entry );
-
-	directory_entry = NULL;
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "directory->is_corrupt",
+	 directory->is_corrupt,
+	 (uint8_t) 0 );
 
-	/* Test error cases
-	 */
-	result = libfsext_directory_get_entry_by_index(
-	          NULL,
-	          0,
-	          &directory_entry,
+	result = libfsext_directory_free(
+	          &directory,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSEXT_TEST_ASSERT_IS_NULL(
-	 "directory_entry",
-	 directory_entry );
-
-	FSEXT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsext_directory_get_entry_by_index(
-	          directory,
-	          -1,
-	          &directory_entry,
+	result = libfsext_directory_initialize(
+	          &directory,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FSEXT_TEST_ASSERT_IS_NULL(
-	 "directory_entry",
-	 directory_entry );
+	 1 );
 
 	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	io_handle->statistics_values[ LIBFSEXT_STATISTICS_VALUE_NUMBER_OF_CHECKSUM_VERIFICATIONS ] = 0;
 
-	result = libfsext_directory_get_entry_by_index(
+	directory_entry_index = 0;
+
+	/* The stored checksum of the metadata checksum tail does not match, which is not an error
+	 * but marks the directory as corrupt
+	 */
+	result = libfsext_directory_read_block_data(
 	          directory,
-	          0,
-	          NULL,
+	          io_handle,
+	          inode,
+	          fsext_test_directory_block_data1,
+	          64,
+	          &directory_entry_index,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSEXT_TEST_ASSERT_IS_NULL(
-	 "directory_entry",
-	 directory_entry );
-
-	FSEXT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
-
-/* The main program
- */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
-#endif
-{
-#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libfsext_directory_t *directory  = NULL;
-	libfsext_inode_t *inode          = NULL;
-	libfsext_io_handle_t *io_handle  = NULL;
-	int result                       = 0;
-#endif
-
-	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
-	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( FSEXT_TEST_DIRECTORY_VERBOSE )
-	libfsext_notify_set_verbose(
-	 1 );
-	libfsext_notify_set_stream(
-	 stderr,
-	 NULL );
-#endif
-
-#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
-
-	FSEXT_TEST_RUN(
-	 "libfsext_directory_initialize",
-	 fsext_test_directory_initialize );
-
-	FSEXT_TEST_RUN(
-	 "libfsext_directory_free",
-	 fsext_test_directory_free );
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "directory->is_corrupt",
+	 directory->is_corrupt,
+	 (uint8_t) 1 );
 
-	FSEXT_TEST_RUN(
-	 "libfsext_directory_read_file_io_handle",
-	 fsext_test_directory_read_file_io_handle );
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry_index",
+	 directory_entry_index,
+	 (uint32_t) 3 );
 
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_checksum_verifications",
+	 io_handle->statistics_values[ LIBFSEXT_STATISTICS_VALUE_NUMBER_OF_CHECKSUM_VERIFICATIONS ],
+	 (uint64_t) 1 );
 
-	/* Initialize directory for tests
-	 */
-	result = libfsext_io_handle_initialize(
-	          &io_handle,
+	result = libfsext_directory_get_number_of_entries(
+	          directory,
+	          &number_of_entries,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
@@ -1034,63 +986,1287 @@ int main(
 	 result,
 	 1 );
 
-	FSEXT_TEST_ASSERT_IS_NOT_NULL(
-	 "io_handle",
-	 io_handle );
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
 
 	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	io_handle->format_version = 3;
-	io_handle->block_size     = 1024;
-	io_handle->inode_size     = 128;
-
-	result = libfsext_inode_initialize(
-	          &inode,
+	/* Test error cases
+	 */
+	result = libfsext_directory_read_block_data(
+	          NULL,
+	          io_handle,
+	          inode,
+	          fsext_test_directory_block_data1,
+	          64,
+	          &directory_entry_index,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FSEXT_TEST_ASSERT_IS_NOT_NULL(
-	 "inode",
-	 inode );
-
-	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsext_inode_read_data(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          NULL,
 	          inode,
-	          io_handle,
-	          fsext_test_inode_data1,
-	          128,
+	          fsext_test_directory_block_data1,
+	          64,
+	          &directory_entry_index,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSEXT_TEST_ASSERT_IS_NULL(
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfsext_inode_read_data_reference(
-	          inode,
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_read_block_data(
+	          directory,
 	          io_handle,
 	          NULL,
+	          fsext_test_directory_block_data1,
+	          64,
+	          &directory_entry_index,
 	          &error );
 
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSEXT_TEST_ASSERT_IS_NULL(
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          io_handle,
+	          inode,
+	          NULL,
+	          64,
+	          &directory_entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          io_handle,
+	          inode,
+	          fsext_test_directory_block_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &directory_entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          io_handle,
+	          inode,
+	          fsext_test_directory_block_data1,
+	          64,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is too small for a directory entry header
+	 */
+	memory_copy(
+	 block_data,
+	 fsext_test_directory_block_data1,
+	 64 );
+
+	directory_entry_index = 0;
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          io_handle,
+	          inode,
+	          block_data,
+	          4,
+	          &directory_entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the directory entry size is smaller than the directory entry header
+	 */
+	memory_copy(
+	 block_data,
+	 fsext_test_directory_block_data1,
+	 64 );
+
+	block_data[ 28 ] = 0x04;
+
+	directory_entry_index = 0;
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          io_handle,
+	          inode,
+	          block_data,
+	          64,
+	          &directory_entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the directory entry size exceeds the data size
+	 */
+	memory_copy(
+	 block_data,
+	 fsext_test_directory_block_data1,
+	 64 );
+
+	block_data[ 28 ] = 0x40;
+
+	directory_entry_index = 0;
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          io_handle,
+	          inode,
+	          block_data,
+	          64,
+	          &directory_entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the name size exceeds the directory entry size
+	 */
+	memory_copy(
+	 block_data,
+	 fsext_test_directory_block_data1,
+	 64 );
+
+	block_data[ 30 ] = 0x15;
+
+	directory_entry_index = 0;
+
+	result = libfsext_directory_read_block_data(
+	          directory,
+	          io_handle,
+	          inode,
+	          block_data,
+	          64,
+	          &directory_entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that no directory entries were added by the error cases
+	 */
+	result = libfsext_directory_get_number_of_entries(
+	          directory,
+	          &number_of_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsext_directory_free(
+	          &directory,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_free(
+	          &inode,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libfsext_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsext_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsext_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_directory_read_slack_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_directory_read_slack_data(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsext_directory_t *directory = NULL;
+	int number_of_deleted_entries   = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_directory_read_slack_data(
+	          directory,
+	          fsext_test_directory_slack_data1,
+	          24,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_directory_get_number_of_deleted_entries(
+	          directory,
+	          &number_of_deleted_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_deleted_entries",
+	 number_of_deleted_entries,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a deleted directory entry with an inode number that exceeds the number of inodes is ignored
+	 */
+	directory->number_of_inodes = 11;
+
+	result = libfsext_directory_read_slack_data(
+	          directory,
+	          fsext_test_directory_slack_data1,
+	          24,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_directory_get_number_of_deleted_entries(
+	          directory,
+	          &number_of_deleted_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_deleted_entries",
+	 number_of_deleted_entries,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a deleted directory entry with an inode number within the number of inodes is read
+	 */
+	directory->number_of_inodes = 12;
+
+	result = libfsext_directory_read_slack_data(
+	          directory,
+	          fsext_test_directory_slack_data1,
+	          24,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_directory_get_number_of_deleted_entries(
+	          directory,
+	          &number_of_deleted_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_deleted_entries",
+	 number_of_deleted_entries,
+	 2 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_directory_read_slack_data(
+	          NULL,
+	          fsext_test_directory_slack_data1,
+	          24,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_read_slack_data(
+	          directory,
+	          NULL,
+	          24,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_read_slack_data(
+	          directory,
+	          fsext_test_directory_slack_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_directory_free(
+	          &directory,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libfsext_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_directory_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_directory_get_number_of_entries(
+     libfsext_directory_t *directory )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_directory_get_number_of_entries(
+	          directory,
+	          &number_of_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_directory_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_get_number_of_entries(
+	          directory,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_directory_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_directory_get_entry_by_index(
+     libfsext_directory_t *directory )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsext_directory_entry_t *directory_entry = 0;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_directory_get_entry_by_index(
+	          directory,
+	          0,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	directory_entry = NULL;
+
+	/* Test error cases
+	 */
+	result = libfsext_directory_get_entry_by_index(
+	          NULL,
+	          0,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_get_entry_by_index(
+	          directory,
+	          -1,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_get_entry_by_index(
+	          directory,
+	          0,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_directory_get_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_directory_get_entry_by_utf8_name(
+     libfsext_directory_t *directory )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsext_directory_entry_t *directory_entry = NULL;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	/* The first lookup does not build the name hash table
+	 */
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "file2",
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint32_t) 13 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory->name_hash_buckets",
+	 directory->name_hash_buckets );
+
+	directory_entry = NULL;
+
+	/* The second lookup builds the name hash table
+	 */
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "file3",
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint32_t) 14 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory->name_hash_buckets",
+	 directory->name_hash_buckets );
+
+	directory_entry = NULL;
+
+	/* Lookups after the name hash table was built
+	 */
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "file2",
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint32_t) 13 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory->name_hash_buckets",
+	 directory->name_hash_buckets );
+
+	directory_entry = NULL;
+
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "lost+found",
+	          10,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint32_t) 11 );
+
+	directory_entry = NULL;
+
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "bogus",
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	directory_entry = NULL;
+
+	/* Test error cases
+	 */
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "file2",
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          directory,
+	          NULL,
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_get_entry_by_utf8_name(
+	          directory,
+	          (uint8_t *) "file2",
+	          5,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_directory_get_entry_by_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_directory_get_entry_by_utf16_name(
+     libfsext_directory_t *directory )
+{
+	uint16_t utf16_name_bogus[ 5 ] = { 'b', 'o', 'g', 'u', 's' };
+	uint16_t utf16_name_file4[ 5 ] = { 'f', 'i', 'l', 'e', '4' };
+
+	libcerror_error_t *error                    = NULL;
+	libfsext_directory_entry_t *directory_entry = NULL;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	/* The name hash table was built by the UTF-8 lookups
+	 */
+	result = libfsext_directory_get_entry_by_utf16_name(
+	          directory,
+	          utf16_name_file4,
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint32_t) 15 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory->name_hash_buckets",
+	 directory->name_hash_buckets );
+
+	directory_entry = NULL;
+
+	result = libfsext_directory_get_entry_by_utf16_name(
+	          directory,
+	          utf16_name_bogus,
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	directory_entry = NULL;
+
+	/* Test error cases
+	 */
+	result = libfsext_directory_get_entry_by_utf16_name(
+	          NULL,
+	          utf16_name_file4,
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_get_entry_by_utf16_name(
+	          directory,
+	          NULL,
+	          5,
+	          &directory_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_directory_get_entry_by_utf16_name(
+	          directory,
+	          utf16_name_file4,
+	          5,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsext_directory_t *directory  = NULL;
+	libfsext_inode_t *inode          = NULL;
+	libfsext_io_handle_t *io_handle  = NULL;
+	int result                       = 0;
+#endif
+
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( FSEXT_TEST_DIRECTORY_VERBOSE )
+	libfsext_notify_set_verbose(
+	 1 );
+	libfsext_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	FSEXT_TEST_RUN(
+	 "libfsext_directory_initialize",
+	 fsext_test_directory_initialize );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_directory_free",
+	 fsext_test_directory_free );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_directory_read_file_io_handle",
+	 fsext_test_directory_read_file_io_handle );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_directory_read_block_data",
+	 fsext_test_directory_read_block_data );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_directory_read_slack_data",
+	 fsext_test_directory_read_slack_data );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize directory for tests
+	 */
+	result = libfsext_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version = 3;
+	io_handle->block_size     = 1024;
+	io_handle->inode_size     = 128;
+
+	result = libfsext_inode_initialize(
+	          &inode,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_read_data(
+	          inode,
+	          io_handle,
+	          fsext_test_inode_data1,
+	          128,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_read_data_reference(
+	          inode,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
@@ -1156,6 +2332,16 @@ int main(
 	 fsext_test_directory_get_entry_by_index,
 	 directory );
 
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_directory_get_entry_by_utf8_name",
+	 fsext_test_directory_get_entry_by_utf8_name,
+	 directory );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_directory_get_entry_by_utf16_name",
+	 fsext_test_directory_get_entry_by_utf16_name,
+	 directory );
+
 	/* Clean up file IO handle
 	 */
 	result = fsext_test_close_file_io_handle(
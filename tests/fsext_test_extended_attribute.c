@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,20 +34,22 @@
 
 #include <time.h>
 
+#include "fsext_test_functions.h"
+#include "fsext_test_libbfio.h"
 #include "fsext_test_libcerror.h"
 #include "fsext_test_libfsext.h"
 #include "fsext_test_macros.h"
 #include "fsext_test_memory.h"
 #include "fsext_test_unused.h"
 
+#include "../libfsext/libfsext_attribute_values.h"
 #include "../libfsext/libfsext_extended_attribute.h"
+#include "../libfsext/libfsext_extent.h"
+#include "../libfsext/libfsext_io_handle.h"
+#include "../libfsext/libfsext_libcdata.h"
 
 #define FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE	4096
 
-#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
-
-#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
-
 /* Tests the libfsext_extended_attribute_free function
  * Returns 1 if successful or 0 if not
  */
@@ -85,6 +88,520 @@ on_error:
 	return( 0 );
 }
 
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Tests the libfsext_internal_extended_attribute_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_internal_extended_attribute_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE ];
+	uint8_t volume_data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle                                    = NULL;
+	libcerror_error_t *error                                            = NULL;
+	libfsext_attribute_values_t *attribute_values                       = NULL;
+	libfsext_extended_attribute_t *extended_attribute                   = NULL;
+	libfsext_extent_t *extent                                           = NULL;
+	libfsext_internal_extended_attribute_t *internal_extended_attribute = NULL;
+	libfsext_io_handle_t *io_handle                                     = NULL;
+	ssize_t read_count                                                  = 0;
+	size_t data_offset                                                  = 0;
+	int entry_index                                                     = 0;
+	int result                                                          = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 2048;
+	     data_offset++ )
+	{
+		if( data_offset < 1024 )
+		{
+			volume_data[ data_offset ] = 0xff;
+		}
+		else
+		{
+			volume_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+		}
+	}
+	result = libfsext_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 1024;
+
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          volume_data,
+	          2048,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->value_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * 6 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values->value_data",
+	 attribute_values->value_data );
+
+	memory_copy(
+	 attribute_values->value_data,
+	 "value1",
+	 6 );
+
+	attribute_values->value_data_size = 6;
+
+	result = libfsext_extended_attribute_initialize(
+	          &extended_attribute,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "extended_attribute",
+	 extended_attribute );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_extended_attribute = (libfsext_internal_extended_attribute_t *) extended_attribute;
+
+	/* Test regular cases with the value stored in the attribute entry
+	 */
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              buffer,
+	              FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 6 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          "value1",
+	          6 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              buffer,
+	              FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE,
+	              2,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          "lue1",
+	          4 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              buffer,
+	              FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE,
+	              6,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with the value stored in a separate inode
+	 * The value data inode has a single extent of block 1 followed by a sparse range
+	 */
+	attribute_values->value_data_inode_number = 12;
+	attribute_values->value_data_size         = 1500;
+
+	result = libcdata_array_initialize(
+	          &( internal_extended_attribute->data_extents_array ),
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_extent_initialize(
+	          &extent,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->logical_block_number  = 0;
+	extent->physical_block_number = 1;
+	extent->number_of_blocks      = 1;
+
+	result = libcdata_array_append_entry(
+	          internal_extended_attribute->data_extents_array,
+	          &entry_index,
+	          (intptr_t *) extent,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent = NULL;
+
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              buffer,
+	              FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1500 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( volume_data[ 1024 ] ),
+	          1024 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 1024 ]",
+	 buffer[ 1024 ],
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 1499 ]",
+	 buffer[ 1499 ],
+	 0 );
+
+	/* Test a read that crosses from the extent into the sparse range
+	 */
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              buffer,
+	              100,
+	              1000,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( volume_data[ 2024 ] ),
+	          24 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 24 ]",
+	 buffer[ 24 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              NULL,
+	              FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsext_internal_extended_attribute_read_buffer_at_offset(
+	              internal_extended_attribute,
+	              buffer,
+	              FSEXT_TEST_EXTENDED_ATTRIBUTE_READ_BUFFER_SIZE,
+	              -1,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_extended_attribute_free(
+	          &extended_attribute,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "extended_attribute",
+	 extended_attribute );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent != NULL )
+	{
+		libfsext_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( extended_attribute != NULL )
+	{
+		libfsext_extended_attribute_free(
+		 &extended_attribute,
+		 NULL );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsext_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsext_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -132,7 +649,11 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
 
-	/* TODO: add tests for libfsext_internal_extended_attribute_get_data_stream */
+	/* TODO: add tests for libfsext_internal_extended_attribute_get_data_extents */
+
+	FSEXT_TEST_RUN(
+	 "libfsext_internal_extended_attribute_read_buffer_at_offset",
+	 fsext_test_internal_extended_attribute_read_buffer_at_offset );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
 
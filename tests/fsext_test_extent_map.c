@@ -0,0 +1,928 @@
+/*
+ * Library extent_map type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsext_test_functions.h"
+#include "fsext_test_libbfio.h"
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+#include "fsext_test_macros.h"
+#include "fsext_test_memory.h"
+#include "fsext_test_unused.h"
+
+#include "../libfsext/libfsext_extent_map.h"
+#include "../libfsext/libfsext_inode.h"
+#include "../libfsext/libfsext_io_handle.h"
+
+/* Inode with a single extent of 1 block at physical block 7
+ */
+uint8_t fsext_test_extent_map_inode_data1[ 128 ] = {
+	0xed, 0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb4, 0x69, 0x47, 0x55, 0xb4, 0x69, 0x47, 0x55,
+	0xb4, 0x69, 0x47, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf3, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fsext_test_extent_map_data1[ 1024 ];
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Tests the libfsext_extent_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_extent_map_initialize(
+     libfsext_inode_t *inode )
+{
+	libcerror_error_t *error          = NULL;
+	libfsext_extent_map_t *extent_map = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsext_extent_map_initialize(
+	          &extent_map,
+	          1024,
+	          1024,
+	          inode->data_extents_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "extent_map->number_of_entries",
+	 extent_map->number_of_entries,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libfsext_extent_map_entry_t )",
+	 sizeof( libfsext_extent_map_entry_t ),
+	 (size_t) 16 );
+
+	result = libfsext_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_extent_map_initialize(
+	          NULL,
+	          1024,
+	          1024,
+	          inode->data_extents_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_map = (libfsext_extent_map_t *) 0x12345678UL;
+
+	result = libfsext_extent_map_initialize(
+	          &extent_map,
+	          1024,
+	          1024,
+	          inode->data_extents_array,
+	          &error );
+
+	extent_map = NULL;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_extent_map_initialize(
+	          &extent_map,
+	          0,
+	          1024,
+	          inode->data_extents_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_extent_map_initialize(
+	          &extent_map,
+	          1024,
+	          1024,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_extent_map_initialize with malloc failing
+		 */
+		fsext_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsext_extent_map_initialize(
+		          &extent_map,
+		          1024,
+		          1024,
+		          inode->data_extents_array,
+		          &error );
+
+		if( fsext_test_malloc_attempts_before_fail != -1 )
+		{
+			fsext_test_malloc_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libfsext_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_extent_map_initialize with memset failing
+		 */
+		fsext_test_memset_attempts_before_fail = test_number;
+
+		result = libfsext_extent_map_initialize(
+		          &extent_map,
+		          1024,
+		          1024,
+		          inode->data_extents_array,
+		          &error );
+
+		if( fsext_test_memset_attempts_before_fail != -1 )
+		{
+			fsext_test_memset_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libfsext_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSEXT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsext_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_extent_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_extent_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsext_extent_map_free(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_extent_map_get_entry_index_by_logical_block_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_extent_map_get_entry_index_by_logical_block_number(
+     libfsext_extent_map_t *extent_map )
+{
+	libcerror_error_t *error = NULL;
+	int entry_index          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_extent_map_get_entry_index_by_logical_block_number(
+	          extent_map,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_extent_map_get_entry_index_by_logical_block_number(
+	          extent_map,
+	          2,
+	          &entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_extent_map_get_entry_index_by_logical_block_number(
+	          NULL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_extent_map_get_entry_index_by_logical_block_number(
+	          extent_map,
+	          0,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_extent_map_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_extent_map_read_buffer_at_offset(
+     libfsext_extent_map_t *extent_map )
+{
+	uint8_t buffer[ 256 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsext_test_extent_map_data1,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libfsext_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              256,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( fsext_test_extent_map_data1[ 896 ] ),
+	          128 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( buffer[ 128 ] ),
+	          fsext_test_extent_map_data1,
+	          128 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read beyond the end of the data
+	 */
+	read_count = libfsext_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              256,
+	              448,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsext_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              256,
+	              512,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsext_extent_map_read_buffer_at_offset(
+	              NULL,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              256,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsext_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              NULL,
+	              file_io_handle,
+	              NULL,
+	              256,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsext_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsext_extent_map_read_buffer_at_offset(
+	              extent_map,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              256,
+	              -1,
+	              &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+	libcerror_error_t *error          = NULL;
+	libfsext_extent_map_t *extent_map = NULL;
+	libfsext_inode_t *inode           = NULL;
+	libfsext_io_handle_t *io_handle   = NULL;
+	size_t data_offset                = 0;
+	int result                        = 0;
+#endif
+
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	for( data_offset = 896;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		fsext_test_extent_map_data1[ data_offset ] = (uint8_t) data_offset;
+	}
+	result = libfsext_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version = 4;
+	io_handle->block_size     = 1024;
+	io_handle->inode_size     = 128;
+
+	result = libfsext_inode_initialize(
+	          &inode,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_read_data(
+	          inode,
+	          io_handle,
+	          fsext_test_extent_map_inode_data1,
+	          128,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_read_data_reference(
+	          inode,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_extent_map_initialize",
+	 fsext_test_extent_map_initialize,
+	 inode );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_extent_map_free",
+	 fsext_test_extent_map_free );
+
+	/* Use a block size of 128 so the extent at physical block 7 maps to offset 896
+	 * and the data size of 512 leaves logical blocks 1 to 3 unmapped
+	 */
+	result = libfsext_extent_map_initialize(
+	          &extent_map,
+	          128,
+	          512,
+	          inode->data_extents_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_extent_map_get_entry_index_by_logical_block_number",
+	 fsext_test_extent_map_get_entry_index_by_logical_block_number,
+	 extent_map );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_extent_map_read_buffer_at_offset",
+	 fsext_test_extent_map_read_buffer_at_offset,
+	 extent_map );
+
+	/* Clean up
+	 */
+	result = libfsext_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_free(
+	          &inode,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsext_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsext_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsext_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,7 +34,9 @@
 #include "fsext_test_memory.h"
 #include "fsext_test_unused.h"
 
+#include "../libfsext/libfsext_attribute_values.h"
 #include "../libfsext/libfsext_file_entry.h"
+#include "../libfsext/libfsext_libcdata.h"
 
 /* Tests the libfsext_file_entry_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +78,801 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
 
+/* Tests the libfsext_internal_file_entry_get_all_extended_attributes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_internal_file_entry_get_all_extended_attributes(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	uint8_t expected_data[ 35 ] = {
+		0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 'u', 's', 'e', 'r', '.', 'a', 0x00, 'x',
+		'y', 'z', 0x09, 0x00, 0x01, 0x00, 0x88, 0x13, 0x00, 0x00, 'u', 's', 'e', 'r', '.', 'b',
+		'i', 'g', 0x00 };
+
+	libcerror_error_t *error                      = NULL;
+	libfsext_attribute_values_t *attribute_values = NULL;
+	libfsext_internal_file_entry_t file_entry;
+	size_t required_data_size                     = 0;
+	int entry_index                               = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &file_entry,
+	 0,
+	 sizeof( libfsext_internal_file_entry_t ) );
+
+	result = libcdata_array_initialize(
+	          &( file_entry.extended_attributes_array ),
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first extended attribute has its value stored in the attribute entry
+	 */
+	result = libfsext_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->name = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * 7 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values->name",
+	 attribute_values->name );
+
+	memory_copy(
+	 attribute_values->name,
+	 "user.a",
+	 7 );
+
+	attribute_values->name_size = 7;
+
+	attribute_values->value_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * 3 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values->value_data",
+	 attribute_values->value_data );
+
+	memory_copy(
+	 attribute_values->value_data,
+	 "xyz",
+	 3 );
+
+	attribute_values->value_data_size = 3;
+
+	result = libcdata_array_append_entry(
+	          file_entry.extended_attributes_array,
+	          &entry_index,
+	          (intptr_t *) attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values = NULL;
+
+	/* The second extended attribute has its value stored in a separate inode
+	 */
+	result = libfsext_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->name = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * 9 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values->name",
+	 attribute_values->name );
+
+	memory_copy(
+	 attribute_values->name,
+	 "user.big",
+	 9 );
+
+	attribute_values->name_size               = 9;
+	attribute_values->value_data_inode_number = 12;
+	attribute_values->value_data_size         = 5000;
+
+	result = libcdata_array_append_entry(
+	          file_entry.extended_attributes_array,
+	          &entry_index,
+	          (intptr_t *) attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfsext_internal_file_entry_get_all_extended_attributes(
+	          &file_entry,
+	          NULL,
+	          0,
+	          &required_data_size,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "required_data_size",
+	 required_data_size,
+	 (size_t) 35 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	required_data_size = 0;
+
+	result = libfsext_internal_file_entry_get_all_extended_attributes(
+	          &file_entry,
+	          data,
+	          64,
+	          &required_data_size,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "required_data_size",
+	 required_data_size,
+	 (size_t) 35 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          35 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsext_internal_file_entry_get_all_extended_attributes(
+	          NULL,
+	          data,
+	          64,
+	          &required_data_size,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_internal_file_entry_get_all_extended_attributes(
+	          &file_entry,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_data_size,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_internal_file_entry_get_all_extended_attributes(
+	          &file_entry,
+	          data,
+	          64,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data too small
+	 */
+	result = libfsext_internal_file_entry_get_all_extended_attributes(
+	          &file_entry,
+	          data,
+	          34,
+	          &required_data_size,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_file_entry_get_all_extended_attributes_size(
+	          NULL,
+	          &required_data_size,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_file_entry_get_all_extended_attributes(
+	          NULL,
+	          data,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_file_entry_get_all_extended_attributes(
+	          (libfsext_file_entry_t *) &file_entry,
+	          NULL,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &( file_entry.extended_attributes_array ),
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_attribute_values_free,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsext_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	if( file_entry.extended_attributes_array != NULL )
+	{
+		libcdata_array_free(
+		 &( file_entry.extended_attributes_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_attribute_values_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_internal_file_entry_get_attribute_values_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_internal_file_entry_get_attribute_values_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	libfsext_attribute_values_t *attribute_values          = NULL;
+	libfsext_attribute_values_t *expected_attribute_values = NULL;
+	libfsext_internal_file_entry_t file_entry;
+	int entry_index                                        = 0;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &file_entry,
+	 0,
+	 sizeof( libfsext_internal_file_entry_t ) );
+
+	result = libcdata_array_initialize(
+	          &( file_entry.extended_attributes_array ),
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->name = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * 7 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values->name",
+	 attribute_values->name );
+
+	memory_copy(
+	 attribute_values->name,
+	 "user.a",
+	 7 );
+
+	attribute_values->name_size = 7;
+
+	result = libfsext_attribute_values_calculate_utf8_name_hash(
+	          attribute_values->name,
+	          6,
+	          &( attribute_values->name_hash ),
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          file_entry.extended_attributes_array,
+	          &entry_index,
+	          (intptr_t *) attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values = NULL;
+
+	result = libfsext_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->name = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * 7 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values->name",
+	 attribute_values->name );
+
+	memory_copy(
+	 attribute_values->name,
+	 "user.b",
+	 7 );
+
+	attribute_values->name_size = 7;
+
+	result = libfsext_attribute_values_calculate_utf8_name_hash(
+	          attribute_values->name,
+	          6,
+	          &( attribute_values->name_hash ),
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          file_entry.extended_attributes_array,
+	          &entry_index,
+	          (intptr_t *) attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values = NULL;
+
+	/* The third extended attribute reuses the name of the first one
+	 */
+	result = libfsext_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->name = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * 7 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values->name",
+	 attribute_values->name );
+
+	memory_copy(
+	 attribute_values->name,
+	 "user.a",
+	 7 );
+
+	attribute_values->name_size = 7;
+
+	result = libfsext_attribute_values_calculate_utf8_name_hash(
+	          attribute_values->name,
+	          6,
+	          &( attribute_values->name_hash ),
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          file_entry.extended_attributes_array,
+	          &entry_index,
+	          (intptr_t *) attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values = NULL;
+
+	result = libfsext_internal_file_entry_build_extended_attributes_hash_table(
+	          &file_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry.extended_attributes_hash_buckets",
+	 file_entry.extended_attributes_hash_buckets );
+
+	/* Test regular cases
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          file_entry.extended_attributes_array,
+	          1,
+	          (intptr_t **) &expected_attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
+	          &file_entry,
+	          (uint8_t *) "user.b",
+	          6,
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "attribute_values == expected_attribute_values",
+	 (int) ( attribute_values == expected_attribute_values ),
+	 1 );
+
+	attribute_values = NULL;
+
+	/* The first of the attributes with the same name is returned
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          file_entry.extended_attributes_array,
+	          0,
+	          (intptr_t **) &expected_attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
+	          &file_entry,
+	          (uint8_t *) "user.a",
+	          6,
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "attribute_values == expected_attribute_values",
+	 (int) ( attribute_values == expected_attribute_values ),
+	 1 );
+
+	attribute_values = NULL;
+
+	result = libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
+	          &file_entry,
+	          (uint8_t *) "user.c",
+	          6,
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_internal_file_entry_build_extended_attributes_hash_table(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_internal_file_entry_get_attribute_values_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "user.a",
+	          6,
+	          &attribute_values,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 file_entry.extended_attributes_hash_chains );
+
+	file_entry.extended_attributes_hash_chains = NULL;
+
+	memory_free(
+	 file_entry.extended_attributes_hash_buckets );
+
+	file_entry.extended_attributes_hash_buckets = NULL;
+
+	result = libcdata_array_free(
+	          &( file_entry.extended_attributes_array ),
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_attribute_values_free,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry.extended_attributes_hash_chains != NULL )
+	{
+		memory_free(
+		 file_entry.extended_attributes_hash_chains );
+	}
+	if( file_entry.extended_attributes_hash_buckets != NULL )
+	{
+		memory_free(
+		 file_entry.extended_attributes_hash_buckets );
+	}
+	if( file_entry.extended_attributes_array != NULL )
+	{
+		libcdata_array_free(
+		 &( file_entry.extended_attributes_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_attribute_values_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
 
 /* The main program
@@ -147,9 +945,16 @@ int main(
 	/* TODO: add tests for libfsext_file_entry_get_size */
 
 	/* TODO: add tests for libfsext_file_entry_get_number_of_extents */
-
 	/* TODO: add tests for libfsext_file_entry_get_extent_by_index */
 
+	FSEXT_TEST_RUN(
+	 "libfsext_internal_file_entry_get_all_extended_attributes",
+	 fsext_test_internal_file_entry_get_all_extended_attributes );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_internal_file_entry_get_attribute_values_by_utf8_name",
+	 fsext_test_internal_file_entry_get_attribute_values_by_utf8_name );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -317,10 +317,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsext_inode_clone function
+/* Tests the libfsext_inode_get_reference function
  * Returns 1 if successful or 0 if not
  */
-int fsext_test_inode_clone(
+int fsext_test_inode_get_reference(
      void )
 {
 	libcerror_error_t *error            = NULL;
@@ -328,15 +328,6 @@ int fsext_test_inode_clone(
 	libfsext_inode_t *source_inode      = NULL;
 	int result                          = 0;
 
-#if defined( HAVE_FSEXT_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 2;
-	int test_number                 = 0;
-
-#if defined( OPTIMIZATION_DISABLED )
-	int number_of_memcpy_fail_tests = 1;
-#endif
-#endif /* defined( HAVE_FSEXT_TEST_MEMORY ) */
-
 	/* Initialize test
 	 */
 	result = libfsext_inode_initialize(
@@ -358,7 +349,7 @@ int fsext_test_inode_clone(
 
 	/* Test regular cases
 	 */
-	result = libfsext_inode_clone(
+	result = libfsext_inode_get_reference(
 	          &destination_inode,
 	          source_inode,
 	          &error );
@@ -376,6 +367,13 @@ int fsext_test_inode_clone(
 	 "error",
 	 error );
 
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "source_inode->number_of_references",
+	 source_inode->number_of_references,
+	 2 );
+
+	/* Freeing a reference does not free the inode while other references remain
+	 */
 	result = libfsext_inode_free(
 	          &destination_inode,
 	          &error );
@@ -393,7 +391,64 @@ int fsext_test_inode_clone(
 	 "error",
 	 error );
 
-	result = libfsext_inode_clone(
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "source_inode->number_of_references",
+	 source_inode->number_of_references,
+	 1 );
+
+	/* Freeing the original inode does not free it while other references remain
+	 */
+	source_inode->flags = 0x00080000UL;
+
+	result = libfsext_inode_get_reference(
+	          &destination_inode,
+	          source_inode,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_free(
+	          &source_inode,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "source_inode",
+	 source_inode );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_inode",
+	 destination_inode );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "destination_inode->number_of_references",
+	 destination_inode->number_of_references,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_inode->flags",
+	 destination_inode->flags,
+	 (uint32_t) 0x00080000UL );
+
+	source_inode      = destination_inode;
+	destination_inode = NULL;
+
+	result = libfsext_inode_get_reference(
 	          &destination_inode,
 	          NULL,
 	          &error );
@@ -413,7 +468,7 @@ int fsext_test_inode_clone(
 
 	/* Test error cases
 	 */
-	result = libfsext_inode_clone(
+	result = libfsext_inode_get_reference(
 	          NULL,
 	          source_inode,
 	          &error );
@@ -432,11 +487,13 @@ int fsext_test_inode_clone(
 
 	destination_inode = (libfsext_inode_t *) 0x12345678UL;
 
-	result = libfsext_inode_clone(
+	result = libfsext_inode_get_reference(
 	          &destination_inode,
 	          source_inode,
 	          &error );
 
+	destination_inode = NULL;
+
 	FSEXT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -449,101 +506,6 @@ int fsext_test_inode_clone(
 	libcerror_error_free(
 	 &error );
 
-	destination_inode = NULL;
-
-#if defined( HAVE_FSEXT_TEST_MEMORY )
-
-	for( test_number = 0;
-	     test_number < number_of_malloc_fail_tests;
-	     test_number++ )
-	{
-		/* Test libfsext_inode_clone with malloc failing
-		 */
-		fsext_test_malloc_attempts_before_fail = test_number;
-
-		result = libfsext_inode_clone(
-		          &destination_inode,
-		          source_inode,
-		          &error );
-
-		if( fsext_test_malloc_attempts_before_fail != -1 )
-		{
-			fsext_test_malloc_attempts_before_fail = -1;
-
-			if( destination_inode != NULL )
-			{
-				libfsext_inode_free(
-				 &destination_inode,
-				 NULL );
-			}
-		}
-		else
-		{
-			FSEXT_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
-
-			FSEXT_TEST_ASSERT_IS_NULL(
-			 "destination_inode",
-			 destination_inode );
-
-			FSEXT_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
-
-			libcerror_error_free(
-			 &error );
-		}
-	}
-#if defined( OPTIMIZATION_DISABLED )
-
-	for( test_number = 0;
-	     test_number < number_of_memcpy_fail_tests;
-	     test_number++ )
-	{
-		/* Test libfsext_inode_clone with memcpy failing
-		 */
-		fsext_test_memcpy_attempts_before_fail = 0;
-
-		result = libfsext_inode_clone(
-		          &destination_inode,
-		          source_inode,
-		          &error );
-
-		if( fsext_test_memcpy_attempts_before_fail != -1 )
-		{
-			fsext_test_memcpy_attempts_before_fail = -1;
-
-			if( destination_inode != NULL )
-			{
-				libfsext_inode_free(
-				 &destination_inode,
-				 NULL );
-			}
-		}
-		else
-		{
-			FSEXT_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
-
-			FSEXT_TEST_ASSERT_IS_NULL(
-			 "destination_inode",
-			 destination_inode );
-
-			FSEXT_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
-
-			libcerror_error_free(
-			 &error );
-		}
-	}
-#endif /* defined( OPTIMIZATION_DISABLED ) */
-#endif /* defined( HAVE_FSEXT_TEST_MEMORY ) */
-
 	/* Clean up
 	 */
 	result = libfsext_inode_free(
@@ -1898,8 +1860,8 @@ int main(
 	 fsext_test_inode_free );
 
 	FSEXT_TEST_RUN(
-	 "libfsext_inode_clone",
-	 fsext_test_inode_clone );
+	 "libfsext_inode_get_reference",
+	 fsext_test_inode_get_reference );
 
 	FSEXT_TEST_RUN(
 	 "libfsext_inode_read_data",
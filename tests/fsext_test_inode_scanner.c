@@ -0,0 +1,768 @@
+/*
+ * Library inode_scanner type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+#include "fsext_test_macros.h"
+#include "fsext_test_memory.h"
+#include "fsext_test_unused.h"
+
+#include "../libfsext/libfsext_inode_scanner.h"
+#include "../libfsext/libfsext_io_handle.h"
+#include "../libfsext/libfsext_libcdata.h"
+#include "../libfsext/libfsext_superblock.h"
+
+/* Deleted inode with an intact extents header of 1 extent at physical block 7
+ */
+uint8_t fsext_test_inode_scanner_inode_data1[ 128 ] = {
+	0xed, 0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb4, 0x69, 0x47, 0x55, 0xb4, 0x69, 0x47, 0x55,
+	0xb4, 0x69, 0x47, 0x55, 0xb4, 0x69, 0x47, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf3, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Deleted inode of which the extents header was cleared
+ */
+uint8_t fsext_test_inode_scanner_inode_data2[ 128 ] = {
+	0xed, 0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb4, 0x69, 0x47, 0x55, 0xb4, 0x69, 0x47, 0x55,
+	0xb4, 0x69, 0x47, 0x55, 0xb4, 0x69, 0x47, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf3, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Allocated inode with 3 links and without a deletion time
+ */
+uint8_t fsext_test_inode_scanner_inode_data3[ 128 ] = {
+	0xed, 0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb4, 0x69, 0x47, 0x55, 0xb4, 0x69, 0x47, 0x55,
+	0xb4, 0x69, 0x47, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf3, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Tests the libfsext_inode_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_inode_scanner_initialize(
+     libfsext_io_handle_t *io_handle,
+     libfsext_superblock_t *superblock,
+     libcdata_array_t *group_descriptors_array )
+{
+	libcerror_error_t *error                = NULL;
+	libfsext_inode_scanner_t *inode_scanner = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 2;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsext_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          superblock,
+	          group_descriptors_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "inode_scanner->inode_table_data_size",
+	 inode_scanner->inode_table_data_size,
+	 (size_t) 128 * 128 );
+
+	result = libfsext_inode_scanner_free(
+	          &inode_scanner,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_inode_scanner_initialize(
+	          NULL,
+	          io_handle,
+	          superblock,
+	          group_descriptors_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_scanner = (libfsext_inode_scanner_t *) 0x12345678UL;
+
+	result = libfsext_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          superblock,
+	          group_descriptors_array,
+	          &error );
+
+	inode_scanner = NULL;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_inode_scanner_initialize(
+	          &inode_scanner,
+	          NULL,
+	          superblock,
+	          group_descriptors_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          NULL,
+	          group_descriptors_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          superblock,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_inode_scanner_initialize with malloc failing
+		 */
+		fsext_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsext_inode_scanner_initialize(
+		          &inode_scanner,
+		          io_handle,
+		          superblock,
+		          group_descriptors_array,
+		          &error );
+
+		if( fsext_test_malloc_attempts_before_fail != -1 )
+		{
+			fsext_test_malloc_attempts_before_fail = -1;
+
+			if( inode_scanner != NULL )
+			{
+				libfsext_inode_scanner_free(
+				 &inode_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "inode_scanner",
+			 inode_scanner );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_inode_scanner_initialize with memset failing
+		 */
+		fsext_test_memset_attempts_before_fail = test_number;
+
+		result = libfsext_inode_scanner_initialize(
+		          &inode_scanner,
+		          io_handle,
+		          superblock,
+		          group_descriptors_array,
+		          &error );
+
+		if( fsext_test_memset_attempts_before_fail != -1 )
+		{
+			fsext_test_memset_attempts_before_fail = -1;
+
+			if( inode_scanner != NULL )
+			{
+				libfsext_inode_scanner_free(
+				 &inode_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "inode_scanner",
+			 inode_scanner );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSEXT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_scanner != NULL )
+	{
+		libfsext_inode_scanner_free(
+		 &inode_scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_inode_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_inode_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsext_inode_scanner_free(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_inode_scanner_check_inode_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_inode_scanner_check_inode_data(
+     libfsext_inode_scanner_t *inode_scanner )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_inode_scanner_check_inode_data(
+	          inode_scanner,
+	          fsext_test_inode_scanner_inode_data1,
+	          128,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_scanner_check_inode_data(
+	          inode_scanner,
+	          fsext_test_inode_scanner_inode_data2,
+	          128,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_inode_scanner_check_inode_data(
+	          inode_scanner,
+	          fsext_test_inode_scanner_inode_data3,
+	          128,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_inode_scanner_check_inode_data(
+	          NULL,
+	          fsext_test_inode_scanner_inode_data1,
+	          128,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_inode_scanner_check_inode_data(
+	          inode_scanner,
+	          NULL,
+	          128,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_inode_scanner_check_inode_data(
+	          inode_scanner,
+	          fsext_test_inode_scanner_inode_data1,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+	libcdata_array_t *group_descriptors_array = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfsext_inode_scanner_t *inode_scanner   = NULL;
+	libfsext_io_handle_t *io_handle           = NULL;
+	libfsext_superblock_t *superblock         = NULL;
+	int result                                = 0;
+#endif
+
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	/* Initialize test
+	 */
+	result = libfsext_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version = 4;
+	io_handle->block_size     = 1024;
+	io_handle->inode_size     = 128;
+
+	result = libfsext_superblock_initialize(
+	          &superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "superblock",
+	 superblock );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	superblock->number_of_blocks                 = 8192;
+	superblock->first_data_block_number          = 1;
+	superblock->number_of_blocks_per_block_group = 8192;
+	superblock->number_of_inodes_per_block_group = 128;
+	superblock->first_non_reserved_inode         = 11;
+	superblock->inode_size                       = 128;
+
+	result = libcdata_array_initialize(
+	          &group_descriptors_array,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "group_descriptors_array",
+	 group_descriptors_array );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_inode_scanner_initialize",
+	 fsext_test_inode_scanner_initialize,
+	 io_handle,
+	 superblock,
+	 group_descriptors_array );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_inode_scanner_free",
+	 fsext_test_inode_scanner_free );
+
+	result = libfsext_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          superblock,
+	          group_descriptors_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_inode_scanner_check_inode_data",
+	 fsext_test_inode_scanner_check_inode_data,
+	 inode_scanner );
+
+	/* Clean up
+	 */
+	result = libfsext_inode_scanner_free(
+	          &inode_scanner,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &group_descriptors_array,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "group_descriptors_array",
+	 group_descriptors_array );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_superblock_free(
+	          &superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "superblock",
+	 superblock );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_scanner != NULL )
+	{
+		libfsext_inode_scanner_free(
+		 &inode_scanner,
+		 NULL );
+	}
+	if( group_descriptors_array != NULL )
+	{
+		libcdata_array_free(
+		 &group_descriptors_array,
+		 NULL,
+		 NULL );
+	}
+	if( superblock != NULL )
+	{
+		libfsext_superblock_free(
+		 &superblock,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsext_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+}
+
@@ -398,6 +398,288 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsext_io_handle_get_statistics_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_io_handle_get_statistics_value(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsext_io_handle_t *io_handle = NULL;
+	uint64_t start_time             = 0;
+	uint64_t value                  = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfsext_io_handle_update_read_statistics(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_DATA_NUMBER_OF_READS,
+	 4096 );
+
+	libfsext_io_handle_increment_statistics_value(
+	 io_handle,
+	 LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_HITS,
+	 2 );
+
+	/* The checksum verification is not timed by default
+	 */
+	start_time = libfsext_io_handle_get_checksum_start_time(
+	              io_handle );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "start_time",
+	 start_time,
+	 (uint64_t) 0 );
+
+	libfsext_io_handle_update_checksum_statistics(
+	 io_handle,
+	 start_time );
+
+	/* Test regular cases
+	 */
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          LIBFSEXT_STATISTICS_VALUE_DATA_NUMBER_OF_READS,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          LIBFSEXT_STATISTICS_VALUE_DATA_READ_SIZE,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 4096 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          LIBFSEXT_STATISTICS_VALUE_BLOCK_CACHE_HITS,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 2 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          LIBFSEXT_STATISTICS_VALUE_NUMBER_OF_CHECKSUM_VERIFICATIONS,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          LIBFSEXT_STATISTICS_VALUE_CHECKSUM_VERIFICATION_TIME,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_reset_statistics(
+	          io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          LIBFSEXT_STATISTICS_VALUE_DATA_READ_SIZE,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_io_handle_get_statistics_value(
+	          NULL,
+	          LIBFSEXT_STATISTICS_VALUE_DATA_READ_SIZE,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          -1,
+	          &value,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_io_handle_get_statistics_value(
+	          io_handle,
+	          LIBFSEXT_STATISTICS_VALUE_DATA_READ_SIZE,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsext_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +711,10 @@ int main(
 	 "libfsext_io_handle_clear",
 	 fsext_test_io_handle_clear );
 
+	FSEXT_TEST_RUN(
+	 "libfsext_io_handle_get_statistics_value",
+	 fsext_test_io_handle_get_statistics_value );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,2247 @@
+/*
+ * Library journal type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsext_test_functions.h"
+#include "fsext_test_libbfio.h"
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+#include "fsext_test_macros.h"
+#include "fsext_test_memory.h"
+#include "fsext_test_unused.h"
+
+#include "../libfsext/libfsext_definitions.h"
+#include "../libfsext/libfsext_extent.h"
+#include "../libfsext/libfsext_journal.h"
+#include "../libfsext/libfsext_libcdata.h"
+
+uint8_t fsext_test_journal_superblock_data1[ 1024 ] = {
+	0xc0, 0x3b, 0x39, 0x98, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fsext_test_journal_descriptor_block_data1[ 1024 ] = {
+	0xc0, 0x3b, 0x39, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fsext_test_journal_revoke_block_data1[ 1024 ] = {
+	0xc0, 0x3b, 0x39, 0x98, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Writes a journal block header
+ */
+void fsext_test_journal_set_block_header(
+      uint8_t *data,
+      uint32_t block_type,
+      uint32_t sequence_number )
+{
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 0 ] ),
+	 0xc03b3998UL );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 4 ] ),
+	 block_type );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 8 ] ),
+	 sequence_number );
+}
+
+/* Writes a journal descriptor block tag
+ * Returns the offset of the next block tag
+ */
+size_t fsext_test_journal_set_block_tag(
+        uint8_t *data,
+        size_t data_offset,
+        size_t block_tag_size,
+        uint64_t block_number,
+        uint32_t flags )
+{
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ data_offset ] ),
+	 (uint32_t) block_number );
+
+	/* A version 3 block tag has 32-bit flags
+	 */
+	if( block_tag_size == 16 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data[ data_offset + 4 ] ),
+		 flags );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data[ data_offset + 8 ] ),
+		 (uint32_t) ( block_number >> 32 ) );
+	}
+	else
+	{
+		byte_stream_copy_from_uint16_big_endian(
+		 &( data[ data_offset + 6 ] ),
+		 (uint16_t) flags );
+	}
+	data_offset += block_tag_size;
+
+	if( ( flags & LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_SAME_IDENTIFIER ) == 0 )
+	{
+		data_offset += 16;
+	}
+	return( data_offset );
+}
+
+/* Writes a journal with 10 log blocks starting at block 20 of the volume data
+ * The log starts at log block 8 and wraps around to log block 1, it contains:
+ *   log block 8: descriptor of transaction 10 with copies of blocks 100 and 101 in log blocks 9 and 1
+ *   log block 2: commit of transaction 10
+ *   log block 3: revoke of block 101 in transaction 11
+ *   log block 4: descriptor of transaction 11 with an escaped copy of block 100 in log block 5
+ *   log block 6: commit of transaction 11
+ *   log block 7: commit of stale transaction 4
+ * If the 64-bit feature is used the block numbers are offset by 2^32
+ */
+void fsext_test_journal_set_volume_data(
+      uint8_t *volume_data,
+      uint32_t incompatible_features_flags,
+      size_t block_tag_size )
+{
+	uint8_t *data          = NULL;
+	size_t data_offset     = 0;
+	uint64_t block_number1 = 100;
+	uint64_t block_number2 = 101;
+
+	if( ( incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT ) != 0 )
+	{
+		block_number1 += (uint64_t) 1 << 32;
+		block_number2 += (uint64_t) 1 << 32;
+	}
+	memory_set(
+	 volume_data,
+	 0,
+	 30 * 1024 );
+
+	/* Log block 0 contains the journal superblock
+	 */
+	data = &( volume_data[ 20 * 1024 ] );
+
+	fsext_test_journal_set_block_header(
+	 data,
+	 LIBFSEXT_JOURNAL_BLOCK_TYPE_SUPERBLOCK_VERSION2,
+	 0 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 12 ] ),
+	 1024 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 16 ] ),
+	 10 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 20 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 24 ] ),
+	 10 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 28 ] ),
+	 8 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 40 ] ),
+	 incompatible_features_flags );
+
+	/* Transaction 10
+	 */
+	data = &( volume_data[ 28 * 1024 ] );
+
+	fsext_test_journal_set_block_header(
+	 data,
+	 LIBFSEXT_JOURNAL_BLOCK_TYPE_DESCRIPTOR,
+	 10 );
+
+	data_offset = fsext_test_journal_set_block_tag(
+	               data,
+	               12,
+	               block_tag_size,
+	               block_number1,
+	               0 );
+
+	data_offset = fsext_test_journal_set_block_tag(
+	               data,
+	               data_offset,
+	               block_tag_size,
+	               block_number2,
+	               LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_SAME_IDENTIFIER | LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_LAST_TAG );
+
+	memory_set(
+	 &( volume_data[ 29 * 1024 ] ),
+	 0xa1,
+	 1024 );
+
+	memory_set(
+	 &( volume_data[ 21 * 1024 ] ),
+	 0xb1,
+	 1024 );
+
+	fsext_test_journal_set_block_header(
+	 &( volume_data[ 22 * 1024 ] ),
+	 LIBFSEXT_JOURNAL_BLOCK_TYPE_COMMIT,
+	 10 );
+
+	/* Transaction 11
+	 */
+	data = &( volume_data[ 23 * 1024 ] );
+
+	fsext_test_journal_set_block_header(
+	 data,
+	 LIBFSEXT_JOURNAL_BLOCK_TYPE_REVOKE,
+	 11 );
+
+	if( ( incompatible_features_flags & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT ) != 0 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data[ 12 ] ),
+		 24 );
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( data[ 16 ] ),
+		 block_number2 );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data[ 12 ] ),
+		 20 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data[ 16 ] ),
+		 (uint32_t) block_number2 );
+	}
+	data = &( volume_data[ 24 * 1024 ] );
+
+	fsext_test_journal_set_block_header(
+	 data,
+	 LIBFSEXT_JOURNAL_BLOCK_TYPE_DESCRIPTOR,
+	 11 );
+
+	data_offset = fsext_test_journal_set_block_tag(
+	               data,
+	               12,
+	               block_tag_size,
+	               block_number1,
+	               LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_ESCAPED | LIBFSEXT_JOURNAL_BLOCK_TAG_FLAG_LAST_TAG );
+
+	/* The signature at the start of an escaped copy is stored as zero bytes
+	 */
+	memory_set(
+	 &( volume_data[ ( 25 * 1024 ) + 4 ] ),
+	 0xa2,
+	 1024 - 4 );
+
+	fsext_test_journal_set_block_header(
+	 &( volume_data[ 26 * 1024 ] ),
+	 LIBFSEXT_JOURNAL_BLOCK_TYPE_COMMIT,
+	 11 );
+
+	/* A commit left behind by an older transaction
+	 */
+	fsext_test_journal_set_block_header(
+	 &( volume_data[ 27 * 1024 ] ),
+	 LIBFSEXT_JOURNAL_BLOCK_TYPE_COMMIT,
+	 4 );
+}
+
+/* Creates an extents array that maps the 10 log blocks of the journal onto block 20 of the volume data
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_test_journal_initialize_extents_array(
+     libcdata_array_t **extents_array,
+     libcerror_error_t **error )
+{
+	libfsext_extent_t *extent = NULL;
+	int entry_index           = 0;
+
+	if( libcdata_array_initialize(
+	     extents_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsext_extent_initialize(
+	     &extent,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	extent->logical_block_number  = 0;
+	extent->physical_block_number = 20;
+	extent->number_of_blocks      = 10;
+
+	if( libcdata_array_append_entry(
+	     *extents_array,
+	     &entry_index,
+	     (intptr_t *) extent,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libfsext_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( *extents_array != NULL )
+	{
+		libcdata_array_free(
+		 extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsext_journal_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_journal_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsext_journal_t *journal     = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsext_journal_initialize(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_free(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_journal_initialize(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	journal = (libfsext_journal_t *) 0x12345678UL;
+
+	result = libfsext_journal_initialize(
+	          &journal,
+	          &error );
+
+	journal = NULL;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_journal_initialize with malloc failing
+		 */
+		fsext_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsext_journal_initialize(
+		          &journal,
+		          &error );
+
+		if( fsext_test_malloc_attempts_before_fail != -1 )
+		{
+			fsext_test_malloc_attempts_before_fail = -1;
+
+			if( journal != NULL )
+			{
+				libfsext_journal_free(
+				 &journal,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "journal",
+			 journal );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_journal_initialize with memset failing
+		 */
+		fsext_test_memset_attempts_before_fail = test_number;
+
+		result = libfsext_journal_initialize(
+		          &journal,
+		          &error );
+
+		if( fsext_test_memset_attempts_before_fail != -1 )
+		{
+			fsext_test_memset_attempts_before_fail = -1;
+
+			if( journal != NULL )
+			{
+				libfsext_journal_free(
+				 &journal,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "journal",
+			 journal );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSEXT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( journal != NULL )
+	{
+		libfsext_journal_free(
+		 &journal,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_journal_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_journal_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsext_journal_free(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_journal_read_superblock_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_journal_read_superblock_data(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libfsext_journal_t *journal = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_journal_initialize(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_journal_read_superblock_data(
+	          journal,
+	          fsext_test_journal_superblock_data1,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "journal->block_size",
+	 journal->block_size,
+	 (uint32_t) 1024 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "journal->number_of_blocks",
+	 journal->number_of_blocks,
+	 (uint32_t) 1024 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "journal->first_log_block_number",
+	 journal->first_log_block_number,
+	 (uint32_t) 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "journal->first_sequence_number",
+	 journal->first_sequence_number,
+	 (uint32_t) 2 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "journal->start_log_block_number",
+	 journal->start_log_block_number,
+	 (uint32_t) 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "journal->block_tag_size",
+	 journal->block_tag_size,
+	 (size_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libfsext_journal_read_superblock_data(
+	          NULL,
+	          fsext_test_journal_superblock_data1,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_read_superblock_data(
+	          journal,
+	          NULL,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_read_superblock_data(
+	          journal,
+	          fsext_test_journal_superblock_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_read_superblock_data(
+	          journal,
+	          fsext_test_journal_superblock_data1,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where signature is invalid
+	 */
+	result = libfsext_journal_read_superblock_data(
+	          journal,
+	          fsext_test_journal_descriptor_block_data1,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_journal_free(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( journal != NULL )
+	{
+		libfsext_journal_free(
+		 &journal,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_journal_read_descriptor_block_data, libfsext_journal_read_revoke_block_data
+ * and libfsext_journal_resolve_block_entries functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_journal_resolve_block_entries(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsext_journal_block_entry_t *block_entry = NULL;
+	libfsext_journal_t *journal                 = NULL;
+	uint32_t log_block_number                   = 0;
+	int first_block_entry_index                 = 0;
+	int number_of_block_entries                 = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_journal_initialize(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_read_superblock_data(
+	          journal,
+	          fsext_test_journal_superblock_data1,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	log_block_number = 1;
+
+	result = libfsext_journal_read_descriptor_block_data(
+	          journal,
+	          fsext_test_journal_descriptor_block_data1,
+	          1024,
+	          &log_block_number,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "log_block_number",
+	 log_block_number,
+	 (uint32_t) 3 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "journal->number_of_block_entries",
+	 journal->number_of_block_entries,
+	 2 );
+
+	libfsext_journal_commit_transaction(
+	 journal );
+
+	result = libfsext_journal_read_revoke_block_data(
+	          journal,
+	          fsext_test_journal_revoke_block_data1,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "journal->number_of_revoke_entries",
+	 journal->number_of_revoke_entries,
+	 1 );
+
+	libfsext_journal_commit_transaction(
+	 journal );
+
+	/* The block entries of a transaction that is not committed are discarded
+	 */
+	log_block_number = 5;
+
+	result = libfsext_journal_read_descriptor_block_data(
+	          journal,
+	          fsext_test_journal_descriptor_block_data1,
+	          1024,
+	          &log_block_number,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_resolve_block_entries(
+	          journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Block 100 was revoked by a later transaction but is retained as history
+	 */
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "journal->number_of_block_entries",
+	 journal->number_of_block_entries,
+	 2 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "journal->number_of_current_block_entries",
+	 journal->number_of_current_block_entries,
+	 1 );
+
+	result = libfsext_journal_get_block_entries_by_block_number(
+	          journal,
+	          100,
+	          &first_block_entry_index,
+	          &number_of_block_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "first_block_entry_index",
+	 first_block_entry_index,
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_block_entries",
+	 number_of_block_entries,
+	 1 );
+
+	result = libfsext_journal_get_block_entries_by_block_number(
+	          journal,
+	          150,
+	          &first_block_entry_index,
+	          &number_of_block_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_get_block_entry_by_block_number(
+	          journal,
+	          200,
+	          &block_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "block_entry",
+	 block_entry );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "block_entry->journal_block_number",
+	 block_entry->journal_block_number,
+	 (uint64_t) 3 );
+
+	result = libfsext_journal_get_block_entry_by_block_number(
+	          journal,
+	          100,
+	          &block_entry,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_journal_read_descriptor_block_data(
+	          NULL,
+	          fsext_test_journal_descriptor_block_data1,
+	          1024,
+	          &log_block_number,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_read_descriptor_block_data(
+	          journal,
+	          fsext_test_journal_descriptor_block_data1,
+	          1024,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_read_revoke_block_data(
+	          journal,
+	          NULL,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_resolve_block_entries(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_get_block_entries_by_block_number(
+	          NULL,
+	          100,
+	          &first_block_entry_index,
+	          &number_of_block_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_get_block_entries_by_block_number(
+	          journal,
+	          100,
+	          NULL,
+	          &number_of_block_entries,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_get_block_entry_by_block_number(
+	          journal,
+	          200,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_journal_free(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( journal != NULL )
+	{
+		libfsext_journal_free(
+		 &journal,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_journal_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_journal_read_file_io_handle(
+     void )
+{
+	uint8_t volume_data[ 30 * 1024 ];
+
+	uint32_t incompatible_features_flags[ 2 ] = {
+		LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_REVOKE | LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION2,
+		LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_REVOKE | LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT | LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION3 };
+
+	/* A version 2 block tag without the 64-bit feature is 10 bytes, a version 3 block tag is 16 bytes
+	 */
+	size_t block_tag_sizes[ 2 ] = { 10, 16 };
+
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcdata_array_t *empty_extents_array       = NULL;
+	libcdata_array_t *extents_array             = NULL;
+	libcerror_error_t *error                    = NULL;
+	libfsext_journal_block_entry_t *block_entry = NULL;
+	libfsext_journal_t *journal                 = NULL;
+	uint64_t block_number1                      = 0;
+	uint64_t block_number2                      = 0;
+	int result                                  = 0;
+	int test_number                             = 0;
+
+	/* Initialize test
+	 */
+	result = fsext_test_journal_initialize_extents_array(
+	          &extents_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "extents_array",
+	 extents_array );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( test_number = 0;
+	     test_number < 2;
+	     test_number++ )
+	{
+		block_number1 = 100;
+		block_number2 = 101;
+
+		if( ( incompatible_features_flags[ test_number ] & LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_64BIT ) != 0 )
+		{
+			block_number1 += (uint64_t) 1 << 32;
+			block_number2 += (uint64_t) 1 << 32;
+		}
+		/* Test regular cases
+		 */
+		fsext_test_journal_set_volume_data(
+		 volume_data,
+		 incompatible_features_flags[ test_number ],
+		 block_tag_sizes[ test_number ] );
+
+		result = fsext_test_open_file_io_handle(
+		          &file_io_handle,
+		          volume_data,
+		          30 * 1024,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsext_journal_initialize(
+		          &journal,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NOT_NULL(
+		 "journal",
+		 journal );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsext_journal_read_file_io_handle(
+		          journal,
+		          file_io_handle,
+		          extents_array,
+		          1024,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSEXT_TEST_ASSERT_EQUAL_SIZE(
+		 "journal->block_tag_size",
+		 journal->block_tag_size,
+		 block_tag_sizes[ test_number ] );
+
+		/* Only transactions 10 and 11 are read, the log ends at the stale commit in log block 7
+		 */
+		FSEXT_TEST_ASSERT_EQUAL_UINT32(
+		 "journal->number_of_transactions",
+		 journal->number_of_transactions,
+		 2 );
+
+		/* Both copies of block 100 are retained in log order, the copy of block 101 was revoked
+		 * by transaction 11 and the log block numbers are mapped onto volume block numbers
+		 */
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "journal->number_of_block_entries",
+		 journal->number_of_block_entries,
+		 3 );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "journal->number_of_current_block_entries",
+		 journal->number_of_current_block_entries,
+		 1 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT64(
+		 "journal->block_entries[ 0 ].block_number",
+		 journal->block_entries[ 0 ].block_number,
+		 block_number1 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT64(
+		 "journal->block_entries[ 0 ].journal_block_number",
+		 journal->block_entries[ 0 ].journal_block_number,
+		 (uint64_t) 29 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT32(
+		 "journal->block_entries[ 0 ].transaction_index",
+		 journal->block_entries[ 0 ].transaction_index,
+		 0 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT8(
+		 "journal->block_entries[ 0 ].is_current",
+		 journal->block_entries[ 0 ].is_current,
+		 0 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT64(
+		 "journal->block_entries[ 1 ].block_number",
+		 journal->block_entries[ 1 ].block_number,
+		 block_number1 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT64(
+		 "journal->block_entries[ 1 ].journal_block_number",
+		 journal->block_entries[ 1 ].journal_block_number,
+		 (uint64_t) 25 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT32(
+		 "journal->block_entries[ 1 ].transaction_index",
+		 journal->block_entries[ 1 ].transaction_index,
+		 1 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT8(
+		 "journal->block_entries[ 1 ].is_escaped",
+		 journal->block_entries[ 1 ].is_escaped,
+		 1 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT8(
+		 "journal->block_entries[ 1 ].is_current",
+		 journal->block_entries[ 1 ].is_current,
+		 1 );
+
+		/* The copy of block 101 was stored in log block 1 after the log wrapped around
+		 */
+		FSEXT_TEST_ASSERT_EQUAL_UINT64(
+		 "journal->block_entries[ 2 ].block_number",
+		 journal->block_entries[ 2 ].block_number,
+		 block_number2 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT64(
+		 "journal->block_entries[ 2 ].journal_block_number",
+		 journal->block_entries[ 2 ].journal_block_number,
+		 (uint64_t) 21 );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT8(
+		 "journal->block_entries[ 2 ].is_current",
+		 journal->block_entries[ 2 ].is_current,
+		 0 );
+
+		result = libfsext_journal_get_block_entry_by_block_number(
+		          journal,
+		          block_number1,
+		          &block_entry,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSEXT_TEST_ASSERT_EQUAL_UINT64(
+		 "block_entry->journal_block_number",
+		 block_entry->journal_block_number,
+		 (uint64_t) 25 );
+
+		result = libfsext_journal_get_block_entry_by_block_number(
+		          journal,
+		          block_number2,
+		          &block_entry,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsext_journal_free(
+		          &journal,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "journal",
+		 journal );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fsext_test_close_file_io_handle(
+		          &file_io_handle,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	fsext_test_journal_set_volume_data(
+	 volume_data,
+	 incompatible_features_flags[ 0 ],
+	 block_tag_sizes[ 0 ] );
+
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          volume_data,
+	          30 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_initialize(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          extents_array,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_read_file_io_handle(
+	          journal,
+	          file_io_handle,
+	          extents_array,
+	          512,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a block size for which the journal superblock cannot be read
+	 */
+	result = libfsext_journal_read_file_io_handle(
+	          journal,
+	          file_io_handle,
+	          extents_array,
+	          2048,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a journal without a superblock
+	 */
+	result = libcdata_array_initialize(
+	          &empty_extents_array,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_read_file_io_handle(
+	          journal,
+	          file_io_handle,
+	          empty_extents_array,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_array_free(
+	          &empty_extents_array,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsext_journal_free(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &extents_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( journal != NULL )
+	{
+		libfsext_journal_free(
+		 &journal,
+		 NULL );
+	}
+	if( empty_extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &empty_extents_array,
+		 NULL,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_journal_overlay_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_journal_overlay_buffer(
+     void )
+{
+	uint8_t expected_buffer[ 3 * 1024 ];
+	uint8_t buffer[ 3 * 1024 ];
+	uint8_t volume_data[ 30 * 1024 ];
+
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcdata_array_t *extents_array       = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsext_journal_t *journal           = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	fsext_test_journal_set_volume_data(
+	 volume_data,
+	 LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_REVOKE | LIBFSEXT_JOURNAL_INCOMPATIBLE_FEATURES_FLAG_CHECKSUM_VERSION2,
+	 10 );
+
+	result = fsext_test_journal_initialize_extents_array(
+	          &extents_array,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "extents_array",
+	 extents_array );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          volume_data,
+	          30 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_initialize(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_journal_read_file_io_handle(
+	          journal,
+	          file_io_handle,
+	          extents_array,
+	          1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Only block 100 is overlaid, with the escaped signature restored, block 101 was revoked
+	 */
+	memory_set(
+	 buffer,
+	 0x55,
+	 3 * 1024 );
+
+	memory_set(
+	 expected_buffer,
+	 0x55,
+	 3 * 1024 );
+
+	memory_copy(
+	 &( expected_buffer[ 1024 ] ),
+	 fsext_journal_signature,
+	 4 );
+
+	memory_set(
+	 &( expected_buffer[ 1024 + 4 ] ),
+	 0xa2,
+	 1024 - 4 );
+
+	result = libfsext_journal_overlay_buffer(
+	          journal,
+	          file_io_handle,
+	          buffer,
+	          3 * 1024,
+	          99 * 1024,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          expected_buffer,
+	          3 * 1024 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a buffer that starts inside the escaped signature
+	 */
+	memory_set(
+	 buffer,
+	 0x55,
+	 8 );
+
+	result = libfsext_journal_overlay_buffer(
+	          journal,
+	          file_io_handle,
+	          buffer,
+	          8,
+	          ( 100 * 1024 ) + 2,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( expected_buffer[ 1024 + 2 ] ),
+	          8 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsext_journal_overlay_buffer(
+	          NULL,
+	          file_io_handle,
+	          buffer,
+	          8,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_overlay_buffer(
+	          journal,
+	          file_io_handle,
+	          NULL,
+	          8,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_overlay_buffer(
+	          journal,
+	          file_io_handle,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_journal_overlay_buffer(
+	          journal,
+	          file_io_handle,
+	          buffer,
+	          8,
+	          -1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_journal_free(
+	          &journal,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "journal",
+	 journal );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &extents_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( journal != NULL )
+	{
+		libfsext_journal_free(
+		 &journal,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsext_extent_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	FSEXT_TEST_RUN(
+	 "libfsext_journal_initialize",
+	 fsext_test_journal_initialize );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_journal_free",
+	 fsext_test_journal_free );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_journal_read_superblock_data",
+	 fsext_test_journal_read_superblock_data );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_journal_resolve_block_entries",
+	 fsext_test_journal_resolve_block_entries );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_journal_read_file_io_handle",
+	 fsext_test_journal_read_file_io_handle );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_journal_overlay_buffer",
+	 fsext_test_journal_overlay_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
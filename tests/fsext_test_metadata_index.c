@@ -0,0 +1,2086 @@
+/*
+ * Library metadata_index type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsext_test_functions.h"
+#include "fsext_test_libbfio.h"
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+#include "fsext_test_macros.h"
+#include "fsext_test_memory.h"
+#include "fsext_test_unused.h"
+
+#include "../libfsext/libfsext_checksum.h"
+#include "../libfsext/libfsext_metadata_index.h"
+#include "../libfsext/libfsext_superblock.h"
+
+uint8_t fsext_test_metadata_index_data1[ 368 ] = {
+	0x66, 0x73, 0x65, 0x78, 0x74, 0x69, 0x64, 0x78, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x38, 0x06, 0x1d,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x02, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xd8, 0x85, 0x57, 0x34, 0x16,
+	0x00, 0x00, 0xa0, 0xd8, 0x85, 0x57, 0x34, 0x16, 0x00, 0x00, 0xa0, 0xd8, 0x85, 0x57, 0x34, 0x16,
+	0x00, 0x00, 0xa0, 0xd8, 0x85, 0x57, 0x34, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0xa4, 0x81, 0x01, 0x00, 0xe8, 0x03, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x3a, 0x14, 0x86, 0x57, 0x34, 0x16,
+	0x00, 0xca, 0x3a, 0x14, 0x86, 0x57, 0x34, 0x16, 0x00, 0xca, 0x3a, 0x14, 0x86, 0x57, 0x34, 0x16,
+	0x00, 0xca, 0x3a, 0x14, 0x86, 0x57, 0x34, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x69, 0x6c, 0x65, 0x6c, 0x6f, 0x73, 0x74, 0x2b, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Tests the libfsext_metadata_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfsext_metadata_index_t *metadata_index = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_initialize(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_index = (libfsext_metadata_index_t *) 0x12345678UL;
+
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	metadata_index = NULL;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_metadata_index_initialize with malloc failing
+		 */
+		fsext_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsext_metadata_index_initialize(
+		          &metadata_index,
+		          &error );
+
+		if( fsext_test_malloc_attempts_before_fail != -1 )
+		{
+			fsext_test_malloc_attempts_before_fail = -1;
+
+			if( metadata_index != NULL )
+			{
+				libfsext_metadata_index_free(
+				 &metadata_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "metadata_index",
+			 metadata_index );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_metadata_index_initialize with memset failing
+		 */
+		fsext_test_memset_attempts_before_fail = test_number;
+
+		result = libfsext_metadata_index_initialize(
+		          &metadata_index,
+		          &error );
+
+		if( fsext_test_memset_attempts_before_fail != -1 )
+		{
+			fsext_test_memset_attempts_before_fail = -1;
+
+			if( metadata_index != NULL )
+			{
+				libfsext_metadata_index_free(
+				 &metadata_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "metadata_index",
+			 metadata_index );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSEXT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_index != NULL )
+	{
+		libfsext_metadata_index_free(
+		 &metadata_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_metadata_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_free(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_metadata_index_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_read_data(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfsext_metadata_index_t *metadata_index = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          fsext_test_metadata_index_data1,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_index->number_of_inodes",
+	 metadata_index->number_of_inodes,
+	 64 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_index->number_of_group_descriptors",
+	 metadata_index->number_of_group_descriptors,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_index->number_of_tree_entries",
+	 metadata_index->number_of_tree_entries,
+	 2 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_index->number_of_stat_records",
+	 metadata_index->number_of_stat_records,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          fsext_test_metadata_index_data1,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_read_data(
+	          NULL,
+	          fsext_test_metadata_index_data1,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          NULL,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          fsext_test_metadata_index_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          fsext_test_metadata_index_data1,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the checksum does not match
+	 */
+	fsext_test_metadata_index_data1[ 359 ] ^= 0xff;
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          fsext_test_metadata_index_data1,
+	          368,
+	          &error );
+
+	fsext_test_metadata_index_data1[ 359 ] ^= 0xff;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_index != NULL )
+	{
+		libfsext_metadata_index_free(
+		 &metadata_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Updates the checksum of metadata index test data
+ * Returns 1 if successful or -1 on error
+ */
+int fsext_test_metadata_index_update_checksum(
+     uint8_t *data,
+     size_t data_size )
+{
+	uint32_t checksum = 0;
+
+	if( libfsext_checksum_calculate_crc32(
+	     &checksum,
+	     data,
+	     124,
+	     0,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsext_checksum_calculate_crc32(
+	     &checksum,
+	     &( data[ 128 ] ),
+	     data_size - 128,
+	     checksum,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 124 ] ),
+	 checksum );
+
+	return( 1 );
+}
+
+/* Tests the libfsext_metadata_index_read_file_header function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_read_file_header(
+     void )
+{
+	uint8_t data[ 368 ];
+
+	libcerror_error_t *error                  = NULL;
+	libfsext_metadata_index_t *metadata_index = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with the checksum recalculated by the test
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_read_file_header(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_read_file_header(
+	          metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is not supported
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	data[ 0 ] = 0x00;
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the format version is not supported
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 2 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the header size is not supported
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 64 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the stored file size does not match the data size
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 (uint64_t) 376 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the checksum covers a modified stat record
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	data[ 240 ] ^= 0xff;
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the group descriptors are beyond the end of the data
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 56 ] ),
+	 (uint64_t) 368 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where there are more tree entries than fit in the data
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 68 ] ),
+	 100 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the stat records offset is not 8-byte aligned
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 96 ] ),
+	 (uint64_t) 0xe4 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the names extend beyond the end of the data
+	 */
+	memory_copy(
+	 data,
+	 fsext_test_metadata_index_data1,
+	 368 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 88 ] ),
+	 (uint64_t) 17 );
+
+	result = fsext_test_metadata_index_update_checksum(
+	          data,
+	          368 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          data,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_index != NULL )
+	{
+		libfsext_metadata_index_free(
+		 &metadata_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_metadata_index_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfsext_metadata_index_t *metadata_index = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsext_test_metadata_index_data1,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_metadata_index_read_file_io_handle(
+	          metadata_index,
+	          file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_index->number_of_tree_entries",
+	 metadata_index->number_of_tree_entries,
+	 2 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "metadata_index->names_offset",
+	 metadata_index->names_offset,
+	 (size_t) 352 );
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_read_file_io_handle(
+	          metadata_index,
+	          file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the file is smaller than the file header
+	 */
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsext_test_metadata_index_data1,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_read_file_io_handle(
+	          metadata_index,
+	          file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index->data",
+	 metadata_index->data );
+
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the file is truncated
+	 */
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsext_test_metadata_index_data1,
+	          360,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_read_file_io_handle(
+	          metadata_index,
+	          file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index->data",
+	 metadata_index->data );
+
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the data was modified after the checksum was calculated
+	 */
+	fsext_test_metadata_index_data1[ 300 ] ^= 0xff;
+
+	result = fsext_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsext_test_metadata_index_data1,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_read_file_io_handle(
+	          metadata_index,
+	          file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	fsext_test_metadata_index_data1[ 300 ] ^= 0xff;
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index->data",
+	 metadata_index->data );
+
+	result = fsext_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( metadata_index != NULL )
+	{
+		libfsext_metadata_index_free(
+		 &metadata_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_metadata_index_matches_superblock function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_matches_superblock(
+     libfsext_metadata_index_t *metadata_index )
+{
+	uint8_t file_system_identifier[ 16 ] = {
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10 };
+
+	libcerror_error_t *error          = NULL;
+	libfsext_superblock_t *superblock = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_superblock_initialize(
+	          &superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "superblock",
+	 superblock );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 superblock->file_system_identifier,
+	 file_system_identifier,
+	 16 );
+
+	superblock->last_written_time      = 0x5f000000UL;
+	superblock->number_of_inodes       = 64;
+	superblock->number_of_block_groups = 1;
+	superblock->block_size             = 1024;
+
+	/* Test regular cases
+	 */
+	result = libfsext_metadata_index_matches_superblock(
+	          metadata_index,
+	          superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a metadata index of a different file system
+	 */
+	superblock->file_system_identifier[ 0 ] = 0xff;
+
+	result = libfsext_metadata_index_matches_superblock(
+	          metadata_index,
+	          superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	superblock->file_system_identifier[ 0 ] = 0x01;
+
+	/* Test a metadata index that is stale since the volume was written after the index was created
+	 */
+	superblock->last_written_time = 0x5f000010UL;
+
+	result = libfsext_metadata_index_matches_superblock(
+	          metadata_index,
+	          superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	superblock->last_written_time = 0x5f000000UL;
+
+	/* Test a metadata index that is stale since the number of inodes changed
+	 */
+	superblock->number_of_inodes = 128;
+
+	result = libfsext_metadata_index_matches_superblock(
+	          metadata_index,
+	          superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	superblock->number_of_inodes = 64;
+
+	/* Test a metadata index with less group descriptors than the volume has block groups
+	 */
+	superblock->number_of_block_groups = 2;
+
+	result = libfsext_metadata_index_matches_superblock(
+	          metadata_index,
+	          superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	superblock->number_of_block_groups = 1;
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_matches_superblock(
+	          NULL,
+	          superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_matches_superblock(
+	          metadata_index,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_superblock_free(
+	          &superblock,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "superblock",
+	 superblock );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( superblock != NULL )
+	{
+		libfsext_superblock_free(
+		 &superblock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_metadata_index_get_tree_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_get_tree_entry_by_utf8_name(
+     libfsext_metadata_index_t *metadata_index )
+{
+	libcerror_error_t *error       = NULL;
+	const uint8_t *tree_entry_data = NULL;
+	uint32_t inode_number          = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_metadata_index_get_tree_entry_by_utf8_name(
+	          metadata_index,
+	          2,
+	          (uint8_t *) "lost+found",
+	          10,
+	          &tree_entry_data,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "tree_entry_data",
+	 tree_entry_data );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( tree_entry_data[ 4 ] ),
+	 inode_number );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_number",
+	 inode_number,
+	 11 );
+
+	result = libfsext_metadata_index_get_tree_entry_by_utf8_name(
+	          metadata_index,
+	          2,
+	          (uint8_t *) "fil",
+	          3,
+	          &tree_entry_data,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_get_tree_entry_by_utf8_name(
+	          metadata_index,
+	          11,
+	          (uint8_t *) "file",
+	          4,
+	          &tree_entry_data,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_get_tree_entry_by_utf8_name(
+	          NULL,
+	          2,
+	          (uint8_t *) "file",
+	          4,
+	          &tree_entry_data,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_get_tree_entry_by_utf8_name(
+	          metadata_index,
+	          2,
+	          NULL,
+	          4,
+	          &tree_entry_data,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_metadata_index_get_tree_entry_by_utf8_name(
+	          metadata_index,
+	          2,
+	          (uint8_t *) "file",
+	          4,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_metadata_index_get_stat_by_inode_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_metadata_index_get_stat_by_inode_number(
+     libfsext_metadata_index_t *metadata_index )
+{
+	libcerror_error_t *error  = NULL;
+	int64_t access_time       = 0;
+	int64_t creation_time     = 0;
+	int64_t inode_change_time = 0;
+	int64_t modification_time = 0;
+	uint64_t data_size        = 0;
+	uint32_t group_identifier = 0;
+	uint32_t owner_identifier = 0;
+	uint16_t file_mode        = 0;
+	uint16_t number_of_links  = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_metadata_index_get_stat_by_inode_number(
+	          metadata_index,
+	          12,
+	          &file_mode,
+	          &number_of_links,
+	          &owner_identifier,
+	          &group_identifier,
+	          &data_size,
+	          &access_time,
+	          &modification_time,
+	          &inode_change_time,
+	          &creation_time,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT16(
+	 "file_mode",
+	 file_mode,
+	 0x81a4 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 11 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT64(
+	 "creation_time",
+	 creation_time,
+	 (int64_t) 1600000001000000000LL );
+
+	/* The creation time of inode 11 is not available
+	 */
+	result = libfsext_metadata_index_get_stat_by_inode_number(
+	          metadata_index,
+	          11,
+	          &file_mode,
+	          &number_of_links,
+	          &owner_identifier,
+	          &group_identifier,
+	          &data_size,
+	          &access_time,
+	          &modification_time,
+	          &inode_change_time,
+	          &creation_time,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT64(
+	 "creation_time",
+	 creation_time,
+	 (int64_t) 0 );
+
+	result = libfsext_metadata_index_get_stat_by_inode_number(
+	          metadata_index,
+	          13,
+	          &file_mode,
+	          &number_of_links,
+	          &owner_identifier,
+	          &group_identifier,
+	          &data_size,
+	          &access_time,
+	          &modification_time,
+	          &inode_change_time,
+	          &creation_time,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_metadata_index_get_stat_by_inode_number(
+	          NULL,
+	          12,
+	          &file_mode,
+	          &number_of_links,
+	          &owner_identifier,
+	          &group_identifier,
+	          &data_size,
+	          &access_time,
+	          &modification_time,
+	          &inode_change_time,
+	          &creation_time,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+	libcerror_error_t *error                  = NULL;
+	libfsext_metadata_index_t *metadata_index = NULL;
+	int result                                = 0;
+#endif
+
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	FSEXT_TEST_RUN(
+	 "libfsext_metadata_index_initialize",
+	 fsext_test_metadata_index_initialize );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_metadata_index_free",
+	 fsext_test_metadata_index_free );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_metadata_index_read_data",
+	 fsext_test_metadata_index_read_data );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_metadata_index_read_file_header",
+	 fsext_test_metadata_index_read_file_header );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_metadata_index_read_file_io_handle",
+	 fsext_test_metadata_index_read_file_io_handle );
+
+	/* Initialize metadata_index for tests
+	 */
+	result = libfsext_metadata_index_initialize(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_metadata_index_read_data(
+	          metadata_index,
+	          fsext_test_metadata_index_data1,
+	          368,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_metadata_index_get_tree_entry_by_utf8_name",
+	 fsext_test_metadata_index_get_tree_entry_by_utf8_name,
+	 metadata_index );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_metadata_index_get_stat_by_inode_number",
+	 fsext_test_metadata_index_get_stat_by_inode_number,
+	 metadata_index );
+
+	FSEXT_TEST_RUN_WITH_ARGS(
+	 "libfsext_metadata_index_matches_superblock",
+	 fsext_test_metadata_index_matches_superblock,
+	 metadata_index );
+
+	/* Clean up
+	 */
+	result = libfsext_metadata_index_free(
+	          &metadata_index,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "metadata_index",
+	 metadata_index );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_index != NULL )
+	{
+		libfsext_metadata_index_free(
+		 &metadata_index,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+}
+
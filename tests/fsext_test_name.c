@@ -0,0 +1,626 @@
+/*
+ * Library name functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+#include "fsext_test_libuna.h"
+#include "fsext_test_macros.h"
+#include "fsext_test_unused.h"
+
+#include "../libfsext/libfsext_name.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Tests the libfsext_name_get_case_folded_character function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_name_get_case_folded_character(
+     void )
+{
+	libuna_unicode_character_t unicode_character = 0;
+
+	unicode_character = libfsext_name_get_case_folded_character(
+	                     (libuna_unicode_character_t) 'A' );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_character",
+	 (uint32_t) unicode_character,
+	 (uint32_t) 'a' );
+
+	unicode_character = libfsext_name_get_case_folded_character(
+	                     (libuna_unicode_character_t) 'a' );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_character",
+	 (uint32_t) unicode_character,
+	 (uint32_t) 'a' );
+
+	unicode_character = libfsext_name_get_case_folded_character(
+	                     (libuna_unicode_character_t) '_' );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_character",
+	 (uint32_t) unicode_character,
+	 (uint32_t) '_' );
+
+	/* LATIN CAPITAL LETTER A WITH GRAVE
+	 */
+	unicode_character = libfsext_name_get_case_folded_character(
+	                     0x000000c0UL );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_character",
+	 (uint32_t) unicode_character,
+	 (uint32_t) 0x000000e0UL );
+
+	/* LATIN CAPITAL LETTER L WITH STROKE
+	 */
+	unicode_character = libfsext_name_get_case_folded_character(
+	                     0x00000141UL );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_character",
+	 (uint32_t) unicode_character,
+	 (uint32_t) 0x00000142UL );
+
+	/* GREEK CAPITAL LETTER SIGMA
+	 */
+	unicode_character = libfsext_name_get_case_folded_character(
+	                     0x000003a3UL );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_character",
+	 (uint32_t) unicode_character,
+	 (uint32_t) 0x000003c3UL );
+
+	/* CYRILLIC CAPITAL LETTER IO
+	 */
+	unicode_character = libfsext_name_get_case_folded_character(
+	                     0x00000401UL );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "unicode_character",
+	 (uint32_t) unicode_character,
+	 (uint32_t) 0x00000451UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsext_name_get_hash_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_name_get_hash_from_utf8_string(
+     void )
+{
+	uint8_t utf8_string1[ 7 ] = {
+		'R', 'e', 'a', 'd', 'M', 'e', 0 };
+	uint8_t utf8_string2[ 7 ] = {
+		'r', 'e', 'a', 'd', 'm', 'e', 0 };
+
+	libcerror_error_t *error = NULL;
+	uint32_t name_hash1      = 0;
+	uint32_t name_hash2      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_name_get_hash_from_utf8_string(
+	          utf8_string1,
+	          6,
+	          1,
+	          &name_hash1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_name_get_hash_from_utf8_string(
+	          utf8_string2,
+	          7,
+	          1,
+	          &name_hash2,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash2",
+	 name_hash2,
+	 name_hash1 );
+
+	/* Test error cases
+	 */
+	result = libfsext_name_get_hash_from_utf8_string(
+	          NULL,
+	          6,
+	          1,
+	          &name_hash1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_name_get_hash_from_utf8_string(
+	          utf8_string1,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &name_hash1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_name_get_hash_from_utf8_string(
+	          utf8_string1,
+	          6,
+	          1,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_name_get_hash_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_name_get_hash_from_utf16_string(
+     void )
+{
+	uint16_t utf16_string[ 6 ] = {
+		'R', 'E', 'A', 'D', 'M', 'E' };
+	uint8_t utf8_string[ 7 ] = {
+		'r', 'e', 'a', 'd', 'm', 'e', 0 };
+
+	libcerror_error_t *error = NULL;
+	uint32_t name_hash1      = 0;
+	uint32_t name_hash2      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_name_get_hash_from_utf16_string(
+	          utf16_string,
+	          6,
+	          1,
+	          &name_hash1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_name_get_hash_from_utf8_string(
+	          utf8_string,
+	          7,
+	          1,
+	          &name_hash2,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash2",
+	 name_hash2,
+	 name_hash1 );
+
+	/* Test error cases
+	 */
+	result = libfsext_name_get_hash_from_utf16_string(
+	          NULL,
+	          6,
+	          1,
+	          &name_hash1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_name_get_hash_from_utf16_string(
+	          utf16_string,
+	          6,
+	          1,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_name_compare_with_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_name_compare_with_utf8_string(
+     void )
+{
+	uint8_t name[ 7 ] = {
+		'r', 'e', 'a', 'd', 'm', 'e', 0 };
+	uint8_t utf8_string1[ 6 ] = {
+		'R', 'e', 'a', 'd', 'M', 'e' };
+	uint8_t utf8_string2[ 7 ] = {
+		'R', 'e', 'a', 'd', 'M', 'e', 's' };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_name_compare_with_utf8_string(
+	          name,
+	          7,
+	          utf8_string1,
+	          6,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_name_compare_with_utf8_string(
+	          name,
+	          7,
+	          utf8_string1,
+	          6,
+	          0,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_name_compare_with_utf8_string(
+	          name,
+	          7,
+	          utf8_string2,
+	          7,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_GREATER );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_name_compare_with_utf8_string(
+	          NULL,
+	          7,
+	          utf8_string1,
+	          6,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_name_compare_with_utf8_string(
+	          name,
+	          7,
+	          NULL,
+	          6,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_name_compare_with_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_name_compare_with_utf16_string(
+     void )
+{
+	uint8_t name[ 7 ] = {
+		'r', 'e', 'a', 'd', 'm', 'e', 0 };
+	uint16_t utf16_string1[ 6 ] = {
+		'R', 'E', 'A', 'D', 'M', 'E' };
+	uint16_t utf16_string2[ 4 ] = {
+		'R', 'E', 'A', 'D' };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsext_name_compare_with_utf16_string(
+	          name,
+	          7,
+	          utf16_string1,
+	          6,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_EQUAL );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_name_compare_with_utf16_string(
+	          name,
+	          7,
+	          utf16_string2,
+	          4,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBUNA_COMPARE_LESS );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_name_compare_with_utf16_string(
+	          NULL,
+	          7,
+	          utf16_string1,
+	          6,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_name_compare_with_utf16_string(
+	          name,
+	          7,
+	          NULL,
+	          6,
+	          1,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	FSEXT_TEST_RUN(
+	 "libfsext_name_get_case_folded_character",
+	 fsext_test_name_get_case_folded_character );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_name_get_hash_from_utf8_string",
+	 fsext_test_name_get_hash_from_utf8_string );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_name_get_hash_from_utf16_string",
+	 fsext_test_name_get_hash_from_utf16_string );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_name_compare_with_utf8_string",
+	 fsext_test_name_compare_with_utf8_string );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_name_compare_with_utf16_string",
+	 fsext_test_name_compare_with_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+}
+
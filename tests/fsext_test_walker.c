@@ -0,0 +1,1756 @@
+/*
+ * Library walker type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsext_test_libcerror.h"
+#include "fsext_test_libfsext.h"
+#include "fsext_test_macros.h"
+#include "fsext_test_memory.h"
+#include "fsext_test_unused.h"
+
+#include "../libfsext/libfsext_definitions.h"
+#include "../libfsext/libfsext_directory.h"
+#include "../libfsext/libfsext_directory_entry.h"
+#include "../libfsext/libfsext_libcdata.h"
+#include "../libfsext/libfsext_walker.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+/* Tests the libfsext_walker_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsext_walker_t *walker       = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_walker_free(
+	          &walker,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_initialize(
+	          NULL,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	walker = (libfsext_walker_t *) 0x12345678UL;
+
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	walker = NULL;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSEXT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_walker_initialize with malloc failing
+		 */
+		fsext_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsext_walker_initialize(
+		          &walker,
+		          64,
+		          &error );
+
+		if( fsext_test_malloc_attempts_before_fail != -1 )
+		{
+			fsext_test_malloc_attempts_before_fail = -1;
+
+			if( walker != NULL )
+			{
+				libfsext_walker_free(
+				 &walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "walker",
+			 walker );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsext_walker_initialize with memset failing
+		 */
+		fsext_test_memset_attempts_before_fail = test_number;
+
+		result = libfsext_walker_initialize(
+		          &walker,
+		          64,
+		          &error );
+
+		if( fsext_test_memset_attempts_before_fail != -1 )
+		{
+			fsext_test_memset_attempts_before_fail = -1;
+
+			if( walker != NULL )
+			{
+				libfsext_walker_free(
+				 &walker,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSEXT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSEXT_TEST_ASSERT_IS_NULL(
+			 "walker",
+			 walker );
+
+			FSEXT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSEXT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_walker_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_free(
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_walker_file_type_matches_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_file_type_matches_filter(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsext_walker_t *walker = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_walker_file_type_matches_filter(
+	          walker,
+	          LIBFSEXT_FILE_TYPE_REGULAR_FILE );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	walker->file_type_filter = LIBFSEXT_WALK_FILE_TYPE_FILTER_DIRECTORY;
+
+	result = libfsext_walker_file_type_matches_filter(
+	          walker,
+	          LIBFSEXT_FILE_TYPE_DIRECTORY );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsext_walker_file_type_matches_filter(
+	          walker,
+	          LIBFSEXT_FILE_TYPE_REGULAR_FILE );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_file_type_matches_filter(
+	          NULL,
+	          LIBFSEXT_FILE_TYPE_DIRECTORY );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfsext_walker_free(
+	          &walker,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_walker_set_directory_visited function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_set_directory_visited(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsext_walker_t *walker = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_walker_set_directory_visited(
+	          walker,
+	          2,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_walker_set_directory_visited(
+	          walker,
+	          2,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_walker_set_directory_visited(
+	          walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_set_directory_visited(
+	          NULL,
+	          2,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_set_directory_visited(
+	          walker,
+	          0xffffffffUL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_walker_free(
+	          &walker,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_walker_set_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_set_path(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsext_walker_t *walker = NULL;
+	size_t path_length        = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsext_walker_set_path(
+	          walker,
+	          0,
+	          (uint8_t *) "/",
+	          1,
+	          &path_length,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 (size_t) 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_walker_set_path(
+	          walker,
+	          1,
+	          (uint8_t *) "etc",
+	          3,
+	          &path_length,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 (size_t) 4 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_walker_set_path(
+	          walker,
+	          4,
+	          (uint8_t *) "passwd",
+	          6,
+	          &path_length,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "path_length",
+	 path_length,
+	 (size_t) 11 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          walker->path,
+	          "/etc/passwd",
+	          12 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_set_path(
+	          NULL,
+	          1,
+	          (uint8_t *) "etc",
+	          3,
+	          &path_length,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_set_path(
+	          walker,
+	          walker->path_size,
+	          (uint8_t *) "etc",
+	          3,
+	          &path_length,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_set_path(
+	          walker,
+	          1,
+	          NULL,
+	          3,
+	          &path_length,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_set_path(
+	          walker,
+	          1,
+	          (uint8_t *) "etc",
+	          3,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_walker_free(
+	          &walker,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_walker_append_frame function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_append_frame(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfsext_walker_frame_t *frame = NULL;
+	libfsext_walker_t *walker      = NULL;
+	int frame_index                = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( frame_index = 0;
+	     frame_index < 64;
+	     frame_index++ )
+	{
+		result = libfsext_walker_append_frame(
+		          walker,
+		          (uint32_t) frame_index + 2,
+		          frame_index,
+		          (size_t) frame_index,
+		          &frame,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NOT_NULL(
+		 "frame",
+		 frame );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_frames",
+	 walker->number_of_frames,
+	 64 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_allocated_frames",
+	 walker->number_of_allocated_frames,
+	 64 );
+
+	/* Test that the frames are preserved when the frames are resized
+	 */
+	result = libfsext_walker_append_frame(
+	          walker,
+	          66,
+	          64,
+	          64,
+	          &frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_frames",
+	 walker->number_of_frames,
+	 65 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_allocated_frames",
+	 walker->number_of_allocated_frames,
+	 128 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->frames[ 0 ].inode_number",
+	 walker->frames[ 0 ].inode_number,
+	 2 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->frames[ 63 ].inode_number",
+	 walker->frames[ 63 ].inode_number,
+	 65 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->frames[ 63 ].depth",
+	 walker->frames[ 63 ].depth,
+	 63 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "frame->inode_number",
+	 frame->inode_number,
+	 66 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "frame->path_length",
+	 frame->path_length,
+	 (size_t) 64 );
+
+	/* Test that the space of frames removed from the front of the queue is reclaimed
+	 * before the frames are resized
+	 */
+	for( frame_index = 65;
+	     frame_index < 128;
+	     frame_index++ )
+	{
+		result = libfsext_walker_append_frame(
+		          walker,
+		          (uint32_t) frame_index + 2,
+		          frame_index,
+		          (size_t) frame_index,
+		          &frame,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	walker->first_frame_index = 100;
+
+	result = libfsext_walker_append_frame(
+	          walker,
+	          130,
+	          128,
+	          128,
+	          &frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->first_frame_index",
+	 walker->first_frame_index,
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_frames",
+	 walker->number_of_frames,
+	 29 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_allocated_frames",
+	 walker->number_of_allocated_frames,
+	 128 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->frames[ 0 ].inode_number",
+	 walker->frames[ 0 ].inode_number,
+	 102 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->frames[ 28 ].inode_number",
+	 walker->frames[ 28 ].inode_number,
+	 130 );
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_append_frame(
+	          NULL,
+	          2,
+	          0,
+	          0,
+	          &frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_append_frame(
+	          walker,
+	          2,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_walker_free(
+	          &walker,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_walker_append_queued_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_append_queued_path(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfsext_walker_frame_t *frame = NULL;
+	libfsext_walker_t *walker      = NULL;
+	size_t path_length             = 0;
+	size_t path_offset             = 0;
+	int path_index                 = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_walker_set_path(
+	          walker,
+	          0,
+	          (uint8_t *) "/etc/passwd",
+	          11,
+	          &path_length,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Queue a frame per path, like a breadth-first walk does, so that the paths remain in use
+	 */
+	for( path_index = 0;
+	     path_index < 400;
+	     path_index++ )
+	{
+		result = libfsext_walker_append_queued_path(
+		          walker,
+		          path_length,
+		          &path_offset,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_EQUAL_SIZE(
+		 "path_offset",
+		 path_offset,
+		 (size_t) path_index * 11 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsext_walker_append_frame(
+		          walker,
+		          (uint32_t) path_index + 2,
+		          1,
+		          path_length,
+		          &frame,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		frame->path_offset = path_offset;
+	}
+	/* The queued paths grow from 4096 to 8192 bytes
+	 */
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "walker->queued_paths_size",
+	 walker->queued_paths_size,
+	 (size_t) 4400 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "walker->allocated_queued_paths_size",
+	 walker->allocated_queued_paths_size,
+	 (size_t) 8192 );
+
+	result = memory_compare(
+	          walker->queued_paths,
+	          "/etc/passwd",
+	          11 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( walker->queued_paths[ walker->frames[ 399 ].path_offset ] ),
+	          "/etc/passwd",
+	          11 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the paths of frames removed from the front of the queue are reclaimed
+	 * before the queued paths are resized
+	 */
+	walker->first_frame_index = 200;
+
+	for( path_index = 0;
+	     path_index < 345;
+	     path_index++ )
+	{
+		result = libfsext_walker_append_queued_path(
+		          walker,
+		          path_length,
+		          &path_offset,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "walker->queued_paths_size",
+	 walker->queued_paths_size,
+	 (size_t) 5995 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "walker->allocated_queued_paths_size",
+	 walker->allocated_queued_paths_size,
+	 (size_t) 8192 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "walker->frames[ 200 ].path_offset",
+	 walker->frames[ 200 ].path_offset,
+	 (size_t) 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "walker->frames[ 399 ].path_offset",
+	 walker->frames[ 399 ].path_offset,
+	 (size_t) 2189 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "path_offset",
+	 path_offset,
+	 (size_t) 5984 );
+
+	/* Test that the queued paths are emptied when no frames are queued
+	 */
+	walker->first_frame_index = walker->number_of_frames;
+
+	result = libfsext_walker_append_queued_path(
+	          walker,
+	          path_length,
+	          &path_offset,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "path_offset",
+	 path_offset,
+	 (size_t) 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_SIZE(
+	 "walker->queued_paths_size",
+	 walker->queued_paths_size,
+	 (size_t) 11 );
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_append_queued_path(
+	          NULL,
+	          path_length,
+	          &path_offset,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_append_queued_path(
+	          walker,
+	          walker->path_size + 1,
+	          &path_offset,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_append_queued_path(
+	          walker,
+	          path_length,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_walker_free(
+	          &walker,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsext_walker_append_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsext_test_walker_append_entries(
+     void )
+{
+	uint32_t inode_numbers[ 4 ] = { 14, 12, 15, 11 };
+
+	libcerror_error_t *error                    = NULL;
+	libfsext_directory_t *directory             = NULL;
+	libfsext_directory_entry_t *directory_entry = NULL;
+	libfsext_walker_frame_t *frame              = NULL;
+	libfsext_walker_t *walker                   = NULL;
+	int array_entry_index                       = 0;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsext_walker_initialize(
+	          &walker,
+	          64,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libfsext_directory_entry_initialize(
+		          &directory_entry,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		directory_entry->inode_number = inode_numbers[ entry_index ];
+
+		result = libcdata_array_append_entry(
+		          directory->entries_array,
+		          &array_entry_index,
+		          (intptr_t *) directory_entry,
+		          &error );
+
+		FSEXT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSEXT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		directory_entry = NULL;
+	}
+	/* Test regular cases
+	 * Without sorting the entries are visited in directory order
+	 */
+	result = libfsext_walker_append_frame(
+	          walker,
+	          2,
+	          0,
+	          1,
+	          &frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	frame->directory = directory;
+
+	result = libfsext_walker_append_entries(
+	          walker,
+	          frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	frame->directory = NULL;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "frame->entries_offset",
+	 frame->entries_offset,
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "frame->number_of_entries",
+	 frame->number_of_entries,
+	 4 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_entries",
+	 walker->number_of_entries,
+	 4 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 0 ].inode_number",
+	 walker->entries[ 0 ].inode_number,
+	 14 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 1 ].inode_number",
+	 walker->entries[ 1 ].inode_number,
+	 12 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 2 ].inode_number",
+	 walker->entries[ 2 ].inode_number,
+	 15 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 3 ].inode_number",
+	 walker->entries[ 3 ].inode_number,
+	 11 );
+
+	/* With sorting the entries are visited in inode number order
+	 * and refer back to their index in the directory
+	 */
+	walker->walk_flags = LIBFSEXT_WALK_FLAG_SORT_BY_INODE_NUMBER;
+
+	result = libfsext_walker_append_frame(
+	          walker,
+	          3,
+	          1,
+	          1,
+	          &frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	frame->directory = directory;
+
+	result = libfsext_walker_append_entries(
+	          walker,
+	          frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	frame->directory = NULL;
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "frame->entries_offset",
+	 frame->entries_offset,
+	 4 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "frame->number_of_entries",
+	 frame->number_of_entries,
+	 4 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->number_of_entries",
+	 walker->number_of_entries,
+	 8 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 4 ].inode_number",
+	 walker->entries[ 4 ].inode_number,
+	 11 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->entries[ 4 ].directory_entry_index",
+	 walker->entries[ 4 ].directory_entry_index,
+	 3 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 5 ].inode_number",
+	 walker->entries[ 5 ].inode_number,
+	 12 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->entries[ 5 ].directory_entry_index",
+	 walker->entries[ 5 ].directory_entry_index,
+	 1 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 6 ].inode_number",
+	 walker->entries[ 6 ].inode_number,
+	 14 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->entries[ 6 ].directory_entry_index",
+	 walker->entries[ 6 ].directory_entry_index,
+	 0 );
+
+	FSEXT_TEST_ASSERT_EQUAL_UINT32(
+	 "walker->entries[ 7 ].inode_number",
+	 walker->entries[ 7 ].inode_number,
+	 15 );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "walker->entries[ 7 ].directory_entry_index",
+	 walker->entries[ 7 ].directory_entry_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfsext_walker_append_entries(
+	          NULL,
+	          frame,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsext_walker_append_entries(
+	          walker,
+	          NULL,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSEXT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsext_directory_free(
+	          &directory,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsext_walker_free(
+	          &walker,
+	          &error );
+
+	FSEXT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "walker",
+	 walker );
+
+	FSEXT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( frame != NULL )
+	{
+		frame->directory = NULL;
+	}
+	if( directory_entry != NULL )
+	{
+		libfsext_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsext_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( walker != NULL )
+	{
+		libfsext_walker_free(
+		 &walker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSEXT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSEXT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argc )
+	FSEXT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT )
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_initialize",
+	 fsext_test_walker_initialize );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_free",
+	 fsext_test_walker_free );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_file_type_matches_filter",
+	 fsext_test_walker_file_type_matches_filter );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_set_directory_visited",
+	 fsext_test_walker_set_directory_visited );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_set_path",
+	 fsext_test_walker_set_path );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_append_frame",
+	 fsext_test_walker_append_frame );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_append_queued_path",
+	 fsext_test_walker_append_queued_path );
+
+	FSEXT_TEST_RUN(
+	 "libfsext_walker_append_entries",
+	 fsext_test_walker_append_entries );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSEXT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1883 @@
+#!/usr/bin/env python3
+#
+# Script to generate synthetic Extended File System (ext) volume images.
+#
+# Version: 20261018
+#
+# The images are written as sparse files, without root privileges or loop
+# devices, and are intended as large scale inputs for performance testing.
+# Metadata checksums (metadata_csum) are not supported, for ext4 the block
+# group descriptors are protected by the older gdt_csum (uninit_bg) CRC-16.
+
+import argparse
+import array
+import struct
+import sys
+
+
+COMPAT_HAS_JOURNAL = 0x00000004
+COMPAT_DIR_INDEX = 0x00000020
+
+INCOMPAT_FILETYPE = 0x00000002
+INCOMPAT_META_BG = 0x00000010
+INCOMPAT_EXTENTS = 0x00000040
+INCOMPAT_64BIT = 0x00000080
+INCOMPAT_FLEX_BG = 0x00000200
+
+RO_COMPAT_SPARSE_SUPER = 0x00000001
+RO_COMPAT_LARGE_FILE = 0x00000002
+RO_COMPAT_HUGE_FILE = 0x00000008
+RO_COMPAT_GDT_CSUM = 0x00000010
+RO_COMPAT_DIR_NLINK = 0x00000020
+RO_COMPAT_EXTRA_ISIZE = 0x00000040
+
+BLOCK_GROUP_INODE_UNINIT = 0x0001
+BLOCK_GROUP_BLOCK_UNINIT = 0x0002
+BLOCK_GROUP_INODE_TABLE_ZEROED = 0x0004
+
+INODE_FLAG_INDEX = 0x00001000
+INODE_FLAG_EXTENTS = 0x00080000
+
+FILE_MODE_DIRECTORY = 0o040755
+FILE_MODE_REGULAR_FILE = 0o100644
+FILE_MODE_JOURNAL = 0o100600
+
+FILE_TYPE_REGULAR_FILE = 1
+FILE_TYPE_DIRECTORY = 2
+
+ROOT_DIRECTORY_INODE_NUMBER = 2
+JOURNAL_INODE_NUMBER = 8
+LOST_AND_FOUND_INODE_NUMBER = 11
+
+EXTENT_HEADER_SIGNATURE = 0xf30a
+EXTENT_MAXIMUM_NUMBER_OF_BLOCKS = 32768
+
+JOURNAL_SIGNATURE = 0xc03b3998
+JOURNAL_BLOCK_TYPE_SUPERBLOCK_V2 = 4
+
+HTREE_EOF_32BIT = 0x7fffffff
+
+VOLUME_IDENTIFIER = bytes.fromhex("5e1ec7ab1e0d4a7b9c3f0123456789ab")
+
+
+def _CalculateCRC16Table():
+  """Calculates the CRC-16 lookup table used by gdt_csum.
+
+  Returns:
+    list[int]: CRC-16 (polynomial 0x8005, reversed) lookup table.
+  """
+  table = []
+  for index in range(256):
+    value = index
+    for _ in range(8):
+      if value & 1:
+        value = (value >> 1) ^ 0xa001
+      else:
+        value >>= 1
+    table.append(value)
+
+  return table
+
+
+CRC16_TABLE = _CalculateCRC16Table()
+
+
+def CalculateCRC16(data, initial_value):
+  """Calculates a CRC-16 as used by gdt_csum.
+
+  Args:
+    data (bytes): data.
+    initial_value (int): initial CRC-16 value.
+
+  Returns:
+    int: CRC-16.
+  """
+  value = initial_value
+  for byte_value in data:
+    value = (value >> 8) ^ CRC16_TABLE[(value ^ byte_value) & 0xff]
+
+  return value
+
+
+def _HalfMD4Transform(buffer, values):
+  """Applies the half MD4 transform used by the directory index hash.
+
+  Args:
+    buffer (list[int]): 4 x 32-bit hash state, which is updated in place.
+    values (list[int]): 8 x 32-bit input values.
+  """
+  a, b, c, d = buffer
+
+  # Round 1
+  value = (a + (d ^ (b & (c ^ d))) + values[0]) & 0xffffffff
+  a = ((value << 3) | (value >> 29)) & 0xffffffff
+  value = (d + (c ^ (a & (b ^ c))) + values[1]) & 0xffffffff
+  d = ((value << 7) | (value >> 25)) & 0xffffffff
+  value = (c + (b ^ (d & (a ^ b))) + values[2]) & 0xffffffff
+  c = ((value << 11) | (value >> 21)) & 0xffffffff
+  value = (b + (a ^ (c & (d ^ a))) + values[3]) & 0xffffffff
+  b = ((value << 19) | (value >> 13)) & 0xffffffff
+  value = (a + (d ^ (b & (c ^ d))) + values[4]) & 0xffffffff
+  a = ((value << 3) | (value >> 29)) & 0xffffffff
+  value = (d + (c ^ (a & (b ^ c))) + values[5]) & 0xffffffff
+  d = ((value << 7) | (value >> 25)) & 0xffffffff
+  value = (c + (b ^ (d & (a ^ b))) + values[6]) & 0xffffffff
+  c = ((value << 11) | (value >> 21)) & 0xffffffff
+  value = (b + (a ^ (c & (d ^ a))) + values[7]) & 0xffffffff
+  b = ((value << 19) | (value >> 13)) & 0xffffffff
+
+  # Round 2
+  value = (a + ((b & c) + ((b ^ c) & d)) + values[1] + 0x5a827999) & 0xffffffff
+  a = ((value << 3) | (value >> 29)) & 0xffffffff
+  value = (d + ((a & b) + ((a ^ b) & c)) + values[3] + 0x5a827999) & 0xffffffff
+  d = ((value << 5) | (value >> 27)) & 0xffffffff
+  value = (c + ((d & a) + ((d ^ a) & b)) + values[5] + 0x5a827999) & 0xffffffff
+  c = ((value << 9) | (value >> 23)) & 0xffffffff
+  value = (b + ((c & d) + ((c ^ d) & a)) + values[7] + 0x5a827999) & 0xffffffff
+  b = ((value << 13) | (value >> 19)) & 0xffffffff
+  value = (a + ((b & c) + ((b ^ c) & d)) + values[0] + 0x5a827999) & 0xffffffff
+  a = ((value << 3) | (value >> 29)) & 0xffffffff
+  value = (d + ((a & b) + ((a ^ b) & c)) + values[2] + 0x5a827999) & 0xffffffff
+  d = ((value << 5) | (value >> 27)) & 0xffffffff
+  value = (c + ((d & a) + ((d ^ a) & b)) + values[4] + 0x5a827999) & 0xffffffff
+  c = ((value << 9) | (value >> 23)) & 0xffffffff
+  value = (b + ((c & d) + ((c ^ d) & a)) + values[6] + 0x5a827999) & 0xffffffff
+  b = ((value << 13) | (value >> 19)) & 0xffffffff
+
+  # Round 3
+  value = (a + (b ^ c ^ d) + values[3] + 0x6ed9eba1) & 0xffffffff
+  a = ((value << 3) | (value >> 29)) & 0xffffffff
+  value = (d + (a ^ b ^ c) + values[7] + 0x6ed9eba1) & 0xffffffff
+  d = ((value << 9) | (value >> 23)) & 0xffffffff
+  value = (c + (d ^ a ^ b) + values[2] + 0x6ed9eba1) & 0xffffffff
+  c = ((value << 11) | (value >> 21)) & 0xffffffff
+  value = (b + (c ^ d ^ a) + values[6] + 0x6ed9eba1) & 0xffffffff
+  b = ((value << 15) | (value >> 17)) & 0xffffffff
+  value = (a + (b ^ c ^ d) + values[1] + 0x6ed9eba1) & 0xffffffff
+  a = ((value << 3) | (value >> 29)) & 0xffffffff
+  value = (d + (a ^ b ^ c) + values[5] + 0x6ed9eba1) & 0xffffffff
+  d = ((value << 9) | (value >> 23)) & 0xffffffff
+  value = (c + (d ^ a ^ b) + values[0] + 0x6ed9eba1) & 0xffffffff
+  c = ((value << 11) | (value >> 21)) & 0xffffffff
+  value = (b + (c ^ d ^ a) + values[4] + 0x6ed9eba1) & 0xffffffff
+  b = ((value << 15) | (value >> 17)) & 0xffffffff
+
+  buffer[0] = (buffer[0] + a) & 0xffffffff
+  buffer[1] = (buffer[1] + b) & 0xffffffff
+  buffer[2] = (buffer[2] + c) & 0xffffffff
+  buffer[3] = (buffer[3] + d) & 0xffffffff
+
+
+def _GetHalfMD4HashValues(name, name_offset, name_size):
+  """Converts (part of) a name into half MD4 input values.
+
+  Args:
+    name (bytes): name.
+    name_offset (int): offset of the part of the name to convert.
+    name_size (int): remaining size of the name from the offset.
+
+  Returns:
+    list[int]: 8 x 32-bit input values.
+  """
+  padding = name_size | (name_size << 8)
+  padding = (padding | (padding << 16)) & 0xffffffff
+
+  values = []
+  value = padding
+  for index, byte_value in enumerate(
+      name[name_offset:name_offset + min(name_size, 32)]):
+    value = (byte_value + (value << 8)) & 0xffffffff
+    if index % 4 == 3:
+      values.append(value)
+      value = padding
+
+  if len(values) < 8:
+    values.append(value)
+
+  while len(values) < 8:
+    values.append(padding)
+
+  return values
+
+
+def CalculateHalfMD4NameHash(name):
+  """Calculates the unsigned half MD4 directory index hash of a name.
+
+  The hash uses the default seed, which is used when the superblock hash
+  seed is zero.
+
+  Args:
+    name (bytes): name.
+
+  Returns:
+    int: 32-bit hash value, where the least significant bit is not set.
+  """
+  buffer = [0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476]
+
+  name_offset = 0
+  name_size = len(name)
+  while name_size > 0:
+    values = _GetHalfMD4HashValues(name, name_offset, name_size)
+    _HalfMD4Transform(buffer, values)
+    name_offset += 32
+    name_size -= 32
+
+  hash_value = buffer[1] & 0xfffffffe
+  if hash_value == HTREE_EOF_32BIT << 1:
+    hash_value = (HTREE_EOF_32BIT - 1) << 1
+
+  return hash_value
+
+
+class BlockAllocator(object):
+  """Sequential block allocator that skips reserved block ranges.
+
+  Attributes:
+    allocated_ranges (list[tuple[int, int]]): first block number and number
+        of blocks of the allocated block ranges.
+  """
+
+  def __init__(self, number_of_blocks, reserved_ranges, first_block_number):
+    """Initializes a block allocator.
+
+    Args:
+      number_of_blocks (int): number of blocks in the volume.
+      reserved_ranges (list[tuple[int, int]]): sorted first block number and
+          number of blocks of the block ranges that cannot be allocated.
+      first_block_number (int): block number where allocation starts.
+    """
+    super(BlockAllocator, self).__init__()
+    self._current_block_number = first_block_number
+    self._number_of_blocks = number_of_blocks
+    self._reserved_index = 0
+    self._reserved_ranges = reserved_ranges
+    self.allocated_ranges = []
+
+  def _SkipReservedRanges(self):
+    """Moves the current block number past reserved block ranges."""
+    while self._reserved_index < len(self._reserved_ranges):
+      range_start, range_size = self._reserved_ranges[self._reserved_index]
+      if self._current_block_number >= range_start + range_size:
+        self._reserved_index += 1
+      elif self._current_block_number >= range_start:
+        self._current_block_number = range_start + range_size
+        self._reserved_index += 1
+      else:
+        break
+
+  def Allocate(self, number_of_blocks):
+    """Allocates blocks.
+
+    Args:
+      number_of_blocks (int): number of blocks to allocate.
+
+    Returns:
+      list[tuple[int, int]]: first block number and number of blocks of the
+          allocated block ranges.
+
+    Raises:
+      RuntimeError: if the volume has insufficient unallocated blocks.
+    """
+    block_ranges = []
+    while number_of_blocks > 0:
+      self._SkipReservedRanges()
+
+      range_end = self._number_of_blocks
+      if self._reserved_index < len(self._reserved_ranges):
+        range_end = min(
+            range_end, self._reserved_ranges[self._reserved_index][0])
+
+      if self._current_block_number >= range_end:
+        raise RuntimeError("Volume has insufficient unallocated blocks.")
+
+      range_size = min(number_of_blocks, range_end - self._current_block_number)
+      AppendBlockRange(block_ranges, self._current_block_number, range_size)
+      AppendBlockRange(
+          self.allocated_ranges, self._current_block_number, range_size)
+
+      self._current_block_number += range_size
+      number_of_blocks -= range_size
+
+    return block_ranges
+
+  def Skip(self, number_of_blocks):
+    """Skips blocks, which leaves them unallocated.
+
+    Args:
+      number_of_blocks (int): number of blocks to skip.
+    """
+    self._current_block_number += number_of_blocks
+
+
+def AppendBlockRange(block_ranges, range_start, range_size):
+  """Appends a block range, merging it with the last block range if adjacent.
+
+  Args:
+    block_ranges (list[tuple[int, int]]): block ranges.
+    range_start (int): first block number of the range.
+    range_size (int): number of blocks in the range.
+  """
+  if block_ranges:
+    last_range_start, last_range_size = block_ranges[-1]
+    if last_range_start + last_range_size == range_start:
+      block_ranges[-1] = (last_range_start, last_range_size + range_size)
+      return
+
+  block_ranges.append((range_start, range_size))
+
+
+def IsPowerOf(value, base):
+  """Determines if a value is a power of a base.
+
+  Args:
+    value (int): value.
+    base (int): base.
+
+  Returns:
+    bool: True if the value is a power of the base.
+  """
+  while value > 1 and value % base == 0:
+    value //= base
+
+  return value == 1
+
+
+def ParseSize(string):
+  """Parses a size with an optional K, M, G or T suffix.
+
+  Args:
+    string (str): size string.
+
+  Returns:
+    int: size in bytes.
+
+  Raises:
+    ValueError: if the size string is not supported.
+  """
+  multiplier = 1
+  suffix = string[-1:].upper()
+  if suffix in ("K", "M", "G", "T"):
+    multiplier = 1024 ** ("KMGT".index(suffix) + 1)
+    string = string[:-1]
+
+  return int(string, 10) * multiplier
+
+
+class ImageGenerator(object):
+  """Synthetic Extended File System (ext) volume image generator.
+
+  The image contains:
+  * /lost+found
+  * /large_directory, with a configurable number of empty files, stored as
+    an htree (directory index) when dir_index is enabled
+  * /tree/directory%06d/file%06d, a hierarchy of files of a configurable size
+  * /fragmented_file, where every block is stored in a separate extent or
+    non-contiguous block
+  * /indirect_file, a block-mapped file that uses (double and triple)
+    indirect blocks
+
+  Inode and block numbers are allocated sequentially, file data is only
+  written when requested, otherwise allocated blocks are left sparse.
+  """
+
+  # pylint: disable=too-many-instance-attributes
+
+  def __init__(self, options):
+    """Initializes an image generator.
+
+    Args:
+      options (argparse.Namespace): command line options.
+
+    Raises:
+      ValueError: if the options are not supported.
+    """
+    super(ImageGenerator, self).__init__()
+    self._allocator = None
+    self._block_size = options.block_size
+    self._current_inode_table = None
+    self._current_inode_table_group = None
+    self._data_start_group = options.data_start_group
+    self._directory_entries = options.directory_entries
+    self._directories_per_group = {}
+    self._file_object = None
+    self._file_size = options.file_size
+    self._format = options.format
+    self._fragmented_extents = options.fragmented_extents
+    self._indirect_file_blocks = options.indirect_file_blocks
+    self._journal_blocks = options.journal_blocks
+    self._journal_block_map = None
+    self._log_groups_per_flex = options.log_groups_per_flex
+    self._timestamp = options.timestamp
+    self._tree_directories = options.tree_directories
+    self._tree_files = options.tree_files
+    self._write_data = options.write_data
+
+    if self._block_size not in (1024, 2048, 4096, 8192, 16384, 32768, 65536):
+      raise ValueError(f"Unsupported block size: {self._block_size:d}")
+
+    if self._format == "ext3" and self._journal_blocks == 0:
+      raise ValueError("ext3 requires a journal")
+
+    if self._format == "ext2":
+      self._journal_blocks = 0
+
+    if self._journal_blocks and self._journal_blocks < 1024:
+      raise ValueError("Journal requires at least 1024 blocks")
+
+    self._use_64bit = options.use_64bit
+    self._use_dir_index = options.dir_index
+    self._use_extents = self._format == "ext4"
+    self._use_flex_bg = options.flex_bg
+    self._use_meta_bg = options.meta_bg
+    self._use_uninit_bg = self._format == "ext4" and options.uninit_bg
+
+    if self._use_dir_index is None:
+      self._use_dir_index = self._format != "ext2"
+
+    if self._format != "ext4" and (self._use_64bit or self._use_flex_bg):
+      raise ValueError("64bit and flex_bg require ext4")
+
+    self._first_data_block = 1 if self._block_size == 1024 else 0
+    self._blocks_per_group = min(self._block_size * 8, 65528)
+
+    if self._indirect_file_blocks < 0:
+      pointers_per_block = self._block_size // 4
+      self._indirect_file_blocks = 12 + pointers_per_block + (
+          2 * pointers_per_block)
+
+      # A block map can only reference 32-bit block numbers.
+      if self._GetGroupStartBlockNumber(self._data_start_group + 1) >= 2 ** 32:
+        self._indirect_file_blocks = 0
+    self._inode_size = 256 if self._format == "ext4" else 128
+    self._group_descriptor_size = 64 if self._use_64bit else 32
+    self._group_descriptors_per_block = (
+        self._block_size // self._group_descriptor_size)
+
+    self._AssignInodeNumbers()
+    self._CalculateGeometry(options.size, options.inodes)
+
+  def _AssignInodeNumbers(self):
+    """Assigns inode numbers to the files and directories in the image."""
+    inode_number = LOST_AND_FOUND_INODE_NUMBER + 1
+
+    self._large_directory_inode_number = None
+    if self._directory_entries > 0:
+      self._large_directory_inode_number = inode_number
+      inode_number += 1 + self._directory_entries
+
+    self._tree_inode_number = None
+    if self._tree_directories > 0:
+      self._tree_inode_number = inode_number
+      inode_number += 1 + (self._tree_directories * (1 + self._tree_files))
+
+    self._fragmented_file_inode_number = None
+    if self._fragmented_extents > 0:
+      self._fragmented_file_inode_number = inode_number
+      inode_number += 1
+
+    self._indirect_file_inode_number = None
+    if self._indirect_file_blocks > 0:
+      self._indirect_file_inode_number = inode_number
+      inode_number += 1
+
+    self._last_inode_number = inode_number - 1
+
+  def _CalculateGeometry(self, size, number_of_inodes):
+    """Calculates the volume geometry.
+
+    Args:
+      size (int): size of the volume in bytes or None to determine the size
+          from the contents.
+      number_of_inodes (int): minimum number of inodes or None.
+
+    Raises:
+      ValueError: if the volume geometry is not supported.
+    """
+    number_of_inodes = max(number_of_inodes or 0, self._last_inode_number)
+
+    inodes_per_block = self._block_size // self._inode_size
+    inodes_granularity = max(8, inodes_per_block)
+    maximum_inodes_per_group = min(
+        self._blocks_per_group,
+        (2 * self._block_size * self._block_size) // self._inode_size)
+    maximum_inodes_per_group -= maximum_inodes_per_group % inodes_granularity
+
+    if size:
+      number_of_blocks = size // self._block_size
+      number_of_groups = (
+          number_of_blocks - self._first_data_block +
+          self._blocks_per_group - 1) // self._blocks_per_group
+    else:
+      minimum_number_of_groups = (
+          number_of_inodes + maximum_inodes_per_group - 1) // (
+              maximum_inodes_per_group)
+      number_of_data_blocks = self._EstimateNumberOfDataBlocks()
+      number_of_groups = self._data_start_group + 1 + (
+          (number_of_data_blocks * 10) // (self._blocks_per_group * 8))
+      number_of_groups = max(number_of_groups, minimum_number_of_groups)
+      number_of_blocks = self._first_data_block + (
+          number_of_groups * self._blocks_per_group)
+
+    self._number_of_groups = number_of_groups
+    self._number_of_group_descriptor_blocks = (
+        number_of_groups + self._group_descriptors_per_block - 1) // (
+            self._group_descriptors_per_block)
+
+    self._inodes_per_group = (
+        number_of_inodes + number_of_groups - 1) // number_of_groups
+    self._inodes_per_group += (
+        inodes_granularity - self._inodes_per_group) % inodes_granularity
+    self._inodes_per_group = max(self._inodes_per_group, inodes_granularity)
+
+    if self._inodes_per_group > maximum_inodes_per_group:
+      raise ValueError("Volume is too small for the number of inodes")
+
+    self._inode_table_blocks = (
+        self._inodes_per_group * self._inode_size) // self._block_size
+
+    last_group_size = number_of_blocks - self._first_data_block - (
+        (number_of_groups - 1) * self._blocks_per_group)
+    last_group_overhead = self._GetNumberOfBaseMetadataBlocks(
+        number_of_groups - 1) + 64
+    if not self._use_flex_bg:
+      last_group_overhead += 2 + self._inode_table_blocks
+
+    if number_of_groups > 1 and last_group_size < last_group_overhead:
+      self._number_of_groups -= 1
+      number_of_blocks -= last_group_size
+
+    maximum_number_of_group_descriptor_blocks = self._blocks_per_group // 2
+    if (not self._use_meta_bg and self._number_of_group_descriptor_blocks >=
+        maximum_number_of_group_descriptor_blocks):
+      raise ValueError("Group descriptor table too large, use meta_bg")
+
+    if number_of_blocks >= 2 ** 32 and not self._use_64bit:
+      raise ValueError("Volume of 2^32 or more blocks requires 64bit")
+
+    if self._data_start_group >= self._number_of_groups:
+      raise ValueError("Data start group exceeds number of block groups")
+
+    self._number_of_blocks = number_of_blocks
+    self._number_of_inodes = self._inodes_per_group * self._number_of_groups
+
+    if self._number_of_inodes >= 2 ** 32:
+      raise ValueError("Unsupported number of inodes")
+
+    self._number_of_group_descriptor_blocks = (
+        self._number_of_groups + self._group_descriptors_per_block - 1) // (
+            self._group_descriptors_per_block)
+
+  def _EstimateNumberOfDataBlocks(self):
+    """Estimates the number of data blocks needed by the contents.
+
+    Returns:
+      int: estimated number of data blocks.
+    """
+    block_size = self._block_size
+
+    number_of_blocks = 64 + self._journal_blocks
+
+    # Directory entries of "file%08d" names use 20 bytes.
+    number_of_blocks += 2 + ((self._directory_entries * 20) // block_size)
+
+    file_blocks = (self._file_size + block_size - 1) // block_size
+    number_of_blocks += self._tree_directories * (
+        2 + ((self._tree_files * 16) // block_size) + (
+            self._tree_files * file_blocks))
+
+    number_of_blocks += (2 * self._fragmented_extents) + 2 + (
+        self._fragmented_extents // ((block_size - 12) // 12))
+
+    pointers_per_block = block_size // 4
+    number_of_blocks += self._indirect_file_blocks + 3 + (
+        self._indirect_file_blocks // (pointers_per_block - 1))
+
+    return number_of_blocks
+
+  def _GetGroupStartBlockNumber(self, group_number):
+    """Retrieves the first block number of a block group.
+
+    Args:
+      group_number (int): block group number.
+
+    Returns:
+      int: first block number of the block group.
+    """
+    return self._first_data_block + (group_number * self._blocks_per_group)
+
+  def _GetGroupNumberOfBlocks(self, group_number):
+    """Retrieves the number of blocks in a block group.
+
+    Args:
+      group_number (int): block group number.
+
+    Returns:
+      int: number of blocks in the block group.
+    """
+    return min(
+        self._blocks_per_group,
+        self._number_of_blocks - self._GetGroupStartBlockNumber(group_number))
+
+  def _HasSuperblock(self, group_number):
+    """Determines if a block group contains a (backup) superblock.
+
+    Args:
+      group_number (int): block group number.
+
+    Returns:
+      bool: True if the block group contains a superblock (sparse_super).
+    """
+    if group_number in (0, 1):
+      return True
+
+    return (IsPowerOf(group_number, 3) or IsPowerOf(group_number, 5) or
+            IsPowerOf(group_number, 7))
+
+  def _HasMetaGroupDescriptors(self, group_number):
+    """Determines if a block group contains meta_bg group descriptors.
+
+    Args:
+      group_number (int): block group number.
+
+    Returns:
+      bool: True if the block group contains the group descriptors of its
+          meta block group.
+    """
+    group_index = group_number % self._group_descriptors_per_block
+    return group_index in (0, 1, self._group_descriptors_per_block - 1)
+
+  def _GetNumberOfBaseMetadataBlocks(self, group_number):
+    """Retrieves the number of superblock and group descriptor blocks.
+
+    Args:
+      group_number (int): block group number.
+
+    Returns:
+      int: number of superblock and group descriptor blocks at the start of
+          the block group.
+    """
+    number_of_blocks = 0
+    if self._HasSuperblock(group_number):
+      number_of_blocks += 1
+
+    if self._use_meta_bg:
+      if self._HasMetaGroupDescriptors(group_number):
+        number_of_blocks += 1
+
+    elif number_of_blocks:
+      number_of_blocks += self._number_of_group_descriptor_blocks
+
+    return number_of_blocks
+
+  def _LayoutBlockGroups(self):
+    """Determines the location of the block group bitmaps and inode tables.
+
+    Returns:
+      list[tuple[int, int]]: sorted first block number and number of blocks
+          of the metadata block ranges.
+
+    Raises:
+      RuntimeError: if the metadata does not fit in the volume.
+    """
+    metadata_ranges = []
+    for group_number in range(self._number_of_groups):
+      number_of_blocks = self._GetNumberOfBaseMetadataBlocks(group_number)
+      if number_of_blocks:
+        metadata_ranges.append((
+            self._GetGroupStartBlockNumber(group_number), number_of_blocks))
+
+    self._block_bitmap_block_numbers = []
+    self._inode_bitmap_block_numbers = []
+    self._inode_table_block_numbers = []
+
+    if not self._use_flex_bg:
+      for group_number in range(self._number_of_groups):
+        block_number = self._GetGroupStartBlockNumber(group_number) + (
+            self._GetNumberOfBaseMetadataBlocks(group_number))
+
+        self._block_bitmap_block_numbers.append(block_number)
+        self._inode_bitmap_block_numbers.append(block_number + 1)
+        self._inode_table_block_numbers.append(block_number + 2)
+
+        metadata_ranges.append((block_number, 2 + self._inode_table_blocks))
+
+    else:
+      groups_per_flex = 1 << self._log_groups_per_flex
+
+      for first_group_number in range(
+          0, self._number_of_groups, groups_per_flex):
+        group_numbers = range(first_group_number, min(
+            first_group_number + groups_per_flex, self._number_of_groups))
+
+        block_number = self._GetGroupStartBlockNumber(first_group_number) + (
+            self._GetNumberOfBaseMetadataBlocks(first_group_number))
+
+        for block_numbers, number_of_blocks in (
+            (self._block_bitmap_block_numbers, 1),
+            (self._inode_bitmap_block_numbers, 1),
+            (self._inode_table_block_numbers, self._inode_table_blocks)):
+          for _ in group_numbers:
+            block_number = self._GetFlexMetadataBlockNumber(
+                block_number, number_of_blocks)
+            block_numbers.append(block_number)
+            AppendBlockRange(metadata_ranges, block_number, number_of_blocks)
+            block_number += number_of_blocks
+
+    metadata_ranges.sort()
+
+    last_range_end = 0
+    for range_start, range_size in metadata_ranges:
+      if range_start < last_range_end:
+        raise RuntimeError(
+            "Block group metadata overlaps, reduce the number of inodes or "
+            "groups per flex group")
+      last_range_end = range_start + range_size
+
+    if last_range_end > self._number_of_blocks:
+      raise RuntimeError("Block group metadata exceeds volume size")
+
+    return metadata_ranges
+
+  def _GetFlexMetadataBlockNumber(self, block_number, number_of_blocks):
+    """Retrieves the block number of contiguous flex_bg metadata.
+
+    Args:
+      block_number (int): first candidate block number.
+      number_of_blocks (int): number of contiguous blocks needed.
+
+    Returns:
+      int: first block number of the metadata, which does not overlap with
+          the superblock and group descriptors of a block group.
+    """
+    while True:
+      group_number = (
+          block_number - self._first_data_block) // self._blocks_per_group
+      next_group_start = self._GetGroupStartBlockNumber(group_number + 1)
+      if block_number + number_of_blocks <= next_group_start:
+        break
+
+      number_of_base_blocks = 0
+      if group_number + 1 < self._number_of_groups:
+        number_of_base_blocks = self._GetNumberOfBaseMetadataBlocks(
+            group_number + 1)
+      if not number_of_base_blocks:
+        break
+
+      block_number = next_group_start + number_of_base_blocks
+
+    return block_number
+
+  def _AllocateBlocks(self, number_of_blocks, block_ranges):
+    """Allocates blocks and appends them to the block ranges of a file.
+
+    Args:
+      number_of_blocks (int): number of blocks to allocate.
+      block_ranges (list[tuple[int, int]]): block ranges of the file.
+    """
+    for range_start, range_size in self._allocator.Allocate(number_of_blocks):
+      AppendBlockRange(block_ranges, range_start, range_size)
+
+  def _WriteAt(self, offset, data):
+    """Writes data at a specific offset in the image.
+
+    Args:
+      offset (int): offset.
+      data (bytes): data.
+    """
+    self._file_object.seek(offset, 0)
+    self._file_object.write(data)
+
+  def _WriteBlock(self, block_number, data):
+    """Writes a block.
+
+    Args:
+      block_number (int): block number.
+      data (bytes): block data.
+    """
+    self._WriteAt(block_number * self._block_size, data)
+
+  def _WriteFileData(self, inode_number, file_size, block_ranges):
+    """Writes file data with a recognizable pattern.
+
+    Every 16 bytes of the data contain the inode number and the logical block
+    number as two 64-bit little-endian integers.
+
+    Args:
+      inode_number (int): inode number.
+      file_size (int): size of the file data.
+      block_ranges (list[tuple[int, int]]): block ranges of the file.
+    """
+    logical_block_number = 0
+    for range_start, range_size in block_ranges:
+      for block_index in range(range_size):
+        data_size = min(
+            self._block_size,
+            file_size - (logical_block_number * self._block_size))
+        if data_size <= 0:
+          return
+
+        data = struct.pack(
+            "<QQ", inode_number, logical_block_number) * (
+                self._block_size // 16)
+        self._WriteBlock(range_start + block_index, data[:data_size])
+        logical_block_number += 1
+
+  def _BuildBlockMap(self, block_ranges):
+    """Builds a block map and writes its indirect blocks.
+
+    Args:
+      block_ranges (list[tuple[int, int]]): block ranges of the file.
+
+    Returns:
+      tuple[bytes, int]: data of the inode block map and number of indirect
+          blocks.
+
+    Raises:
+      RuntimeError: if a block number cannot be stored in a block map.
+    """
+    block_numbers = array.array("L")
+    for range_start, range_size in block_ranges:
+      if range_start + range_size > 2 ** 32:
+        raise RuntimeError("Block number out of bounds for block map")
+      block_numbers.extend(range(range_start, range_start + range_size))
+
+    pointers_per_block = self._block_size // 4
+
+    pointers = list(block_numbers[:12])
+    pointers.extend([0] * (12 - len(pointers)))
+
+    number_of_metadata_blocks = 0
+    block_index = 12
+    for depth in (1, 2, 3):
+      block_number = 0
+      if block_index < len(block_numbers):
+        block_number, number_of_indirect_blocks = self._BuildIndirectBlock(
+            block_numbers, block_index, depth)
+        number_of_metadata_blocks += number_of_indirect_blocks
+
+      pointers.append(block_number)
+      block_index += pointers_per_block ** depth
+
+    if block_index < len(block_numbers):
+      raise RuntimeError("File too large for block map")
+
+    return struct.pack("<15I", *pointers), number_of_metadata_blocks
+
+  def _BuildIndirectBlock(self, block_numbers, block_index, depth):
+    """Builds and writes an indirect block.
+
+    Args:
+      block_numbers (array.array): block numbers of the file.
+      block_index (int): index of the first block number referenced by the
+          indirect block.
+      depth (int): depth of the indirect block, where 1 represents a block
+          that references data blocks.
+
+    Returns:
+      tuple[int, int]: block number of the indirect block and number of
+          indirect blocks, including the indirect blocks it references.
+    """
+    pointers_per_block = self._block_size // 4
+
+    block_number = self._allocator.Allocate(1)[0][0]
+    number_of_metadata_blocks = 1
+
+    if depth == 1:
+      pointers = list(
+          block_numbers[block_index:block_index + pointers_per_block])
+    else:
+      pointers = []
+      number_of_blocks_per_pointer = pointers_per_block ** (depth - 1)
+      for pointer_index in range(pointers_per_block):
+        pointer_block_index = block_index + (
+            pointer_index * number_of_blocks_per_pointer)
+        if pointer_block_index >= len(block_numbers):
+          break
+
+        pointer, number_of_indirect_blocks = self._BuildIndirectBlock(
+            block_numbers, pointer_block_index, depth - 1)
+        pointers.append(pointer)
+        number_of_metadata_blocks += number_of_indirect_blocks
+
+    data = struct.pack(f"<{len(pointers):d}I", *pointers)
+    self._WriteBlock(block_number, data)
+
+    return block_number, number_of_metadata_blocks
+
+  def _BuildExtentsTree(self, block_ranges):
+    """Builds an extents tree and writes its extent blocks.
+
+    Args:
+      block_ranges (list[tuple[int, int]]): block ranges of the file.
+
+    Returns:
+      tuple[bytes, int]: data of the inode extents tree root and number of
+          extent blocks.
+    """
+    entries = []
+    logical_block_number = 0
+    for range_start, range_size in block_ranges:
+      while range_size > 0:
+        extent_size = min(range_size, EXTENT_MAXIMUM_NUMBER_OF_BLOCKS)
+        entries.append((logical_block_number, struct.pack(
+            "<IHHI", logical_block_number, extent_size, range_start >> 32,
+            range_start & 0xffffffff)))
+
+        logical_block_number += extent_size
+        range_start += extent_size
+        range_size -= extent_size
+
+    maximum_number_of_entries = (self._block_size - 12) // 12
+    number_of_metadata_blocks = 0
+    depth = 0
+
+    while len(entries) > 4:
+      parent_entries = []
+      for entry_index in range(
+          0, len(entries), maximum_number_of_entries):
+        node_entries = entries[
+            entry_index:entry_index + maximum_number_of_entries]
+
+        block_number = self._allocator.Allocate(1)[0][0]
+        number_of_metadata_blocks += 1
+
+        data = b"".join([struct.pack(
+            "<HHHHI", EXTENT_HEADER_SIGNATURE, len(node_entries),
+            maximum_number_of_entries, depth, 0)] + [
+                entry_data for _, entry_data in node_entries])
+        self._WriteBlock(block_number, data)
+
+        first_logical_block_number = node_entries[0][0]
+        parent_entries.append((first_logical_block_number, struct.pack(
+            "<IIHH", first_logical_block_number, block_number & 0xffffffff,
+            block_number >> 32, 0)))
+
+      entries = parent_entries
+      depth += 1
+
+    data = b"".join([struct.pack(
+        "<HHHHI", EXTENT_HEADER_SIGNATURE, len(entries), 4, depth, 0)] + [
+            entry_data for _, entry_data in entries])
+
+    return data + bytes(60 - len(data)), number_of_metadata_blocks
+
+  def _BuildInode(
+      self, file_mode, file_size, number_of_links, block_ranges,
+      use_extents=None, flags=0):
+    """Builds an inode, including its extents tree or block map.
+
+    Args:
+      file_mode (int): file mode.
+      file_size (int): file size.
+      number_of_links (int): number of links.
+      block_ranges (list[tuple[int, int]]): block ranges of the file.
+      use_extents (Optional[bool]): True if the data is stored in extents,
+          False if in a block map or None to use the format default.
+      flags (Optional[int]): inode flags.
+
+    Returns:
+      bytes: inode data.
+    """
+    if use_extents is None:
+      use_extents = self._use_extents
+
+    if use_extents:
+      block_data, number_of_metadata_blocks = self._BuildExtentsTree(
+          block_ranges)
+      flags |= INODE_FLAG_EXTENTS
+    else:
+      block_data, number_of_metadata_blocks = self._BuildBlockMap(
+          block_ranges)
+
+    number_of_blocks = number_of_metadata_blocks + sum(
+        range_size for _, range_size in block_ranges)
+    number_of_sectors = number_of_blocks * (self._block_size // 512)
+
+    if number_of_sectors >= 2 ** 32 and self._format != "ext4":
+      raise RuntimeError("File too large for format")
+
+    data = bytearray(self._inode_size)
+    struct.pack_into(
+        "<HHIIIIIHHII", data, 0, file_mode, 0, file_size & 0xffffffff,
+        self._timestamp, self._timestamp, self._timestamp, 0, 0,
+        number_of_links, number_of_sectors & 0xffffffff, flags)
+    data[40:100] = block_data
+    struct.pack_into("<I", data, 108, file_size >> 32)
+    struct.pack_into("<H", data, 116, number_of_sectors >> 32)
+
+    if self._inode_size > 128:
+      struct.pack_into("<H", data, 128, 32)
+      struct.pack_into("<I", data, 144, self._timestamp)
+
+    return bytes(data)
+
+  def _WriteInode(self, inode_number, data):
+    """Writes an inode.
+
+    Inodes must be written in increasing order, the inode table of a block
+    group is written when the first inode of the next block group is written.
+
+    Args:
+      inode_number (int): inode number.
+      data (bytes): inode data.
+    """
+    group_number, inode_index = divmod(
+        inode_number - 1, self._inodes_per_group)
+
+    if group_number != self._current_inode_table_group:
+      self._FlushInodeTable()
+      self._current_inode_table = bytearray()
+      self._current_inode_table_group = group_number
+
+    self._current_inode_table.extend(
+        bytes((inode_index * self._inode_size) - len(
+            self._current_inode_table)))
+    self._current_inode_table.extend(data)
+
+  def _FlushInodeTable(self):
+    """Writes the buffered inode table of the current block group."""
+    if self._current_inode_table:
+      self._WriteBlock(
+          self._inode_table_block_numbers[self._current_inode_table_group],
+          self._current_inode_table)
+
+    self._current_inode_table = None
+    self._current_inode_table_group = None
+
+  def _IterateDirectoryEntriesData(self, entries):
+    """Iterates the data of directory entries.
+
+    Args:
+      entries (iterable[tuple[int, bytes, int]]): inode number, name and file
+          type of the directory entries.
+
+    Yields:
+      bytes: directory entry data, without the entry size.
+    """
+    for inode_number, name, file_type in entries:
+      entry_size = 8 + ((len(name) + 3) & ~3)
+      yield entry_size, struct.pack(
+          "<IHBB", inode_number, entry_size, len(name), file_type) + name
+
+  def _BuildDirectoryBlocks(self, entries_data):
+    """Builds linear directory blocks.
+
+    Args:
+      entries_data (iterable[tuple[int, bytes]]): directory entry size and
+          data.
+
+    Yields:
+      bytes: directory block data.
+    """
+    block_data = bytearray(self._block_size)
+    block_offset = 0
+    last_entry_offset = None
+
+    for entry_size, entry_data in entries_data:
+      if block_offset + entry_size > self._block_size:
+        struct.pack_into(
+            "<H", block_data, last_entry_offset + 4,
+            self._block_size - last_entry_offset)
+        yield bytes(block_data)
+
+        block_data = bytearray(self._block_size)
+        block_offset = 0
+
+      block_data[block_offset:block_offset + len(entry_data)] = entry_data
+      last_entry_offset = block_offset
+      block_offset += entry_size
+
+    if last_entry_offset is not None:
+      struct.pack_into(
+          "<H", block_data, last_entry_offset + 4,
+          self._block_size - last_entry_offset)
+      yield bytes(block_data)
+
+  def _WriteDirectory(self, inode_number, parent_inode_number, entries):
+    """Writes the blocks and inode of a directory.
+
+    Args:
+      inode_number (int): inode number of the directory.
+      parent_inode_number (int): inode number of the parent directory.
+      entries (list[tuple[int, bytes, int]]): inode number, name and file type
+          of the directory entries, excluding "." and "..".
+    """
+    number_of_subdirectories = sum(
+        1 for _, _, file_type in entries if file_type == FILE_TYPE_DIRECTORY)
+
+    self_entries = [
+        (inode_number, b".", FILE_TYPE_DIRECTORY),
+        (parent_inode_number, b"..", FILE_TYPE_DIRECTORY)]
+
+    if not self._use_dir_index or len(entries) * 20 < self._block_size:
+      blocks = self._BuildDirectoryBlocks(self._IterateDirectoryEntriesData(
+          self_entries + entries))
+      number_of_blocks, block_ranges = self._WriteDirectoryBlocks(blocks)
+      flags = 0
+    else:
+      number_of_blocks, block_ranges = self._WriteIndexedDirectoryBlocks(
+          inode_number, parent_inode_number, entries)
+      flags = INODE_FLAG_INDEX
+
+    data = self._BuildInode(
+        FILE_MODE_DIRECTORY, number_of_blocks * self._block_size,
+        2 + number_of_subdirectories, block_ranges, flags=flags)
+    self._WriteInode(inode_number, data)
+
+    group_number = (inode_number - 1) // self._inodes_per_group
+    self._directories_per_group[group_number] = (
+        self._directories_per_group.get(group_number, 0) + 1)
+
+  def _WriteDirectoryBlocks(self, blocks):
+    """Allocates and writes directory blocks.
+
+    Args:
+      blocks (iterable[bytes]): directory block data.
+
+    Returns:
+      tuple[int, list[tuple[int, int]]]: number of blocks and block ranges of
+          the directory.
+    """
+    block_ranges = []
+    number_of_blocks = 0
+    for block_data in blocks:
+      block_number = self._allocator.Allocate(1)[0][0]
+      AppendBlockRange(block_ranges, block_number, 1)
+      self._WriteBlock(block_number, block_data)
+      number_of_blocks += 1
+
+    return number_of_blocks, block_ranges
+
+  def _WriteIndexedDirectoryBlocks(
+      self, inode_number, parent_inode_number, entries):
+    """Allocates and writes the blocks of a hashed tree (htree) directory.
+
+    The directory consists of a root block, for more than one level of leaf
+    blocks a level of node blocks, followed by the leaf blocks.
+
+    Args:
+      inode_number (int): inode number of the directory.
+      parent_inode_number (int): inode number of the parent directory.
+      entries (list[tuple[int, bytes, int]]): inode number, name and file type
+          of the directory entries, excluding "." and "..".
+
+    Returns:
+      tuple[int, list[tuple[int, int]]]: number of blocks and block ranges of
+          the directory.
+
+    Raises:
+      RuntimeError: if the number of directory entries is not supported.
+    """
+    hash_values = array.array("L", [
+        CalculateHalfMD4NameHash(name) for _, name, _ in entries])
+    entry_indexes = sorted(
+        range(len(entries)), key=hash_values.__getitem__)
+
+    # Determine the first entry and hash of every leaf block, a leaf that
+    # continues a hash of its predecessor has its collision bit set.
+    leaves = []
+    block_offset = self._block_size
+    previous_hash_value = None
+    for sort_index, entry_index in enumerate(entry_indexes):
+      entry_size = 8 + ((len(entries[entry_index][1]) + 3) & ~3)
+      hash_value = hash_values[entry_index]
+
+      if block_offset + entry_size > self._block_size:
+        leaf_hash_value = hash_value
+        if hash_value == previous_hash_value:
+          leaf_hash_value |= 1
+        leaves.append((sort_index, leaf_hash_value))
+        block_offset = 0
+
+      block_offset += entry_size
+      previous_hash_value = hash_value
+
+    maximum_number_of_root_entries = (self._block_size - 32) // 8
+    maximum_number_of_node_entries = (self._block_size - 8) // 8
+
+    if len(leaves) <= maximum_number_of_root_entries:
+      indirect_levels = 0
+      nodes = []
+      root_entries = [(index, leaves[index][1]) for index in range(
+          len(leaves))]
+    else:
+      indirect_levels = 1
+      nodes = [leaves[index:index + maximum_number_of_node_entries]
+               for index in range(
+                   0, len(leaves), maximum_number_of_node_entries)]
+      if len(nodes) > maximum_number_of_root_entries:
+        raise RuntimeError("Too many directory entries for htree")
+
+      root_entries = [(index, nodes[index][0][1]) for index in range(
+          len(nodes))]
+
+    number_of_blocks = 1 + len(nodes) + len(leaves)
+    block_ranges = []
+    self._AllocateBlocks(number_of_blocks, block_ranges)
+
+    block_numbers = []
+    for range_start, range_size in block_ranges:
+      block_numbers.extend(range(range_start, range_start + range_size))
+
+    first_leaf_block = 1 + len(nodes)
+
+    # Root block with "." and "..", the root information and index entries.
+    data = bytearray(self._block_size)
+    struct.pack_into(
+        "<IHBB4sIHBB4s", data, 0, inode_number, 12, 1, FILE_TYPE_DIRECTORY,
+        b".", parent_inode_number, self._block_size - 12, 2,
+        FILE_TYPE_DIRECTORY, b"..")
+    struct.pack_into("<IBBBB", data, 24, 0, 1, 8, indirect_levels, 0)
+
+    root_target_offset = 1 if nodes else first_leaf_block
+    self._PackIndexEntries(
+        data, 32, maximum_number_of_root_entries, [
+            (hash_value, root_target_offset + index)
+            for index, hash_value in root_entries])
+    self._WriteBlock(block_numbers[0], data)
+
+    leaf_index = 0
+    for node_index, node_leaves in enumerate(nodes):
+      data = bytearray(self._block_size)
+      struct.pack_into("<IH", data, 0, 0, self._block_size)
+      self._PackIndexEntries(
+          data, 8, maximum_number_of_node_entries, [
+              (hash_value, first_leaf_block + leaf_index + index)
+              for index, (_, hash_value) in enumerate(node_leaves)])
+      self._WriteBlock(block_numbers[1 + node_index], data)
+      leaf_index += len(node_leaves)
+
+    for leaf_index, (first_sort_index, _) in enumerate(leaves):
+      if leaf_index + 1 < len(leaves):
+        last_sort_index = leaves[leaf_index + 1][0]
+      else:
+        last_sort_index = len(entry_indexes)
+
+      leaf_entries = [
+          entries[entry_index]
+          for entry_index in entry_indexes[first_sort_index:last_sort_index]]
+      for data in self._BuildDirectoryBlocks(
+          self._IterateDirectoryEntriesData(leaf_entries)):
+        self._WriteBlock(block_numbers[first_leaf_block + leaf_index], data)
+
+    return number_of_blocks, block_ranges
+
+  def _PackIndexEntries(self, data, offset, maximum_number_of_entries, entries):
+    """Packs htree index entries.
+
+    The hash of the first entry is implied and its storage contains the
+    maximum and current number of entries.
+
+    Args:
+      data (bytearray): block data.
+      offset (int): offset of the index entries in the block data.
+      maximum_number_of_entries (int): maximum number of index entries.
+      entries (list[tuple[int, int]]): hash value and logical block number of
+          the index entries.
+    """
+    struct.pack_into(
+        "<HHI", data, offset, maximum_number_of_entries, len(entries),
+        entries[0][1])
+    for entry_index, (hash_value, logical_block_number) in enumerate(
+        entries[1:]):
+      struct.pack_into(
+          "<II", data, offset + 8 + (entry_index * 8), hash_value,
+          logical_block_number)
+
+  def _WriteFile(
+      self, inode_number, file_size, block_ranges, use_extents=None):
+    """Writes the data and inode of a regular file.
+
+    Args:
+      inode_number (int): inode number of the file.
+      file_size (int): size of the file.
+      block_ranges (list[tuple[int, int]]): block ranges of the file.
+      use_extents (Optional[bool]): True if the data is stored in extents,
+          False if in a block map or None to use the format default.
+    """
+    if self._write_data:
+      self._WriteFileData(inode_number, file_size, block_ranges)
+
+    data = self._BuildInode(
+        FILE_MODE_REGULAR_FILE, file_size, 1, block_ranges,
+        use_extents=use_extents)
+    self._WriteInode(inode_number, data)
+
+  def _WriteInodes(self):
+    """Writes the inodes and the file and directory data."""
+    root_entries = [
+        (LOST_AND_FOUND_INODE_NUMBER, b"lost+found", FILE_TYPE_DIRECTORY)]
+
+    if self._large_directory_inode_number:
+      root_entries.append((
+          self._large_directory_inode_number, b"large_directory",
+          FILE_TYPE_DIRECTORY))
+
+    if self._tree_inode_number:
+      root_entries.append((
+          self._tree_inode_number, b"tree", FILE_TYPE_DIRECTORY))
+
+    if self._fragmented_file_inode_number:
+      root_entries.append((
+          self._fragmented_file_inode_number, b"fragmented_file",
+          FILE_TYPE_REGULAR_FILE))
+
+    if self._indirect_file_inode_number:
+      root_entries.append((
+          self._indirect_file_inode_number, b"indirect_file",
+          FILE_TYPE_REGULAR_FILE))
+
+    empty_inode_data = bytes(self._inode_size)
+
+    self._WriteInode(1, empty_inode_data)
+    self._WriteDirectory(
+        ROOT_DIRECTORY_INODE_NUMBER, ROOT_DIRECTORY_INODE_NUMBER, root_entries)
+
+    for inode_number in range(
+        ROOT_DIRECTORY_INODE_NUMBER + 1, LOST_AND_FOUND_INODE_NUMBER):
+      if inode_number == JOURNAL_INODE_NUMBER and self._journal_blocks:
+        self._WriteJournal()
+      else:
+        self._WriteInode(inode_number, empty_inode_data)
+
+    self._WriteDirectory(
+        LOST_AND_FOUND_INODE_NUMBER, ROOT_DIRECTORY_INODE_NUMBER, [])
+
+    if self._large_directory_inode_number:
+      first_inode_number = self._large_directory_inode_number + 1
+      self._WriteDirectory(
+          self._large_directory_inode_number, ROOT_DIRECTORY_INODE_NUMBER, [
+              (first_inode_number + index, f"file{index:08d}".encode("ascii"),
+               FILE_TYPE_REGULAR_FILE)
+              for index in range(self._directory_entries)])
+
+      for index in range(self._directory_entries):
+        self._WriteFile(first_inode_number + index, 0, [])
+
+    if self._tree_inode_number:
+      self._WriteTree()
+
+    if self._fragmented_file_inode_number:
+      block_ranges = []
+      for _ in range(self._fragmented_extents):
+        self._AllocateBlocks(1, block_ranges)
+        self._allocator.Skip(1)
+
+      self._WriteFile(
+          self._fragmented_file_inode_number,
+          self._fragmented_extents * self._block_size, block_ranges)
+
+    if self._indirect_file_inode_number:
+      block_ranges = []
+      self._AllocateBlocks(self._indirect_file_blocks, block_ranges)
+
+      self._WriteFile(
+          self._indirect_file_inode_number,
+          self._indirect_file_blocks * self._block_size, block_ranges,
+          use_extents=False)
+
+    self._FlushInodeTable()
+
+  def _WriteTree(self):
+    """Writes the directory hierarchy of the tree directory."""
+    files_per_directory = 1 + self._tree_files
+
+    self._WriteDirectory(
+        self._tree_inode_number, ROOT_DIRECTORY_INODE_NUMBER, [
+            (self._tree_inode_number + 1 + (index * files_per_directory),
+             f"directory{index:06d}".encode("ascii"), FILE_TYPE_DIRECTORY)
+            for index in range(self._tree_directories)])
+
+    number_of_file_blocks = (
+        self._file_size + self._block_size - 1) // self._block_size
+
+    for directory_index in range(self._tree_directories):
+      directory_inode_number = self._tree_inode_number + 1 + (
+          directory_index * files_per_directory)
+
+      self._WriteDirectory(
+          directory_inode_number, self._tree_inode_number, [
+              (directory_inode_number + 1 + index,
+               f"file{index:06d}".encode("ascii"), FILE_TYPE_REGULAR_FILE)
+              for index in range(self._tree_files)])
+
+      for index in range(self._tree_files):
+        block_ranges = []
+        if number_of_file_blocks:
+          self._AllocateBlocks(number_of_file_blocks, block_ranges)
+
+        self._WriteFile(
+            directory_inode_number + 1 + index, self._file_size, block_ranges)
+
+  def _WriteJournal(self):
+    """Writes the journal inode and journal superblock."""
+    block_ranges = []
+    self._AllocateBlocks(self._journal_blocks, block_ranges)
+
+    data = bytearray(1024)
+    struct.pack_into(
+        ">IIIIIIIII", data, 0, JOURNAL_SIGNATURE,
+        JOURNAL_BLOCK_TYPE_SUPERBLOCK_V2, 0, self._block_size,
+        self._journal_blocks, 1, 1, 0, 0)
+    data[48:64] = VOLUME_IDENTIFIER
+    struct.pack_into(">I", data, 64, 1)
+    self._WriteBlock(block_ranges[0][0], data)
+
+    data = bytearray(self._BuildInode(
+        FILE_MODE_JOURNAL, self._journal_blocks * self._block_size, 1,
+        block_ranges))
+    self._WriteInode(JOURNAL_INODE_NUMBER, data)
+
+    # The superblock contains a backup of the journal inode block map or
+    # extents tree followed by the file size.
+    self._journal_block_map = bytes(data[40:100]) + struct.pack(
+        "<II", 0, self._journal_blocks * self._block_size)
+
+  def _WriteBlockGroups(self, metadata_ranges):
+    """Writes the block and inode bitmaps and the group descriptors.
+
+    Args:
+      metadata_ranges (list[tuple[int, int]]): sorted first block number and
+          number of blocks of the metadata block ranges.
+
+    Returns:
+      tuple[int, int]: number of unallocated blocks and inodes.
+    """
+    used_ranges = sorted(metadata_ranges + self._allocator.allocated_ranges)
+    range_index = 0
+
+    group_descriptors = []
+    total_unallocated_blocks = 0
+    total_unallocated_inodes = 0
+
+    for group_number in range(self._number_of_groups):
+      group_start = self._GetGroupStartBlockNumber(group_number)
+      group_size = self._GetGroupNumberOfBlocks(group_number)
+      group_end = group_start + group_size
+
+      block_bitmap = bytearray(self._block_size)
+      number_of_used_blocks = 0
+
+      while range_index < len(used_ranges):
+        range_start, range_size = used_ranges[range_index]
+        if range_start >= group_end:
+          break
+
+        first_bit = max(range_start, group_start) - group_start
+        last_bit = min(range_start + range_size, group_end) - group_start
+        if last_bit > first_bit:
+          SetBits(block_bitmap, first_bit, last_bit - first_bit)
+          number_of_used_blocks += last_bit - first_bit
+
+        if range_start + range_size > group_end:
+          break
+        range_index += 1
+
+      SetBits(block_bitmap, group_size, (self._block_size * 8) - group_size)
+
+      number_of_used_inodes = min(max(
+          self._last_inode_number - (group_number * self._inodes_per_group),
+          0), self._inodes_per_group)
+
+      inode_bitmap = bytearray(self._block_size)
+      SetBits(inode_bitmap, 0, number_of_used_inodes)
+      SetBits(inode_bitmap, self._inodes_per_group,
+              (self._block_size * 8) - self._inodes_per_group)
+
+      flags = 0
+      unused_inodes = 0
+      if self._use_uninit_bg:
+        flags |= BLOCK_GROUP_INODE_TABLE_ZEROED
+        unused_inodes = self._inodes_per_group - number_of_used_inodes
+
+        if group_number > 0 and number_of_used_inodes == 0:
+          flags |= BLOCK_GROUP_INODE_UNINIT
+
+        number_of_own_metadata_blocks = self._GetNumberOfBaseMetadataBlocks(
+            group_number)
+        for block_number, number_of_blocks in (
+            (self._block_bitmap_block_numbers[group_number], 1),
+            (self._inode_bitmap_block_numbers[group_number], 1),
+            (self._inode_table_block_numbers[group_number],
+             self._inode_table_blocks)):
+          if group_start <= block_number < group_end:
+            number_of_own_metadata_blocks += number_of_blocks
+
+        if (0 < group_number < self._number_of_groups - 1 and
+            number_of_used_blocks == number_of_own_metadata_blocks):
+          flags |= BLOCK_GROUP_BLOCK_UNINIT
+
+      if not flags & BLOCK_GROUP_BLOCK_UNINIT:
+        self._WriteBlock(
+            self._block_bitmap_block_numbers[group_number], block_bitmap)
+
+      if not flags & BLOCK_GROUP_INODE_UNINIT:
+        self._WriteBlock(
+            self._inode_bitmap_block_numbers[group_number], inode_bitmap)
+
+      unallocated_blocks = group_size - number_of_used_blocks
+      unallocated_inodes = self._inodes_per_group - number_of_used_inodes
+      directories = self._directories_per_group.get(group_number, 0)
+
+      group_descriptors.append(self._BuildGroupDescriptor(
+          group_number, unallocated_blocks, unallocated_inodes, directories,
+          flags, unused_inodes))
+
+      total_unallocated_blocks += unallocated_blocks
+      total_unallocated_inodes += unallocated_inodes
+
+    self._WriteGroupDescriptors(group_descriptors)
+
+    return total_unallocated_blocks, total_unallocated_inodes
+
+  def _BuildGroupDescriptor(
+      self, group_number, unallocated_blocks, unallocated_inodes, directories,
+      flags, unused_inodes):
+    """Builds a group descriptor.
+
+    Args:
+      group_number (int): block group number.
+      unallocated_blocks (int): number of unallocated blocks.
+      unallocated_inodes (int): number of unallocated inodes.
+      directories (int): number of directories.
+      flags (int): block group flags.
+      unused_inodes (int): number of unused inodes at the end of the inode
+          table.
+
+    Returns:
+      bytes: group descriptor data.
+    """
+    block_bitmap = self._block_bitmap_block_numbers[group_number]
+    inode_bitmap = self._inode_bitmap_block_numbers[group_number]
+    inode_table = self._inode_table_block_numbers[group_number]
+
+    data = bytearray(self._group_descriptor_size)
+    struct.pack_into(
+        "<IIIHHHHIHHH", data, 0, block_bitmap & 0xffffffff,
+        inode_bitmap & 0xffffffff, inode_table & 0xffffffff,
+        unallocated_blocks & 0xffff, unallocated_inodes & 0xffff,
+        directories & 0xffff, flags, 0, 0, 0, unused_inodes & 0xffff)
+
+    if self._group_descriptor_size == 64:
+      struct.pack_into(
+          "<IIIHHHH", data, 32, block_bitmap >> 32, inode_bitmap >> 32,
+          inode_table >> 32, unallocated_blocks >> 16,
+          unallocated_inodes >> 16, directories >> 16, unused_inodes >> 16)
+
+    if self._use_uninit_bg:
+      checksum = CalculateCRC16(VOLUME_IDENTIFIER, 0xffff)
+      checksum = CalculateCRC16(struct.pack("<I", group_number), checksum)
+      checksum = CalculateCRC16(data[:30], checksum)
+      checksum = CalculateCRC16(data[32:], checksum)
+      struct.pack_into("<H", data, 30, checksum)
+
+    return bytes(data)
+
+  def _WriteGroupDescriptors(self, group_descriptors):
+    """Writes the primary and backup group descriptor tables.
+
+    Args:
+      group_descriptors (list[bytes]): group descriptors data.
+    """
+    for group_number in range(self._number_of_groups):
+      block_number = self._GetGroupStartBlockNumber(group_number)
+      if self._HasSuperblock(group_number):
+        block_number += 1
+
+      if not self._use_meta_bg:
+        if self._HasSuperblock(group_number):
+          self._WriteBlock(block_number, b"".join(group_descriptors))
+
+      elif self._HasMetaGroupDescriptors(group_number):
+        first_group_number = group_number - (
+            group_number % self._group_descriptors_per_block)
+        self._WriteBlock(block_number, b"".join(group_descriptors[
+            first_group_number:first_group_number + (
+                self._group_descriptors_per_block)]))
+
+  def _WriteSuperblocks(self, unallocated_blocks, unallocated_inodes):
+    """Writes the primary and backup superblocks.
+
+    Args:
+      unallocated_blocks (int): number of unallocated blocks.
+      unallocated_inodes (int): number of unallocated inodes.
+    """
+    compatible_features = 0
+    incompatible_features = INCOMPAT_FILETYPE
+    read_only_compatible_features = (
+        RO_COMPAT_SPARSE_SUPER | RO_COMPAT_LARGE_FILE)
+
+    if self._journal_blocks:
+      compatible_features |= COMPAT_HAS_JOURNAL
+    if self._use_dir_index:
+      compatible_features |= COMPAT_DIR_INDEX
+    if self._use_meta_bg:
+      incompatible_features |= INCOMPAT_META_BG
+    if self._use_extents:
+      incompatible_features |= INCOMPAT_EXTENTS
+      read_only_compatible_features |= (
+          RO_COMPAT_HUGE_FILE | RO_COMPAT_DIR_NLINK | RO_COMPAT_EXTRA_ISIZE)
+    if self._use_64bit:
+      incompatible_features |= INCOMPAT_64BIT
+    if self._use_flex_bg:
+      incompatible_features |= INCOMPAT_FLEX_BG
+    if self._use_uninit_bg:
+      read_only_compatible_features |= RO_COMPAT_GDT_CSUM
+
+    log_block_size = self._block_size.bit_length() - 11
+
+    data = bytearray(1024)
+    struct.pack_into(
+        "<IIIIIIIIIIIIIHhHHHHIIIIHH", data, 0, self._number_of_inodes,
+        self._number_of_blocks & 0xffffffff, 0,
+        unallocated_blocks & 0xffffffff, unallocated_inodes,
+        self._first_data_block, log_block_size, log_block_size,
+        self._blocks_per_group, self._blocks_per_group,
+        self._inodes_per_group, 0, self._timestamp, 0, -1, 0xef53, 1, 1, 0,
+        self._timestamp, 0, 0, 1, 0, 0)
+    struct.pack_into(
+        "<IHHIII", data, 84, LOST_AND_FOUND_INODE_NUMBER, self._inode_size, 0,
+        compatible_features, incompatible_features,
+        read_only_compatible_features)
+    data[104:120] = VOLUME_IDENTIFIER
+    data[120:129] = b"synthetic"
+
+    if self._journal_blocks:
+      struct.pack_into("<I", data, 224, JOURNAL_INODE_NUMBER)
+      struct.pack_into("<B", data, 253, 1)
+      data[268:336] = self._journal_block_map
+
+    struct.pack_into("<B", data, 252, 1)
+
+    if self._use_64bit:
+      struct.pack_into("<H", data, 254, self._group_descriptor_size)
+      struct.pack_into(
+          "<III", data, 336, self._number_of_blocks >> 32, 0,
+          unallocated_blocks >> 32)
+
+    struct.pack_into("<I", data, 264, self._timestamp)
+
+    if self._inode_size > 128:
+      struct.pack_into("<HH", data, 348, 32, 32)
+
+    # Use unsigned characters in the directory index hash.
+    struct.pack_into("<I", data, 352, 0x00000002)
+
+    if self._use_flex_bg:
+      struct.pack_into("<B", data, 372, self._log_groups_per_flex)
+
+    for group_number in range(self._number_of_groups):
+      if not self._HasSuperblock(group_number):
+        continue
+
+      struct.pack_into("<H", data, 90, group_number & 0xffff)
+
+      if group_number == 0:
+        offset = 1024
+      else:
+        offset = self._GetGroupStartBlockNumber(group_number) * (
+            self._block_size)
+
+      self._WriteAt(offset, data)
+
+  def Generate(self, path):
+    """Generates an image.
+
+    Args:
+      path (str): path of the image.
+    """
+    metadata_ranges = self._LayoutBlockGroups()
+
+    first_block_number = self._GetGroupStartBlockNumber(self._data_start_group)
+    self._allocator = BlockAllocator(
+        self._number_of_blocks, metadata_ranges, first_block_number)
+
+    with open(path, "wb") as file_object:
+      self._file_object = file_object
+
+      self._WriteInodes()
+
+      unallocated_blocks, unallocated_inodes = self._WriteBlockGroups(
+          metadata_ranges)
+      self._WriteSuperblocks(unallocated_blocks, unallocated_inodes)
+
+      file_object.truncate(self._number_of_blocks * self._block_size)
+
+      self._file_object = None
+
+    print(f"Format\t\t\t: {self._format:s}")
+    print(f"Block size\t\t: {self._block_size:d}")
+    print(f"Number of blocks\t: {self._number_of_blocks:d}")
+    print(f"Number of block groups\t: {self._number_of_groups:d}")
+    print(f"Number of inodes\t: {self._number_of_inodes:d}")
+    print(f"Used inodes\t\t: {self._last_inode_number:d}")
+    print(f"Used blocks\t\t: {self._number_of_blocks - unallocated_blocks:d}")
+
+
+def SetBits(bitmap, first_bit, number_of_bits):
+  """Sets a range of bits in a bitmap.
+
+  Args:
+    bitmap (bytearray): bitmap.
+    first_bit (int): index of the first bit to set.
+    number_of_bits (int): number of bits to set.
+  """
+  bit_index = first_bit
+  last_bit = first_bit + number_of_bits
+
+  while bit_index < last_bit and bit_index % 8:
+    bitmap[bit_index // 8] |= 1 << (bit_index % 8)
+    bit_index += 1
+
+  number_of_bytes = (last_bit - bit_index) // 8
+  if number_of_bytes > 0:
+    bitmap[bit_index // 8:(bit_index // 8) + number_of_bytes] = (
+        b"\xff" * number_of_bytes)
+    bit_index += number_of_bytes * 8
+
+  while bit_index < last_bit:
+    bitmap[bit_index // 8] |= 1 << (bit_index % 8)
+    bit_index += 1
+
+
+def Main():
+  """Entry point of console script to generate a synthetic image.
+
+  Returns:
+    int: exit code that is provided to sys.exit().
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      "Generates a synthetic sparse Extended File System (ext) volume image."))
+
+  argument_parser.add_argument(
+      "--block_size", "--block-size", dest="block_size", type=int,
+      action="store", default=4096, help="block size, default is 4096.")
+
+  argument_parser.add_argument(
+      "--data_start_group", "--data-start-group", dest="data_start_group",
+      type=int, action="store", default=0, help=(
+          "block group where data allocation starts, can be used to store "
+          "data at 64-bit block numbers, default is 0."))
+
+  argument_parser.add_argument(
+      "--dir_index", "--dir-index", dest="dir_index", action="store_true",
+      default=None, help=(
+          "store large directories as htree, default for ext3 and ext4."))
+
+  argument_parser.add_argument(
+      "--no_dir_index", "--no-dir-index", dest="dir_index",
+      action="store_false", help="store large directories as linear list.")
+
+  argument_parser.add_argument(
+      "--directory_entries", "--directory-entries", dest="directory_entries",
+      type=int, action="store", default=1024, help=(
+          "number of empty files in /large_directory, default is 1024."))
+
+  argument_parser.add_argument(
+      "--file_size", "--file-size", dest="file_size", type=int,
+      action="store", default=4096, help=(
+          "size of the files in /tree, default is 4096."))
+
+  argument_parser.add_argument(
+      "--flex_bg", "--flex-bg", dest="flex_bg", action="store_true",
+      default=False, help="use flexible block groups (ext4 only).")
+
+  argument_parser.add_argument(
+      "--format", dest="format", choices=["ext2", "ext3", "ext4"],
+      action="store", default="ext4", help="format, default is ext4.")
+
+  argument_parser.add_argument(
+      "--fragmented_extents", "--fragmented-extents",
+      dest="fragmented_extents", type=int, action="store", default=2048,
+      help=(
+          "number of single block extents in /fragmented_file, default is "
+          "2048."))
+
+  argument_parser.add_argument(
+      "--indirect_file_blocks", "--indirect-file-blocks",
+      dest="indirect_file_blocks", type=int, action="store", default=-1,
+      help=(
+          "number of blocks in the block-mapped /indirect_file, default is "
+          "sufficient to use double indirect blocks."))
+
+  argument_parser.add_argument(
+      "--inodes", dest="inodes", type=int, action="store", default=None,
+      help="minimum number of inodes.")
+
+  argument_parser.add_argument(
+      "--journal_blocks", "--journal-blocks", dest="journal_blocks", type=int,
+      action="store", default=1024, help=(
+          "number of journal blocks (ext3 and ext4), 0 disables the journal "
+          "(ext4), default is 1024."))
+
+  argument_parser.add_argument(
+      "--log_groups_per_flex", "--log-groups-per-flex",
+      dest="log_groups_per_flex", type=int, action="store", default=4, help=(
+          "logarithm base 2 of the number of block groups per flex group, "
+          "default is 4."))
+
+  argument_parser.add_argument(
+      "--meta_bg", "--meta-bg", dest="meta_bg", action="store_true",
+      default=False, help="use meta block groups.")
+
+  argument_parser.add_argument(
+      "--no_uninit_bg", "--no-uninit-bg", dest="uninit_bg",
+      action="store_false", default=True, help=(
+          "do not use uninitialized block groups (ext4), which requires "
+          "writing all bitmaps."))
+
+  argument_parser.add_argument(
+      "--size", dest="size", type=ParseSize, action="store", default=None,
+      help=(
+          "size of the volume, for example 64G, default is determined by "
+          "the contents."))
+
+  argument_parser.add_argument(
+      "--timestamp", dest="timestamp", type=int, action="store",
+      default=1700000000, help="POSIX timestamp of the files and volume.")
+
+  argument_parser.add_argument(
+      "--tree_directories", "--tree-directories", dest="tree_directories",
+      type=int, action="store", default=16, help=(
+          "number of directories in /tree, default is 16."))
+
+  argument_parser.add_argument(
+      "--tree_files", "--tree-files", dest="tree_files", type=int,
+      action="store", default=64, help=(
+          "number of files per directory in /tree, default is 64."))
+
+  argument_parser.add_argument(
+      "--write_data", "--write-data", dest="write_data", action="store_true",
+      default=False, help=(
+          "write file data, otherwise file data is left sparse."))
+
+  argument_parser.add_argument(
+      "--64bit", dest="use_64bit", action="store_true", default=False,
+      help="use 64-bit block numbers (ext4 only).")
+
+  argument_parser.add_argument(
+      "output", nargs="?", action="store", metavar="PATH", default=None,
+      help="path of the image.")
+
+  options = argument_parser.parse_args()
+
+  if not options.output:
+    print("Output path missing.")
+    print("")
+    argument_parser.print_help()
+    print("")
+    return 1
+
+  try:
+    image_generator = ImageGenerator(options)
+    image_generator.Generate(options.output)
+
+  except (RuntimeError, ValueError) as exception:
+    print(f"Unable to generate image with error: {exception!s}")
+    return 1
+
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(Main())
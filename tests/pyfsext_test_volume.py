@@ -348,6 +348,37 @@ class VolumeTypeTests(unittest.TestCase):
 
       fsext_volume.close()
 
+  def test_get_statistics(self):
+    """Tests the get_statistics and reset_statistics functions."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    fsext_volume = pyfsext.volume()
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fsext_volume = pyfsext.volume()
+      fsext_volume.set_time_checksum_verification(True)
+      fsext_volume.open_file_object(file_object)
+
+      statistics = fsext_volume.get_statistics()
+      self.assertIsNotNone(statistics)
+      self.assertEqual(statistics["superblock_number_of_reads"], 1)
+
+      with self.assertRaises(IOError):
+        fsext_volume.set_time_checksum_verification(False)
+
+      fsext_volume.reset_statistics()
+
+      statistics = fsext_volume.get_statistics()
+      self.assertEqual(statistics["superblock_number_of_reads"], 0)
+
+      fsext_volume.close()
+
   def test_get_root_directory(self):
     """Tests the get_root_directory function and root_directory property."""
     test_source = getattr(unittest, "source", None)
@@ -371,6 +402,92 @@ class VolumeTypeTests(unittest.TestCase):
 
       fsext_volume.close()
 
+  def test_walk(self):
+    """Tests the walk function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fsext_volume = pyfsext.volume()
+      fsext_volume.open_file_object(file_object)
+
+      root_directory = fsext_volume.get_root_directory()
+      self.assertIsNotNone(root_directory)
+
+      names = [record.name for record in root_directory.scandir()]
+      self.assertEqual(
+          len(names), root_directory.get_number_of_sub_file_entries())
+
+      for record in fsext_volume.walk(maximum_depth=1):
+        self.assertIn(record.name, names)
+        self.assertEqual(record.path, "/{0:s}".format(record.name))
+        self.assertEqual(record.depth, 1)
+
+      with self.assertRaises(ValueError):
+        fsext_volume.walk(maximum_depth=0)
+
+      fsext_volume.close()
+
+  def test_readinto(self):
+    """Tests the readinto and read_buffer_at_offset_into functions."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fsext_volume = pyfsext.volume()
+      fsext_volume.open_file_object(file_object)
+
+      root_directory = fsext_volume.get_root_directory()
+      self.assertIsNotNone(root_directory)
+
+      file_entry = None
+      for sub_file_entry in root_directory.sub_file_entries:
+        if sub_file_entry.file_mode & 0xf000 == 0x8000 and sub_file_entry.size:
+          file_entry = sub_file_entry
+          break
+
+      if not file_entry:
+        raise unittest.SkipTest("missing regular file with data")
+
+      read_size = min(file_entry.size, 4096)
+
+      expected_data = file_entry.read_buffer_at_offset(read_size, 0)
+      self.assertEqual(len(expected_data), read_size)
+
+      file_entry.seek_offset(0, os.SEEK_SET)
+
+      data = bytearray(read_size)
+      read_count = file_entry.readinto(data)
+      self.assertEqual(read_count, read_size)
+      self.assertEqual(bytes(data), expected_data)
+      self.assertEqual(file_entry.get_offset(), read_size)
+
+      data = bytearray(read_size)
+      read_count = file_entry.read_buffer_at_offset_into(memoryview(data), 0)
+      self.assertEqual(read_count, read_size)
+      self.assertEqual(bytes(data), expected_data)
+
+      file_entry.seek_offset(0, os.SEEK_END)
+
+      data = bytearray(read_size)
+      read_count = file_entry.readinto(memoryview(data))
+      self.assertEqual(read_count, 0)
+
+      with self.assertRaises(TypeError):
+        file_entry.readinto(expected_data)
+
+      fsext_volume.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "attribute_values bitmap block block_data block_data_handle block_vector buffer_data_handle checksum directory directory_entry error extended_attribute extent extent_index extents_footer extents_header file_entry group_descriptor inode inode_table io_handle notify superblock"
+$LibraryTests = "attribute_values bitmap block block_data block_data_handle block_vector buffer_data_handle checksum data_blocks directory directory_entry error extended_attribute extent extent_index extent_map extents_footer extents_header file_entry group_descriptor inode inode_scanner inode_table io_handle journal metadata_index name notify superblock walker"
 $LibraryTestsWithInput = "support volume"
 $OptionSets = "offset" -split " "
 